@@ -0,0 +1,842 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Lazy element-wise expressions over SimpleArray.
+ *
+ * @ingroup group_core
+ *
+ * Each call of SimpleArray::add(), mul(), and the like makes a full array, so
+ * a chain of n operations streams 3n arrays through memory.  An expression
+ * built from expr::lazy() records the operations instead and evaluates the
+ * whole chain in one pass: the elements are processed in tiles of TILE_SIZE,
+ * the intermediate tiles stay in the L1 cache, and only the operands and the
+ * result travel to and from memory.  The arithmetic of a tile uses the SIMD
+ * kernels of simd::add() and friends.
+ *
+ * @code
+ * SimpleArray<double> r = (expr::lazy(a) + b) * c - d;
+ * SimpleArray<double> s = expr::where(expr::lazy(a) < 0.0, b, c).evaluate();
+ * @endcode
+ *
+ * An expression refers to its operand arrays without owning them; it must not
+ * outlive them.  LazyArray is the run-time counterpart that owns its operands
+ * and is composed one operation at a time, e.g., from Python.
+ */
+
+#include <solvcon/buffer/SimpleArray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace solvcon
+{
+
+namespace expr
+{
+
+/// Number of elements an expression evaluates at a time.
+inline constexpr size_t TILE_SIZE = 512;
+
+struct ExpressionTag
+{
+}; /* end struct ExpressionTag */
+
+template <typename E>
+concept ExpressionType = std::derived_from<E, ExpressionTag>;
+
+template <typename D>
+class Expression;
+
+/**
+ * Leaf of an expression that reads the elements of a SimpleArray in place.
+ */
+template <typename T>
+class ArrayOperand
+    : public Expression<ArrayOperand<T>>
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = typename SimpleArray<T>::shape_type;
+
+    static constexpr bool is_scalar = false;
+
+    explicit ArrayOperand(SimpleArray<T> const & arr)
+        : m_data(arr.logical_data())
+        , m_size(arr.size())
+        , m_shape(arr.shape())
+        , m_nghost(arr.nghost())
+    {
+        if (!arr.is_c_contiguous())
+        {
+            throw std::invalid_argument("expr::lazy(): the array must be C contiguous");
+        }
+    }
+
+    shape_type const & shape() const { return m_shape; }
+    size_t size() const { return m_size; }
+    ssize_t nghost() const { return m_nghost; }
+
+    T const * tile(size_t begin, size_t, T *) const { return m_data + begin; }
+
+private:
+
+    T const * m_data;
+    size_t m_size;
+    shape_type m_shape;
+    ssize_t m_nghost;
+
+}; /* end class ArrayOperand */
+
+/**
+ * Leaf of an expression that repeats a scalar.  It takes the shape of the
+ * other operand.
+ */
+template <typename T>
+class ScalarOperand
+    : public Expression<ScalarOperand<T>>
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = typename SimpleArray<T>::shape_type;
+
+    static constexpr bool is_scalar = true;
+
+    explicit ScalarOperand(T value)
+        : m_value(value)
+    {
+    }
+
+    T const * tile(size_t, size_t n, T * scratch) const
+    {
+        std::fill_n(scratch, n, m_value);
+        return scratch;
+    }
+
+private:
+
+    T m_value;
+
+}; /* end class ScalarOperand */
+
+namespace op
+{
+
+// Each operation fills n results from n operands.  The result may overwrite
+// an operand at the same index.
+
+struct Add
+{
+    static constexpr char const * name = "add";
+    template <typename T>
+    using result_type = T;
+    template <typename T>
+    static void apply(T * out, size_t n, T const * lhs, T const * rhs) { simd::add<T>(out, out + n, lhs, rhs); }
+}; /* end struct Add */
+
+struct Sub
+{
+    static constexpr char const * name = "sub";
+    template <typename T>
+    using result_type = T;
+    template <typename T>
+    static void apply(T * out, size_t n, T const * lhs, T const * rhs) { simd::sub<T>(out, out + n, lhs, rhs); }
+}; /* end struct Sub */
+
+struct Mul
+{
+    static constexpr char const * name = "mul";
+    template <typename T>
+    using result_type = T;
+    template <typename T>
+    static void apply(T * out, size_t n, T const * lhs, T const * rhs) { simd::mul<T>(out, out + n, lhs, rhs); }
+}; /* end struct Mul */
+
+struct Div
+{
+    static constexpr char const * name = "div";
+    template <typename T>
+    using result_type = T;
+    template <typename T>
+    static void apply(T * out, size_t n, T const * lhs, T const * rhs) { simd::div<T>(out, out + n, lhs, rhs); }
+}; /* end struct Div */
+
+template <typename Cmp>
+struct Compare
+{
+    template <typename T>
+    using result_type = bool;
+    template <typename T>
+    static void apply(bool * out, size_t n, T const * lhs, T const * rhs)
+    {
+        Cmp const cmp;
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = cmp(lhs[i], rhs[i]);
+        }
+    }
+}; /* end struct Compare */
+
+struct Eq : Compare<std::equal_to<>>
+{
+    static constexpr char const * name = "eq";
+}; /* end struct Eq */
+
+struct Ne : Compare<std::not_equal_to<>>
+{
+    static constexpr char const * name = "ne";
+}; /* end struct Ne */
+
+struct Lt : Compare<std::less<>>
+{
+    static constexpr char const * name = "lt";
+}; /* end struct Lt */
+
+struct Le : Compare<std::less_equal<>>
+{
+    static constexpr char const * name = "le";
+}; /* end struct Le */
+
+struct Gt : Compare<std::greater<>>
+{
+    static constexpr char const * name = "gt";
+}; /* end struct Gt */
+
+struct Ge : Compare<std::greater_equal<>>
+{
+    static constexpr char const * name = "ge";
+}; /* end struct Ge */
+
+struct Neg
+{
+    template <typename T>
+    static void apply(T * out, size_t n, T const * src)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = -src[i];
+        }
+    }
+}; /* end struct Neg */
+
+struct Abs
+{
+    template <typename T>
+    static void apply(T * out, size_t n, T const * src)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                out[i] = src[i] < T(0) ? T(-src[i]) : src[i];
+            }
+            else
+            {
+                out[i] = src[i];
+            }
+        }
+    }
+}; /* end struct Abs */
+
+} /* end namespace op */
+
+/**
+ * Element-wise binary operation of two expressions.
+ */
+template <typename Op, ExpressionType L, ExpressionType R>
+class BinaryExpression
+    : public Expression<BinaryExpression<Op, L, R>>
+{
+
+public:
+
+    using operand_type = typename L::value_type;
+    using value_type = typename Op::template result_type<operand_type>;
+    using shape_type = typename SimpleArray<value_type>::shape_type;
+
+    static_assert(std::is_same_v<operand_type, typename R::value_type>, "operands must have the same value type");
+    static_assert(!(L::is_scalar && R::is_scalar), "an expression needs an array operand");
+
+    static constexpr bool is_scalar = false;
+
+    BinaryExpression(L lhs, R rhs)
+        : m_lhs(std::move(lhs))
+        , m_rhs(std::move(rhs))
+    {
+        if constexpr (!L::is_scalar && !R::is_scalar)
+        {
+            if (m_lhs.shape() != m_rhs.shape())
+            {
+                throw std::invalid_argument(std::format(
+                    "expr::{}(): shape mismatch: lhs={} rhs={}",
+                    Op::name,
+                    solvcon::detail::format_shape(m_lhs.shape()),
+                    solvcon::detail::format_shape(m_rhs.shape())));
+            }
+        }
+    }
+
+    shape_type const & shape() const { return array_side().shape(); }
+    size_t size() const { return array_side().size(); }
+    ssize_t nghost() const { return array_side().nghost(); }
+
+    value_type const * tile(size_t begin, size_t n, value_type * scratch) const
+    {
+        std::array<operand_type, TILE_SIZE> lbuf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::array<operand_type, TILE_SIZE> rbuf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        operand_type const * lhs = m_lhs.tile(begin, n, lbuf.data());
+        operand_type const * rhs = m_rhs.tile(begin, n, rbuf.data());
+        Op::template apply<operand_type>(scratch, n, lhs, rhs);
+        return scratch;
+    }
+
+private:
+
+    auto const & array_side() const
+    {
+        if constexpr (L::is_scalar)
+        {
+            return m_rhs;
+        }
+        else
+        {
+            return m_lhs;
+        }
+    }
+
+    L m_lhs;
+    R m_rhs;
+
+}; /* end class BinaryExpression */
+
+/**
+ * Element-wise unary operation of an expression.
+ */
+template <typename Op, ExpressionType E>
+class UnaryExpression
+    : public Expression<UnaryExpression<Op, E>>
+{
+
+public:
+
+    using value_type = typename E::value_type;
+    using shape_type = typename SimpleArray<value_type>::shape_type;
+
+    static constexpr bool is_scalar = false;
+
+    explicit UnaryExpression(E src)
+        : m_src(std::move(src))
+    {
+    }
+
+    shape_type const & shape() const { return m_src.shape(); }
+    size_t size() const { return m_src.size(); }
+    ssize_t nghost() const { return m_src.nghost(); }
+
+    value_type const * tile(size_t begin, size_t n, value_type * scratch) const
+    {
+        std::array<value_type, TILE_SIZE> buf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        Op::template apply<value_type>(scratch, n, m_src.tile(begin, n, buf.data()));
+        return scratch;
+    }
+
+private:
+
+    E m_src;
+
+}; /* end class UnaryExpression */
+
+/**
+ * Element-wise selection: x where the condition holds, otherwise y.
+ */
+template <ExpressionType C, ExpressionType X, ExpressionType Y>
+class WhereExpression
+    : public Expression<WhereExpression<C, X, Y>>
+{
+
+public:
+
+    using value_type = typename X::value_type;
+    using shape_type = typename SimpleArray<value_type>::shape_type;
+
+    static_assert(std::is_same_v<bool, typename C::value_type>, "the condition must be a bool expression");
+    static_assert(std::is_same_v<value_type, typename Y::value_type>, "x and y must have the same value type");
+    static_assert(!C::is_scalar, "the condition must be an array expression");
+
+    static constexpr bool is_scalar = false;
+
+    WhereExpression(C cond, X x, Y y)
+        : m_cond(std::move(cond))
+        , m_x(std::move(x))
+        , m_y(std::move(y))
+    {
+        auto check = [this](auto const & operand, char const * name)
+        {
+            if constexpr (!std::remove_cvref_t<decltype(operand)>::is_scalar)
+            {
+                if (operand.shape() != m_cond.shape())
+                {
+                    throw std::invalid_argument(std::format(
+                        "expr::where(): shape mismatch: condition={} {}={}",
+                        solvcon::detail::format_shape(m_cond.shape()),
+                        name,
+                        solvcon::detail::format_shape(operand.shape())));
+                }
+            }
+        };
+        check(m_x, "x");
+        check(m_y, "y");
+    }
+
+    shape_type const & shape() const { return m_cond.shape(); }
+    size_t size() const { return m_cond.size(); }
+    ssize_t nghost() const { return m_cond.nghost(); }
+
+    value_type const * tile(size_t begin, size_t n, value_type * scratch) const
+    {
+        std::array<bool, TILE_SIZE> cbuf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::array<value_type, TILE_SIZE> xbuf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::array<value_type, TILE_SIZE> ybuf; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        bool const * cond = m_cond.tile(begin, n, cbuf.data());
+        value_type const * x = m_x.tile(begin, n, xbuf.data());
+        value_type const * y = m_y.tile(begin, n, ybuf.data());
+        for (size_t i = 0; i < n; ++i)
+        {
+            scratch[i] = cond[i] ? x[i] : y[i];
+        }
+        return scratch;
+    }
+
+private:
+
+    C m_cond;
+    X m_x;
+    Y m_y;
+
+}; /* end class WhereExpression */
+
+namespace detail
+{
+
+template <typename X>
+struct operand_value
+{
+}; /* end struct operand_value */
+
+template <ExpressionType X>
+struct operand_value<X>
+{
+    using type = typename X::value_type;
+}; /* end struct operand_value */
+
+template <typename T>
+struct operand_value<SimpleArray<T>>
+{
+    using type = T;
+}; /* end struct operand_value */
+
+template <typename X>
+concept ArrayLike = requires { typename operand_value<X>::type; };
+
+// The value type of a binary operation comes from its array-like operand.
+template <typename L, typename R>
+using common_value_t = typename std::conditional_t<ArrayLike<L>, operand_value<L>, operand_value<R>>::type;
+
+// Turn an operand into an expression with the value type T.
+template <typename T, typename X>
+auto as_expression(X const & x)
+{
+    if constexpr (ExpressionType<X>)
+    {
+        return x;
+    }
+    else if constexpr (std::is_same_v<X, SimpleArray<T>>)
+    {
+        return ArrayOperand<T>(x);
+    }
+    else
+    {
+        return ScalarOperand<T>(static_cast<T>(x));
+    }
+}
+
+template <typename Op, typename L, typename R>
+auto make_binary(L const & lhs, R const & rhs)
+{
+    using value_type = common_value_t<L, R>;
+    using lhs_type = decltype(as_expression<value_type>(lhs));
+    using rhs_type = decltype(as_expression<value_type>(rhs));
+    return BinaryExpression<Op, lhs_type, rhs_type>(as_expression<value_type>(lhs), as_expression<value_type>(rhs));
+}
+
+// At least one operand of an operator must already be an expression, so that
+// the operators never apply to two plain arrays.
+template <typename L, typename R>
+concept BinaryOperands = (ExpressionType<L> || ExpressionType<R>) && (ArrayLike<L> || std::is_arithmetic_v<L>) && (ArrayLike<R> || std::is_arithmetic_v<R>);
+
+} /* end namespace detail */
+
+/**
+ * CRTP base of the expression nodes.
+ */
+template <typename D>
+class Expression
+    : public ExpressionTag
+{
+
+public:
+
+    D const & derived() const { return *static_cast<D const *>(this); }
+
+    /// Evaluate into a new array.
+    auto evaluate() const
+    {
+        using value_type = typename D::value_type;
+        SimpleArray<value_type> ret(derived().shape());
+        ret.set_nghost(derived().nghost());
+        evaluate_into(ret);
+        return ret;
+    }
+
+    /// Evaluate into an existing C-contiguous array of the same shape, which
+    /// may also be an operand.
+    template <typename T>
+    void evaluate_into(SimpleArray<T> & out) const
+    {
+        static_assert(std::is_same_v<T, typename D::value_type>, "the output must have the value type of the expression");
+        if (out.shape() != derived().shape() || !out.is_c_contiguous())
+        {
+            throw std::invalid_argument(std::format(
+                "expr::evaluate_into(): the output must be C contiguous in shape {}, not {}",
+                solvcon::detail::format_shape(derived().shape()),
+                solvcon::detail::format_shape(out.shape())));
+        }
+        size_t const size = derived().size();
+        T * dst = out.logical_data();
+        for (size_t begin = 0; begin < size; begin += TILE_SIZE)
+        {
+            size_t const n = std::min(TILE_SIZE, size - begin);
+            // The root writes the tile straight to the output; a bare operand
+            // hands back its own memory and has to be copied.
+            T const * src = derived().tile(begin, n, dst + begin);
+            if (src != dst + begin)
+            {
+                std::copy_n(src, n, dst + begin);
+            }
+        }
+    }
+
+    template <typename X>
+    auto add(X const & other) const { return detail::make_binary<op::Add>(derived(), other); }
+    template <typename X>
+    auto sub(X const & other) const { return detail::make_binary<op::Sub>(derived(), other); }
+    template <typename X>
+    auto mul(X const & other) const { return detail::make_binary<op::Mul>(derived(), other); }
+    template <typename X>
+    auto div(X const & other) const { return detail::make_binary<op::Div>(derived(), other); }
+    template <typename X>
+    auto eq(X const & other) const { return detail::make_binary<op::Eq>(derived(), other); }
+    template <typename X>
+    auto ne(X const & other) const { return detail::make_binary<op::Ne>(derived(), other); }
+    template <typename X>
+    auto lt(X const & other) const { return detail::make_binary<op::Lt>(derived(), other); }
+    template <typename X>
+    auto le(X const & other) const { return detail::make_binary<op::Le>(derived(), other); }
+    template <typename X>
+    auto gt(X const & other) const { return detail::make_binary<op::Gt>(derived(), other); }
+    template <typename X>
+    auto ge(X const & other) const { return detail::make_binary<op::Ge>(derived(), other); }
+    auto neg() const { return UnaryExpression<op::Neg, D>(derived()); }
+    auto abs() const { return UnaryExpression<op::Abs, D>(derived()); }
+
+    template <typename T>
+    operator SimpleArray<T>() const // NOLINT(google-explicit-constructor)
+    {
+        return evaluate();
+    }
+
+}; /* end class Expression */
+
+/// Start a lazy expression from an array.
+template <typename T>
+ArrayOperand<T> lazy(SimpleArray<T> const & arr)
+{
+    return ArrayOperand<T>(arr);
+}
+
+// clang-format off
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator+(L const & lhs, R const & rhs) { return detail::make_binary<op::Add>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator-(L const & lhs, R const & rhs) { return detail::make_binary<op::Sub>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator*(L const & lhs, R const & rhs) { return detail::make_binary<op::Mul>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator/(L const & lhs, R const & rhs) { return detail::make_binary<op::Div>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator==(L const & lhs, R const & rhs) { return detail::make_binary<op::Eq>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator!=(L const & lhs, R const & rhs) { return detail::make_binary<op::Ne>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator<(L const & lhs, R const & rhs) { return detail::make_binary<op::Lt>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator<=(L const & lhs, R const & rhs) { return detail::make_binary<op::Le>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator>(L const & lhs, R const & rhs) { return detail::make_binary<op::Gt>(lhs, rhs); }
+template <typename L, typename R> requires detail::BinaryOperands<L, R>
+auto operator>=(L const & lhs, R const & rhs) { return detail::make_binary<op::Ge>(lhs, rhs); }
+// clang-format on
+
+template <ExpressionType E>
+auto operator-(E const & src)
+{
+    return src.neg();
+}
+
+/// Select x where the condition holds, otherwise y.  x and y may be
+/// expressions, arrays, or scalars.
+template <ExpressionType C, typename X, typename Y>
+auto where(C const & cond, X const & x, Y const & y)
+{
+    using value_type = detail::common_value_t<X, Y>;
+    using x_type = decltype(detail::as_expression<value_type>(x));
+    using y_type = decltype(detail::as_expression<value_type>(y));
+    return WhereExpression<C, x_type, y_type>(cond, detail::as_expression<value_type>(x), detail::as_expression<value_type>(y));
+}
+
+/**
+ * Type-erased expression node for LazyArray.
+ */
+template <typename T>
+class Node
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = typename SimpleArray<T>::shape_type;
+
+    Node() = default;
+    Node(Node const &) = delete;
+    Node(Node &&) = delete;
+    Node & operator=(Node const &) = delete;
+    Node & operator=(Node &&) = delete;
+    virtual ~Node() = default;
+
+    virtual shape_type const & shape() const = 0;
+    virtual size_t size() const = 0;
+    virtual ssize_t nghost() const = 0;
+    virtual T const * tile(size_t begin, size_t n, T * scratch) const = 0;
+
+}; /* end class Node */
+
+template <ExpressionType E>
+class NodeOf final
+    : public Node<typename E::value_type>
+{
+
+public:
+
+    using value_type = typename E::value_type;
+    using shape_type = typename Node<value_type>::shape_type;
+
+    explicit NodeOf(E expr)
+        : m_expr(std::move(expr))
+    {
+    }
+
+    shape_type const & shape() const override { return m_expr.shape(); }
+    size_t size() const override { return m_expr.size(); }
+    ssize_t nghost() const override { return m_expr.nghost(); }
+    value_type const * tile(size_t begin, size_t n, value_type * scratch) const override
+    {
+        return m_expr.tile(begin, n, scratch);
+    }
+
+private:
+
+    E m_expr;
+
+}; /* end class NodeOf */
+
+/**
+ * Leaf of an expression that evaluates a shared type-erased node.
+ */
+template <typename T>
+class NodeOperand
+    : public Expression<NodeOperand<T>>
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = typename Node<T>::shape_type;
+
+    static constexpr bool is_scalar = false;
+
+    explicit NodeOperand(std::shared_ptr<Node<T> const> node)
+        : m_node(std::move(node))
+    {
+    }
+
+    shape_type const & shape() const { return m_node->shape(); }
+    size_t size() const { return m_node->size(); }
+    ssize_t nghost() const { return m_node->nghost(); }
+    T const * tile(size_t begin, size_t n, T * scratch) const { return m_node->tile(begin, n, scratch); }
+
+private:
+
+    std::shared_ptr<Node<T> const> m_node;
+
+}; /* end class NodeOperand */
+
+} /* end namespace expr */
+
+/**
+ * Deferred element-wise computation that is composed at run time.
+ *
+ * @ingroup group_core
+ *
+ * A LazyArray owns its operand arrays (it shares their buffers) and the
+ * operations applied to it.  Nothing is computed until evaluate(), which runs
+ * the whole chain in one tiled pass like an expr::Expression.  Every
+ * operation costs a virtual call per tile, which is negligible next to the
+ * TILE_SIZE elements it processes.
+ */
+template <typename T>
+class LazyArray
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = typename SimpleArray<T>::shape_type;
+
+    explicit LazyArray(SimpleArray<T> const & arr)
+        : m_node(std::make_shared<expr::NodeOf<OwnedOperand>>(OwnedOperand(arr)))
+    {
+    }
+
+    explicit LazyArray(std::shared_ptr<expr::Node<T> const> node)
+        : m_node(std::move(node))
+    {
+    }
+
+    shape_type const & shape() const { return m_node->shape(); }
+    size_t size() const { return m_node->size(); }
+
+    expr::NodeOperand<T> operand() const { return expr::NodeOperand<T>(m_node); }
+
+    SimpleArray<T> evaluate() const { return operand().evaluate(); }
+    void evaluate_into(SimpleArray<T> & out) const { operand().evaluate_into(out); }
+
+    template <typename X>
+    auto add(X const & other) const { return binary<expr::op::Add>(other); }
+    template <typename X>
+    auto sub(X const & other) const { return binary<expr::op::Sub>(other); }
+    template <typename X>
+    auto mul(X const & other) const { return binary<expr::op::Mul>(other); }
+    template <typename X>
+    auto div(X const & other) const { return binary<expr::op::Div>(other); }
+    template <typename X>
+    auto eq(X const & other) const { return binary<expr::op::Eq>(other); }
+    template <typename X>
+    auto ne(X const & other) const { return binary<expr::op::Ne>(other); }
+    template <typename X>
+    auto lt(X const & other) const { return binary<expr::op::Lt>(other); }
+    template <typename X>
+    auto le(X const & other) const { return binary<expr::op::Le>(other); }
+    template <typename X>
+    auto gt(X const & other) const { return binary<expr::op::Gt>(other); }
+    template <typename X>
+    auto ge(X const & other) const { return binary<expr::op::Ge>(other); }
+
+    /// Scalar minus this, for the reflected operator.
+    LazyArray rsub(T scalar) const { return make(expr::ScalarOperand<T>(scalar) - operand()); }
+    /// Scalar divided by this, for the reflected operator.
+    LazyArray rdiv(T scalar) const { return make(expr::ScalarOperand<T>(scalar) / operand()); }
+
+    LazyArray neg() const { return make(operand().neg()); }
+    LazyArray abs() const { return make(operand().abs()); }
+
+    /// Select x where this bool array holds, otherwise y.
+    template <typename U>
+    LazyArray<U> where(LazyArray<U> const & x, LazyArray<U> const & y) const
+    {
+        static_assert(std::is_same_v<T, bool>, "LazyArray::where() requires a bool array");
+        return LazyArray<U>::make(expr::where(operand(), x.operand(), y.operand()));
+    }
+
+    template <expr::ExpressionType E>
+    static LazyArray make(E const & e)
+    {
+        return LazyArray(std::make_shared<expr::NodeOf<E> const>(e));
+    }
+
+private:
+
+    // Array operand that keeps the buffer of the array alive.
+    class OwnedOperand
+        : public expr::ArrayOperand<T>
+    {
+    public:
+        explicit OwnedOperand(SimpleArray<T> const & arr)
+            : expr::ArrayOperand<T>(arr)
+            , m_keep(arr.buffer().shared_from_this())
+        {
+        }
+
+    private:
+        std::shared_ptr<ConcreteBuffer const> m_keep;
+    }; /* end class OwnedOperand */
+
+    template <typename Op, typename X>
+    auto binary(X const & other) const
+    {
+        using result_type = typename Op::template result_type<T>;
+        if constexpr (std::is_same_v<X, LazyArray>)
+        {
+            return LazyArray<result_type>::make(make_binary<Op>(operand(), other.operand()));
+        }
+        else if constexpr (std::is_same_v<X, SimpleArray<T>>)
+        {
+            return LazyArray<result_type>::make(make_binary<Op>(operand(), LazyArray(other).operand()));
+        }
+        else
+        {
+            return LazyArray<result_type>::make(make_binary<Op>(operand(), expr::ScalarOperand<T>(static_cast<T>(other))));
+        }
+    }
+
+    template <typename Op, typename L, typename R>
+    static auto make_binary(L const & lhs, R const & rhs)
+    {
+        return expr::BinaryExpression<Op, L, R>(lhs, rhs);
+    }
+
+    template <typename U>
+    friend class LazyArray;
+
+    std::shared_ptr<expr::Node<T> const> m_node;
+
+}; /* end class LazyArray */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
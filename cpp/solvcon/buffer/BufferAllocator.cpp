@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/buffer/BufferAllocator.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <stdexcept>
+
+namespace solvcon
+{
+
+size_t BufferAllocator::nlive() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_nlive;
+}
+
+size_t BufferAllocator::nreuse() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_nreuse;
+}
+
+size_t BufferAllocator::nsystem() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_nsystem;
+}
+
+std::vector<std::shared_ptr<BufferAllocator>> & BufferAllocator::stack()
+{
+    thread_local std::vector<std::shared_ptr<BufferAllocator>> ret;
+    return ret;
+}
+
+std::shared_ptr<BufferAllocator> const & BufferAllocator::current()
+{
+    static std::shared_ptr<BufferAllocator> const none;
+    auto const & stk = stack();
+    return stk.empty() ? none : stk.back();
+}
+
+void * BufferAllocator::system_allocate(size_t nbytes)
+{
+    // aligned_alloc() wants the size to be a multiple of the alignment.
+    size_t const padded = (nbytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+#ifdef _WIN32
+    void * ptr = _aligned_malloc(padded, ALIGNMENT); // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#else
+    void * ptr = std::aligned_alloc(ALIGNMENT, padded); // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#endif
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void BufferAllocator::system_deallocate(void * ptr) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(ptr); // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#else
+    std::free(ptr); // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#endif
+}
+
+BufferAllocatorScope::BufferAllocatorScope(std::shared_ptr<BufferAllocator> allocator)
+{
+    push(std::move(allocator));
+}
+
+BufferAllocatorScope::~BufferAllocatorScope()
+{
+    auto & stk = BufferAllocator::stack();
+    if (!stk.empty())
+    {
+        stk.pop_back();
+    }
+}
+
+void BufferAllocatorScope::push(std::shared_ptr<BufferAllocator> allocator)
+{
+    BufferAllocator::stack().push_back(std::move(allocator));
+}
+
+void BufferAllocatorScope::pop()
+{
+    auto & stk = BufferAllocator::stack();
+    if (stk.empty())
+    {
+        throw std::runtime_error("BufferAllocatorScope::pop: no allocator scope to leave");
+    }
+    stk.pop_back();
+}
+
+PoolBufferAllocator::PoolBufferAllocator(size_t max_block, size_t max_cached, ctor_passkey const &)
+    : m_max_block(std::min(max_block, MIN_BLOCK << (NCLASS - 1)))
+    , m_max_cached(max_cached)
+{
+}
+
+PoolBufferAllocator::~PoolBufferAllocator()
+{
+    release();
+}
+
+size_t PoolBufferAllocator::size_class(size_t nbytes) const
+{
+    if (nbytes > m_max_block)
+    {
+        return NCLASS;
+    }
+    size_t const block = std::bit_ceil(std::max(nbytes, MIN_BLOCK));
+    return static_cast<size_t>(std::countr_zero(block) - std::countr_zero(MIN_BLOCK));
+}
+
+void * PoolBufferAllocator::allocate(size_t nbytes)
+{
+    size_t const icls = size_class(nbytes);
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        ++m_nlive;
+        if (icls < NCLASS && !m_free[icls].empty())
+        {
+            void * ptr = m_free[icls].back();
+            m_free[icls].pop_back();
+            m_cached_bytes -= MIN_BLOCK << icls;
+            ++m_nreuse;
+            return ptr;
+        }
+        ++m_nsystem;
+    }
+    try
+    {
+        return system_allocate(icls < NCLASS ? MIN_BLOCK << icls : nbytes);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        --m_nlive;
+        throw;
+    }
+}
+
+void PoolBufferAllocator::deallocate(void * ptr, size_t nbytes) noexcept
+{
+    size_t const icls = size_class(nbytes);
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        --m_nlive;
+        if (icls < NCLASS && m_cached_bytes + (MIN_BLOCK << icls) <= m_max_cached)
+        {
+            try
+            {
+                m_free[icls].push_back(ptr);
+                m_cached_bytes += MIN_BLOCK << icls;
+                return;
+            }
+            catch (std::bad_alloc const &)
+            {
+                // Fall through to free the block.
+            }
+        }
+    }
+    system_deallocate(ptr);
+}
+
+size_t PoolBufferAllocator::cached_bytes() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_cached_bytes;
+}
+
+void PoolBufferAllocator::release()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    for (auto & blocks : m_free)
+    {
+        for (void * ptr : blocks)
+        {
+            system_deallocate(ptr);
+        }
+        blocks.clear();
+    }
+    m_cached_bytes = 0;
+}
+
+std::shared_ptr<ArenaBufferAllocator> const & ArenaBufferAllocator::thread_instance()
+{
+    thread_local std::shared_ptr<ArenaBufferAllocator> const ret = construct();
+    return ret;
+}
+
+ArenaBufferAllocator::ArenaBufferAllocator(size_t chunk_size, ctor_passkey const &)
+    : m_chunk_size(std::max(chunk_size, ALIGNMENT))
+{
+}
+
+ArenaBufferAllocator::~ArenaBufferAllocator()
+{
+    for (Chunk const & chunk : m_chunks)
+    {
+        system_deallocate(chunk.data);
+    }
+}
+
+void * ArenaBufferAllocator::allocate(size_t nbytes)
+{
+    size_t const padded = (std::max(nbytes, size_t(1)) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    // Skip the chunks too small for the request.
+    while (m_ichunk < m_chunks.size() && m_offset + padded > m_chunks[m_ichunk].size)
+    {
+        ++m_ichunk;
+        m_offset = 0;
+    }
+    if (m_ichunk == m_chunks.size())
+    {
+        size_t const size = std::max(padded, m_chunk_size);
+        m_chunks.push_back(Chunk{static_cast<int8_t *>(system_allocate(size)), size});
+        ++m_nsystem;
+    }
+    else
+    {
+        ++m_nreuse;
+    }
+    int8_t * ptr = static_cast<int8_t *>(m_chunks[m_ichunk].data) + m_offset;
+    m_blocks.push_back(Block{ptr, m_ichunk, m_offset, true});
+    m_offset += padded;
+    ++m_nlive;
+    return ptr;
+}
+
+void ArenaBufferAllocator::deallocate(void * ptr, size_t) noexcept
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    --m_nlive;
+    // Temporaries die young; search from the top of the stack.
+    for (auto it = m_blocks.rbegin(); it != m_blocks.rend(); ++it)
+    {
+        if (it->data == ptr)
+        {
+            it->live = false;
+            break;
+        }
+    }
+    // Pop the released blocks on the top, and move the top down to them.
+    while (!m_blocks.empty() && !m_blocks.back().live)
+    {
+        m_ichunk = m_blocks.back().ichunk;
+        m_offset = m_blocks.back().offset;
+        m_blocks.pop_back();
+    }
+    if (m_blocks.empty())
+    {
+        m_ichunk = 0;
+        m_offset = 0;
+    }
+}
+
+size_t ArenaBufferAllocator::nchunk() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_chunks.size();
+}
+
+size_t ArenaBufferAllocator::capacity() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    size_t ret = 0;
+    for (Chunk const & chunk : m_chunks)
+    {
+        ret += chunk.size;
+    }
+    return ret;
+}
+
+size_t ArenaBufferAllocator::used() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    size_t ret = m_offset;
+    for (size_t ic = 0; ic < m_ichunk; ++ic)
+    {
+        ret += m_chunks[ic].size;
+    }
+    return ret;
+}
+
+void ArenaBufferAllocator::release()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (m_nlive != 0)
+    {
+        throw std::runtime_error(std::format("ArenaBufferAllocator::release: {} buffers are still live", m_nlive));
+    }
+    for (Chunk const & chunk : m_chunks)
+    {
+        system_deallocate(chunk.data);
+    }
+    m_chunks.clear();
+    m_ichunk = 0;
+    m_offset = 0;
+}
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
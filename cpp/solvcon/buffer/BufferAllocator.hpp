@@ -0,0 +1,262 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Pluggable memory allocators for the data of ConcreteBuffer.
+ *
+ * @ingroup group_core
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace solvcon
+{
+
+/**
+ * Source of the data memory of ConcreteBuffer.
+ *
+ * @ingroup group_core
+ *
+ * By default ConcreteBuffer calls malloc and free.  An allocator made current
+ * on a thread with BufferAllocatorScope serves every ConcreteBuffer (hence
+ * every SimpleArray) constructed on that thread until the scope ends.  Each
+ * buffer keeps its allocator alive and returns its memory to it when the
+ * buffer is destroyed, from whatever thread and after whatever scope.  The
+ * memory is aligned to at least ALIGNMENT bytes, the largest alignment that
+ * ConcreteBuffer accepts.
+ */
+class BufferAllocator
+    : public std::enable_shared_from_this<BufferAllocator>
+{
+
+public:
+
+    static constexpr size_t ALIGNMENT = 64;
+
+    BufferAllocator() = default;
+    BufferAllocator(BufferAllocator const &) = delete;
+    BufferAllocator(BufferAllocator &&) = delete;
+    BufferAllocator & operator=(BufferAllocator const &) = delete;
+    BufferAllocator & operator=(BufferAllocator &&) = delete;
+    virtual ~BufferAllocator() = default;
+
+    virtual void * allocate(size_t nbytes) = 0;
+    virtual void deallocate(void * ptr, size_t nbytes) noexcept = 0;
+
+    /// Number of buffers allocated and not yet deallocated.
+    size_t nlive() const;
+    /// Number of allocate() calls served without calling the system.
+    size_t nreuse() const;
+    /// Number of allocate() calls that went to the system.
+    size_t nsystem() const;
+
+    /// The allocator of the innermost BufferAllocatorScope on this thread, or
+    /// null for malloc.
+    static std::shared_ptr<BufferAllocator> const & current();
+
+protected:
+
+    static void * system_allocate(size_t nbytes);
+    static void system_deallocate(void * ptr) noexcept;
+
+    mutable std::mutex m_mutex;
+    size_t m_nlive = 0;
+    size_t m_nreuse = 0;
+    size_t m_nsystem = 0;
+
+private:
+
+    friend class BufferAllocatorScope;
+
+    static std::vector<std::shared_ptr<BufferAllocator>> & stack();
+
+}; /* end class BufferAllocator */
+
+/**
+ * Make an allocator current on this thread for the lifetime of the object.
+ * Scopes nest; a null allocator selects malloc again.
+ *
+ * @ingroup group_core
+ */
+class BufferAllocatorScope
+{
+
+public:
+
+    explicit BufferAllocatorScope(std::shared_ptr<BufferAllocator> allocator);
+    ~BufferAllocatorScope();
+
+    BufferAllocatorScope(BufferAllocatorScope const &) = delete;
+    BufferAllocatorScope(BufferAllocatorScope &&) = delete;
+    BufferAllocatorScope & operator=(BufferAllocatorScope const &) = delete;
+    BufferAllocatorScope & operator=(BufferAllocatorScope &&) = delete;
+
+    static void push(std::shared_ptr<BufferAllocator> allocator);
+    static void pop();
+
+}; /* end class BufferAllocatorScope */
+
+/**
+ * Keep freed blocks in power-of-two size classes and hand them out again.
+ *
+ * @ingroup group_core
+ *
+ * A request is rounded up to the next size class from MIN_BLOCK bytes.  Blocks
+ * larger than max_block are not pooled.  A freed block is kept for reuse
+ * unless the cached bytes would exceed max_cached; release() returns all the
+ * cached blocks to the system.  Large temporaries benefit the most, because
+ * malloc maps and unmaps them from the kernel, and every first touch of the
+ * fresh pages faults.
+ */
+class PoolBufferAllocator
+    : public BufferAllocator
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    }; /* end struct ctor_passkey */
+
+public:
+
+    static constexpr size_t MIN_BLOCK = 64;
+    static constexpr size_t NCLASS = 32;
+
+    template <class... Args>
+    static std::shared_ptr<PoolBufferAllocator> construct(Args &&... args)
+    {
+        return std::make_shared<PoolBufferAllocator>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    PoolBufferAllocator(size_t max_block, size_t max_cached, ctor_passkey const &);
+    explicit PoolBufferAllocator(ctor_passkey const & passkey)
+        : PoolBufferAllocator(size_t(1) << 30, size_t(1) << 30, passkey)
+    {
+    }
+
+    PoolBufferAllocator() = delete;
+    PoolBufferAllocator(PoolBufferAllocator const &) = delete;
+    PoolBufferAllocator(PoolBufferAllocator &&) = delete;
+    PoolBufferAllocator & operator=(PoolBufferAllocator const &) = delete;
+    PoolBufferAllocator & operator=(PoolBufferAllocator &&) = delete;
+    ~PoolBufferAllocator() override;
+
+    void * allocate(size_t nbytes) override;
+    void deallocate(void * ptr, size_t nbytes) noexcept override;
+
+    size_t max_block() const { return m_max_block; }
+    size_t max_cached() const { return m_max_cached; }
+    size_t cached_bytes() const;
+    /// Return the cached blocks to the system.
+    void release();
+
+    /// Index of the size class holding nbytes, or NCLASS if it is not pooled.
+    size_t size_class(size_t nbytes) const;
+
+private:
+
+    size_t m_max_block;
+    size_t m_max_cached;
+    size_t m_cached_bytes = 0;
+    std::array<std::vector<void *>, NCLASS> m_free;
+
+}; /* end class PoolBufferAllocator */
+
+/**
+ * Bump-pointer allocator over large chunks for short-lived buffers.
+ *
+ * @ingroup group_core
+ *
+ * Allocation advances an offset in the current chunk.  A released buffer
+ * gives its memory back once every buffer allocated after it is released as
+ * well, so the arena works as a stack: the temporaries of an expression and
+ * of a loop iteration, which die in the reverse order of their creation, are
+ * reused right away, while a long-lived buffer only holds the memory below it.
+ * A request larger than chunk_size gets a chunk of its own.  Each thread has
+ * its own arena from thread_instance().
+ */
+class ArenaBufferAllocator
+    : public BufferAllocator
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    }; /* end struct ctor_passkey */
+
+public:
+
+    template <class... Args>
+    static std::shared_ptr<ArenaBufferAllocator> construct(Args &&... args)
+    {
+        return std::make_shared<ArenaBufferAllocator>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    /// The arena of the calling thread.
+    static std::shared_ptr<ArenaBufferAllocator> const & thread_instance();
+
+    ArenaBufferAllocator(size_t chunk_size, ctor_passkey const &);
+    explicit ArenaBufferAllocator(ctor_passkey const & passkey)
+        : ArenaBufferAllocator(size_t(1) << 22, passkey)
+    {
+    }
+
+    ArenaBufferAllocator() = delete;
+    ArenaBufferAllocator(ArenaBufferAllocator const &) = delete;
+    ArenaBufferAllocator(ArenaBufferAllocator &&) = delete;
+    ArenaBufferAllocator & operator=(ArenaBufferAllocator const &) = delete;
+    ArenaBufferAllocator & operator=(ArenaBufferAllocator &&) = delete;
+    ~ArenaBufferAllocator() override;
+
+    void * allocate(size_t nbytes) override;
+    void deallocate(void * ptr, size_t nbytes) noexcept override;
+
+    size_t chunk_size() const { return m_chunk_size; }
+    size_t nchunk() const;
+    /// Bytes of all the chunks.
+    size_t capacity() const;
+    /// Bytes from the start of the first chunk to the top of the stack.
+    size_t used() const;
+    /// Return the chunks to the system; throw std::runtime_error if any
+    /// buffer is live.
+    void release();
+
+private:
+
+    struct Chunk
+    {
+        void * data;
+        size_t size;
+    }; /* end struct Chunk */
+
+    struct Block
+    {
+        int8_t * data;
+        size_t ichunk;
+        size_t offset;
+        bool live;
+    }; /* end struct Block */
+
+    size_t m_chunk_size;
+    std::vector<Chunk> m_chunks;
+    std::vector<Block> m_blocks; // Allocated blocks in the stack order.
+    size_t m_ichunk = 0; // Index of the chunk to allocate from.
+    size_t m_offset = 0; // Bytes used in the current chunk.
+
+}; /* end class ArenaBufferAllocator */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
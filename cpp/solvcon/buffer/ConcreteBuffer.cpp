@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/buffer/ConcreteBuffer.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace solvcon
+{
+
+namespace detail
+{
+
+// NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+void ConcreteBufferMappedRemover::operator()(int8_t *, size_t) const
+{
+    if (base)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+#else
+        munmap(base, length);
+#endif
+    }
+}
+
+} /* end namespace detail */
+
+namespace
+{
+
+// Read before closing any handle, which may overwrite the error code.
+std::string last_error()
+{
+#ifdef _WIN32
+    return std::format("error {}", GetLastError());
+#else
+    return std::strerror(errno);
+#endif
+}
+
+[[noreturn]] void throw_map_error(char const * what, std::string const & path, std::string const & reason)
+{
+    throw std::runtime_error(std::format("ConcreteBuffer::map_file: {} '{}': {}", what, path, reason));
+}
+
+void validate_map_range(std::string const & path, size_t file_size, size_t offset, size_t & nbytes)
+{
+    if (offset > file_size)
+    {
+        throw std::out_of_range(
+            std::format("ConcreteBuffer::map_file: offset {} exceeds size {} of '{}'", offset, file_size, path));
+    }
+    if (nbytes == 0)
+    {
+        nbytes = file_size - offset;
+    }
+    else if (nbytes > file_size - offset)
+    {
+        throw std::out_of_range(
+            std::format("ConcreteBuffer::map_file: {} bytes at offset {} exceed size {} of '{}'", nbytes, offset, file_size, path));
+    }
+}
+
+} /* end namespace */
+
+#ifdef _WIN32
+
+std::shared_ptr<ConcreteBuffer> ConcreteBuffer::map_file(std::string const & path, size_t offset, size_t nbytes, MapMode mode)
+{
+    bool const write_file = (mode == MapMode::SHARED);
+    HANDLE const file = CreateFileA(
+        path.c_str(),
+        write_file ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw_map_error("cannot open", path, last_error());
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size))
+    {
+        std::string const reason = last_error();
+        CloseHandle(file);
+        throw_map_error("cannot stat", path, reason);
+    }
+    try
+    {
+        validate_map_range(path, static_cast<size_t>(file_size.QuadPart), offset, nbytes);
+    }
+    catch (...)
+    {
+        CloseHandle(file);
+        throw;
+    }
+    if (nbytes == 0)
+    {
+        CloseHandle(file);
+        return construct();
+    }
+
+    // A view has to start at a multiple of the allocation granularity.
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    size_t const lead = offset % info.dwAllocationGranularity;
+    size_t const base_offset = offset - lead;
+    size_t const length = lead + nbytes;
+
+    DWORD const protect = write_file ? PAGE_READWRITE : (mode == MapMode::COPY_ON_WRITE ? PAGE_WRITECOPY : PAGE_READONLY);
+    DWORD const access = write_file ? FILE_MAP_WRITE : (mode == MapMode::COPY_ON_WRITE ? FILE_MAP_COPY : FILE_MAP_READ);
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, protect, 0, 0, nullptr);
+    std::string const reason = mapping ? std::string() : last_error();
+    CloseHandle(file);
+    if (!mapping)
+    {
+        throw_map_error("cannot map", path, reason);
+    }
+    void * base = MapViewOfFile(
+        mapping,
+        access,
+        static_cast<DWORD>(static_cast<uint64_t>(base_offset) >> 32),
+        static_cast<DWORD>(base_offset & 0xffffffffULL),
+        length);
+    std::string const view_reason = base ? std::string() : last_error();
+    // The view keeps the mapping object alive.
+    CloseHandle(mapping);
+    if (!base)
+    {
+        throw_map_error("cannot map", path, view_reason);
+    }
+
+    auto remover = std::make_unique<detail::ConcreteBufferMappedRemover>(base, length, mode);
+    return construct(nbytes, static_cast<int8_t *>(base) + lead, std::move(remover));
+}
+
+#else // _WIN32
+
+std::shared_ptr<ConcreteBuffer> ConcreteBuffer::map_file(std::string const & path, size_t offset, size_t nbytes, MapMode mode)
+{
+    bool const write_file = (mode == MapMode::SHARED);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    int const fd = ::open(path.c_str(), write_file ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        throw_map_error("cannot open", path, last_error());
+    }
+    struct stat st
+    {
+    };
+    if (::fstat(fd, &st) != 0)
+    {
+        std::string const reason = last_error();
+        ::close(fd);
+        throw_map_error("cannot stat", path, reason);
+    }
+    try
+    {
+        validate_map_range(path, static_cast<size_t>(st.st_size), offset, nbytes);
+    }
+    catch (...)
+    {
+        ::close(fd);
+        throw;
+    }
+    if (nbytes == 0)
+    {
+        ::close(fd);
+        return construct();
+    }
+
+    // mmap() takes a page-aligned offset; the data pointer skips the lead.
+    auto const page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t const lead = offset % page;
+    size_t const length = lead + nbytes;
+
+    int const prot = (mode == MapMode::READ_ONLY) ? PROT_READ : (PROT_READ | PROT_WRITE);
+    int const flags = write_file ? MAP_SHARED : MAP_PRIVATE;
+    void * base = ::mmap(nullptr, length, prot, flags, fd, static_cast<off_t>(offset - lead));
+    std::string const reason = (base == MAP_FAILED) ? last_error() : std::string();
+    // The mapping holds its own reference to the file.
+    ::close(fd);
+    if (base == MAP_FAILED)
+    {
+        throw_map_error("cannot map", path, reason);
+    }
+
+    auto remover = std::make_unique<detail::ConcreteBufferMappedRemover>(base, length, mode);
+    return construct(nbytes, static_cast<int8_t *>(base) + lead, std::move(remover));
+}
+
+#endif // _WIN32
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -13,17 +13,51 @@
  */
 
 #include <solvcon/base.hpp>
+#include <solvcon/buffer/BufferAllocator.hpp>
 #include <solvcon/buffer/BufferBase.hpp>
 #include <solvcon/buffer/small_vector.hpp>
 
 #include <algorithm>
+#include <format>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <typeinfo>
 
 namespace solvcon
 {
 
+/**
+ * Access mode of a file mapped by ConcreteBuffer::map_file().
+ *
+ * @ingroup group_core
+ */
+enum class MapMode : uint8_t
+{
+    READ_ONLY = 0, ///< Pages are read-only; a write faults.
+    COPY_ON_WRITE = 1, ///< Writes go to private pages and never reach the file.
+    SHARED = 2, ///< Writes go to the file.
+}; /* end enum class MapMode */
+
+inline MapMode map_mode_from_string(std::string const & mode)
+{
+    if (mode == "r")
+    {
+        return MapMode::READ_ONLY;
+    }
+    if (mode == "c")
+    {
+        return MapMode::COPY_ON_WRITE;
+    }
+    if (mode == "r+")
+    {
+        return MapMode::SHARED;
+    }
+    throw std::invalid_argument(
+        std::format("ConcreteBuffer: map mode '{}' not supported", mode));
+}
+
 namespace detail
 {
 
@@ -77,6 +111,35 @@ struct ConcreteBufferNoRemove : public ConcreteBufferRemover
 
 }; /* end struct ConcreteBufferNoRemove */
 
+/**
+ * Unmap the file view created by ConcreteBuffer::map_file().  The view starts
+ * at the page boundary below the data pointer, so the remover keeps its own
+ * base address and length.
+ */
+struct ConcreteBufferMappedRemover : public ConcreteBufferRemover
+{
+
+    static bool is_same_type(ConcreteBufferRemover const & other)
+    {
+        return typeid(other) == typeid(ConcreteBufferMappedRemover);
+    }
+
+    ConcreteBufferMappedRemover(void * base_in, size_t length_in, MapMode mode_in)
+        : base(base_in)
+        , length(length_in)
+        , mode(mode_in)
+    {
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t *, size_t) const override;
+
+    void * base = nullptr;
+    size_t length = 0;
+    MapMode mode = MapMode::READ_ONLY;
+
+}; /* end struct ConcreteBufferMappedRemover */
+
 struct ConcreteBufferDataDeleter
 {
 
@@ -94,22 +157,34 @@ struct ConcreteBufferDataDeleter
         , alignment(alignment_in)
     {
     }
+    ConcreteBufferDataDeleter(std::shared_ptr<BufferAllocator> allocator_in, size_t nbytes_in, size_t alignment_in)
+        : alignment(alignment_in)
+        , allocator(std::move(allocator_in))
+        , nbytes(nbytes_in)
+    {
+    }
 
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
     void operator()(int8_t * p) const
     {
-        if (!remover)
+        if (remover)
         {
-            remover_type::deallocate_memory(p, alignment);
+            (*remover)(p, alignment);
+        }
+        else if (allocator)
+        {
+            allocator->deallocate(p, nbytes);
         }
         else
         {
-            (*remover)(p, alignment);
+            remover_type::deallocate_memory(p, alignment);
         }
     }
 
     std::unique_ptr<remover_type> remover{nullptr};
     size_t alignment = 0; // Alignment of the data buffer in bytes. 0 means no alignment.
+    std::shared_ptr<BufferAllocator> allocator{nullptr}; // Owner of the data when there is no remover.
+    size_t nbytes = 0; // Bytes requested from the allocator.
 
 }; /* end struct ConcreteBufferDataDeleter */
 
@@ -162,6 +237,24 @@ public:
     /// Construct an empty ConcreteBuffer with no data and no alignment.
     static std::shared_ptr<ConcreteBuffer> construct() { return construct(0, 0); }
 
+    /**
+     * Map @p nbytes of the file at @p path starting at byte @p offset without
+     * reading it.  Pages are loaded on first touch and the mapping is released
+     * with the last reference to the buffer.
+     *
+     * @param[in] path
+     *      Path of the file to map.
+     * @param[in] offset
+     *      Byte offset of the first mapped byte.  It does not need to be
+     *      page-aligned.
+     * @param[in] nbytes
+     *      Number of bytes to map.  0 maps through the end of the file.
+     * @param[in] mode
+     *      READ_ONLY and COPY_ON_WRITE open the file read-only; SHARED opens
+     *      it read-write.
+     */
+    static std::shared_ptr<ConcreteBuffer> map_file(std::string const & path, size_t offset = 0, size_t nbytes = 0, MapMode mode = MapMode::READ_ONLY);
+
     std::shared_ptr<ConcreteBuffer> clone() const
     {
         std::shared_ptr<ConcreteBuffer> ret = construct(nbytes(), m_alignment);
@@ -256,6 +349,21 @@ public:
 
     size_type alignment() const noexcept { return m_alignment; }
 
+    /// The allocator that the data came from; null for malloc or external data.
+    std::shared_ptr<BufferAllocator> const & allocator() const noexcept { return m_data.get_deleter().allocator; }
+
+    /// True if the data is a file view created by map_file().
+    bool is_mapped() const noexcept
+    {
+        return has_remover() && detail::ConcreteBufferMappedRemover::is_same_type(get_remover());
+    }
+
+    /// False only for a read-only file view, whose pages fault on write.
+    bool is_writable() const noexcept
+    {
+        return !is_mapped() || static_cast<detail::ConcreteBufferMappedRemover const &>(get_remover()).mode != MapMode::READ_ONLY;
+    }
+
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     using unique_ptr_type = std::unique_ptr<int8_t, data_deleter_type>;
 
@@ -271,6 +379,16 @@ private:
             if (alignment > 0)
             {
                 validate_size_alignment(nbytes, alignment, "ConcreteBuffer::allocate");
+            }
+            if (std::shared_ptr<BufferAllocator> const & allocator = BufferAllocator::current())
+            {
+                // The allocator aligns to BufferAllocator::ALIGNMENT, which
+                // covers every valid alignment.
+                ptr = allocator->allocate(nbytes);
+                return unique_ptr_type(static_cast<int8_t *>(ptr), data_deleter_type(allocator, nbytes, alignment));
+            }
+            if (alignment > 0)
+            {
 #ifdef _WIN32
                 ptr = _aligned_malloc(nbytes, alignment); // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
 #else
@@ -13,6 +13,7 @@
  */
 
 #include <solvcon/buffer/ConcreteBuffer.hpp>
+#include <solvcon/buffer/broadcast.hpp>
 #include <solvcon/buffer/matmul.hpp>
 #include <solvcon/buffer/signed_stride_layout.hpp>
 #include <solvcon/math/math.hpp>
@@ -32,6 +33,7 @@
 #include <limits>
 #include <mdspan>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <string>
@@ -108,6 +110,39 @@ inline ssize_t buffer_offset(small_vector<ssize_t> const & stride, small_vector<
     return offset;
 }
 
+/**
+ * Summation algorithm of SimpleArray::sum for contiguous floating-point
+ * arrays. Integer sums are exact modulo the type width and ignore it. C++
+ * callers pass the enum; the Python binding accepts the equivalent lower-case
+ * string.
+ *
+ * @ingroup group_core
+ */
+enum class SumMethod : uint8_t
+{
+    FAST = 0, ///< Vector partial sums; the error grows linearly with the length.
+    PAIRWISE = 1, ///< Pairwise over vector blocks; the error grows with the logarithm.
+    KAHAN = 2, ///< Compensated; the error does not grow with the length.
+}; /* end enum class SumMethod */
+
+inline SumMethod sum_method_from_string(std::string const & method)
+{
+    if (method == "fast")
+    {
+        return SumMethod::FAST;
+    }
+    if (method == "pairwise")
+    {
+        return SumMethod::PAIRWISE;
+    }
+    if (method == "kahan")
+    {
+        return SumMethod::KAHAN;
+    }
+    throw std::invalid_argument(
+        std::format("SimpleArray: sum method '{}' not supported", method));
+}
+
 namespace detail
 {
 
@@ -255,7 +290,7 @@ public:
     using value_type = typename internal_types::value_type;
     using shape_type = typename internal_types::shape_type;
 
-    value_type sum() const
+    value_type sum(SumMethod method = SumMethod::FAST) const
     {
         auto athis = static_cast<A const *>(this);
         const size_t n = athis->size();
@@ -268,7 +303,7 @@ public:
         // once, in C order or F order respectively.
         if (athis->is_c_contiguous() || athis->is_f_contiguous())
         {
-            return sum_contiguous(athis->data(), n);
+            return sum_contiguous(athis->logical_data(), n, method);
         }
         return sum_strided(athis->logical_data(), athis->shape(), athis->stride());
     }
@@ -299,14 +334,35 @@ private:
         }
     }
 
-    static value_type sum_contiguous(value_type const * data, size_t n)
+    static value_type sum_contiguous(value_type const * data, size_t n, SumMethod method)
     {
-        value_type acc = zero();
-        for (size_t i = 0; i < n; ++i)
+        // Boolean "sum" is a logical or, and complex values have no vector
+        // lanes; both keep the scalar loop.
+        if constexpr (std::is_arithmetic_v<value_type> && !std::is_same_v<bool, std::remove_const_t<value_type>>)
         {
-            accumulate(acc, data[i]);
+            using elem_type = std::remove_const_t<value_type>;
+            if constexpr (std::is_floating_point_v<elem_type>)
+            {
+                if (method == SumMethod::PAIRWISE)
+                {
+                    return simd::sum_pairwise<elem_type>(data, data + n);
+                }
+                if (method == SumMethod::KAHAN)
+                {
+                    return simd::sum_kahan<elem_type>(data, data + n);
+                }
+            }
+            return simd::sum<elem_type>(data, data + n);
+        }
+        else
+        {
+            value_type acc = zero();
+            for (size_t i = 0; i < n; ++i)
+            {
+                accumulate(acc, data[i]);
+            }
+            return acc;
         }
-        return acc;
     }
 
     // Walk a strided array by its innermost dimension: compute the row base
@@ -423,6 +479,16 @@ public:
         auto const out_range = IndexRange(result);
         shape_type out_idx = out_range.first();
 
+        // Every output element reduces the same number of values; reuse one
+        // slice instead of growing a new one per element.
+        size_t red_size = 1;
+        for (ssize_t const ax : red_axes)
+        {
+            red_size *= athis->shape(ax);
+        }
+        small_vector<value_type> slice(red_size);
+        shape_type red_idx(red_axes.size());
+
         do
         {
             for (ssize_t i = 0, out_dim = 0; i < ndim; ++i)
@@ -433,16 +499,15 @@ public:
                 }
             }
 
-            small_vector<value_type> slice;
-            shape_type red_idx = red_range.first();
-
+            red_idx = red_range.first();
+            size_t islice = 0;
             do
             {
                 for (size_t k = 0; k < red_axes.size(); ++k)
                 {
                     full_idx[red_axes[k]] = red_idx[k];
                 }
-                slice.push_back(athis->at(full_idx));
+                slice[islice++] = athis->at(full_idx);
 
             } while (red_range.next(red_idx));
 
@@ -625,6 +690,23 @@ public:
                 acc += athis->at(sidx).norm();
             } while (range.next(sidx));
         }
+        else if constexpr (std::is_floating_point_v<value_type>)
+        {
+            // The sum of squares of a dense block is a dot product with itself.
+            if (athis->is_c_contiguous() || athis->is_f_contiguous())
+            {
+                value_type const * ptr = athis->logical_data();
+                acc = simd::dot<value_type>(ptr, ptr + n, ptr);
+            }
+            else
+            {
+                do
+                {
+                    value_type const value = athis->at(sidx);
+                    acc += value * value;
+                } while (range.next(sidx));
+            }
+        }
         else
         {
             do
@@ -664,6 +746,15 @@ public:
     {
         value_type initial = std::numeric_limits<value_type>::max();
         auto athis = static_cast<A const *>(this);
+        if constexpr (std::is_arithmetic_v<value_type>)
+        {
+            if (athis->is_c_contiguous() || athis->is_f_contiguous())
+            {
+                using elem_type = std::remove_const_t<value_type>;
+                value_type const * ptr = athis->logical_data();
+                return simd::min<elem_type>(ptr, ptr + athis->size(), initial);
+            }
+        }
         for (size_t i = 0; i < athis->size(); ++i)
         {
             if (athis->data(i) < initial)
@@ -678,6 +769,15 @@ public:
     {
         value_type initial = std::numeric_limits<value_type>::lowest();
         auto athis = static_cast<A const *>(this);
+        if constexpr (std::is_arithmetic_v<value_type>)
+        {
+            if (athis->is_c_contiguous() || athis->is_f_contiguous())
+            {
+                using elem_type = std::remove_const_t<value_type>;
+                value_type const * ptr = athis->logical_data();
+                return simd::max<elem_type>(ptr, ptr + athis->size(), initial);
+            }
+        }
         for (size_t i = 0; i < athis->size(); ++i)
         {
             if (athis->data(i) > initial)
@@ -702,56 +802,163 @@ public:
         return ret;
     }
 
+    // The arithmetic copies into a named result so that it is returned
+    // without a second copy of the data.  Operands of different shapes are
+    // broadcast like NumPy; the in-place operation does it when the result
+    // keeps the shape of this array.
     A add(A const & other) const
     {
-        validate_same_shape(other, "add");
-        return A(*static_cast<A const *>(this)).iadd(other);
+        auto const * athis = static_cast<A const *>(this);
+        shape_type const shape = broadcast_shape(other, "add");
+        if (shape == athis->shape())
+        {
+            A ret(*athis);
+            ret.iadd(other);
+            return ret;
+        }
+        if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+        {
+            return broadcast_with(other, shape, std::logical_or<>{});
+        }
+        else
+        {
+            return broadcast_with(other, shape, std::plus<>{});
+        }
     }
 
     A add(value_type scalar) const
     {
-        return A(*static_cast<A const *>(this)).iadd(scalar);
+        A ret(*static_cast<A const *>(this));
+        ret.iadd(scalar);
+        return ret;
     }
 
     A sub(A const & other) const
     {
-        validate_same_shape(other, "sub");
-        return A(*static_cast<A const *>(this)).isub(other);
+        auto const * athis = static_cast<A const *>(this);
+        shape_type const shape = broadcast_shape(other, "sub");
+        if (shape == athis->shape())
+        {
+            A ret(*athis);
+            ret.isub(other);
+            return ret;
+        }
+        if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+        {
+            throw std::runtime_error(
+                "SimpleArray<bool>::isub(): boolean value doesn't support this operation");
+        }
+        else
+        {
+            return broadcast_with(other, shape, std::minus<>{});
+        }
     }
 
     A sub(value_type scalar) const
     {
-        return A(*static_cast<A const *>(this)).isub(scalar);
+        A ret(*static_cast<A const *>(this));
+        ret.isub(scalar);
+        return ret;
     }
 
     A mul(A const & other) const
     {
-        validate_same_shape(other, "mul");
-        return A(*static_cast<A const *>(this)).imul(other);
+        auto const * athis = static_cast<A const *>(this);
+        shape_type const shape = broadcast_shape(other, "mul");
+        if (shape == athis->shape())
+        {
+            A ret(*athis);
+            ret.imul(other);
+            return ret;
+        }
+        if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+        {
+            return broadcast_with(other, shape, std::logical_and<>{});
+        }
+        else
+        {
+            return broadcast_with(other, shape, std::multiplies<>{});
+        }
     }
 
     A mul(value_type scalar) const
     {
-        return A(*static_cast<A const *>(this)).imul(scalar);
+        A ret(*static_cast<A const *>(this));
+        ret.imul(scalar);
+        return ret;
     }
 
     A div(A const & other) const
     {
-        validate_same_shape(other, "div");
-        return A(*static_cast<A const *>(this)).idiv(other);
+        auto const * athis = static_cast<A const *>(this);
+        shape_type const shape = broadcast_shape(other, "div");
+        if (shape == athis->shape())
+        {
+            A ret(*athis);
+            ret.idiv(other);
+            return ret;
+        }
+        if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+        {
+            throw std::runtime_error(
+                "SimpleArray<bool>::idiv(): boolean value doesn't support this operation");
+        }
+        else
+        {
+            return broadcast_with(other, shape, std::divides<>{});
+        }
     }
 
     A div(value_type scalar) const
     {
-        return A(*static_cast<A const *>(this)).idiv(scalar);
+        A ret(*static_cast<A const *>(this));
+        ret.idiv(scalar);
+        return ret;
     }
 
 private:
 
     void validate_same_shape(A const & other, char const * op) const;
+    [[noreturn]] void throw_shape_mismatch(A const & other, char const * op) const;
+
+    // Shape that this and other broadcast to; throw std::invalid_argument if
+    // they do not broadcast together.
+    shape_type broadcast_shape(A const & other, char const * op) const;
+    // Throw std::invalid_argument unless other broadcasts to the shape of this.
+    void validate_broadcast_to_self(A const & other, char const * op) const;
+
+    template <typename Op>
+    A broadcast_with(A const & other, shape_type const & shape, Op op) const
+    {
+        A ret(shape);
+        BroadcastPlan::evaluate(ret, *static_cast<A const *>(this), other, op);
+        return ret;
+    }
+
+    // Evaluate this = op(this, other) in place with other broadcast to the
+    // shape of this. An element of other that this overwrites would be read
+    // again for the next rows, so an overlapping other is evaluated from a
+    // copy.
+    template <typename Op>
+    void broadcast_to_self(A const & other, Op op)
+    {
+        auto athis = static_cast<A *>(this);
+        auto const & mine = athis->buffer();
+        auto const & theirs = other.buffer();
+        if (theirs.begin() < mine.end() && mine.begin() < theirs.end())
+        {
+            A const copy(other);
+            BroadcastPlan::evaluate(*athis, *athis, copy, op);
+        }
+        else
+        {
+            BroadcastPlan::evaluate(*athis, *athis, other, op);
+        }
+    }
 
     // Element-wise comparison kernel shared by eq/ne/lt/le/gt/ge. The array
-    // overload requires matching shapes; both produce a bool per element.
+    // overload broadcasts operands of different shapes; both produce a bool
+    // per element.
     template <typename Cmp>
     SimpleArray<bool> compare_with(A const & other, Cmp cmp, char const * op) const;
     template <typename Cmp>
@@ -780,7 +987,19 @@ public:
     A & iadd(A const & other)
     {
         auto athis = static_cast<A *>(this);
-        validate_same_shape(other, "iadd");
+        if (athis->shape() != other.shape())
+        {
+            validate_broadcast_to_self(other, "iadd");
+            if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+            {
+                broadcast_to_self(other, std::logical_or<>{});
+            }
+            else
+            {
+                broadcast_to_self(other, std::plus<>{});
+            }
+            return *athis;
+        }
         if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
         {
             const value_type * const end = athis->end();
@@ -833,7 +1052,15 @@ public:
     A & isub(A const & other)
     {
         auto athis = static_cast<A *>(this);
-        validate_same_shape(other, "isub");
+        if (athis->shape() != other.shape())
+        {
+            validate_broadcast_to_self(other, "isub");
+            if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
+            {
+                broadcast_to_self(other, std::minus<>{});
+                return *athis;
+            }
+        }
         if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
         {
             const value_type * const end = athis->end();
@@ -880,7 +1107,19 @@ public:
     A & imul(A const & other)
     {
         auto athis = static_cast<A *>(this);
-        validate_same_shape(other, "imul");
+        if (athis->shape() != other.shape())
+        {
+            validate_broadcast_to_self(other, "imul");
+            if constexpr (std::is_same_v<bool, std::remove_const_t<value_type>>)
+            {
+                broadcast_to_self(other, std::logical_and<>{});
+            }
+            else
+            {
+                broadcast_to_self(other, std::multiplies<>{});
+            }
+            return *athis;
+        }
         if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
         {
             const value_type * const end = athis->end();
@@ -936,7 +1175,15 @@ public:
     A & idiv(A const & other)
     {
         auto athis = static_cast<A *>(this);
-        validate_same_shape(other, "idiv");
+        if (athis->shape() != other.shape())
+        {
+            validate_broadcast_to_self(other, "idiv");
+            if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
+            {
+                broadcast_to_self(other, std::divides<>{});
+                return *athis;
+            }
+        }
         if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
         {
             const value_type * const end = athis->end();
@@ -2517,11 +2764,44 @@ void detail::SimpleArrayMixinCalculators<A, T>::validate_same_shape(
     auto const * athis = static_cast<A const *>(this);
     if (athis->shape() != other.shape())
     {
-        throw std::invalid_argument(std::format(
-            "SimpleArray::{}(): shape mismatch: this={} other={}",
-            op,
-            format_shape(athis->shape()),
-            format_shape(other.shape())));
+        throw_shape_mismatch(other, op);
+    }
+}
+
+template <typename A, typename T>
+void detail::SimpleArrayMixinCalculators<A, T>::throw_shape_mismatch(
+    A const & other, char const * op) const
+{
+    auto const * athis = static_cast<A const *>(this);
+    throw std::invalid_argument(std::format(
+        "SimpleArray::{}(): shape mismatch: this={} other={}",
+        op,
+        format_shape(athis->shape()),
+        format_shape(other.shape())));
+}
+
+template <typename A, typename T>
+typename detail::SimpleArrayMixinCalculators<A, T>::shape_type
+detail::SimpleArrayMixinCalculators<A, T>::broadcast_shape(
+    A const & other, char const * op) const
+{
+    auto const * athis = static_cast<A const *>(this);
+    std::optional<shape_type> shape = BroadcastPlan::make_shape(athis->shape(), other.shape());
+    if (!shape)
+    {
+        throw_shape_mismatch(other, op);
+    }
+    return std::move(*shape);
+}
+
+template <typename A, typename T>
+void detail::SimpleArrayMixinCalculators<A, T>::validate_broadcast_to_self(
+    A const & other, char const * op) const
+{
+    auto const * athis = static_cast<A const *>(this);
+    if (broadcast_shape(other, op) != athis->shape())
+    {
+        throw_shape_mismatch(other, op);
     }
 }
 
@@ -2531,7 +2811,12 @@ SimpleArray<bool> detail::SimpleArrayMixinCalculators<A, T>::compare_with(
     A const & other, Cmp cmp, char const * op) const
 {
     auto const * athis = static_cast<A const *>(this);
-    validate_same_shape(other, op);
+    if (athis->shape() != other.shape())
+    {
+        SimpleArray<bool> ret(broadcast_shape(other, op));
+        BroadcastPlan::evaluate(ret, *athis, other, cmp);
+        return ret;
+    }
     SimpleArray<bool> ret(athis->shape());
     const value_type * ptr = athis->begin();
     const value_type * const end = athis->end();
@@ -3066,6 +3351,13 @@ size_t detail::SimpleArrayMixinSearch<A, T>::argmin() const
     if (athis->is_c_contiguous())
     {
         value_type const * ptr = athis->logical_data();
+        // Integers have no NaN to report, so the first position holding the
+        // vector extremum is the answer.
+        if constexpr (std::is_integral_v<value_type>)
+        {
+            value_type const * const end = ptr + athis->size();
+            return static_cast<size_t>(std::find(ptr, end, simd::min<value_type>(ptr, end)) - ptr);
+        }
         value_type min_value = ptr[0];
         size_t min_index = 0;
         size_t const size = athis->size();
@@ -3134,6 +3426,12 @@ size_t detail::SimpleArrayMixinSearch<A, T>::argmax() const
     if (athis->is_c_contiguous())
     {
         value_type const * ptr = athis->logical_data();
+        // The same shortcut as argmin().
+        if constexpr (std::is_integral_v<value_type>)
+        {
+            value_type const * const end = ptr + athis->size();
+            return static_cast<size_t>(std::find(ptr, end, simd::max<value_type>(ptr, end)) - ptr);
+        }
         value_type max_value = ptr[0];
         size_t max_index = 0;
         size_t const size = athis->size();
@@ -3414,17 +3712,15 @@ SimpleArray<U> detail::SimpleArrayMixinSearch<A, T>::where(SimpleArray<U> const
 template <IntegralType T>
 T const * detail::check_index_range(SimpleArray<T> const & indices, ssize_t max_idx)
 {
-    T const * src = indices.begin();
-    T const * const end = indices.end();
-    while (src < end)
+    if (max_idx <= 0)
     {
-        if (std::cmp_less(*src, 0) || std::cmp_greater_equal(*src, max_idx))
-        {
-            return src;
-        }
-        ++src;
+        return indices.size() == 0 ? nullptr : indices.begin();
     }
-    return nullptr;
+    // An index type too narrow to reach the end of the axis cannot overflow it.
+    T const last = std::cmp_less(max_idx - 1, std::numeric_limits<T>::max())
+                       ? static_cast<T>(max_idx - 1)
+                       : std::numeric_limits<T>::max();
+    return simd::check_between<T>(indices.begin(), indices.end(), T(0), last);
 }
 /// @endcond
 
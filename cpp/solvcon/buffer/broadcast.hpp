@@ -0,0 +1,252 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/buffer/loop.hpp>
+#include <solvcon/buffer/small_vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace solvcon
+{
+
+namespace detail
+{
+
+/**
+ * @brief Describe an element-wise binary operation with NumPy broadcasting.
+ *
+ * The operand shapes are aligned at the trailing axis, and an operand axis of
+ * extent 1, or an axis the operand lacks, is repeated over the output extent
+ * with a zero stride. The plan drops the axes of extent 1 and coalesces the
+ * adjacent axes that every operand traverses with a uniform stride, so that
+ * the last remaining axis is as long as possible. That axis becomes the inner
+ * loop, and the rest become the LoopDomain walked by a MappedOffsetCursor.
+ *
+ * For `(3,4) + (4,)`, the output, lhs, and rhs strides are `{4,1}`, `{4,1}`,
+ * and `{0,1}`. Nothing coalesces, so the domain is `(3)` and each of the three
+ * inner loops adds four contiguous elements. For `(3,1) + (1,4)`, the inner
+ * loop adds the scalar `lhs[i]` to the contiguous rhs row.
+ */
+class BroadcastPlan
+{
+public:
+    using shape_type = small_vector<ssize_t>;
+
+    enum class Operand : size_t
+    {
+        output = 0,
+        lhs = 1,
+        rhs = 2,
+    }; /* end enum class Operand */
+
+    /// Shape of the broadcast result, or nullopt if the shapes do not
+    /// broadcast together.
+    static std::optional<shape_type> make_shape(shape_type const & lhs, shape_type const & rhs);
+
+    template <typename OutArray, typename Array>
+    static BroadcastPlan make(OutArray const & output, Array const & lhs, Array const & rhs);
+
+    /// Write op(lhs, rhs) to output; output must have the broadcast shape.
+    template <typename OutArray, typename Array, typename Op>
+    static void evaluate(OutArray & output, Array const & lhs, Array const & rhs, Op op);
+
+    LoopDomain const & domain() const noexcept { return m_domain; }
+    ssize_t inner_extent() const noexcept { return m_inner_extent; }
+    ssize_t inner_stride(Operand operand) const noexcept { return m_inner_strides[std::to_underlying(operand)]; }
+    MappedOffsetCursor cursor() const & { return MappedOffsetCursor(m_domain, m_mappings); }
+    MappedOffsetCursor cursor() const && = delete;
+
+    template <typename R, typename T, typename Op>
+    void apply(R * output, T const * lhs, T const * rhs, Op op) const;
+
+private:
+    using mapping_type = MappedOffsetCursor::mapping_type;
+    using stride_type = OperandMapping::stride_type;
+
+    static constexpr size_t NOPERAND = 3;
+
+    BroadcastPlan(shape_type const & shape, std::array<stride_type, NOPERAND> const & strides);
+
+    template <typename Array>
+    static stride_type make_strides(Array const & operand, shape_type const & shape);
+
+    LoopDomain m_domain;
+    mapping_type m_mappings;
+    ssize_t m_inner_extent = 1;
+    std::array<ssize_t, NOPERAND> m_inner_strides = {0, 0, 0};
+}; /* end class BroadcastPlan */
+
+inline std::optional<BroadcastPlan::shape_type> BroadcastPlan::make_shape(shape_type const & lhs, shape_type const & rhs)
+{
+    size_t const rank = std::max(lhs.size(), rhs.size());
+    shape_type shape(rank, 1);
+    for (size_t offset = 0; offset < rank; ++offset)
+    {
+        ssize_t const lhs_extent = offset < lhs.size() ? lhs[lhs.size() - offset - 1] : 1;
+        ssize_t const rhs_extent = offset < rhs.size() ? rhs[rhs.size() - offset - 1] : 1;
+        if (lhs_extent != rhs_extent && lhs_extent != 1 && rhs_extent != 1)
+        {
+            return std::nullopt;
+        }
+        shape[rank - offset - 1] = lhs_extent == 1 ? rhs_extent : lhs_extent;
+    }
+    return shape;
+}
+
+template <typename Array>
+BroadcastPlan::stride_type BroadcastPlan::make_strides(Array const & operand, shape_type const & shape)
+{
+    stride_type strides(shape.size(), 0);
+    size_t const rank = operand.shape().size();
+    size_t const axis_offset = shape.size() - rank;
+    for (size_t axis = 0; axis < rank; ++axis)
+    {
+        if (operand.shape(axis) == shape[axis_offset + axis])
+        {
+            strides[axis_offset + axis] = operand.stride(axis);
+        }
+    }
+    return strides;
+}
+
+template <typename OutArray, typename Array>
+BroadcastPlan BroadcastPlan::make(OutArray const & output, Array const & lhs, Array const & rhs)
+{
+    shape_type const & shape = output.shape();
+    return BroadcastPlan(
+        shape,
+        {make_strides(output, shape), make_strides(lhs, shape), make_strides(rhs, shape)});
+}
+
+inline BroadcastPlan::BroadcastPlan(shape_type const & shape, std::array<stride_type, NOPERAND> const & strides)
+    : m_domain(shape_type{})
+{
+    // Keep the axes that are not of extent 1, and merge each into the kept
+    // axis after it when every operand strides uniformly across both.
+    shape_type extents;
+    std::array<stride_type, NOPERAND> kept;
+    for (size_t axis_plus_one = shape.size(); axis_plus_one > 0; --axis_plus_one)
+    {
+        size_t const axis = axis_plus_one - 1;
+        if (shape[axis] == 1)
+        {
+            continue;
+        }
+        bool mergeable = !extents.empty();
+        for (size_t iop = 0; mergeable && iop < NOPERAND; ++iop)
+        {
+            mergeable = strides[iop][axis] == kept[iop][kept[iop].size() - 1] * extents[extents.size() - 1];
+        }
+        if (mergeable)
+        {
+            extents[extents.size() - 1] *= shape[axis];
+            continue;
+        }
+        extents.push_back(shape[axis]);
+        for (size_t iop = 0; iop < NOPERAND; ++iop)
+        {
+            kept[iop].push_back(strides[iop][axis]);
+        }
+    }
+    // The kept axes are collected backward; the first is the inner loop.
+    if (!extents.empty())
+    {
+        m_inner_extent = extents[0];
+        for (size_t iop = 0; iop < NOPERAND; ++iop)
+        {
+            m_inner_strides[iop] = kept[iop][0];
+        }
+    }
+    size_t const outer_rank = extents.empty() ? 0 : extents.size() - 1;
+    shape_type outer(outer_rank, 0);
+    std::array<stride_type, NOPERAND> outer_strides;
+    for (size_t iop = 0; iop < NOPERAND; ++iop)
+    {
+        outer_strides[iop] = stride_type(outer_rank, 0);
+    }
+    for (size_t axis = 0; axis < outer_rank; ++axis)
+    {
+        outer[axis] = extents[outer_rank - axis];
+        for (size_t iop = 0; iop < NOPERAND; ++iop)
+        {
+            outer_strides[iop][axis] = kept[iop][outer_rank - axis];
+        }
+    }
+    m_domain = LoopDomain(std::move(outer));
+    for (size_t iop = 0; iop < NOPERAND; ++iop)
+    {
+        m_mappings.push_back(OperandMapping(std::move(outer_strides[iop])));
+    }
+}
+
+/**
+ * Run the inner loop at every cursor position.  The inner loop is a plain
+ * unit-stride loop when the output and the array operands are contiguous
+ * along it, and holds a broadcast operand in a scalar, so that the compiler
+ * vectorizes it.  Other layouts take the strided loop.
+ */
+template <typename R, typename T, typename Op>
+void BroadcastPlan::apply(R * output, T const * lhs, T const * rhs, Op op) const
+{
+    ssize_t const n = m_inner_extent;
+    ssize_t const os = inner_stride(Operand::output);
+    ssize_t const ls = inner_stride(Operand::lhs);
+    ssize_t const rs = inner_stride(Operand::rhs);
+    for (MappedOffsetCursor cursor = this->cursor(); cursor; cursor.advance())
+    {
+        R * out = output + cursor.offset(Operand::output);
+        T const * lp = lhs + cursor.offset(Operand::lhs);
+        T const * rp = rhs + cursor.offset(Operand::rhs);
+        if (os == 1 && ls == 1 && rs == 1)
+        {
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                out[i] = op(lp[i], rp[i]);
+            }
+        }
+        else if (os == 1 && ls == 1 && rs == 0)
+        {
+            T const rv = *rp;
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                out[i] = op(lp[i], rv);
+            }
+        }
+        else if (os == 1 && ls == 0 && rs == 1)
+        {
+            T const lv = *lp;
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                out[i] = op(lv, rp[i]);
+            }
+        }
+        else
+        {
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                out[i * os] = op(lp[i * ls], rp[i * rs]);
+            }
+        }
+    }
+}
+
+template <typename OutArray, typename Array, typename Op>
+void BroadcastPlan::evaluate(OutArray & output, Array const & lhs, Array const & rhs, Op op)
+{
+    BroadcastPlan const plan = make(output, lhs, rhs);
+    plan.apply(output.logical_data(), lhs.logical_data(), rhs.logical_data(), op);
+}
+
+} /* end namespace detail */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -10,9 +10,11 @@
  */
 
 #include <solvcon/buffer/small_vector.hpp>
+#include <solvcon/buffer/BufferAllocator.hpp>
 #include <solvcon/buffer/ConcreteBuffer.hpp>
 #include <solvcon/buffer/BufferExpander.hpp>
 #include <solvcon/buffer/SimpleArray.hpp>
+#include <solvcon/buffer/ArrayExpression.hpp>
 #include <solvcon/buffer/SimpleCollector.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/buffer/gemm.hpp>
+
+#include <mutex>
+
+namespace solvcon
+{
+
+namespace
+{
+
+struct MatmulPoolHolder
+{
+    std::mutex mutex;
+    std::shared_ptr<ThreadPool> pool;
+}; /* end struct MatmulPoolHolder */
+
+MatmulPoolHolder & matmul_pool_holder()
+{
+    static MatmulPoolHolder holder;
+    return holder;
+}
+
+} /* end namespace */
+
+size_t matmul_nthread()
+{
+    return detail::matmul_thread_pool()->nthread();
+}
+
+void set_matmul_nthread(size_t nthread)
+{
+    auto pool = ThreadPool::shared(nthread);
+    MatmulPoolHolder & holder = matmul_pool_holder();
+    std::scoped_lock const guard(holder.mutex);
+    holder.pool.swap(pool);
+}
+
+namespace detail
+{
+
+std::shared_ptr<ThreadPool> matmul_thread_pool()
+{
+    MatmulPoolHolder & holder = matmul_pool_holder();
+    std::scoped_lock const guard(holder.mutex);
+    if (!holder.pool)
+    {
+        holder.pool = ThreadPool::shared(ThreadPool::toggle_nthread("buffer.matmul_nthread"));
+    }
+    return holder.pool;
+}
+
+} /* end namespace detail */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,317 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Packed, register-blocked GEMM used by the planned matmul when BLAS does not
+ * take the contraction.
+ */
+
+#include <solvcon/base.hpp>
+#include <solvcon/math/Complex.hpp>
+#include <solvcon/parallel/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace solvcon
+{
+
+/// Number of threads the planned matmul uses for its native GEMM and for
+/// batches of small products, and the LU factorizations use for their
+/// trailing updates and batches.  The default comes from the toggle
+/// "buffer.matmul_nthread" (1); 0 means ThreadPool::hardware_nthread().
+size_t matmul_nthread();
+void set_matmul_nthread(size_t nthread);
+
+namespace detail
+{
+
+/// Shared pool of matmul_nthread() threads.  Holding the returned pointer
+/// keeps the pool alive across a set_matmul_nthread() call.
+std::shared_ptr<ThreadPool> matmul_thread_pool();
+
+template <typename T>
+inline constexpr bool can_matmul_native_v = std::is_same_v<T, float> ||
+                                            std::is_same_v<T, double> ||
+                                            std::is_same_v<T, Complex<float>> ||
+                                            std::is_same_v<T, Complex<double>> ||
+                                            std::is_same_v<T, int32_t> ||
+                                            std::is_same_v<T, int64_t>;
+
+/**
+ * Register and cache blocking of the native GEMM.
+ *
+ * The MR-by-NR accumulator tile spans 32 bytes per row so that the compiler
+ * keeps it in vector registers; the lhs block of MC-by-KC and the rhs sliver
+ * of KC-by-NR stay in L2 and L1 while the microkernel sweeps them.
+ */
+template <typename T>
+struct GemmBlocking
+{
+    static constexpr ssize_t MR = 4;
+    static constexpr ssize_t NR = std::max<ssize_t>(2, 32 / static_cast<ssize_t>(sizeof(T)));
+    static constexpr ssize_t KC = 256;
+    static constexpr ssize_t MC = 64;
+    static constexpr ssize_t NC = 512;
+}; /* end struct GemmBlocking */
+
+/**
+ * Strided, non-owning view of a GEMM operand.  Any signed element strides are
+ * accepted because the operand is always packed before the microkernel reads
+ * it.
+ */
+template <typename T>
+struct GemmOperand
+{
+    T const * m_data;
+    ssize_t m_row_stride;
+    ssize_t m_column_stride;
+
+    T const & operator()(ssize_t row, ssize_t column) const
+    {
+        return m_data[row * m_row_stride + column * m_column_stride];
+    }
+}; /* end struct GemmOperand */
+
+/// Packing buffers reused by consecutive GEMM calls on one thread.
+template <typename T>
+class GemmWorkspace
+{
+
+public:
+
+    T * lhs(size_t size) { return grow(m_lhs, size); }
+    T * rhs(size_t size) { return grow(m_rhs, size); }
+
+private:
+
+    static T * grow(std::vector<T> & buffer, size_t size)
+    {
+        if (buffer.size() < size)
+        {
+            buffer.resize(size);
+        }
+        return buffer.data();
+    }
+
+    std::vector<T> m_lhs;
+    std::vector<T> m_rhs;
+
+}; /* end class GemmWorkspace */
+
+/// Pack rows [row, row+mc) and columns [inner, inner+kc) of @p lhs into
+/// MR-row slivers, each stored column by column and padded with zeros.
+template <typename T>
+void gemm_pack_lhs(GemmOperand<T> const & lhs, ssize_t row, ssize_t mc, ssize_t inner, ssize_t kc, T * packed)
+{
+    constexpr ssize_t MR = GemmBlocking<T>::MR;
+    for (ssize_t ir = 0; ir < mc; ir += MR)
+    {
+        ssize_t const mr = std::min(MR, mc - ir);
+        for (ssize_t p = 0; p < kc; ++p)
+        {
+            ssize_t i = 0;
+            for (; i < mr; ++i)
+            {
+                packed[i] = lhs(row + ir + i, inner + p);
+            }
+            for (; i < MR; ++i)
+            {
+                packed[i] = T{};
+            }
+            packed += MR;
+        }
+    }
+}
+
+/// Pack rows [inner, inner+kc) and columns [column, column+nc) of @p rhs into
+/// NR-column slivers, each stored row by row and padded with zeros.
+template <typename T>
+void gemm_pack_rhs(GemmOperand<T> const & rhs, ssize_t inner, ssize_t kc, ssize_t column, ssize_t nc, T * packed)
+{
+    constexpr ssize_t NR = GemmBlocking<T>::NR;
+    for (ssize_t jr = 0; jr < nc; jr += NR)
+    {
+        ssize_t const nr = std::min(NR, nc - jr);
+        for (ssize_t p = 0; p < kc; ++p)
+        {
+            ssize_t j = 0;
+            for (; j < nr; ++j)
+            {
+                packed[j] = rhs(inner + p, column + jr + j);
+            }
+            for (; j < NR; ++j)
+            {
+                packed[j] = T{};
+            }
+            packed += NR;
+        }
+    }
+}
+
+/**
+ * Multiply an MR-row lhs sliver by an NR-column rhs sliver of depth @p kc
+ * and store (or add, when @p accumulate) the leading mr-by-nr corner of the
+ * product into @p output.
+ */
+template <typename T>
+void gemm_microkernel(
+    ssize_t kc, T const * lhs, T const * rhs, T * output, ssize_t output_stride, ssize_t mr, ssize_t nr, bool accumulate)
+{
+    constexpr ssize_t MR = GemmBlocking<T>::MR;
+    constexpr ssize_t NR = GemmBlocking<T>::NR;
+    T acc[MR][NR] = {};
+    for (ssize_t p = 0; p < kc; ++p)
+    {
+        for (ssize_t i = 0; i < MR; ++i)
+        {
+            T const a = lhs[i];
+            for (ssize_t j = 0; j < NR; ++j)
+            {
+                acc[i][j] += a * rhs[j];
+            }
+        }
+        lhs += MR;
+        rhs += NR;
+    }
+    for (ssize_t i = 0; i < mr; ++i)
+    {
+        T * row = output + i * output_stride;
+        for (ssize_t j = 0; j < nr; ++j)
+        {
+            row[j] = accumulate ? row[j] + acc[i][j] : acc[i][j];
+        }
+    }
+}
+
+/**
+ * Compute the output block of rows [row, row+mc) and columns
+ * [column, column+nc) over the full inner dimension.
+ */
+template <typename T>
+void gemm_block(
+    ssize_t k,
+    GemmOperand<T> const & lhs,
+    GemmOperand<T> const & rhs,
+    T * output,
+    ssize_t output_stride,
+    ssize_t row,
+    ssize_t mc,
+    ssize_t column,
+    ssize_t nc,
+    GemmWorkspace<T> & workspace)
+{
+    using blocking = GemmBlocking<T>;
+    constexpr ssize_t MR = blocking::MR;
+    constexpr ssize_t NR = blocking::NR;
+    constexpr ssize_t KC = blocking::KC;
+
+    ssize_t const mc_padded = (mc + MR - 1) / MR * MR;
+    ssize_t const nc_padded = (nc + NR - 1) / NR * NR;
+    T * const packed_lhs = workspace.lhs(static_cast<size_t>(mc_padded * std::min(k, KC)));
+    T * const packed_rhs = workspace.rhs(static_cast<size_t>(nc_padded * std::min(k, KC)));
+    for (ssize_t inner = 0; inner < k; inner += KC)
+    {
+        ssize_t const kc = std::min(KC, k - inner);
+        gemm_pack_rhs(rhs, inner, kc, column, nc, packed_rhs);
+        gemm_pack_lhs(lhs, row, mc, inner, kc, packed_lhs);
+        for (ssize_t jr = 0; jr < nc; jr += NR)
+        {
+            T const * const rhs_sliver = packed_rhs + jr * kc;
+            for (ssize_t ir = 0; ir < mc; ir += MR)
+            {
+                gemm_microkernel(
+                    kc,
+                    packed_lhs + ir * kc,
+                    rhs_sliver,
+                    output + (row + ir) * output_stride + column + jr,
+                    output_stride,
+                    std::min(MR, mc - ir),
+                    std::min(NR, nc - jr),
+                    inner != 0);
+            }
+        }
+    }
+}
+
+/**
+ * Row-major C = A B of the m-by-k @p lhs and the k-by-n @p rhs into
+ * @p output with row stride @p output_stride.
+ *
+ * The output is cut into MC-by-NC tiles.  With a @p pool of more than one
+ * thread the tiles are distributed over the threads; every tile is computed
+ * whole by one thread with its own packing buffers, so the result does not
+ * depend on the thread count.
+ */
+template <typename T>
+void gemm_native(
+    ssize_t m,
+    ssize_t n,
+    ssize_t k,
+    GemmOperand<T> const & lhs,
+    GemmOperand<T> const & rhs,
+    T * output,
+    ssize_t output_stride,
+    GemmWorkspace<T> & workspace,
+    ThreadPool * pool = nullptr)
+{
+    using blocking = GemmBlocking<T>;
+    constexpr ssize_t MC = blocking::MC;
+    constexpr ssize_t NC = blocking::NC;
+
+    if (m <= 0 || n <= 0)
+    {
+        return;
+    }
+    if (k <= 0)
+    {
+        for (ssize_t row = 0; row < m; ++row)
+        {
+            std::fill_n(output + row * output_stride, n, T{});
+        }
+        return;
+    }
+
+    ssize_t const nrow_tile = (m + MC - 1) / MC;
+    ssize_t const ncolumn_tile = (n + NC - 1) / NC;
+    auto run_tiles = [&](ssize_t first, ssize_t last, GemmWorkspace<T> & tile_workspace)
+    {
+        for (ssize_t tile = first; tile < last; ++tile)
+        {
+            ssize_t const row = (tile % nrow_tile) * MC;
+            ssize_t const column = (tile / nrow_tile) * NC;
+            gemm_block(
+                k, lhs, rhs, output, output_stride, row, std::min(MC, m - row), column, std::min(NC, n - column), tile_workspace);
+        }
+    };
+
+    ssize_t const ntile = nrow_tile * ncolumn_tile;
+    if (pool == nullptr || pool->nthread() <= 1 || ntile <= 1)
+    {
+        run_tiles(0, ntile, workspace);
+        return;
+    }
+    pool->parallel_for(
+        ssize_t(0),
+        ntile,
+        [&](ssize_t first, ssize_t last)
+        {
+            GemmWorkspace<T> tile_workspace;
+            run_tiles(first, last, tile_workspace);
+        });
+}
+
+} /* end namespace detail */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -5,20 +5,24 @@
  * BSD 3-Clause License, see COPYING
  */
 
+#include <solvcon/buffer/gemm.hpp>
 #include <solvcon/buffer/loop.hpp>
 #include <solvcon/buffer/small_vector.hpp>
 #include <solvcon/math/math.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <format>
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace solvcon
 {
@@ -80,6 +84,7 @@ public:
     bool lhs_has_zero_batch_stride() const noexcept { return m_batch.m_lhs_has_zero_stride; }
     bool rhs_has_zero_batch_stride() const noexcept { return m_batch.m_rhs_has_zero_stride; }
     bool has_batch_axes() const noexcept { return m_batch.m_domain.rank() != 0; }
+    size_t batch_size() const noexcept { return m_batch.m_domain.size(); }
     MappedOffsetCursor batch_cursor() const & { return MappedOffsetCursor(m_batch.m_domain, m_batch.m_mappings); }
     MappedOffsetCursor batch_cursor() const && = delete;
 
@@ -165,6 +170,14 @@ private:
  * evaluates one `(3,4) @ (4,6)` contraction at each offset. The results are
  * written into the allocated `(2,5,3,6)` output.
  *
+ * A matrix-matrix contraction that BLAS does not take (integer types, builds
+ * without CBLAS, or layouts BLAS cannot describe) goes to the packed,
+ * register-blocked gemm_native() when it is large enough, and to the generic
+ * loop otherwise. With matmul_nthread() above one, a batch of at least as
+ * many contractions as threads is split over the threads in cursor order;
+ * a smaller batch runs serially and lets gemm_native() split the output
+ * tiles of each contraction instead.
+ *
  * @note This implementation provides generic signed-stride routes, direct
  * BLAS routes, and pack-once GEMM for reused matrix operands. Batched-vector
  * tuning remains follow-up work. Pack-once applies when shape broadcasting
@@ -189,6 +202,7 @@ private:
     using value_type = typename Array::value_type;
     using matrix_view_type = BlasMatrixView<value_type>;
     using vector_view_type = BlasVectorView<value_type>;
+    using workspace_type = GemmWorkspace<value_type>;
 
     enum class MappingSlot : std::uint8_t
     {
@@ -210,12 +224,18 @@ private:
     static constexpr ssize_t BLAS_GEMV_MIN_DIMENSION = 32;
     static constexpr ssize_t BLAS_GEMM_MIN_DIMENSION = 8;
     static constexpr ssize_t BLAS_GEMM_PACK_MIN_DIMENSION = 16;
+    // Below this many multiply-adds the generic loop beats packing.
+    static constexpr ssize_t NATIVE_GEMM_MIN_WORK = 512;
+    // Below this many multiply-adds in total threads cost more than they save.
+    static constexpr size_t PARALLEL_MIN_WORK = 1 << 16;
 
     PackingState select_packing() const;
     void pack(PackingState const & packing);
     void execute_contractions();
-    void execute_at(ssize_t output_base, ssize_t lhs_base, ssize_t rhs_base);
+    std::shared_ptr<ThreadPool> select_pool() const;
+    void execute_at(ssize_t output_base, ssize_t lhs_base, ssize_t rhs_base, workspace_type & workspace, ThreadPool * pool);
     bool try_execute_blas(ssize_t output_base, ssize_t lhs_base, ssize_t rhs_base);
+    bool try_execute_native(ssize_t output_base, ssize_t lhs_base, ssize_t rhs_base, workspace_type & workspace, ThreadPool * pool);
     bool try_dot(value_type * output, value_type const * lhs_data, value_type const * rhs_data);
     bool try_gevm(value_type * output, value_type const * lhs_data, value_type const * rhs_data);
     bool try_gemv(value_type * output, value_type const * lhs_data, value_type const * rhs_data);
@@ -238,6 +258,7 @@ private:
     value_type * m_output_data;
     value_type const * m_lhs_data;
     value_type const * m_rhs_data;
+    workspace_type m_workspace;
 }; /* end class MatmulExecutor */
 
 inline MatmulPlan::MatmulPlan(
@@ -563,28 +584,86 @@ void MatmulExecutor<Array>::pack(PackingState const & packing)
 template <typename Array>
 void MatmulExecutor<Array>::execute_contractions()
 {
+    std::shared_ptr<ThreadPool> const pool = select_pool();
     if (!m_plan.has_batch_axes())
     {
-        execute_at(0, 0, 0);
+        execute_at(0, 0, 0, m_workspace, pool.get());
+        return;
+    }
+
+    if (!pool || m_plan.batch_size() < pool->nthread())
+    {
+        for (MappedOffsetCursor cursor = m_plan.batch_cursor(); cursor; cursor.advance())
+        {
+            execute_at(
+                cursor.offset(MappingSlot::Output),
+                cursor.offset(MappingSlot::Lhs),
+                cursor.offset(MappingSlot::Rhs),
+                m_workspace,
+                pool.get());
+        }
         return;
     }
 
+    // Record the cursor offsets once so that each thread can take a
+    // contiguous run of contractions with its own packing buffers.
+    std::vector<std::array<ssize_t, 3>> offsets;
+    offsets.reserve(m_plan.batch_size());
     for (MappedOffsetCursor cursor = m_plan.batch_cursor(); cursor; cursor.advance())
     {
-        execute_at(
+        offsets.push_back({
             cursor.offset(MappingSlot::Output),
             cursor.offset(MappingSlot::Lhs),
-            cursor.offset(MappingSlot::Rhs));
+            cursor.offset(MappingSlot::Rhs),
+        });
+    }
+    pool->parallel_for(
+        size_t(0),
+        offsets.size(),
+        [&](size_t first, size_t last)
+        {
+            workspace_type workspace;
+            for (size_t index = first; index < last; ++index)
+            {
+                auto const & [output_base, lhs_base, rhs_base] = offsets[index];
+                execute_at(output_base, lhs_base, rhs_base, workspace, nullptr);
+            }
+        });
+}
+
+template <typename Array>
+std::shared_ptr<ThreadPool> MatmulExecutor<Array>::select_pool() const
+{
+    auto const work = static_cast<size_t>(m_plan.rows() * m_plan.columns() * m_plan.inner_size());
+    if (work * m_plan.batch_size() < PARALLEL_MIN_WORK)
+    {
+        return nullptr;
     }
+    std::shared_ptr<ThreadPool> pool = matmul_thread_pool();
+    if (pool->nthread() <= 1)
+    {
+        return nullptr;
+    }
+    return pool;
 }
 
 template <typename Array>
-void MatmulExecutor<Array>::execute_at(ssize_t output_base, ssize_t lhs_base, ssize_t rhs_base)
+void MatmulExecutor<Array>::execute_at(
+    ssize_t output_base,
+    ssize_t lhs_base,
+    ssize_t rhs_base,
+    workspace_type & workspace,
+    ThreadPool * pool)
 {
-    if (!try_execute_blas(output_base, lhs_base, rhs_base))
+    if (try_execute_blas(output_base, lhs_base, rhs_base))
+    {
+        return;
+    }
+    if (try_execute_native(output_base, lhs_base, rhs_base, workspace, pool))
     {
-        execute_generic(output_base, lhs_base, rhs_base);
+        return;
     }
+    execute_generic(output_base, lhs_base, rhs_base);
 }
 
 template <typename Array>
@@ -614,6 +693,40 @@ bool MatmulExecutor<Array>::try_execute_blas(ssize_t output_base, ssize_t lhs_ba
     return false;
 }
 
+template <typename Array>
+bool MatmulExecutor<Array>::try_execute_native(
+    ssize_t output_base,
+    ssize_t lhs_base,
+    ssize_t rhs_base,
+    workspace_type & workspace,
+    ThreadPool * pool)
+{
+    if constexpr (can_matmul_native_v<value_type>)
+    {
+        if (m_plan.lhs_is_vector() || m_plan.rhs_is_vector() ||
+            m_plan.rows() * m_plan.columns() * m_plan.inner_size() < NATIVE_GEMM_MIN_WORK)
+        {
+            return false;
+        }
+        GemmOperand<value_type> const lhs{
+            m_lhs_data + lhs_base, m_plan.lhs_row_stride(), m_plan.lhs_inner_stride()};
+        GemmOperand<value_type> const rhs{
+            m_rhs_data + rhs_base, m_plan.rhs_inner_stride(), m_plan.rhs_column_stride()};
+        gemm_native(
+            m_plan.rows(),
+            m_plan.columns(),
+            m_plan.inner_size(),
+            lhs,
+            rhs,
+            m_output_data + output_base,
+            m_plan.columns(),
+            workspace,
+            pool);
+        return true;
+    }
+    return false;
+}
+
 template <typename Array>
 bool MatmulExecutor<Array>::try_dot(value_type * output, value_type const * lhs_data, value_type const * rhs_data)
 {
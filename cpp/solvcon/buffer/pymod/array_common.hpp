@@ -161,6 +161,17 @@ class ArrayPropertyHelper
 public:
     using shape_type = solvcon::detail::shape_type;
 
+    /// Return the array for writing, or throw if it views a read-only file
+    /// mapping, where a write would fault instead of raising.
+    static SimpleArray<T> & writable(SimpleArray<T> & arr)
+    {
+        if (!arr.buffer().is_writable())
+        {
+            throw pybind11::value_error("SimpleArray: buffer is read-only");
+        }
+        return arr;
+    }
+
     static void broadcast_array_using_ellipsis(SimpleArray<T> & arr_out, pybind11::array const & arr_in)
     {
         auto slices = make_default_slices(arr_out);
@@ -172,6 +183,8 @@ public:
     {
         namespace py = pybind11;
 
+        writable(arr_out);
+
         if (args.size() == 2)
         {
             const py::object & py_key = args[0];
@@ -266,7 +279,8 @@ public:
             format, /* Python struct-style format descriptor */
             array.ndim(), /* Number of dimensions */
             std::vector<pybind11::ssize_t>(array.shape().begin(), array.shape().end()), /* Buffer dimensions */
-            stride /* Strides (in bytes) for each index */
+            stride, /* Strides (in bytes) for each index */
+            !array.buffer().is_writable() /* Read-only file view */
         );
     }
 
@@ -52,14 +52,19 @@ void initialize_buffer(pybind11::module & mod)
         wrap_ConcreteBuffer(mod);
         wrap_SimpleArray(mod);
         wrap_SimpleArrayPlex(mod);
+        wrap_LazyArray(mod);
 
         // Reports the runtime-detected SIMD feature so pytest can verify that
-        // NEON dispatch is active on aarch64. Without this guard, a regression
+        // the NEON or AVX dispatch is active. Without this guard, a regression
         // that silently routes everything to the scalar path would still pass
         // every correctness check. Kept under an underscore-prefixed name
-        // because detect_simd() only meaningfully reflects the dispatched
-        // backend on aarch64 today; on other targets it would mislead users.
+        // because the SSE and AVX levels are reported but have no backend of
+        // their own; they take the scalar path and would mislead users.
         mod.def("_simd_feature", &simd_feature_name);
+
+        // Threads of the native GEMM behind SimpleArray.matmul_planned().
+        mod.def("matmul_nthread", &matmul_nthread);
+        mod.def("set_matmul_nthread", &set_matmul_nthread, pybind11::arg("nthread"));
     };
 
     OneTimeInitializer<buffer_pymod_tag>::me()(mod, initialize_impl);
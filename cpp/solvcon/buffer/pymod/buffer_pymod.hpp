@@ -20,6 +20,7 @@ void initialize_buffer(pybind11::module & mod);
 void wrap_ConcreteBuffer(pybind11::module & mod);
 void wrap_SimpleArray(pybind11::module & mod);
 void wrap_SimpleArrayPlex(pybind11::module & mod);
+void wrap_LazyArray(pybind11::module & mod);
 
 } /* end namespace python */
 
@@ -43,9 +43,20 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
                 }),
             py::arg("array"),
             py::arg("alignment") = 0)
+        .def_static(
+            "map_file",
+            [](std::string const & path, size_t offset, size_t nbytes, std::string const & mode)
+            { return wrapped_type::map_file(path, offset, nbytes, map_mode_from_string(mode)); },
+            py::arg("path"),
+            py::arg("offset") = 0,
+            py::arg("nbytes") = 0,
+            py::arg("mode") = "r")
         .def_timed("clone", &wrapped_type::clone)
         .def_property_readonly("nbytes", &wrapped_type::nbytes)
         .def_property_readonly("alignment", &wrapped_type::alignment)
+        .def_property_readonly("is_mapped", &wrapped_type::is_mapped)
+        .def_property_readonly("is_writable", &wrapped_type::is_writable)
+        .def_property_readonly("allocator", &wrapped_type::allocator)
         .def("__len__", &wrapped_type::size)
         .def(
             "__getitem__",
@@ -54,7 +65,13 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
         .def(
             "__setitem__",
             [](wrapped_type & self, size_t it, int8_t val)
-            { self.at(it) = val; })
+            {
+                if (!self.is_writable())
+                {
+                    throw py::value_error("ConcreteBuffer: buffer is read-only");
+                }
+                self.at(it) = val;
+            })
         .def_buffer(
             [](wrapped_type & self)
             {
@@ -64,7 +81,8 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
                     py::format_descriptor<int8_t>::format(), /* Python struct-style format descriptor */
                     1, /* Number of dimensions */
                     {self.size()}, /* Buffer dimensions */
-                    {1} /* Strides (in bytes) for each index */
+                    {1}, /* Strides (in bytes) for each index */
+                    !self.is_writable() /* Read-only file view */
                 );
             })
         .def_property_readonly(
@@ -72,13 +90,18 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
             [](wrapped_type & self)
             {
                 namespace py = pybind11;
-                return py::array(
+                py::array ret(
                     py::detail::npy_format_descriptor<int8_t>::dtype(), /* Numpy dtype */
                     {self.size()}, /* Buffer dimensions */
                     {1}, /* Strides (in bytes) for each index */
                     self.data(), /* Pointer to buffer */
                     py::cast(self.shared_from_this()) /* Owning Python object */
                 );
+                if (!self.is_writable())
+                {
+                    ret.attr("flags").attr("writeable") = false;
+                }
+                return ret;
             })
         .def_property_readonly(
             "is_from_python",
@@ -139,10 +162,114 @@ WrapBufferExpander::WrapBufferExpander(pybind11::module & mod, char const * pyna
         ;
 }
 
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapBufferAllocator
+    : public WrapBase<WrapBufferAllocator, BufferAllocator, std::shared_ptr<BufferAllocator>>
+{
+
+    friend root_base_type;
+
+    WrapBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapBufferAllocator */
+
+WrapBufferAllocator::WrapBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : root_base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def_property_readonly("nlive", &wrapped_type::nlive)
+        .def_property_readonly("nreuse", &wrapped_type::nreuse)
+        .def_property_readonly("nsystem", &wrapped_type::nsystem)
+        .def_property_readonly_static(
+            "current",
+            [](py::object const &)
+            { return wrapped_type::current(); })
+        // Make the allocator current on this thread in a with statement.
+        .def(
+            "__enter__",
+            [](std::shared_ptr<wrapped_type> const & self)
+            {
+                BufferAllocatorScope::push(self);
+                return self;
+            })
+        .def(
+            "__exit__",
+            [](wrapped_type const &, py::object const &, py::object const &, py::object const &)
+            { BufferAllocatorScope::pop(); })
+        //
+        ;
+}
+
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapPoolBufferAllocator
+    : public WrapBase<WrapPoolBufferAllocator, PoolBufferAllocator, std::shared_ptr<PoolBufferAllocator>, BufferAllocator>
+{
+
+    friend root_base_type;
+
+    WrapPoolBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapPoolBufferAllocator */
+
+WrapPoolBufferAllocator::WrapPoolBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : root_base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def_timed(
+            py::init(
+                [](size_t max_block, size_t max_cached)
+                { return wrapped_type::construct(max_block, max_cached); }),
+            py::arg("max_block") = size_t(1) << 30,
+            py::arg("max_cached") = size_t(1) << 30)
+        .def_property_readonly("max_block", &wrapped_type::max_block)
+        .def_property_readonly("max_cached", &wrapped_type::max_cached)
+        .def_property_readonly("cached_bytes", &wrapped_type::cached_bytes)
+        .def("size_class", &wrapped_type::size_class, py::arg("nbytes"))
+        .def_timed("release", &wrapped_type::release)
+        //
+        ;
+}
+
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapArenaBufferAllocator
+    : public WrapBase<WrapArenaBufferAllocator, ArenaBufferAllocator, std::shared_ptr<ArenaBufferAllocator>, BufferAllocator>
+{
+
+    friend root_base_type;
+
+    WrapArenaBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapArenaBufferAllocator */
+
+WrapArenaBufferAllocator::WrapArenaBufferAllocator(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : root_base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def_timed(
+            py::init(
+                [](size_t chunk_size)
+                { return wrapped_type::construct(chunk_size); }),
+            py::arg("chunk_size") = size_t(1) << 22)
+        .def_static("thread_instance", &wrapped_type::thread_instance)
+        .def_property_readonly("chunk_size", &wrapped_type::chunk_size)
+        .def_property_readonly("nchunk", &wrapped_type::nchunk)
+        .def_property_readonly("capacity", &wrapped_type::capacity)
+        .def_property_readonly("used", &wrapped_type::used)
+        .def_timed("release", &wrapped_type::release)
+        //
+        ;
+}
+
 void wrap_ConcreteBuffer(pybind11::module & mod)
 {
     WrapConcreteBuffer::commit(mod, "ConcreteBuffer", "ConcreteBuffer");
     WrapBufferExpander::commit(mod, "BufferExpander", "BufferExpander");
+    WrapBufferAllocator::commit(mod, "BufferAllocator", "Source of the data memory of ConcreteBuffer");
+    WrapPoolBufferAllocator::commit(mod, "PoolBufferAllocator", "Size-class pool of buffer memory");
+    WrapArenaBufferAllocator::commit(mod, "ArenaBufferAllocator", "Stack-like arena of buffer memory");
 }
 
 } /* end namespace python */
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+
+#include <solvcon/buffer/pymod/array_common.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace solvcon
+{
+
+namespace python
+{
+
+template <typename T>
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapLazyArray
+    : public WrapBase<WrapLazyArray<T>, LazyArray<T>>
+{
+
+    using root_base_type = WrapBase<WrapLazyArray<T>, LazyArray<T>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+    using wrapper_type = typename root_base_type::wrapper_type;
+    using value_type = typename wrapped_type::value_type;
+    using array_type = SimpleArray<value_type>;
+
+    friend root_base_type;
+
+    WrapLazyArray(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](array_type const & array)
+                    { return wrapped_type(array); }),
+                py::arg("array"))
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.shape().size());
+                    for (size_t i = 0; i < self.shape().size(); ++i)
+                    {
+                        ret[i] = self.shape()[i];
+                    }
+                    return ret;
+                })
+            .def_property_readonly("size", &wrapped_type::size)
+            .def_timed("evaluate", &wrapped_type::evaluate)
+            .def_timed(
+                "evaluate_into",
+                [](wrapped_type const & self, array_type & out)
+                { self.evaluate_into(ArrayPropertyHelper<value_type>::writable(out)); },
+                py::arg("out"))
+            //
+            ;
+
+        def_binary(
+            "eq", "__eq__", [](wrapped_type const & self, auto const & other)
+            { return self.eq(other); });
+        def_binary(
+            "ne", "__ne__", [](wrapped_type const & self, auto const & other)
+            { return self.ne(other); });
+        def_binary(
+            "lt", "__lt__", [](wrapped_type const & self, auto const & other)
+            { return self.lt(other); });
+        def_binary(
+            "le", "__le__", [](wrapped_type const & self, auto const & other)
+            { return self.le(other); });
+        def_binary(
+            "gt", "__gt__", [](wrapped_type const & self, auto const & other)
+            { return self.gt(other); });
+        def_binary(
+            "ge", "__ge__", [](wrapped_type const & self, auto const & other)
+            { return self.ge(other); });
+
+        if constexpr (std::is_same_v<bool, value_type>)
+        {
+            def_where<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float, double>();
+        }
+        else
+        {
+            def_binary(
+                "add", "__add__", [](wrapped_type const & self, auto const & other)
+                { return self.add(other); });
+            def_binary(
+                "sub", "__sub__", [](wrapped_type const & self, auto const & other)
+                { return self.sub(other); });
+            def_binary(
+                "mul", "__mul__", [](wrapped_type const & self, auto const & other)
+                { return self.mul(other); });
+            def_binary(
+                "div", "__truediv__", [](wrapped_type const & self, auto const & other)
+                { return self.div(other); });
+            (*this)
+                .def(
+                    "__radd__",
+                    [](wrapped_type const & self, value_type scalar)
+                    { return self.add(scalar); },
+                    py::is_operator())
+                .def(
+                    "__radd__",
+                    [](wrapped_type const & self, array_type const & other)
+                    { return wrapped_type(other).add(self); },
+                    py::is_operator())
+                .def(
+                    "__rsub__",
+                    [](wrapped_type const & self, value_type scalar)
+                    { return self.rsub(scalar); },
+                    py::is_operator())
+                .def(
+                    "__rsub__",
+                    [](wrapped_type const & self, array_type const & other)
+                    { return wrapped_type(other).sub(self); },
+                    py::is_operator())
+                .def(
+                    "__rmul__",
+                    [](wrapped_type const & self, value_type scalar)
+                    { return self.mul(scalar); },
+                    py::is_operator())
+                .def(
+                    "__rmul__",
+                    [](wrapped_type const & self, array_type const & other)
+                    { return wrapped_type(other).mul(self); },
+                    py::is_operator())
+                .def(
+                    "__rtruediv__",
+                    [](wrapped_type const & self, value_type scalar)
+                    { return self.rdiv(scalar); },
+                    py::is_operator())
+                .def(
+                    "__rtruediv__",
+                    [](wrapped_type const & self, array_type const & other)
+                    { return wrapped_type(other).div(self); },
+                    py::is_operator())
+                .def("neg", &wrapped_type::neg)
+                .def("abs", &wrapped_type::abs)
+                .def("__neg__", &wrapped_type::neg)
+                .def("__abs__", &wrapped_type::abs)
+                //
+                ;
+        }
+    }
+
+    // Each operation takes a lazy array, an array, or a scalar.
+    template <typename F>
+    void def_binary(char const * name, char const * pyop, F const & f)
+    {
+        namespace py = pybind11;
+
+        auto with_lazy = [f](wrapped_type const & self, wrapped_type const & other)
+        { return f(self, other); };
+        auto with_array = [f](wrapped_type const & self, array_type const & other)
+        { return f(self, other); };
+        auto with_scalar = [f](wrapped_type const & self, value_type other)
+        { return f(self, other); };
+        (*this)
+            .def(name, with_lazy, py::arg("other"))
+            .def(name, with_array, py::arg("other"))
+            .def(name, with_scalar, py::arg("other"))
+            .def(pyop, with_lazy, py::is_operator())
+            .def(pyop, with_array, py::is_operator())
+            .def(pyop, with_scalar, py::is_operator());
+    }
+
+    template <typename... U>
+    void def_where()
+    {
+        (def_where_typed<U>(), ...);
+    }
+
+    template <typename U>
+    void def_where_typed()
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                "where",
+                [](wrapped_type const & self, LazyArray<U> const & x, LazyArray<U> const & y)
+                { return self.where(x, y); },
+                py::arg("x"),
+                py::arg("y"))
+            .def(
+                "where",
+                [](wrapped_type const & self, SimpleArray<U> const & x, SimpleArray<U> const & y)
+                { return self.where(LazyArray<U>(x), LazyArray<U>(y)); },
+                py::arg("x"),
+                py::arg("y"));
+    }
+
+}; /* end class WrapLazyArray */
+
+void wrap_LazyArray(pybind11::module & mod)
+{
+    WrapLazyArray<bool>::commit(mod, "LazyArrayBool", "LazyArrayBool");
+    WrapLazyArray<int8_t>::commit(mod, "LazyArrayInt8", "LazyArrayInt8");
+    WrapLazyArray<int16_t>::commit(mod, "LazyArrayInt16", "LazyArrayInt16");
+    WrapLazyArray<int32_t>::commit(mod, "LazyArrayInt32", "LazyArrayInt32");
+    WrapLazyArray<int64_t>::commit(mod, "LazyArrayInt64", "LazyArrayInt64");
+    WrapLazyArray<uint8_t>::commit(mod, "LazyArrayUint8", "LazyArrayUint8");
+    WrapLazyArray<uint16_t>::commit(mod, "LazyArrayUint16", "LazyArrayUint16");
+    WrapLazyArray<uint32_t>::commit(mod, "LazyArrayUint32", "LazyArrayUint32");
+    WrapLazyArray<uint64_t>::commit(mod, "LazyArrayUint64", "LazyArrayUint64");
+    WrapLazyArray<float>::commit(mod, "LazyArrayFloat32", "LazyArrayFloat32");
+    WrapLazyArray<double>::commit(mod, "LazyArrayFloat64", "LazyArrayFloat64");
+}
+
+} /* end namespace python */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
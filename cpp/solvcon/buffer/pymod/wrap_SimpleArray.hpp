@@ -50,6 +50,13 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                     { return wrapped_type(make_shape(shape), alignment, with_alignment_t{}); }),
                 py::arg("shape"),
                 py::arg("alignment"))
+            .def_timed(
+                py::init(
+                    [](py::object const & shape, std::shared_ptr<ConcreteBuffer> const & buffer, size_t offset)
+                    { return wrapped_type(make_shape(shape), buffer, offset); }),
+                py::arg("shape"),
+                py::arg("buffer"),
+                py::arg("offset") = 0)
             .def_timed(
                 py::init(
                     [](py::object const & shape, value_type const & value)
@@ -82,6 +89,10 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
             .def_property_readonly("size", &wrapped_type::size)
             .def_property_readonly("itemsize", &wrapped_type::itemsize)
             .def_property_readonly("alignment", &wrapped_type::alignment)
+            .def_property_readonly(
+                "allocator",
+                [](wrapped_type const & self)
+                { return self.buffer().allocator(); })
             .def_property_readonly(
                 "shape",
                 [](wrapped_type const & self)
@@ -188,7 +199,7 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                 // (see https://github.com/solvcon/solvcon/issues/283)
                 "fill",
                 [](wrapped_type & arr, value_type const value)
-                { arr.fill(value); },
+                { property_helper::writable(arr).fill(value); },
                 py::arg("value"))
             //
             ;
@@ -261,7 +272,11 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                 py::arg("ddof") = 0)
             .def("min", &wrapped_type::min)
             .def("max", &wrapped_type::max)
-            .def("sum", &wrapped_type::sum)
+            .def(
+                "sum",
+                [](wrapped_type const & self, std::string const & method)
+                { return self.sum(sum_method_from_string(method)); },
+                py::arg("method") = "fast")
             .def("abs", &wrapped_type::abs)
             .def(
                 "add",
@@ -337,7 +352,12 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
         // for <, <=, >, >= just as numpy does for a complex ndarray.
         if constexpr (!is_complex_v<value_type>)
         {
+            // Lazy expressions (LazyArray) also cover the real types only.
             (*this)
+                .def(
+                    "lazy",
+                    [](wrapped_type const & self)
+                    { return LazyArray<value_type>(self); })
                 .def(
                     "lt",
                     [](wrapped_type const & self, wrapped_type const & other)
@@ -441,37 +461,37 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
             .def(
                 "iadd",
                 [](wrapped_type & self, wrapped_type const & other)
-                { self.iadd(other); })
+                { property_helper::writable(self).iadd(other); })
             .def(
                 "iadd",
                 [](wrapped_type & self, value_type scalar)
-                { self.iadd(scalar); })
+                { property_helper::writable(self).iadd(scalar); })
             .def(
                 "isub",
                 [](wrapped_type & self, wrapped_type const & other)
-                { self.isub(other); })
+                { property_helper::writable(self).isub(other); })
             .def(
                 "isub",
                 [](wrapped_type & self, value_type scalar)
-                { self.isub(scalar); })
+                { property_helper::writable(self).isub(scalar); })
             .def(
                 "imul",
                 [](wrapped_type & self, wrapped_type const & other)
-                { self.imul(other); })
+                { property_helper::writable(self).imul(other); })
             .def(
                 "imul",
                 [](wrapped_type & self, value_type scalar)
-                { self.imul(scalar); })
+                { property_helper::writable(self).imul(scalar); })
             .def("idiv", [](wrapped_type & self, wrapped_type const & other)
-                 { self.idiv(other); })
+                 { property_helper::writable(self).idiv(other); })
             .def(
                 "idiv",
                 [](wrapped_type & self, value_type scalar)
-                { self.idiv(scalar); })
+                { property_helper::writable(self).idiv(scalar); })
             .def("imatmul", [](wrapped_type & self, wrapped_type const & other)
-                 { self.imatmul(other); })
+                 { property_helper::writable(self).imatmul(other); })
             .def("imatmul_blas", [](wrapped_type & self, wrapped_type const & other)
-                 { self.imatmul_blas(other); })
+                 { property_helper::writable(self).imatmul_blas(other); })
             .def(
                 "imatmul_fast",
                 [](wrapped_type & self,
@@ -479,27 +499,27 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                    ssize_t tile_x,
                    ssize_t tile_y,
                    ssize_t tile_z)
-                { self.imatmul_fast(other, tile_x, tile_y, tile_z); },
+                { property_helper::writable(self).imatmul_fast(other, tile_x, tile_y, tile_z); },
                 py::arg("other"),
                 py::arg("tile_x") = 16,
                 py::arg("tile_y") = 16,
                 py::arg("tile_z") = 16)
             .def("__imatmul__", [](wrapped_type & self, wrapped_type const & other)
                  {
-                     self.imatmul(other);
+                     property_helper::writable(self).imatmul(other);
                      return self; })
             .def("add_simd", &wrapped_type::add_simd)
             .def("sub_simd", &wrapped_type::sub_simd)
             .def("mul_simd", &wrapped_type::mul_simd)
             .def("div_simd", &wrapped_type::div_simd)
             .def("iadd_simd", [](wrapped_type & self, wrapped_type const & other)
-                 { self.iadd_simd(other); })
+                 { property_helper::writable(self).iadd_simd(other); })
             .def("isub_simd", [](wrapped_type & self, wrapped_type const & other)
-                 { self.isub_simd(other); })
+                 { property_helper::writable(self).isub_simd(other); })
             .def("imul_simd", [](wrapped_type & self, wrapped_type const & other)
-                 { self.imul_simd(other); })
+                 { property_helper::writable(self).imul_simd(other); })
             .def("idiv_simd", [](wrapped_type & self, wrapped_type const & other)
-                 { self.idiv_simd(other); })
+                 { property_helper::writable(self).idiv_simd(other); })
             //
             ;
 
@@ -543,7 +563,10 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
         namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
 
         (*this)
-            .def("sort", &wrapped_type::sort)
+            .def(
+                "sort",
+                [](wrapped_type & self)
+                { property_helper::writable(self).sort(); })
             .def(
                 "argsort",
                 [](wrapped_type & self)
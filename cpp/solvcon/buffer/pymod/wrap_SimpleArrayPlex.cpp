@@ -353,7 +353,7 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSimpleArrayPlex : public WrapBase<Wr
                             using value_type = typename std::remove_reference_t<decltype(array[0])>;
                             verify_python_value_datatype(py_value, datatype);
                             const auto value = py_value.cast<value_type>();
-                            array.fill(value);
+                            ArrayPropertyHelper<value_type>::writable(array).fill(value);
                         }); },
                 py::arg("value"))
             //
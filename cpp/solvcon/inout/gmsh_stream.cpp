@@ -0,0 +1,718 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/inout/gmsh_stream.hpp>
+#include <solvcon/inout/inout_util.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace solvcon
+{
+
+namespace inout
+{
+
+namespace detail
+{
+
+namespace
+{
+
+bool is_space(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+[[noreturn]] void throw_end_of_input()
+{
+    throw std::invalid_argument("GmshStream: unexpected end of input");
+}
+
+} /* end namespace */
+
+GmshScanner::GmshScanner(std::istream & input, size_t chunk_size)
+    : m_input(input)
+    , m_buffer(std::max(chunk_size, size_t(1)))
+{
+}
+
+bool GmshScanner::fill(size_t need)
+{
+    while (m_end - m_begin < need)
+    {
+        if (m_eof)
+        {
+            return false;
+        }
+        // Move the unread tail to the front and grow the buffer only when a
+        // single line or request does not fit in it.
+        if (m_begin > 0)
+        {
+            std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+            m_end -= m_begin;
+            m_begin = 0;
+        }
+        if (m_end == m_buffer.size() || need > m_buffer.size())
+        {
+            m_buffer.resize(std::max(m_buffer.size() * 2, need));
+        }
+        size_t const nfree = m_buffer.size() - m_end;
+        m_input.read(m_buffer.data() + m_end, static_cast<std::streamsize>(nfree));
+        size_t const nread = static_cast<size_t>(m_input.gcount());
+        m_end += nread;
+        if (nread < nfree)
+        {
+            m_eof = true;
+        }
+    }
+    return true;
+}
+
+bool GmshScanner::next_line(std::string_view & line)
+{
+    size_t pos = m_begin;
+    for (;;)
+    {
+        auto const * found = static_cast<char const *>(std::memchr(m_buffer.data() + pos, '\n', m_end - pos));
+        if (found != nullptr)
+        {
+            pos = static_cast<size_t>(found - m_buffer.data());
+            break;
+        }
+        size_t const offset = m_end - m_begin;
+        if (!fill(offset + 1))
+        {
+            if (m_begin == m_end)
+            {
+                return false;
+            }
+            // The last line has no terminator.
+            pos = m_end;
+            break;
+        }
+        pos = m_begin + offset;
+    }
+    line = std::string_view(m_buffer.data() + m_begin, pos - m_begin);
+    // Drop the CR of a CRLF terminator and trailing blanks.
+    while (!line.empty() && is_space(line.back()))
+    {
+        line.remove_suffix(1);
+    }
+    m_begin = std::min(pos + 1, m_end);
+    return true;
+}
+
+std::string_view GmshScanner::token()
+{
+    for (;;)
+    {
+        while (m_begin < m_end && is_space(m_buffer[m_begin]))
+        {
+            ++m_begin;
+        }
+        if (m_begin < m_end)
+        {
+            break;
+        }
+        if (!fill(1))
+        {
+            throw_end_of_input();
+        }
+    }
+    size_t pos = m_begin;
+    for (;;)
+    {
+        while (pos < m_end && !is_space(m_buffer[pos]))
+        {
+            ++pos;
+        }
+        if (pos < m_end)
+        {
+            break;
+        }
+        // The token reaches the end of the chunk; read on to complete it.
+        size_t const offset = pos - m_begin;
+        if (!fill(offset + 1))
+        {
+            pos = m_end;
+            break;
+        }
+        pos = m_begin + offset;
+    }
+    std::string_view const ret(m_buffer.data() + m_begin, pos - m_begin);
+    m_begin = pos;
+    return ret;
+}
+
+template <typename T>
+T GmshScanner::number()
+{
+    std::string_view const tok = token();
+    T value{};
+    auto const [ptr, ec] = std::from_chars(tok.data(), tok.data() + tok.size(), value);
+    if (ec != std::errc() || ptr != tok.data() + tok.size())
+    {
+        throw std::invalid_argument(std::format("GmshStream: invalid number '{}'", tok));
+    }
+    return value;
+}
+
+template int32_t GmshScanner::number<int32_t>();
+template int64_t GmshScanner::number<int64_t>();
+template uint64_t GmshScanner::number<uint64_t>();
+template double GmshScanner::number<double>();
+
+void GmshScanner::read(void * dst, size_t nbyte)
+{
+    auto * out = static_cast<char *>(dst);
+    size_t const nbuf = std::min(nbyte, m_end - m_begin);
+    std::memcpy(out, m_buffer.data() + m_begin, nbuf);
+    m_begin += nbuf;
+    out += nbuf;
+    nbyte -= nbuf;
+    if (nbyte == 0)
+    {
+        return;
+    }
+    if (nbyte >= m_buffer.size())
+    {
+        // A block larger than the chunk goes straight to its destination.
+        m_input.read(out, static_cast<std::streamsize>(nbyte));
+        if (static_cast<size_t>(m_input.gcount()) != nbyte)
+        {
+            throw_end_of_input();
+        }
+        return;
+    }
+    if (!fill(nbyte))
+    {
+        throw_end_of_input();
+    }
+    std::memcpy(out, m_buffer.data() + m_begin, nbyte);
+    m_begin += nbyte;
+}
+
+GmshElementShape GmshElementShape::of(int32_t type)
+{
+    GmshElementDef const def = GmshElementDef::by_id(static_cast<uint16_t>(type));
+    if (type <= 0 || def.nnds() == 0)
+    {
+        throw std::invalid_argument(std::format("GmshStream: element type {} not supported", type));
+    }
+    GmshElementShape ret;
+    ret.type = type;
+    ret.ndim = def.ndim();
+    ret.mmtpn = def.mmtpn();
+    ret.nnds = def.nnds();
+    ret.mmcl = def.mmcl();
+    return ret;
+}
+
+} /* end namespace detail */
+
+GmshStream::GmshStream(std::string const & path, size_t chunk_size)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        throw std::runtime_error(std::format("GmshStream: cannot open '{}'", path));
+    }
+    detail::GmshScanner scanner(input, chunk_size);
+    parse(scanner);
+}
+
+GmshStream::GmshStream(std::istream & input, size_t chunk_size)
+{
+    detail::GmshScanner scanner(input, chunk_size);
+    parse(scanner);
+}
+
+void GmshStream::parse(detail::GmshScanner & scanner)
+{
+    bool node_enter = false;
+    bool element_enter = false;
+    std::string_view line;
+    while (scanner.next_line(line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        if (m_version.empty() && line != "$MeshFormat")
+        {
+            throw std::invalid_argument("GmshStream: the input does not start with $MeshFormat");
+        }
+        if (line == "$MeshFormat")
+        {
+            load_meta(scanner);
+        }
+        else if (line == "$Entities" && m_version != "2.2")
+        {
+            load_entities(scanner);
+        }
+        else if (line == "$Nodes")
+        {
+            if (m_version == "2.2")
+            {
+                load_nodes_v2(scanner);
+            }
+            else
+            {
+                load_nodes_v4(scanner);
+            }
+            node_enter = true;
+        }
+        else if (line == "$Elements")
+        {
+            if (!node_enter)
+            {
+                throw std::invalid_argument("GmshStream: $Elements comes before $Nodes");
+            }
+            if (m_version == "2.2")
+            {
+                load_elements_v2(scanner);
+            }
+            else
+            {
+                load_elements_v4(scanner);
+            }
+            element_enter = true;
+        }
+        else if (line.front() == '$')
+        {
+            // $PhysicalNames and the sections solvcon does not use.
+            std::string const name(line.substr(1));
+            skip_section(scanner, name);
+        }
+        else
+        {
+            throw std::invalid_argument(std::format("GmshStream: unexpected line '{}'", line));
+        }
+    }
+
+    if (!(node_enter && element_enter))
+    {
+        throw std::invalid_argument("GmshStream: missing $Nodes or $Elements section");
+    }
+}
+
+void GmshStream::load_meta(detail::GmshScanner & scanner)
+{
+    std::string_view line;
+    if (!scanner.next_line(line))
+    {
+        detail::throw_end_of_input();
+    }
+    // <version> <file-type> <data-size>
+    std::vector<std::string> const tokens = tokenize(std::string(line), ' ');
+    if (tokens.size() < 3)
+    {
+        throw std::invalid_argument(std::format("GmshStream: invalid $MeshFormat line '{}'", line));
+    }
+    m_version = tokens[0];
+    m_binary = tokens[1] != "0";
+    if (m_version != "2.2" && m_version != "4.1")
+    {
+        throw std::invalid_argument(std::format("GmshStream: MSH version {} not supported", m_version));
+    }
+    if (m_binary)
+    {
+        if (m_version != "4.1")
+        {
+            throw std::invalid_argument(std::format("GmshStream: binary MSH version {} not supported", m_version));
+        }
+        if (tokens[2] != std::to_string(sizeof(uint64_t)))
+        {
+            throw std::invalid_argument(std::format("GmshStream: binary MSH data size {} not supported", tokens[2]));
+        }
+        // The integer 1 written in binary tells the byte order.
+        if (scanner.binary<int32_t>() != 1)
+        {
+            throw std::invalid_argument("GmshStream: binary MSH of the other byte order not supported");
+        }
+    }
+    expect_end(scanner, "MeshFormat");
+}
+
+void GmshStream::load_entities(detail::GmshScanner & scanner)
+{
+    std::array<uint64_t, 4> counts{};
+    for (uint64_t & count : counts)
+    {
+        count = get<uint64_t>(scanner);
+    }
+    for (size_t dim = 0; dim < counts.size(); ++dim)
+    {
+        for (uint64_t ient = 0; ient < counts[dim]; ++ient)
+        {
+            int_type const tag = get<int32_t>(scanner);
+            // A point has its coordinates; a curve, surface, or volume has
+            // its bounding box.
+            size_t const ncoord = dim == 0 ? 3 : 6;
+            for (size_t i = 0; i < ncoord; ++i)
+            {
+                get<double>(scanner);
+            }
+            uint64_t const nphysical = get<uint64_t>(scanner);
+            int_type physical = 0;
+            for (uint64_t i = 0; i < nphysical; ++i)
+            {
+                int_type const value = get<int32_t>(scanner);
+                if (i == 0)
+                {
+                    physical = value;
+                }
+            }
+            m_entity_physical[dim][tag] = physical;
+            if (dim > 0)
+            {
+                uint64_t const nbound = get<uint64_t>(scanner);
+                for (uint64_t i = 0; i < nbound; ++i)
+                {
+                    get<int32_t>(scanner);
+                }
+            }
+        }
+    }
+    expect_end(scanner, "Entities");
+}
+
+void GmshStream::load_nodes_v2(detail::GmshScanner & scanner)
+{
+    uint64_t const nnode = scanner.number<uint64_t>();
+    m_nds.remake(small_vector<ssize_t>{static_cast<ssize_t>(nnode), 3}, 0);
+    m_ndmap.assign(nnode + 1, -1);
+    for (uint64_t ind = 0; ind < nnode; ++ind)
+    {
+        add_node_tag(scanner.number<uint64_t>(), static_cast<int_type>(ind));
+        real_type * const crd = &m_nds(ind, 0);
+        crd[0] = scanner.number<double>();
+        crd[1] = scanner.number<double>();
+        crd[2] = scanner.number<double>();
+    }
+    expect_end(scanner, "Nodes");
+}
+
+void GmshStream::load_nodes_v4(detail::GmshScanner & scanner)
+{
+    uint64_t const nblock = get<uint64_t>(scanner);
+    uint64_t const nnode = get<uint64_t>(scanner);
+    get<uint64_t>(scanner); // minimum node tag
+    uint64_t const maxtag = get<uint64_t>(scanner);
+    m_nds.remake(small_vector<ssize_t>{static_cast<ssize_t>(nnode), 3}, 0);
+    m_ndmap.assign(maxtag + 1, -1);
+
+    std::vector<uint64_t> tags;
+    uint64_t ind = 0;
+    for (uint64_t iblock = 0; iblock < nblock; ++iblock)
+    {
+        int32_t const dim = get<int32_t>(scanner);
+        get<int32_t>(scanner); // entity tag
+        int32_t const parametric = get<int32_t>(scanner);
+        uint64_t const count = get<uint64_t>(scanner);
+        if (count > nnode - ind)
+        {
+            throw std::invalid_argument(std::format("GmshStream: more nodes than the declared {}", nnode));
+        }
+        if (count == 0)
+        {
+            continue;
+        }
+
+        tags.resize(count);
+        if (m_binary)
+        {
+            scanner.read(tags.data(), count * sizeof(uint64_t));
+        }
+        else
+        {
+            for (uint64_t & tag : tags)
+            {
+                tag = scanner.number<uint64_t>();
+            }
+        }
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            add_node_tag(tags[i], static_cast<int_type>(ind + i));
+        }
+
+        // A parametric node carries its (u, v, w) on the entity after (x, y, z).
+        size_t const ncoord = 3 + (parametric != 0 ? static_cast<size_t>(dim) : 0);
+        real_type * const crd = &m_nds(ind, 0);
+        if (m_binary && ncoord == 3)
+        {
+            scanner.read(crd, count * 3 * sizeof(real_type));
+        }
+        else
+        {
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                for (size_t j = 0; j < ncoord; ++j)
+                {
+                    real_type const value = get<double>(scanner);
+                    if (j < 3)
+                    {
+                        crd[i * 3 + j] = value;
+                    }
+                }
+            }
+        }
+        ind += count;
+    }
+    if (ind != nnode)
+    {
+        throw std::invalid_argument(std::format("GmshStream: read {} nodes but {} declared", ind, nnode));
+    }
+    expect_end(scanner, "Nodes");
+}
+
+void GmshStream::load_elements_v2(detail::GmshScanner & scanner)
+{
+    uint64_t const nelement = scanner.number<uint64_t>();
+    allocate_elements(nelement);
+
+    detail::GmshElementShape shape;
+    std::vector<uint64_t> tags;
+    for (uint64_t iel = 0; iel < nelement; ++iel)
+    {
+        scanner.number<uint64_t>(); // element tag
+        int32_t const type = scanner.number<int32_t>();
+        if (type != shape.type)
+        {
+            shape = detail::GmshElementShape::of(type);
+            tags.resize(shape.nnds);
+        }
+        int32_t const ntag = scanner.number<int32_t>();
+        int_type grp = 0;
+        int_type geo = 0;
+        for (int32_t i = 0; i < ntag; ++i)
+        {
+            int_type const value = scanner.number<int32_t>();
+            if (i == 0)
+            {
+                grp = value;
+            }
+            else if (i == 1)
+            {
+                geo = value;
+            }
+        }
+        for (uint64_t & tag : tags)
+        {
+            tag = scanner.number<uint64_t>();
+        }
+        set_element(iel, shape, grp, geo, tags.data());
+    }
+    expect_end(scanner, "Elements");
+}
+
+void GmshStream::load_elements_v4(detail::GmshScanner & scanner)
+{
+    uint64_t const nblock = get<uint64_t>(scanner);
+    uint64_t const nelement = get<uint64_t>(scanner);
+    get<uint64_t>(scanner); // minimum element tag
+    get<uint64_t>(scanner); // maximum element tag
+    allocate_elements(nelement);
+
+    // A binary block is read in batches so a large block does not need a
+    // second copy of itself in memory.
+    constexpr size_t batch_nbyte = 1 << 16;
+    std::vector<uint64_t> rows;
+    uint64_t iel = 0;
+    for (uint64_t iblock = 0; iblock < nblock; ++iblock)
+    {
+        int32_t const dim = get<int32_t>(scanner);
+        int_type const geo = get<int32_t>(scanner);
+        int32_t const type = get<int32_t>(scanner);
+        uint64_t const count = get<uint64_t>(scanner);
+        if (count > nelement - iel)
+        {
+            throw std::invalid_argument(std::format("GmshStream: more elements than the declared {}", nelement));
+        }
+
+        detail::GmshElementShape const shape = detail::GmshElementShape::of(type);
+        int_type grp = 0;
+        if (dim >= 0 && static_cast<size_t>(dim) < m_entity_physical.size())
+        {
+            auto const it = m_entity_physical[dim].find(geo);
+            if (it != m_entity_physical[dim].end())
+            {
+                grp = it->second;
+            }
+        }
+
+        // Each element is its tag followed by its node tags.
+        size_t const stride = 1 + shape.nnds;
+        if (m_binary)
+        {
+            size_t const nbatch = std::max(batch_nbyte / (stride * sizeof(uint64_t)), size_t(1));
+            for (uint64_t first = 0; first < count; first += nbatch)
+            {
+                size_t const nrow = std::min(static_cast<size_t>(count - first), nbatch);
+                rows.resize(nrow * stride);
+                scanner.read(rows.data(), rows.size() * sizeof(uint64_t));
+                for (size_t i = 0; i < nrow; ++i)
+                {
+                    set_element(iel + first + i, shape, grp, geo, &rows[i * stride + 1]);
+                }
+            }
+        }
+        else
+        {
+            rows.resize(stride);
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                for (uint64_t & value : rows)
+                {
+                    value = scanner.number<uint64_t>();
+                }
+                set_element(iel + i, shape, grp, geo, &rows[1]);
+            }
+        }
+        iel += count;
+    }
+    if (iel != nelement)
+    {
+        throw std::invalid_argument(std::format("GmshStream: read {} elements but {} declared", iel, nelement));
+    }
+    expect_end(scanner, "Elements");
+}
+
+void GmshStream::skip_section(detail::GmshScanner & scanner, std::string_view name)
+{
+    std::string const end = std::format("$End{}", name);
+    std::string_view line;
+    while (scanner.next_line(line))
+    {
+        if (line == end)
+        {
+            return;
+        }
+    }
+    throw std::invalid_argument(std::format("GmshStream: missing {}", end));
+}
+
+void GmshStream::expect_end(detail::GmshScanner & scanner, std::string_view name)
+{
+    std::string const end = std::format("$End{}", name);
+    std::string_view line;
+    while (scanner.next_line(line))
+    {
+        // Skip the rest of the line holding the last value.
+        if (line.empty())
+        {
+            continue;
+        }
+        if (line == end)
+        {
+            return;
+        }
+        throw std::invalid_argument(std::format("GmshStream: expect {} but got '{}'", end, line));
+    }
+    throw std::invalid_argument(std::format("GmshStream: missing {}", end));
+}
+
+void GmshStream::add_node_tag(size_t tag, int_type index)
+{
+    if (tag >= m_ndmap.size())
+    {
+        m_ndmap.resize(std::max(tag + 1, m_ndmap.size() * 2), -1);
+    }
+    if (m_ndmap[tag] >= 0)
+    {
+        throw std::invalid_argument(std::format("GmshStream: duplicate node tag {}", tag));
+    }
+    m_ndmap[tag] = index;
+}
+
+GmshStream::int_type GmshStream::node_index(size_t tag) const
+{
+    if (tag >= m_ndmap.size() || m_ndmap[tag] < 0)
+    {
+        throw std::invalid_argument(std::format("GmshStream: undefined node tag {}", tag));
+    }
+    return m_ndmap[tag];
+}
+
+void GmshStream::allocate_elements(size_t nelement)
+{
+    auto const nel = static_cast<ssize_t>(nelement);
+    m_eltpn.remake(small_vector<ssize_t>{nel}, 0);
+    m_elnds.remake(small_vector<ssize_t>{nel, StaticMesh::CLMND + 1}, -1);
+    m_eldim.remake(small_vector<ssize_t>{nel}, 0);
+    m_elgrp.remake(small_vector<ssize_t>{nel}, 0);
+    m_elgeo.remake(small_vector<ssize_t>{nel}, 0);
+}
+
+void GmshStream::set_element(
+    size_t iel, detail::GmshElementShape const & shape, int_type grp, int_type geo, uint64_t const * tags)
+{
+    m_eltpn(iel) = shape.mmtpn;
+    m_eldim(iel) = shape.ndim;
+    m_elgrp(iel) = grp;
+    m_elgeo(iel) = geo;
+    // Only the corner nodes of a high-order element make the cell.
+    int_type * const nds = &m_elnds(iel, 0);
+    nds[0] = static_cast<int_type>(shape.mmcl.size());
+    for (size_t i = 0; i < shape.mmcl.size(); ++i)
+    {
+        nds[shape.mmcl[i] + 1] = node_index(tags[i]);
+    }
+}
+
+std::shared_ptr<StaticMesh> GmshStream::to_block() const
+{
+    if (nelement() == 0)
+    {
+        throw std::invalid_argument("GmshStream::to_block: no element to build a mesh from");
+    }
+    // Only the top-dimension elements are cells, as in Gmsh::to_block().
+    int_type const topdim = *std::max_element(m_eldim.begin(), m_eldim.end());
+    auto const ncell = std::count(m_eldim.begin(), m_eldim.end(), topdim);
+
+    std::shared_ptr<StaticMesh> blk = StaticMesh::construct(
+        static_cast<uint8_t>(topdim),
+        static_cast<StaticMesh::uint_type>(nnode()),
+        0,
+        static_cast<StaticMesh::uint_type>(ncell));
+    auto & ndcrd = blk->ndcrd();
+    for (size_t ind = 0; ind < nnode(); ++ind)
+    {
+        for (int_type idm = 0; idm < topdim; ++idm)
+        {
+            ndcrd(ind, idm) = m_nds(ind, idm);
+        }
+    }
+    auto & cltpn = blk->cltpn();
+    auto & clnds = blk->clnds();
+    size_t icl = 0;
+    for (size_t iel = 0; iel < nelement(); ++iel)
+    {
+        if (m_eldim(iel) != topdim)
+        {
+            continue;
+        }
+        cltpn(icl) = m_eltpn(iel);
+        for (int_type j = 0; j <= m_elnds(iel, 0); ++j)
+        {
+            clnds(icl, j) = m_elnds(iel, j);
+        }
+        ++icl;
+    }
+    blk->build_interior(true);
+    blk->build_boundary();
+    blk->build_ghost();
+    return blk;
+}
+
+} /* end namespace inout */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,203 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Streaming reader for Gmsh MSH 2.2 and 4.1 mesh files, ASCII or binary.
+ *
+ * @ingroup group_inout
+ */
+
+#include <solvcon/base.hpp>
+#include <solvcon/buffer/buffer.hpp>
+#include <solvcon/mesh/mesh.hpp>
+#include <solvcon/inout/gmsh.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace solvcon
+{
+
+namespace inout
+{
+
+namespace detail
+{
+
+/**
+ * Pull-style scanner over an input stream read in fixed-size chunks.
+ *
+ * Only the current chunk (and the unread tail of the previous one) is held in
+ * memory.  A line or number token that straddles two chunks is completed by
+ * the next read; a line longer than the chunk grows the buffer.
+ */
+class GmshScanner
+{
+
+public:
+
+    GmshScanner(std::istream & input, size_t chunk_size);
+
+    /// Get the next line without the line terminator.  The view is valid
+    /// until the next call.  Return false at the end of the input.
+    bool next_line(std::string_view & line);
+
+    /// Parse the next whitespace-delimited token with std::from_chars.
+    template <typename T>
+    T number();
+
+    /// Copy the next @p nbyte raw bytes to @p dst.
+    void read(void * dst, size_t nbyte);
+
+    template <typename T>
+    T binary()
+    {
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+private:
+
+    /// Make at least @p need bytes available after m_begin.  Return false
+    /// when the input ends first.
+    bool fill(size_t need);
+    std::string_view token();
+
+    std::istream & m_input;
+    std::vector<char> m_buffer;
+    size_t m_begin = 0;
+    size_t m_end = 0;
+    bool m_eof = false;
+
+}; /* end class GmshScanner */
+
+/// Copyable summary of a GmshElementDef, looked up once per element type.
+struct GmshElementShape
+{
+    static GmshElementShape of(int32_t type);
+
+    int32_t type = 0;
+    int32_t ndim = 0;
+    int32_t mmtpn = 0;
+    size_t nnds = 0;
+    small_vector<uint8_t> mmcl;
+}; /* end struct GmshElementShape */
+
+} /* end namespace detail */
+
+/**
+ * Reader that streams a Gmsh MSH file into a solvcon StaticMesh.
+ *
+ * Unlike Gmsh, which takes the whole file contents as a string and tokenizes
+ * it line by line, GmshStream pulls the input in fixed-size chunks from a file
+ * path or any std::istream, parses numbers with std::from_chars, and writes
+ * the node coordinates and element tables straight into their arrays.  It
+ * reads the MSH 2.2 ASCII format and the MSH 4.1 ASCII and binary formats.
+ * For 4.1 the physical group of an element comes from the $Entities section.
+ * Node tags need not be contiguous; nodes are numbered in file order.
+ *
+ * Like Gmsh::to_block(), to_block() takes the top-dimension elements as cells.
+ *
+ * @ingroup group_inout
+ */
+class GmshStream
+    : public NumberBase<int32_t, double>
+{
+
+public:
+
+    using number_base = NumberBase<int32_t, double>;
+    using int_type = typename number_base::int_type;
+    using uint_type = typename number_base::uint_type;
+    using real_type = typename number_base::real_type;
+
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+    explicit GmshStream(std::string const & path, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+    explicit GmshStream(std::istream & input, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    ~GmshStream() = default;
+
+    GmshStream() = delete;
+    GmshStream(GmshStream const & other) = delete;
+    GmshStream(GmshStream && other) = delete;
+    GmshStream & operator=(GmshStream const & other) = delete;
+    GmshStream & operator=(GmshStream && other) = delete;
+
+    std::string const & version() const { return m_version; }
+    bool is_binary() const { return m_binary; }
+    size_t nnode() const { return static_cast<size_t>(m_nds.shape(0)); }
+    size_t nelement() const { return m_eltpn.size(); }
+
+    /// Node coordinates of shape (nnode, 3).
+    SimpleArray<real_type> const & nds() const { return m_nds; }
+    /// solvcon cell type of each element.
+    SimpleArray<int_type> const & eltpn() const { return m_eltpn; }
+    /// Element nodes of shape (nelement, CLMND+1) in the StaticMesh::clnds layout.
+    SimpleArray<int_type> const & elnds() const { return m_elnds; }
+    SimpleArray<int_type> const & eldim() const { return m_eldim; }
+    SimpleArray<int_type> const & elgrp() const { return m_elgrp; }
+    SimpleArray<int_type> const & elgeo() const { return m_elgeo; }
+
+    std::shared_ptr<StaticMesh> to_block() const;
+
+private:
+
+    void parse(detail::GmshScanner & scanner);
+    void load_meta(detail::GmshScanner & scanner);
+    void load_entities(detail::GmshScanner & scanner);
+    void load_nodes_v2(detail::GmshScanner & scanner);
+    void load_nodes_v4(detail::GmshScanner & scanner);
+    void load_elements_v2(detail::GmshScanner & scanner);
+    void load_elements_v4(detail::GmshScanner & scanner);
+    static void skip_section(detail::GmshScanner & scanner, std::string_view name);
+    static void expect_end(detail::GmshScanner & scanner, std::string_view name);
+
+    /// Read one value in the file encoding: raw bytes for binary 4.1, a
+    /// text token otherwise.
+    template <typename T>
+    T get(detail::GmshScanner & scanner) const
+    {
+        return m_binary ? scanner.binary<T>() : scanner.number<T>();
+    }
+
+    void add_node_tag(size_t tag, int_type index);
+    int_type node_index(size_t tag) const;
+    void allocate_elements(size_t nelement);
+    void set_element(size_t iel, detail::GmshElementShape const & shape, int_type grp, int_type geo, uint64_t const * tags);
+
+    std::string m_version;
+    bool m_binary = false;
+
+    SimpleArray<real_type> m_nds;
+    std::vector<int_type> m_ndmap; // Gmsh node tag to 0-based node index.
+
+    SimpleArray<int_type> m_eltpn;
+    SimpleArray<int_type> m_elnds;
+    SimpleArray<int_type> m_eldim;
+    SimpleArray<int_type> m_elgrp;
+    SimpleArray<int_type> m_elgeo;
+
+    // First physical tag of each (dimension, entity tag) from $Entities.
+    std::array<std::unordered_map<int_type, int_type>, 4> m_entity_physical;
+
+}; /* end class GmshStream */
+
+} /* end namespace inout */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
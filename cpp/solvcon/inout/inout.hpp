@@ -1,5 +1,7 @@
 #pragma once
 #include <solvcon/inout/gmsh.hpp>
+#include <solvcon/inout/gmsh_stream.hpp>
 #include <solvcon/inout/plot3d.hpp>
+#include <solvcon/inout/snapshot.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -20,7 +20,9 @@ void initialize_inout(pybind11::module & mod)
     auto initialize_impl = [](pybind11::module & mod)
     {
         wrap_Gmsh(mod);
+        wrap_GmshStream(mod);
         wrap_Plot3d(mod);
+        wrap_Snapshot(mod);
     };
 
     OneTimeInitializer<inout_pymod_tag>::me()(mod, initialize_impl);
@@ -0,0 +1,70 @@
+#include <solvcon/inout/pymod/inout_pymod.hpp>
+#include <solvcon/solvcon.hpp>
+
+#include <spanstream>
+
+namespace solvcon
+{
+
+namespace python
+{
+
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapGmshStream
+    : public WrapBase<WrapGmshStream, inout::GmshStream, std::shared_ptr<inout::GmshStream>>
+{
+public:
+
+    using base_type = WrapBase<WrapGmshStream, inout::GmshStream, std::shared_ptr<inout::GmshStream>>;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend root_base_type;
+
+protected:
+
+    WrapGmshStream(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(
+                py::init(
+                    [](std::string const & path, size_t chunk_size)
+                    { return std::make_shared<inout::GmshStream>(path, chunk_size); }),
+                py::arg("path"),
+                py::arg("chunk_size") = inout::GmshStream::DEFAULT_CHUNK_SIZE)
+            .def_static(
+                "from_bytes",
+                [](py::bytes const & data, size_t chunk_size)
+                {
+                    std::string_view const view(data);
+                    std::ispanstream input(std::span<char const>(view.data(), view.size()));
+                    return std::make_shared<inout::GmshStream>(input, chunk_size);
+                },
+                py::arg("data"),
+                py::arg("chunk_size") = inout::GmshStream::DEFAULT_CHUNK_SIZE)
+            .def_property_readonly("version", &wrapped_type::version)
+            .def_property_readonly("is_binary", &wrapped_type::is_binary)
+            .def_property_readonly("nnode", &wrapped_type::nnode)
+            .def_property_readonly("nelement", &wrapped_type::nelement)
+            .def_property_readonly("nds", &wrapped_type::nds)
+            .def_property_readonly("eltpn", &wrapped_type::eltpn)
+            .def_property_readonly("elnds", &wrapped_type::elnds)
+            .def_property_readonly("eldim", &wrapped_type::eldim)
+            .def_property_readonly("elgrp", &wrapped_type::elgrp)
+            .def_property_readonly("elgeo", &wrapped_type::elgeo)
+            .def_timed("to_block", &wrapped_type::to_block);
+    }
+
+}; /* end class WrapGmshStream */
+
+void wrap_GmshStream(pybind11::module & mod)
+{
+    WrapGmshStream::commit(mod, "GmshStream", "Streaming Gmsh MSH 2.2/4.1 reader");
+}
+
+} /* end namespace python */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
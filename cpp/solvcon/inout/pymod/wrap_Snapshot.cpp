@@ -0,0 +1,60 @@
+#include <solvcon/inout/pymod/inout_pymod.hpp>
+#include <solvcon/solvcon.hpp>
+
+namespace solvcon
+{
+
+namespace python
+{
+
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapSnapshot
+    : public WrapBase<WrapSnapshot, inout::Snapshot, std::shared_ptr<inout::Snapshot>>
+{
+public:
+
+    using base_type = WrapBase<WrapSnapshot, inout::Snapshot, std::shared_ptr<inout::Snapshot>>;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend root_base_type;
+
+protected:
+
+    WrapSnapshot(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : WrapBase<WrapSnapshot, inout::Snapshot, std::shared_ptr<inout::Snapshot>>(mod, pyname, pydoc)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(py::init(
+                []()
+                { return std::make_shared<inout::Snapshot>(); }))
+            .def_static(
+                "load",
+                [](std::string const & path, bool mapped)
+                { return std::make_shared<inout::Snapshot>(inout::Snapshot::load(path, mapped)); },
+                py::arg("path"),
+                py::arg("mapped") = true)
+            .def_timed("save", &wrapped_type::save, py::arg("path"))
+            .def_property_readonly("names", &wrapped_type::names)
+            .def("__len__", &wrapped_type::size)
+            .def("__contains__", &wrapped_type::has, py::arg("name"))
+            .def_timed("add_mesh", &wrapped_type::add_mesh, py::arg("mesh"))
+            .def_timed("to_mesh", &wrapped_type::to_mesh)
+            .def_timed("add_euler", &wrapped_type::add_euler, py::arg("core"))
+            .def_timed("to_euler", &wrapped_type::to_euler, py::arg("mesh"))
+            //
+            ;
+    }
+
+}; /* end class WrapSnapshot */
+
+void wrap_Snapshot(pybind11::module & mod)
+{
+    WrapSnapshot::commit(mod, "Snapshot", "Snapshot");
+}
+
+} /* end namespace python */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,517 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/inout/snapshot.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace solvcon
+{
+
+namespace inout
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> MAGIC = {'S', 'C', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr size_t HEADER_NBYTES = 64;
+
+size_t align_up(size_t offset)
+{
+    return (offset + Snapshot::ALIGNMENT - 1) / Snapshot::ALIGNMENT * Snapshot::ALIGNMENT;
+}
+
+size_t dtype_itemsize(DataType dtype)
+{
+    switch (dtype)
+    {
+    case DataType::Bool: return sizeof(bool);
+    case DataType::Int8: return sizeof(int8_t);
+    case DataType::Int16: return sizeof(int16_t);
+    case DataType::Int32: return sizeof(int32_t);
+    case DataType::Int64: return sizeof(int64_t);
+    case DataType::Uint8: return sizeof(uint8_t);
+    case DataType::Uint16: return sizeof(uint16_t);
+    case DataType::Uint32: return sizeof(uint32_t);
+    case DataType::Uint64: return sizeof(uint64_t);
+    case DataType::Float32: return sizeof(float);
+    case DataType::Float64: return sizeof(double);
+    case DataType::Complex64: return 2 * sizeof(float);
+    case DataType::Complex128: return 2 * sizeof(double);
+    default: return 0;
+    }
+}
+
+// Append fixed-size values to the byte string of the table of contents.
+class ByteWriter
+{
+
+public:
+
+    template <typename T>
+    void put(T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_bytes.append(reinterpret_cast<char const *>(&value), sizeof(T)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    void put(std::string const & value)
+    {
+        put(static_cast<uint32_t>(value.size()));
+        m_bytes.append(value);
+    }
+
+    std::string const & bytes() const { return m_bytes; }
+
+private:
+
+    std::string m_bytes;
+
+}; /* end class ByteWriter */
+
+// Read back what ByteWriter wrote, failing on a truncated table.
+class ByteReader
+{
+
+public:
+
+    explicit ByteReader(std::string const & bytes)
+        : m_bytes(bytes)
+    {
+    }
+
+    template <typename T>
+    T get()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, m_bytes.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string get_string()
+    {
+        auto const size = get<uint32_t>();
+        require(size);
+        std::string value = m_bytes.substr(m_pos, size);
+        m_pos += size;
+        return value;
+    }
+
+private:
+
+    void require(size_t nbytes) const
+    {
+        if (m_pos + nbytes > m_bytes.size())
+        {
+            throw std::runtime_error("Snapshot::load: truncated table of contents");
+        }
+    }
+
+    std::string const & m_bytes;
+    size_t m_pos = 0;
+
+}; /* end class ByteReader */
+
+struct Header
+{
+    std::array<char, 8> magic = MAGIC;
+    uint32_t version = Snapshot::VERSION;
+    uint32_t byte_order = BYTE_ORDER_MARK;
+    uint64_t nsection = 0;
+    uint64_t toc_offset = 0;
+    uint64_t toc_nbytes = 0;
+}; /* end struct Header */
+
+static_assert(sizeof(Header) <= HEADER_NBYTES);
+
+// Every array of a StaticMesh in the order they are stored.
+template <typename M, typename F>
+void for_each_mesh_array(M & mesh, F && fn)
+{
+    fn("ndcrd", mesh.ndcrd());
+    fn("fccnd", mesh.fccnd());
+    fn("fcnml", mesh.fcnml());
+    fn("fcara", mesh.fcara());
+    fn("clcnd", mesh.clcnd());
+    fn("clvol", mesh.clvol());
+    fn("fctpn", mesh.fctpn());
+    fn("cltpn", mesh.cltpn());
+    fn("clgrp", mesh.clgrp());
+    fn("fcnds", mesh.fcnds());
+    fn("fccls", mesh.fccls());
+    fn("clnds", mesh.clnds());
+    fn("clfcs", mesh.clfcs());
+    fn("ednds", mesh.ednds());
+    fn("bndfcs", mesh.bndfcs());
+}
+
+// The EulerCore arrays a restart needs.  A substep swaps the current and new
+// solutions before marching, so the latest state between calls is in so0n and
+// so1n and both pairs are kept.
+template <typename C, typename F>
+void for_each_euler_array(C & core, F && fn)
+{
+    fn("so0c", core.so0c());
+    fn("so0n", core.so0n());
+    fn("so1c", core.so1c());
+    fn("so1n", core.so1n());
+    fn("cflo", core.cflo());
+    fn("cflc", core.cflc());
+    fn("gamma", core.gamma());
+}
+
+template <typename T>
+SimpleArray<T> make_vector(size_t size)
+{
+    return SimpleArray<T>(small_vector<ssize_t>{static_cast<ssize_t>(size)});
+}
+
+} /* end namespace */
+
+std::vector<std::string> Snapshot::names() const
+{
+    std::vector<std::string> ret;
+    ret.reserve(m_sections.size());
+    for (Section const & sec : m_sections)
+    {
+        ret.push_back(sec.name);
+    }
+    return ret;
+}
+
+Snapshot::Section const * Snapshot::find(std::string const & name) const
+{
+    for (Section const & sec : m_sections)
+    {
+        if (sec.name == name)
+        {
+            return &sec;
+        }
+    }
+    return nullptr;
+}
+
+Snapshot::Section const & Snapshot::section(std::string const & name) const
+{
+    Section const * sec = find(name);
+    if (!sec)
+    {
+        throw std::out_of_range(std::format("Snapshot: section '{}' not found", name));
+    }
+    return *sec;
+}
+
+void Snapshot::add_section(Section && section)
+{
+    if (has(section.name))
+    {
+        throw std::invalid_argument(std::format("Snapshot::add: section '{}' already exists", section.name));
+    }
+    m_sections.push_back(std::move(section));
+}
+
+void Snapshot::save(std::string const & path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        throw std::runtime_error(std::format("Snapshot::save: cannot open '{}'", path));
+    }
+
+    std::array<char, ALIGNMENT> const zeros{};
+    auto pad_to = [&](size_t from, size_t to)
+    {
+        out.write(zeros.data(), static_cast<std::streamsize>(to - from));
+    };
+
+    pad_to(0, HEADER_NBYTES);
+    size_t offset = HEADER_NBYTES;
+    ByteWriter toc;
+    for (Section const & sec : m_sections)
+    {
+        size_t const begin = align_up(offset);
+        pad_to(offset, begin);
+        size_t const nbytes = sec.buffer->nbytes();
+        out.write(reinterpret_cast<char const *>(sec.buffer->data()), static_cast<std::streamsize>(nbytes)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        offset = begin + nbytes;
+
+        toc.put(sec.name);
+        toc.put(static_cast<uint8_t>(sec.dtype.type()));
+        toc.put(static_cast<uint8_t>(sec.shape.size()));
+        toc.put(static_cast<int64_t>(sec.nghost));
+        for (ssize_t const n : sec.shape)
+        {
+            toc.put(static_cast<int64_t>(n));
+        }
+        toc.put(static_cast<uint64_t>(begin));
+        toc.put(static_cast<uint64_t>(nbytes));
+    }
+
+    Header header;
+    header.nsection = m_sections.size();
+    header.toc_offset = align_up(offset);
+    header.toc_nbytes = toc.bytes().size();
+    pad_to(offset, header.toc_offset);
+    out.write(toc.bytes().data(), static_cast<std::streamsize>(toc.bytes().size()));
+    out.seekp(0);
+    out.write(reinterpret_cast<char const *>(&header), sizeof(header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error(std::format("Snapshot::save: cannot write '{}'", path));
+    }
+}
+
+Snapshot Snapshot::load(std::string const & path, bool mapped)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        throw std::runtime_error(std::format("Snapshot::load: cannot open '{}'", path));
+    }
+    Header header;
+    in.read(reinterpret_cast<char *>(&header), sizeof(header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!in || header.magic != MAGIC)
+    {
+        throw std::runtime_error(std::format("Snapshot::load: '{}' is not a snapshot", path));
+    }
+    if (header.byte_order != BYTE_ORDER_MARK)
+    {
+        throw std::runtime_error(std::format("Snapshot::load: '{}' has a foreign byte order", path));
+    }
+    if (header.version > VERSION)
+    {
+        throw std::runtime_error(
+            std::format("Snapshot::load: '{}' has version {} newer than {}", path, header.version, VERSION));
+    }
+
+    std::string toc_bytes(header.toc_nbytes, '\0');
+    in.seekg(static_cast<std::streamoff>(header.toc_offset));
+    in.read(toc_bytes.data(), static_cast<std::streamsize>(toc_bytes.size()));
+    if (!in)
+    {
+        throw std::runtime_error(std::format("Snapshot::load: truncated table of contents in '{}'", path));
+    }
+
+    Snapshot ret;
+    ByteReader toc(toc_bytes);
+    for (uint64_t isec = 0; isec < header.nsection; ++isec)
+    {
+        Section sec;
+        sec.name = toc.get_string();
+        sec.dtype = static_cast<DataType::enum_type>(toc.get<uint8_t>());
+        auto const ndim = toc.get<uint8_t>();
+        sec.nghost = static_cast<ssize_t>(toc.get<int64_t>());
+        size_t nelem = 1;
+        for (uint8_t idim = 0; idim < ndim; ++idim)
+        {
+            auto const n = static_cast<ssize_t>(toc.get<int64_t>());
+            sec.shape.push_back(n);
+            nelem *= static_cast<size_t>(n);
+        }
+        auto const offset = static_cast<size_t>(toc.get<uint64_t>());
+        auto const nbytes = static_cast<size_t>(toc.get<uint64_t>());
+        if (dtype_itemsize(sec.dtype) * nelem != nbytes)
+        {
+            throw std::runtime_error(
+                std::format("Snapshot::load: section '{}' has {} bytes not matching its type and shape", sec.name, nbytes));
+        }
+
+        if (nbytes == 0)
+        {
+            sec.buffer = ConcreteBuffer::construct();
+        }
+        else if (mapped)
+        {
+            sec.buffer = ConcreteBuffer::map_file(path, offset, nbytes, MapMode::COPY_ON_WRITE);
+        }
+        else
+        {
+            sec.buffer = ConcreteBuffer::construct(nbytes);
+            in.seekg(static_cast<std::streamoff>(offset));
+            in.read(reinterpret_cast<char *>(sec.buffer->data()), static_cast<std::streamsize>(nbytes)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            if (!in)
+            {
+                throw std::runtime_error(std::format("Snapshot::load: truncated section '{}' in '{}'", sec.name, path));
+            }
+        }
+        ret.add_section(std::move(sec));
+    }
+    return ret;
+}
+
+void Snapshot::add_mesh(StaticMesh const & mesh)
+{
+    auto counts = make_vector<int64_t>(10);
+    counts(0) = mesh.ndim();
+    counts(1) = mesh.nnode();
+    counts(2) = mesh.nface();
+    counts(3) = mesh.ncell();
+    counts(4) = mesh.nbound();
+    counts(5) = mesh.ngstnode();
+    counts(6) = mesh.ngstface();
+    counts(7) = mesh.ngstcell();
+    counts(8) = mesh.use_incenter() ? 1 : 0;
+    counts(9) = static_cast<int64_t>(mesh.nbcs());
+    add("mesh/counts", counts);
+
+    auto add_array = [this](char const * name, auto const & array)
+    {
+        add(std::format("mesh/{}", name), array);
+    };
+    for_each_mesh_array(mesh, add_array);
+
+    for (size_t ibc = 0; ibc < mesh.nbcs(); ++ibc)
+    {
+        StaticMeshBc const & bc = *mesh.bc(ibc);
+        auto name = make_vector<uint8_t>(bc.name().size());
+        std::copy(bc.name().begin(), bc.name().end(), name.begin());
+        add(std::format("mesh/bc{}/name", ibc), name);
+        add(std::format("mesh/bc{}/facn", ibc), bc.facn());
+    }
+}
+
+std::shared_ptr<StaticMesh> Snapshot::to_mesh() const
+{
+    auto const counts = get<int64_t>("mesh/counts");
+    if (counts.size() != 10)
+    {
+        throw std::runtime_error("Snapshot::to_mesh: malformed mesh/counts");
+    }
+    using uint_type = StaticMesh::uint_type;
+    auto mesh = StaticMesh::construct(
+        static_cast<uint8_t>(counts(0)),
+        static_cast<uint_type>(counts(1)),
+        static_cast<uint_type>(counts(2)),
+        static_cast<uint_type>(counts(3)));
+    mesh->m_nbound = static_cast<uint_type>(counts(4));
+    mesh->m_ngstnode = static_cast<uint_type>(counts(5));
+    mesh->m_ngstface = static_cast<uint_type>(counts(6));
+    mesh->m_ngstcell = static_cast<uint_type>(counts(7));
+    mesh->m_use_incenter = counts(8) != 0;
+
+    auto get_array = [this](char const * name, auto & array)
+    {
+        using value_type = typename std::remove_reference_t<decltype(array)>::value_type;
+        array = get<value_type>(std::format("mesh/{}", name));
+    };
+    for_each_mesh_array(*mesh, get_array);
+
+    for (int64_t ibc = 0; ibc < counts(9); ++ibc)
+    {
+        auto const name = get<uint8_t>(std::format("mesh/bc{}/name", ibc));
+        auto bc = std::make_shared<StaticMeshBc>();
+        bc->set_name(std::string(name.begin(), name.end()));
+        bc->facn() = get<StaticMeshBc::int_type>(std::format("mesh/bc{}/facn", ibc));
+        mesh->m_bcs.push_back(std::move(bc));
+    }
+    return mesh;
+}
+
+void Snapshot::add_euler(EulerCore const & core)
+{
+    auto params = make_vector<double>(4);
+    params(0) = core.time_increment();
+    params(1) = core.sigma0();
+    params(2) = core.taumin();
+    params(3) = core.tauscale();
+    add("euler/params", params);
+
+    auto counts = make_vector<int64_t>(3);
+    counts(0) = core.ncell();
+    counts(1) = core.ngstcell();
+    counts(2) = static_cast<int64_t>(core.boundaries().size());
+    add("euler/counts", counts);
+
+    auto add_array = [this](char const * name, auto const & array)
+    {
+        add(std::format("euler/{}", name), array);
+    };
+    for_each_euler_array(core, add_array);
+
+    for (size_t ibc = 0; ibc < core.boundaries().size(); ++ibc)
+    {
+        EulerBoundary const & bnd = core.boundaries()[ibc];
+        auto kind = make_vector<int32_t>(1);
+        kind(0) = static_cast<int32_t>(bnd.kind);
+        auto faces = make_vector<int32_t>(bnd.faces.size());
+        for (size_t i = 0; i < bnd.faces.size(); ++i)
+        {
+            faces(i) = bnd.faces[i];
+        }
+        auto value = make_vector<double>(bnd.value.size());
+        for (size_t i = 0; i < bnd.value.size(); ++i)
+        {
+            value(i) = bnd.value[i];
+        }
+        add(std::format("euler/bc{}/kind", ibc), kind);
+        add(std::format("euler/bc{}/faces", ibc), faces);
+        add(std::format("euler/bc{}/value", ibc), value);
+    }
+}
+
+std::shared_ptr<EulerCore> Snapshot::to_euler(std::shared_ptr<StaticMesh> const & mesh) const
+{
+    auto const params = get<double>("euler/params");
+    auto const counts = get<int64_t>("euler/counts");
+    if (params.size() != 4 || counts.size() != 3)
+    {
+        throw std::runtime_error("Snapshot::to_euler: malformed euler/params or euler/counts");
+    }
+    if (counts(0) != static_cast<int64_t>(mesh->ncell()) || counts(1) != static_cast<int64_t>(mesh->ngstcell()))
+    {
+        throw std::invalid_argument(
+            std::format("Snapshot::to_euler: mesh has {} cells and {} ghost cells but the solver has {} and {}",
+                        mesh->ncell(),
+                        mesh->ngstcell(),
+                        counts(0),
+                        counts(1)));
+    }
+
+    auto core = EulerCore::construct(mesh, params(0));
+    core->set_sigma0(params(1));
+    core->set_taumin(params(2));
+    core->set_tauscale(params(3));
+
+    // The solver owns its arrays, so the saved state is copied in.
+    auto copy_array = [this](char const * name, auto & array)
+    {
+        using value_type = typename std::remove_reference_t<decltype(array)>::value_type;
+        auto const saved = get<value_type>(std::format("euler/{}", name));
+        if (saved.shape() != array.shape())
+        {
+            throw std::runtime_error(std::format("Snapshot::to_euler: euler/{} has a different shape", name));
+        }
+        std::copy_n(saved.data(), saved.size(), array.data());
+    };
+    for_each_euler_array(*core, copy_array);
+
+    for (int64_t ibc = 0; ibc < counts(2); ++ibc)
+    {
+        auto const kind = get<int32_t>(std::format("euler/bc{}/kind", ibc));
+        auto const faces = get<int32_t>(std::format("euler/bc{}/faces", ibc));
+        auto const value = get<double>(std::format("euler/bc{}/value", ibc));
+        core->add_bc(
+            static_cast<EulerBC>(kind(0)),
+            std::vector<int32_t>(faces.begin(), faces.end()),
+            std::vector<double>(value.begin(), value.end()));
+    }
+    return core;
+}
+
+} /* end namespace inout */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,157 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Versioned binary snapshot of a StaticMesh and the EulerCore solution.
+ *
+ * @ingroup group_inout
+ */
+
+#include <solvcon/base.hpp>
+#include <solvcon/buffer/buffer.hpp>
+#include <solvcon/mesh/mesh.hpp>
+#include <solvcon/multidim/euler.hpp>
+
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace solvcon
+{
+
+namespace inout
+{
+
+/**
+ * Container of named, typed array sections written to and read from a single
+ * binary file.
+ *
+ * The file starts with a fixed 64-byte header (magic, format version, byte
+ * order mark, and the location of the table of contents), followed by the raw
+ * data of every section at a 64-byte aligned offset, and ends with the table
+ * of contents recording the name, data type, shape, ghost count, offset, and
+ * length of each section.  Sections are stored in native byte order; a file
+ * written on a machine of the other byte order is rejected.
+ *
+ * load() maps every section with ConcreteBuffer::map_file() in copy-on-write
+ * mode by default, so opening a snapshot reads nothing but the table of
+ * contents and the arrays page in as they are touched.
+ *
+ * add_mesh() / to_mesh() store every array of a StaticMesh together with its
+ * counts and boundary-condition groups, so the loaded mesh needs no
+ * build_interior(), build_boundary(), or build_ghost().  add_euler() /
+ * to_euler() do the same for the EulerCore solution (current and new), CFL,
+ * and gamma arrays, the parameters, and the registered boundary conditions.
+ *
+ * @ingroup group_inout
+ */
+class Snapshot
+{
+
+public:
+
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t ALIGNMENT = 64;
+
+    struct Section
+    {
+        std::string name;
+        DataType dtype = DataType::Undefined;
+        small_vector<ssize_t> shape;
+        ssize_t nghost = 0;
+        std::shared_ptr<ConcreteBuffer> buffer;
+    }; /* end struct Section */
+
+    Snapshot() = default;
+    Snapshot(Snapshot const &) = default;
+    Snapshot(Snapshot &&) = default;
+    Snapshot & operator=(Snapshot const &) = default;
+    Snapshot & operator=(Snapshot &&) = default;
+    ~Snapshot() = default;
+
+    /**
+     * Read the table of contents of the snapshot at @p path.
+     *
+     * @param[in] path
+     *      File written by save().
+     * @param[in] mapped
+     *      Map each section with copy-on-write pages when true; read the
+     *      sections into memory otherwise.
+     */
+    static Snapshot load(std::string const & path, bool mapped = true);
+
+    void save(std::string const & path) const;
+
+    size_t size() const { return m_sections.size(); }
+    std::vector<std::string> names() const;
+    bool has(std::string const & name) const { return find(name) != nullptr; }
+    Section const & section(std::string const & name) const;
+
+    /// Add a C-contiguous array.  The section shares the array buffer.
+    template <typename T>
+    void add(std::string const & name, SimpleArray<T> const & array);
+
+    /// Get the section @p name as an array sharing the section buffer.
+    template <typename T>
+    SimpleArray<T> get(std::string const & name) const;
+
+    void add_mesh(StaticMesh const & mesh);
+    std::shared_ptr<StaticMesh> to_mesh() const;
+
+    void add_euler(EulerCore const & core);
+    std::shared_ptr<EulerCore> to_euler(std::shared_ptr<StaticMesh> const & mesh) const;
+
+private:
+
+    Section const * find(std::string const & name) const;
+    void add_section(Section && section);
+
+    std::vector<Section> m_sections;
+
+}; /* end class Snapshot */
+
+template <typename T>
+void Snapshot::add(std::string const & name, SimpleArray<T> const & array)
+{
+    auto const * const first = reinterpret_cast<int8_t const *>(array.logical_data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!array.is_c_contiguous() || first != array.buffer().data() || array.nbytes() != array.buffer().nbytes())
+    {
+        throw std::invalid_argument(
+            std::format("Snapshot::add: array '{}' does not span its whole buffer contiguously", name));
+    }
+    Section section;
+    section.name = name;
+    section.dtype = DataType::from<T>();
+    section.shape = array.shape();
+    section.nghost = array.nghost();
+    section.buffer = std::const_pointer_cast<ConcreteBuffer>(array.buffer().shared_from_this());
+    add_section(std::move(section));
+}
+
+template <typename T>
+SimpleArray<T> Snapshot::get(std::string const & name) const
+{
+    Section const & sec = section(name);
+    if (sec.dtype != DataType::from<T>())
+    {
+        throw std::invalid_argument(
+            std::format("Snapshot::get: section '{}' holds a different data type", name));
+    }
+    SimpleArray<T> ret(sec.shape, sec.buffer);
+    ret.set_nghost(sec.nghost);
+    return ret;
+}
+
+} /* end namespace inout */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
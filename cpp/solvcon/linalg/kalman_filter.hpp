@@ -13,8 +13,18 @@
  */
 
 #include <solvcon/linalg/factorization.hpp>
+#include <solvcon/linalg/lu_factorization.hpp>
 #include <solvcon/math/math.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace solvcon
 {
 
@@ -24,6 +34,36 @@ template <typename T>
 struct select_real_t;
 } /* end namespace detail */
 
+/**
+ * Covariance recursion of `KalmanFilter<T>::batch_filter(...)`.
+ *
+ * @ingroup group_numerics
+ */
+enum class KalmanBatchMode : uint8_t
+{
+    STANDARD = 0, ///< Predict the covariance and apply the Joseph-form update at each step.
+    STEADY_STATE = 1, ///< Apply the converged gain of the discrete algebraic Riccati equation.
+    SQUARE_ROOT = 2, ///< Propagate a Cholesky factor of the covariance by orthogonal triangularization.
+}; /* end enum class KalmanBatchMode */
+
+inline KalmanBatchMode kalman_batch_mode_from_string(std::string const & mode)
+{
+    if (mode == "standard")
+    {
+        return KalmanBatchMode::STANDARD;
+    }
+    if (mode == "steady_state")
+    {
+        return KalmanBatchMode::STEADY_STATE;
+    }
+    if (mode == "square_root")
+    {
+        return KalmanBatchMode::SQUARE_ROOT;
+    }
+    throw std::invalid_argument(
+        std::format("KalmanFilter: batch mode '{}' not supported", mode));
+}
+
 /**
  * @brief `KalmanStateInfo` includes prior and posterior states and their covariances,
  *  and it is the return type of `KalmanFilter<T>::batch_filter(...)`.
@@ -72,6 +112,16 @@ struct KalmanStateInfo
  * through an LLT solve and applies the Joseph-form covariance update for
  * numerical stability.
  *
+ * For high-rate measurement streams, batch_filter() offers two more modes
+ * (KalmanBatchMode) whose loops run on buffers allocated before the first
+ * step.  STEADY_STATE solves the discrete algebraic Riccati equation once by
+ * the structured doubling algorithm and applies the converged gain, so that a
+ * step only costs the state products.  SQUARE_ROOT propagates a lower
+ * Cholesky factor L of the covariance P = L L^H: the predict and update steps
+ * triangularize the pre-arrays [F L, chol(Q)] and [[chol(R), H L], [0, L]]
+ * with Householder reflections, which keeps P positive semi-definite in
+ * finite precision.
+ *
  * Reference: FilterPy KalmanFilter documentation
  * https://filterpy.readthedocs.io/en/latest/kalman/KalmanFilter.html
  *
@@ -104,6 +154,12 @@ private:
 
     real_type m_jitter; // regularization jitter for numerical stability
 
+    // Steady state, solved on first use: prior and posterior covariances and gain.
+    bool m_has_steady_state = false;
+    array_type m_ss_prior;
+    array_type m_ss_posterior;
+    array_type m_ss_gain;
+
 public:
 
     /**
@@ -292,11 +348,12 @@ public:
      * (https://filterpy.readthedocs.io/en/latest/_modules/filterpy/kalman/kalman_filter.html#KalmanFilter.batch_filter).
      *
      * @param zs A batch of measurement inputs.
+     * @param mode Covariance recursion; see KalmanBatchMode.
      *
      * @see KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs, array_type const & us)
      * @see struct KalmanStateInfo<T>;
      */
-    KalmanStateInfo<T> batch_filter(array_type const & zs);
+    KalmanStateInfo<T> batch_filter(array_type const & zs, KalmanBatchMode mode = KalmanBatchMode::STANDARD);
 
     /**
      * @brief Predict and update in batch mode with a batch of control input `us`.
@@ -310,11 +367,31 @@ public:
      *
      * @param zs A batch of measurement inputs.
      * @param us A batch of control inputs.
+     * @param mode Covariance recursion; see KalmanBatchMode.
      *
      * @see KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs)
      * @see struct KalmanStateInfo<T>;
      */
-    KalmanStateInfo<T> batch_filter(array_type const & zs, array_type const & us);
+    KalmanStateInfo<T> batch_filter(
+        array_type const & zs,
+        array_type const & us,
+        KalmanBatchMode mode = KalmanBatchMode::STANDARD);
+
+    /**
+     * @brief Prior covariance of the steady state.
+     *
+     * @details
+     * Solves P = F P F^H - F P H^H (H P H^H + R + jitter I)^{-1} H P F^H + Q
+     * by the structured doubling algorithm, which converges quadratically
+     * when (F, H) is detectable and (F, Q) is stabilizable.  The solution is
+     * computed on the first call and kept.
+     *
+     * @throw std::runtime_error if the iteration does not converge.
+     */
+    array_type const & steady_state_covariance();
+
+    /// Kalman gain of the steady state, K = P H^H (H P H^H + R + jitter I)^{-1}.
+    array_type const & steady_state_gain();
 
 private:
 
@@ -338,6 +415,20 @@ private:
     void predict_and_update(array_type const & z, KalmanStateInfo<T> & bfs, ssize_t iter);
     void predict_and_update(array_type const & z, array_type const & u, KalmanStateInfo<T> & bfs, ssize_t iter);
 
+    // Batch filter with the steady state and square-root modes; us may be null.
+    void check_batch(array_type const & zs, array_type const * us) const;
+    KalmanStateInfo<T> batch_filter_steady_state(array_type const & zs, array_type const * us);
+    KalmanStateInfo<T> batch_filter_square_root(array_type const & zs, array_type const * us);
+    void solve_steady_state();
+
+    // Allocation-free kernels on row-major buffers.
+    static std::vector<T> row_major(array_type const & a);
+    static void cholesky_lower(T const * a, T * l, ssize_t n);
+    static void triangularize_lower(T * a, ssize_t rows, ssize_t cols);
+    static void lower_outer(T const * l, ssize_t ld, ssize_t n, T * p);
+
+    static constexpr size_t MAX_DOUBLING = 64;
+
 }; /* end class KalmanFilter */
 
 template <typename T>
@@ -519,8 +610,17 @@ void KalmanFilter<T>::update_covariance(array_type const & k)
 }
 
 template <typename T>
-KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs)
+KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs, KalmanBatchMode mode)
 {
+    if (mode == KalmanBatchMode::STEADY_STATE)
+    {
+        return batch_filter_steady_state(zs, nullptr);
+    }
+    if (mode == KalmanBatchMode::SQUARE_ROOT)
+    {
+        return batch_filter_square_root(zs, nullptr);
+    }
+
     ssize_t const z_m = zs.shape(0);
     ssize_t const z_n = zs.shape(1);
     array_type z(small_vector<ssize_t>{z_n});
@@ -567,8 +667,17 @@ void KalmanFilter<T>::predict_and_update(array_type const & z, KalmanStateInfo<T
 }
 
 template <typename T>
-KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs, array_type const & us)
+KalmanStateInfo<T> KalmanFilter<T>::batch_filter(array_type const & zs, array_type const & us, KalmanBatchMode mode)
 {
+    if (mode == KalmanBatchMode::STEADY_STATE)
+    {
+        return batch_filter_steady_state(zs, &us);
+    }
+    if (mode == KalmanBatchMode::SQUARE_ROOT)
+    {
+        return batch_filter_square_root(zs, &us);
+    }
+
     ssize_t const z_m = zs.shape(0);
     ssize_t const z_n = zs.shape(1);
     array_type z(small_vector<ssize_t>{z_n});
@@ -629,6 +738,444 @@ void KalmanFilter<T>::predict_and_update(array_type const & z, array_type const
     }
 }
 
+template <typename T>
+typename KalmanFilter<T>::array_type const & KalmanFilter<T>::steady_state_covariance()
+{
+    solve_steady_state();
+    return m_ss_prior;
+}
+
+template <typename T>
+typename KalmanFilter<T>::array_type const & KalmanFilter<T>::steady_state_gain()
+{
+    solve_steady_state();
+    return m_ss_gain;
+}
+
+template <typename T>
+void KalmanFilter<T>::solve_steady_state()
+{
+    if (m_has_steady_state)
+    {
+        return;
+    }
+
+    // The filter DARE is the control DARE X = A^H X (I + G X)^{-1} A + Q with
+    // A = F^H and G = H^H R^{-1} H.  Doubling: W = I + G X,
+    // A <- A W^{-1} A, G <- G + A W^{-1} G A^H, X <- X + A^H X W^{-1} A.
+    array_type const r = m_r.add(array_type::scaled_eye(m_measurement_size, static_cast<T>(m_jitter)));
+    array_type a = m_f.hermitian();
+    array_type g = m_h.hermitian().matmul(llt_solve(r, m_h)).symmetrize();
+    array_type x = m_q;
+    real_type const tol = std::numeric_limits<real_type>::epsilon() * 1000;
+    bool converged = false;
+    for (size_t iter = 0; iter < MAX_DOUBLING && !converged; ++iter)
+    {
+        LuFactorization<T> const w(m_i.add(g.matmul(x)));
+        array_type const wa = w.solve(a);
+        array_type const wg = w.solve(g);
+        array_type const a_h = a.hermitian();
+        array_type const x_next = x.add(a_h.matmul(x).matmul(wa)).symmetrize();
+        g = g.add(a.matmul(wg).matmul(a_h)).symmetrize();
+        a = a.matmul(wa);
+
+        real_type diff = 0;
+        real_type norm = 0;
+        for (ssize_t i = 0; i < m_state_size; ++i)
+        {
+            for (ssize_t j = 0; j < m_state_size; ++j)
+            {
+                diff += real(conj_mul(x_next(i, j) - x(i, j), x_next(i, j) - x(i, j)));
+                norm += real(conj_mul(x_next(i, j), x_next(i, j)));
+            }
+        }
+        if (!std::isfinite(norm))
+        {
+            break;
+        }
+        converged = std::sqrt(diff) <= tol * std::sqrt(norm);
+        x = x_next;
+    }
+    if (!converged)
+    {
+        throw std::runtime_error(std::format(
+            "KalmanFilter::steady_state_covariance: The doubling iteration of the discrete algebraic Riccati "
+            "equation did not converge in {} steps; (F, H) must be detectable and (F, Q) stabilizable",
+            MAX_DOUBLING));
+    }
+
+    // S <- H P H^H + R + jitter I, K <- P H^H S^{-1}, and the Joseph-form posterior.
+    array_type const s = m_h.matmul(x).matmul(m_h.hermitian()).add(r).symmetrize();
+    array_type k = llt_solve(s, m_h.matmul(x)).hermitian();
+    array_type const i_minus_kh = m_i.sub(k.matmul(m_h));
+    array_type const posterior = i_minus_kh.matmul(x).matmul(i_minus_kh.hermitian())
+                                     .add(k.matmul(m_r).matmul(k.hermitian()));
+    // Move into the members; copy assignment requires a buffer of the same size.
+    m_ss_prior = std::move(x);
+    m_ss_gain = std::move(k);
+    m_ss_posterior = posterior.symmetrize();
+    m_has_steady_state = true;
+}
+
+template <typename T>
+void KalmanFilter<T>::check_batch(array_type const & zs, array_type const * us) const
+{
+    if (zs.ndim() != 2 || zs.shape(1) != m_measurement_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilter::batch_filter: The measurements zs must be 2D with measurement_size ("
+            << m_measurement_size << ") columns, but got shape " << detail::format_shape(zs.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    if (us != nullptr)
+    {
+        if (m_control_size == 0)
+        {
+            throw std::invalid_argument("KalmanFilter::batch_filter: Control input not supported: control_size is 0");
+        }
+        if (us->ndim() != 2 || us->shape(0) != zs.shape(0) || us->shape(1) != m_control_size)
+        {
+            std::ostringstream oss;
+            oss << "KalmanFilter::batch_filter: The control inputs us must be 2D with a row per measurement and control_size ("
+                << m_control_size << ") columns, but got shape " << detail::format_shape(us->shape());
+            throw std::invalid_argument(oss.str());
+        }
+    }
+}
+
+template <typename T>
+std::vector<T> KalmanFilter<T>::row_major(array_type const & a)
+{
+    std::vector<T> ret;
+    ret.reserve(a.size());
+    if (a.ndim() == 1)
+    {
+        for (ssize_t i = 0; i < a.shape(0); ++i)
+        {
+            ret.push_back(a(i));
+        }
+    }
+    else
+    {
+        for (ssize_t i = 0; i < a.shape(0); ++i)
+        {
+            for (ssize_t j = 0; j < a.shape(1); ++j)
+            {
+                ret.push_back(a(i, j));
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * Lower Cholesky factor of a positive semi-definite matrix: a pivot that is
+ * not positive leaves a zero column, so that a singular Q or P is accepted.
+ */
+template <typename T>
+void KalmanFilter<T>::cholesky_lower(T const * a, T * l, ssize_t n)
+{
+    real_type const eps = std::numeric_limits<real_type>::epsilon();
+    std::fill(l, l + (n * n), T(0));
+    for (ssize_t j = 0; j < n; ++j)
+    {
+        real_type d = real(a[(j * n) + j]);
+        for (ssize_t k = 0; k < j; ++k)
+        {
+            d -= real(conj_mul(l[(j * n) + k], l[(j * n) + k]));
+        }
+        if (d <= std::max<real_type>(1, abs(a[(j * n) + j])) * 100 * eps)
+        {
+            continue;
+        }
+        real_type const ljj = std::sqrt(d);
+        l[(j * n) + j] = ljj;
+        for (ssize_t i = j + 1; i < n; ++i)
+        {
+            T sum = a[(i * n) + j];
+            for (ssize_t k = 0; k < j; ++k)
+            {
+                sum -= conj_mul(l[(i * n) + k], l[(j * n) + k]);
+            }
+            l[(i * n) + j] = sum / ljj;
+        }
+    }
+}
+
+/**
+ * Reduce the row-major rows x cols array A to lower-trapezoidal form A Theta
+ * in place, with Theta unitary, so that A A^H is kept.  Row i is reflected
+ * onto its diagonal by the Householder reflection I - tau u u^H of
+ * u = conj(a_i) - alpha e_i, with alpha = -|a_i| conj(a_ii) / |a_ii|.
+ */
+template <typename T>
+void KalmanFilter<T>::triangularize_lower(T * a, ssize_t rows, ssize_t cols)
+{
+    ssize_t const nreflect = std::min(rows, cols);
+    for (ssize_t i = 0; i < nreflect; ++i)
+    {
+        T * ai = a + (i * cols);
+        real_type norm2 = 0;
+        for (ssize_t j = i; j < cols; ++j)
+        {
+            norm2 += real(conj_mul(ai[j], ai[j]));
+        }
+        if (norm2 == 0)
+        {
+            continue;
+        }
+        real_type const norm = std::sqrt(norm2);
+        T const x0 = conj(ai[i]);
+        real_type const ax0 = abs(x0);
+        T const phase = ax0 > 0 ? x0 * (real_type(1) / ax0) : T(1);
+        T const alpha = phase * (-norm);
+        T const u0 = x0 - alpha;
+        real_type const tau = real_type(1) / (norm * (norm + ax0));
+        for (ssize_t r = i + 1; r < rows; ++r)
+        {
+            T * ar = a + (r * cols);
+            T dot = ar[i] * u0;
+            for (ssize_t j = i + 1; j < cols; ++j)
+            {
+                dot += conj_mul(ar[j], ai[j]);
+            }
+            T const scale = dot * tau;
+            ar[i] -= scale * conj(u0);
+            for (ssize_t j = i + 1; j < cols; ++j)
+            {
+                ar[j] -= scale * ai[j];
+            }
+        }
+        ai[i] = conj(alpha);
+        std::fill(ai + i + 1, ai + cols, T(0));
+    }
+}
+
+/// P <- L L^H for the n x n lower-triangular L of leading dimension ld.
+template <typename T>
+void KalmanFilter<T>::lower_outer(T const * l, ssize_t ld, ssize_t n, T * p)
+{
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j <= i; ++j)
+        {
+            T sum = 0;
+            for (ssize_t k = 0; k <= j; ++k)
+            {
+                sum += conj_mul(l[(i * ld) + k], l[(j * ld) + k]);
+            }
+            p[(i * n) + j] = sum;
+            p[(j * n) + i] = conj(sum);
+        }
+    }
+}
+
+template <typename T>
+KalmanStateInfo<T> KalmanFilter<T>::batch_filter_steady_state(array_type const & zs, array_type const * us)
+{
+    check_batch(zs, us);
+    solve_steady_state();
+
+    ssize_t const nstep = zs.shape(0);
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    ssize_t const c = us != nullptr ? m_control_size : 0;
+    std::vector<T> const f = row_major(m_f);
+    std::vector<T> const h = row_major(m_h);
+    std::vector<T> const b = row_major(m_b);
+    std::vector<T> const k = row_major(m_ss_gain);
+    std::vector<T> const prior_p = row_major(m_ss_prior);
+    std::vector<T> const posterior_p = row_major(m_ss_posterior);
+    std::vector<T> x = row_major(m_x);
+    std::vector<T> xp(n);
+    std::vector<T> y(m);
+
+    KalmanStateInfo<T> bfs(nstep, n);
+    T * prior_xs = bfs.prior_states.data();
+    T * prior_ps = bfs.prior_states_covariance.data();
+    T * posterior_xs = bfs.posterior_states.data();
+    T * posterior_ps = bfs.posterior_states_covariance.data();
+    for (ssize_t iter = 0; iter < nstep; ++iter)
+    {
+        // x- <- F x + B u
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            T sum = 0;
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                sum += f[(i * n) + j] * x[j];
+            }
+            for (ssize_t j = 0; j < c; ++j)
+            {
+                sum += b[(i * c) + j] * (*us)(iter, j);
+            }
+            xp[i] = sum;
+        }
+        // y <- z - H x-
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            T sum = zs(iter, i);
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                sum -= h[(i * n) + j] * xp[j];
+            }
+            y[i] = sum;
+        }
+        // x+ <- x- + K y
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            T sum = xp[i];
+            for (ssize_t j = 0; j < m; ++j)
+            {
+                sum += k[(i * m) + j] * y[j];
+            }
+            x[i] = sum;
+        }
+        std::copy(xp.begin(), xp.end(), prior_xs + (iter * n));
+        std::copy(x.begin(), x.end(), posterior_xs + (iter * n));
+        std::copy(prior_p.begin(), prior_p.end(), prior_ps + (iter * n * n));
+        std::copy(posterior_p.begin(), posterior_p.end(), posterior_ps + (iter * n * n));
+    }
+
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        m_x(i) = x[i];
+    }
+    m_p = m_ss_posterior;
+    return bfs;
+}
+
+template <typename T>
+KalmanStateInfo<T> KalmanFilter<T>::batch_filter_square_root(array_type const & zs, array_type const * us)
+{
+    check_batch(zs, us);
+
+    ssize_t const nstep = zs.shape(0);
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    ssize_t const c = us != nullptr ? m_control_size : 0;
+    ssize_t const npre = 2 * n; // Columns of the predict pre-array.
+    ssize_t const nupd = m + n; // Rows and columns of the update pre-array.
+    std::vector<T> const f = row_major(m_f);
+    std::vector<T> const h = row_major(m_h);
+    std::vector<T> const b = row_major(m_b);
+    std::vector<T> const lr = row_major(llt_factorization(
+        m_r.add(array_type::scaled_eye(m_measurement_size, static_cast<T>(m_jitter)))));
+    std::vector<T> lq(n * n);
+    cholesky_lower(row_major(m_q).data(), lq.data(), n);
+    std::vector<T> l(n * n);
+    cholesky_lower(row_major(m_p).data(), l.data(), n);
+    std::vector<T> x = row_major(m_x);
+    std::vector<T> xp(n);
+    std::vector<T> y(m);
+    std::vector<T> pre(n * npre);
+    std::vector<T> upd(nupd * nupd);
+
+    KalmanStateInfo<T> bfs(nstep, n);
+    T * prior_xs = bfs.prior_states.data();
+    T * prior_ps = bfs.prior_states_covariance.data();
+    T * posterior_xs = bfs.posterior_states.data();
+    T * posterior_ps = bfs.posterior_states_covariance.data();
+    for (ssize_t iter = 0; iter < nstep; ++iter)
+    {
+        // x- <- F x + B u, and the pre-array [F L, chol(Q)] for L- L-^H = F P F^H + Q.
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            T sum = 0;
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                sum += f[(i * n) + j] * x[j];
+            }
+            for (ssize_t j = 0; j < c; ++j)
+            {
+                sum += b[(i * c) + j] * (*us)(iter, j);
+            }
+            xp[i] = sum;
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                T fl = 0;
+                for (ssize_t k = j; k < n; ++k)
+                {
+                    fl += f[(i * n) + k] * l[(k * n) + j];
+                }
+                pre[(i * npre) + j] = fl;
+                pre[(i * npre) + n + j] = lq[(i * n) + j];
+            }
+        }
+        triangularize_lower(pre.data(), n, npre);
+        std::copy(xp.begin(), xp.end(), prior_xs + (iter * n));
+        lower_outer(pre.data(), npre, n, prior_ps + (iter * n * n));
+
+        // The pre-array [[chol(R), H L-], [0, L-]] becomes [[chol(S), 0], [K chol(S), L+]].
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            for (ssize_t j = 0; j < m; ++j)
+            {
+                upd[(i * nupd) + j] = lr[(i * m) + j];
+            }
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                T hl = 0;
+                for (ssize_t k = j; k < n; ++k)
+                {
+                    hl += h[(i * n) + k] * pre[(k * npre) + j];
+                }
+                upd[(i * nupd) + m + j] = hl;
+            }
+        }
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            for (ssize_t j = 0; j < m; ++j)
+            {
+                upd[((m + i) * nupd) + j] = T(0);
+            }
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                upd[((m + i) * nupd) + m + j] = pre[(i * npre) + j];
+            }
+        }
+        triangularize_lower(upd.data(), nupd, nupd);
+
+        // y <- z - H x-, then solve chol(S) w = y into y and x+ <- x- + (K chol(S)) w.
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            T sum = zs(iter, i);
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                sum -= h[(i * n) + j] * xp[j];
+            }
+            for (ssize_t j = 0; j < i; ++j)
+            {
+                sum -= upd[(i * nupd) + j] * y[j];
+            }
+            y[i] = sum / upd[(i * nupd) + i];
+        }
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            T sum = xp[i];
+            for (ssize_t j = 0; j < m; ++j)
+            {
+                sum += upd[((m + i) * nupd) + j] * y[j];
+            }
+            x[i] = sum;
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                l[(i * n) + j] = upd[((m + i) * nupd) + m + j];
+            }
+        }
+        std::copy(x.begin(), x.end(), posterior_xs + (iter * n));
+        lower_outer(l.data(), n, n, posterior_ps + (iter * n * n));
+    }
+
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        m_x(i) = x[i];
+    }
+    m_p = array_type(small_vector<ssize_t>{n, n});
+    lower_outer(l.data(), n, n, m_p.data());
+    return bfs;
+}
+
 } /* end namespace solvcon */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,926 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Bank of Kalman filters sharing one linear model, stepped together.
+ *
+ * @ingroup group_numerics
+ */
+
+#include <solvcon/linalg/kalman_filter.hpp>
+#include <solvcon/math/math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace solvcon
+{
+
+/**
+ * Bank of Kalman filters for many tracks that share one linear model.
+ *
+ * Every track has its own state mean and covariance, while the transition
+ * matrix F, control matrix B, measurement matrix H, and the noise
+ * covariances Q and R are common to the bank.  The per-track data are kept
+ * in structure-of-arrays layout with the track index innermost: the state is
+ * a (state_size, ntrack) buffer and the covariance a (state_size,
+ * state_size, ntrack) buffer.  Each predict() or update() call steps all the
+ * tracks, and every small-matrix kernel (the products with the model
+ * matrices, the Cholesky factorization of the innovation covariance, and the
+ * triangular solves for the gain) runs its innermost loop over the contiguous
+ * track axis so that the compiler vectorizes it.  The buffers are allocated
+ * by the constructor; the steps do not allocate.
+ *
+ * A step computes the same recursion as KalmanFilter<T>::predict() and
+ * KalmanFilter<T>::update(): the gain comes from an LLT solve and the
+ * covariance takes the Joseph-form update.  The covariance products compute
+ * the lower triangle and mirror it, which keeps the covariance Hermitian.
+ *
+ * @ingroup group_numerics
+ */
+template <typename T>
+class KalmanFilterBank
+{
+
+public:
+
+    using value_type = T;
+    using real_type = typename detail::select_real_t<value_type>::type;
+    using array_type = SimpleArray<T>;
+
+private:
+
+    ssize_t m_ntrack; // number of tracks
+    ssize_t m_state_size; // state dimension
+    ssize_t m_measurement_size; // measurement dimension
+    ssize_t m_control_size; // control dimension
+
+    // Shared model, contiguous row-major.
+    array_type m_f; // state transition matrix (state_sizexstate_size)
+    array_type m_b; // control matrix (state_sizexcontrol_size)
+    array_type m_h; // measurement matrix (measurement_sizexstate_size)
+    array_type m_q; // process noise covariance (state_sizexstate_size)
+    array_type m_r; // measurement noise covariance (measurement_sizexmeasurement_size)
+
+    real_type m_jitter; // regularization jitter for numerical stability
+
+    // Per-track data with the track index innermost.
+    array_type m_x; // states (state_sizexntrack)
+    array_type m_p; // covariances (state_sizexstate_sizexntrack)
+
+    // Work buffers of the steps.
+    array_type m_u; // control inputs (control_sizexntrack)
+    array_type m_np; // F P or (I-K H) P (state_sizexstate_sizexntrack)
+    array_type m_a; // I-K H (state_sizexstate_sizexntrack)
+    array_type m_hp; // H P, then S^{-1} H P (measurement_sizexstate_sizexntrack)
+    array_type m_s; // S, then its lower Cholesky factor (measurement_sizexmeasurement_sizexntrack)
+    array_type m_k; // gain K (state_sizexmeasurement_sizexntrack)
+    array_type m_kr; // K R (state_sizexmeasurement_sizexntrack)
+    array_type m_y; // innovation (measurement_sizexntrack)
+    std::vector<real_type> m_tol; // Cholesky pivot tolerance (ntrack)
+
+public:
+
+    /**
+     * @brief Construct a bank of Kalman filters with scalar noise.
+     *
+     * @details
+     * The process and measurement noise covariances are the squared standard
+     * deviations times identity matrices, and every track starts with the
+     * identity covariance.
+     *
+     * @param x Initial states, one row per track (ntrackxstate_size).
+     * @param f State transition matrix F.
+     * @param b Control matrix B (empty to disable control input u).
+     * @param h Measurement matrix H.
+     * @param process_noise Process noise standard deviation.
+     * @param measurement_noise Measurement noise standard deviation.
+     * @param jitter Numerical stability jitter.
+     */
+    KalmanFilterBank(
+        array_type const & x,
+        array_type const & f,
+        array_type const & b,
+        array_type const & h,
+        real_type process_noise,
+        real_type measurement_noise,
+        real_type jitter)
+        : KalmanFilterBank(
+              x,
+              f,
+              b,
+              h,
+              array_type::scaled_eye(column_count(x), static_cast<T>(process_noise * process_noise)),
+              array_type::scaled_eye(row_count(h), static_cast<T>(measurement_noise * measurement_noise)),
+              array_type::eye(column_count(x)),
+              jitter)
+    {
+    }
+
+    /**
+     * @brief Construct a bank of Kalman filters with explicit covariance matrices.
+     *
+     * @param x Initial states, one row per track (ntrackxstate_size).
+     * @param f State transition matrix F.
+     * @param b Control matrix B (empty to disable control input u).
+     * @param h Measurement matrix H.
+     * @param q Process noise covariance Q.
+     * @param r Measurement noise covariance R.
+     * @param p Initial state covariance, shared (state_sizexstate_size) or
+     *  per track (ntrackxstate_sizexstate_size).
+     * @param jitter Numerical stability jitter.
+     */
+    KalmanFilterBank(
+        array_type const & x,
+        array_type const & f,
+        array_type const & b,
+        array_type const & h,
+        array_type const & q,
+        array_type const & r,
+        array_type const & p,
+        real_type jitter);
+
+    ssize_t ntrack() const { return m_ntrack; }
+    ssize_t state_size() const { return m_state_size; }
+    ssize_t measurement_size() const { return m_measurement_size; }
+    ssize_t control_size() const { return m_control_size; }
+
+    /// States of all tracks (ntrackxstate_size).
+    array_type states() const;
+    /// Covariances of all tracks (ntrackxstate_sizexstate_size).
+    array_type covariances() const;
+    /// State of one track (state_size).
+    array_type state(ssize_t track) const;
+    /// Covariance of one track (state_sizexstate_size).
+    array_type covariance(ssize_t track) const;
+
+    /// Restart one track, e.g., when a new target replaces a lost one.
+    void set_track(ssize_t track, array_type const & x, array_type const & p);
+
+    /**
+     * @brief Predict step of all tracks without control input.
+     *
+     * @see KalmanFilter<T>::predict()
+     */
+    void predict();
+
+    /**
+     * @brief Predict step of all tracks with control input.
+     *
+     * @param us Control inputs, one row per track (ntrackxcontrol_size).
+     *
+     * @see KalmanFilter<T>::predict(array_type const & u)
+     */
+    void predict(array_type const & us);
+
+    /**
+     * @brief Update step of all tracks.
+     *
+     * @param zs Measurements, one row per track (ntrackxmeasurement_size).
+     *
+     * @throw std::runtime_error if the innovation covariance of a track is
+     *  not (numerically) positive definite.
+     *
+     * @see KalmanFilter<T>::update(array_type const & z)
+     */
+    void update(array_type const & zs);
+
+private:
+
+    static ssize_t row_count(array_type const & a) { return a.ndim() == 2 ? a.shape(0) : 0; }
+    static ssize_t column_count(array_type const & a) { return a.ndim() == 2 ? a.shape(1) : 0; }
+    static array_type contiguous(array_type const & a);
+
+    void check_dimensions(array_type const & x, array_type const & p) const;
+    void check_track(ssize_t track) const;
+    void check_measurement(array_type const & zs) const;
+    void check_control(array_type const & us) const;
+
+    // Lane kernels on (rows x ntrack) buffers.
+    T * lane(array_type & a, ssize_t row) { return a.data() + (row * m_ntrack); }
+    T const * lane(array_type const & a, ssize_t row) const { return a.data() + (row * m_ntrack); }
+    void fill_lane(T * y, T value) const { std::fill(y, y + m_ntrack, value); }
+    void axpy_lane(T * y, T a, T const * x) const;
+    void mirror_lower(array_type & a, ssize_t n);
+
+    void predict_state(bool with_control);
+    void predict_covariance();
+    void factorize_innovation();
+    void solve_gain();
+    void update_covariance();
+
+}; /* end class KalmanFilterBank */
+
+template <typename T>
+KalmanFilterBank<T>::KalmanFilterBank(
+    array_type const & x,
+    array_type const & f,
+    array_type const & b,
+    array_type const & h,
+    array_type const & q,
+    array_type const & r,
+    array_type const & p,
+    real_type jitter)
+    : m_ntrack(row_count(x))
+    , m_state_size(column_count(x))
+    , m_measurement_size(row_count(h))
+    , m_control_size(column_count(b))
+    , m_f(contiguous(f))
+    , m_b(contiguous(b))
+    , m_h(contiguous(h))
+    , m_q(contiguous(q))
+    , m_r(contiguous(r))
+    , m_jitter(jitter)
+{
+    check_dimensions(x, p);
+
+    ssize_t const nt = m_ntrack;
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    m_x = array_type(small_vector<ssize_t>{n, nt});
+    m_p = array_type(small_vector<ssize_t>{n, n, nt});
+    m_u = array_type(small_vector<ssize_t>{m_control_size, nt});
+    m_np = array_type(small_vector<ssize_t>{n, n, nt});
+    m_a = array_type(small_vector<ssize_t>{n, n, nt});
+    m_hp = array_type(small_vector<ssize_t>{m, n, nt});
+    m_s = array_type(small_vector<ssize_t>{m, m, nt});
+    m_k = array_type(small_vector<ssize_t>{n, m, nt});
+    m_kr = array_type(small_vector<ssize_t>{n, m, nt});
+    m_y = array_type(small_vector<ssize_t>{m, nt});
+    m_tol.resize(static_cast<size_t>(nt));
+
+    for (ssize_t t = 0; t < nt; ++t)
+    {
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            m_x(i, t) = x(t, i);
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                m_p(i, j, t) = p.ndim() == 2 ? p(i, j) : p(t, i, j);
+            }
+        }
+    }
+}
+
+template <typename T>
+typename KalmanFilterBank<T>::array_type KalmanFilterBank<T>::contiguous(array_type const & a)
+{
+    // Copy by index, so that a strided view is read in logical order.
+    array_type ret(a.shape());
+    if (a.ndim() == 2)
+    {
+        for (ssize_t i = 0; i < a.shape(0); ++i)
+        {
+            for (ssize_t j = 0; j < a.shape(1); ++j)
+            {
+                ret(i, j) = a(i, j);
+            }
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+// FIXME: NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void KalmanFilterBank<T>::check_dimensions(array_type const & x, array_type const & p) const
+{
+    auto const check_square = [](array_type const & a, ssize_t size, char const * description)
+    {
+        if (a.ndim() != 2 || a.shape(0) != size || a.shape(1) != size)
+        {
+            std::ostringstream oss;
+            oss << "KalmanFilterBank::check_dimensions: The " << description << " must be "
+                << size << "x" << size << ", but got shape " << detail::format_shape(a.shape());
+            throw std::invalid_argument(oss.str());
+        }
+    };
+
+    if (x.ndim() != 2)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::check_dimensions: The state SimpleArray x must be ntrackxstate_size, but got shape "
+            << detail::format_shape(x.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    check_square(m_f, m_state_size, "state transition SimpleArray f");
+    if (m_h.ndim() != 2 || m_h.shape(1) != m_state_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::check_dimensions: The measurement SimpleArray h must be measurement_sizexstate_size, but got shape "
+            << detail::format_shape(m_h.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    check_square(m_q, m_state_size, "process noise covariance SimpleArray q");
+    check_square(m_r, m_measurement_size, "measurement noise covariance SimpleArray r");
+    if (m_b.ndim() != 2 || m_b.shape(0) != m_state_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::check_dimensions: The control SimpleArray b must be state_sizexcontrol_size, but got shape "
+            << detail::format_shape(m_b.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    if (p.ndim() == 3)
+    {
+        if (p.shape(0) != m_ntrack || p.shape(1) != m_state_size || p.shape(2) != m_state_size)
+        {
+            std::ostringstream oss;
+            oss << "KalmanFilterBank::check_dimensions: The state covariance SimpleArray p must be ntrackxstate_sizexstate_size, but got shape "
+                << detail::format_shape(p.shape());
+            throw std::invalid_argument(oss.str());
+        }
+    }
+    else
+    {
+        check_square(p, m_state_size, "state covariance SimpleArray p");
+    }
+}
+
+template <typename T>
+void KalmanFilterBank<T>::check_track(ssize_t track) const
+{
+    if (track < 0 || track >= m_ntrack)
+    {
+        throw std::out_of_range(std::format("KalmanFilterBank: track {} out of range [0, {})", track, m_ntrack));
+    }
+}
+
+template <typename T>
+void KalmanFilterBank<T>::check_measurement(array_type const & zs) const
+{
+    if (zs.ndim() != 2 || zs.shape(0) != m_ntrack || zs.shape(1) != m_measurement_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::check_measurement: The measurement SimpleArray zs must be ntrackxmeasurement_size ("
+            << m_ntrack << "x" << m_measurement_size << "), but got shape " << detail::format_shape(zs.shape());
+        throw std::invalid_argument(oss.str());
+    }
+}
+
+template <typename T>
+void KalmanFilterBank<T>::check_control(array_type const & us) const
+{
+    if (m_control_size == 0)
+    {
+        throw std::invalid_argument("KalmanFilterBank::check_control: Control input not supported: control_size is 0");
+    }
+    if (us.ndim() != 2 || us.shape(0) != m_ntrack || us.shape(1) != m_control_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::check_control: The control SimpleArray us must be ntrackxcontrol_size ("
+            << m_ntrack << "x" << m_control_size << "), but got shape " << detail::format_shape(us.shape());
+        throw std::invalid_argument(oss.str());
+    }
+}
+
+template <typename T>
+typename KalmanFilterBank<T>::array_type KalmanFilterBank<T>::states() const
+{
+    array_type ret(small_vector<ssize_t>{m_ntrack, m_state_size});
+    for (ssize_t t = 0; t < m_ntrack; ++t)
+    {
+        for (ssize_t i = 0; i < m_state_size; ++i)
+        {
+            ret(t, i) = m_x(i, t);
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+typename KalmanFilterBank<T>::array_type KalmanFilterBank<T>::covariances() const
+{
+    array_type ret(small_vector<ssize_t>{m_ntrack, m_state_size, m_state_size});
+    for (ssize_t t = 0; t < m_ntrack; ++t)
+    {
+        for (ssize_t i = 0; i < m_state_size; ++i)
+        {
+            for (ssize_t j = 0; j < m_state_size; ++j)
+            {
+                ret(t, i, j) = m_p(i, j, t);
+            }
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+typename KalmanFilterBank<T>::array_type KalmanFilterBank<T>::state(ssize_t track) const
+{
+    check_track(track);
+    array_type ret(small_vector<ssize_t>{m_state_size});
+    for (ssize_t i = 0; i < m_state_size; ++i)
+    {
+        ret(i) = m_x(i, track);
+    }
+    return ret;
+}
+
+template <typename T>
+typename KalmanFilterBank<T>::array_type KalmanFilterBank<T>::covariance(ssize_t track) const
+{
+    check_track(track);
+    array_type ret(small_vector<ssize_t>{m_state_size, m_state_size});
+    for (ssize_t i = 0; i < m_state_size; ++i)
+    {
+        for (ssize_t j = 0; j < m_state_size; ++j)
+        {
+            ret(i, j) = m_p(i, j, track);
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+void KalmanFilterBank<T>::set_track(ssize_t track, array_type const & x, array_type const & p)
+{
+    check_track(track);
+    if (x.ndim() != 1 || x.shape(0) != m_state_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::set_track: The state SimpleArray x must be 1D of length state_size ("
+            << m_state_size << "), but got shape " << detail::format_shape(x.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    if (p.ndim() != 2 || p.shape(0) != m_state_size || p.shape(1) != m_state_size)
+    {
+        std::ostringstream oss;
+        oss << "KalmanFilterBank::set_track: The state covariance SimpleArray p must be state_sizexstate_size, but got shape "
+            << detail::format_shape(p.shape());
+        throw std::invalid_argument(oss.str());
+    }
+    for (ssize_t i = 0; i < m_state_size; ++i)
+    {
+        m_x(i, track) = x(i);
+        for (ssize_t j = 0; j < m_state_size; ++j)
+        {
+            m_p(i, j, track) = p(i, j);
+        }
+    }
+}
+
+template <typename T>
+void KalmanFilterBank<T>::predict()
+{
+    // x <- F x
+    predict_state(false);
+
+    // P <- F P F^H + Q
+    predict_covariance();
+}
+
+template <typename T>
+void KalmanFilterBank<T>::predict(array_type const & us)
+{
+    check_control(us);
+
+    // Stage u with the track index innermost.
+    for (ssize_t j = 0; j < m_control_size; ++j)
+    {
+        T * u = lane(m_u, j);
+        for (ssize_t t = 0; t < m_ntrack; ++t)
+        {
+            u[t] = us(t, j);
+        }
+    }
+
+    // x <- F x + B u
+    predict_state(true);
+
+    // P <- F P F^H + Q
+    predict_covariance();
+}
+
+template <typename T>
+void KalmanFilterBank<T>::update(array_type const & zs)
+{
+    check_measurement(zs);
+
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+
+    // y <- z - H x
+    for (ssize_t i = 0; i < m; ++i)
+    {
+        T * y = lane(m_y, i);
+        for (ssize_t t = 0; t < m_ntrack; ++t)
+        {
+            y[t] = zs(t, i);
+        }
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T const h = m_h(i, j);
+            if (h != T(0))
+            {
+                axpy_lane(y, T(0) - h, lane(m_x, j));
+            }
+        }
+    }
+
+    // S <- H P H^H + R + jitter I, then its lower Cholesky factor
+    factorize_innovation();
+
+    // K <- P H^H S^{-1} = (S^{-1} H P)^H
+    solve_gain();
+
+    // x <- x + K y
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        T * x = lane(m_x, i);
+        for (ssize_t j = 0; j < m; ++j)
+        {
+            T const * k = lane(m_k, (i * m) + j);
+            T const * y = lane(m_y, j);
+            for (ssize_t t = 0; t < m_ntrack; ++t)
+            {
+                x[t] += k[t] * y[t];
+            }
+        }
+    }
+
+    // P <- (I-K H) P (I-K H)^H + K R K^H
+    update_covariance();
+}
+
+template <typename T>
+void KalmanFilterBank<T>::axpy_lane(T * y, T a, T const * x) const
+{
+    for (ssize_t t = 0; t < m_ntrack; ++t)
+    {
+        y[t] += a * x[t];
+    }
+}
+
+/// Copy the lower triangle of the n x n lane matrix to the upper one as its
+/// conjugate, and drop the imaginary part of the diagonal.
+template <typename T>
+void KalmanFilterBank<T>::mirror_lower(array_type & a, ssize_t n)
+{
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        if constexpr (is_complex_v<T>)
+        {
+            T * d = lane(a, (i * n) + i);
+            for (ssize_t t = 0; t < m_ntrack; ++t)
+            {
+                d[t] = T(real(d[t]));
+            }
+        }
+        for (ssize_t j = 0; j < i; ++j)
+        {
+            T const * lower = lane(a, (i * n) + j);
+            T * upper = lane(a, (j * n) + i);
+            for (ssize_t t = 0; t < m_ntrack; ++t)
+            {
+                upper[t] = conj(lower[t]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void KalmanFilterBank<T>::predict_state(bool with_control)
+{
+    ssize_t const n = m_state_size;
+    // x <- F x (+ B u), staged in m_np
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        T * xn = lane(m_np, i);
+        fill_lane(xn, T(0));
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T const f = m_f(i, j);
+            if (f != T(0))
+            {
+                axpy_lane(xn, f, lane(m_x, j));
+            }
+        }
+        for (ssize_t j = 0; with_control && j < m_control_size; ++j)
+        {
+            T const b = m_b(i, j);
+            if (b != T(0))
+            {
+                axpy_lane(xn, b, lane(m_u, j));
+            }
+        }
+    }
+    std::copy_n(m_np.data(), n * m_ntrack, m_x.data());
+}
+
+template <typename T>
+void KalmanFilterBank<T>::predict_covariance()
+{
+    ssize_t const n = m_state_size;
+    // F P
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T * fp = lane(m_np, (i * n) + j);
+            fill_lane(fp, T(0));
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const f = m_f(i, k);
+                if (f != T(0))
+                {
+                    axpy_lane(fp, f, lane(m_p, (k * n) + j));
+                }
+            }
+        }
+    }
+    // P <- (F P) F^H + Q, lower triangle
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j <= i; ++j)
+        {
+            T * p = lane(m_p, (i * n) + j);
+            fill_lane(p, m_q(i, j));
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const f = conj(m_f(j, k));
+                if (f != T(0))
+                {
+                    axpy_lane(p, f, lane(m_np, (i * n) + k));
+                }
+            }
+        }
+    }
+    mirror_lower(m_p, n);
+}
+
+/**
+ * Form S = H P H^H + R + jitter I and factorize it in place as S = L L^H,
+ * one pivot at a time for all the tracks.  The pivot tolerance is the one
+ * of Llt::factorize().
+ */
+template <typename T>
+// FIXME: NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void KalmanFilterBank<T>::factorize_innovation()
+{
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    ssize_t const nt = m_ntrack;
+
+    // H P
+    for (ssize_t i = 0; i < m; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T * hp = lane(m_hp, (i * n) + j);
+            fill_lane(hp, T(0));
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const h = m_h(i, k);
+                if (h != T(0))
+                {
+                    axpy_lane(hp, h, lane(m_p, (k * n) + j));
+                }
+            }
+        }
+    }
+    // S <- (H P) H^H + R + jitter I, lower triangle
+    for (ssize_t i = 0; i < m; ++i)
+    {
+        for (ssize_t j = 0; j <= i; ++j)
+        {
+            T * s = lane(m_s, (i * m) + j);
+            T const r = i == j ? m_r(i, j) + static_cast<T>(m_jitter) : m_r(i, j);
+            fill_lane(s, r);
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const h = conj(m_h(j, k));
+                if (h != T(0))
+                {
+                    axpy_lane(s, h, lane(m_hp, (i * n) + k));
+                }
+            }
+        }
+    }
+    mirror_lower(m_s, m);
+
+    // S <- L, lower triangle
+    real_type const eps = std::numeric_limits<real_type>::epsilon();
+    for (ssize_t j = 0; j < m; ++j)
+    {
+        T * ljj = lane(m_s, (j * m) + j);
+        for (ssize_t t = 0; t < nt; ++t)
+        {
+            m_tol[t] = std::max<real_type>(1, abs(ljj[t])) * 100 * eps;
+        }
+        for (ssize_t k = 0; k < j; ++k)
+        {
+            T const * ljk = lane(m_s, (j * m) + k);
+            for (ssize_t t = 0; t < nt; ++t)
+            {
+                ljj[t] -= conj_mul(ljk[t], ljk[t]);
+            }
+        }
+        ssize_t nfail = 0;
+        for (ssize_t t = 0; t < nt; ++t)
+        {
+            nfail += real(ljj[t]) <= m_tol[t] ? 1 : 0;
+        }
+        if (nfail > 0)
+        {
+            ssize_t track = 0;
+            while (real(ljj[track]) > m_tol[track])
+            {
+                ++track;
+            }
+            throw std::runtime_error(std::format(
+                "KalmanFilterBank::update: Cholesky failed: innovation covariance of track {} not (numerically) SPD.",
+                track));
+        }
+        for (ssize_t t = 0; t < nt; ++t)
+        {
+            ljj[t] = std::sqrt(real(ljj[t]));
+        }
+        for (ssize_t i = j + 1; i < m; ++i)
+        {
+            T * lij = lane(m_s, (i * m) + j);
+            for (ssize_t k = 0; k < j; ++k)
+            {
+                T const * lik = lane(m_s, (i * m) + k);
+                T const * ljk = lane(m_s, (j * m) + k);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    lij[t] -= conj_mul(lik[t], ljk[t]);
+                }
+            }
+            for (ssize_t t = 0; t < nt; ++t)
+            {
+                lij[t] /= ljj[t];
+            }
+        }
+    }
+}
+
+/// Solve L L^H X = H P in place of H P, and set K = X^H.
+template <typename T>
+// FIXME: NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void KalmanFilterBank<T>::solve_gain()
+{
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    ssize_t const nt = m_ntrack;
+
+    for (ssize_t c = 0; c < n; ++c)
+    {
+        // L Y = H P
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            T * yi = lane(m_hp, (i * n) + c);
+            for (ssize_t k = 0; k < i; ++k)
+            {
+                T const * lik = lane(m_s, (i * m) + k);
+                T const * yk = lane(m_hp, (k * n) + c);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    yi[t] -= lik[t] * yk[t];
+                }
+            }
+            T const * lii = lane(m_s, (i * m) + i);
+            for (ssize_t t = 0; t < nt; ++t)
+            {
+                yi[t] /= lii[t];
+            }
+        }
+        // L^H X = Y
+        for (ssize_t i = m - 1; i >= 0; --i)
+        {
+            T * xi = lane(m_hp, (i * n) + c);
+            for (ssize_t k = i + 1; k < m; ++k)
+            {
+                T const * lki = lane(m_s, (k * m) + i);
+                T const * xk = lane(m_hp, (k * n) + c);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    xi[t] -= conj_mul(xk[t], lki[t]);
+                }
+            }
+            T const * lii = lane(m_s, (i * m) + i);
+            for (ssize_t t = 0; t < nt; ++t)
+            {
+                xi[t] /= lii[t];
+            }
+        }
+    }
+
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < m; ++j)
+        {
+            T * k = lane(m_k, (i * m) + j);
+            T const * x = lane(m_hp, (j * n) + i);
+            for (ssize_t t = 0; t < nt; ++t)
+            {
+                k[t] = conj(x[t]);
+            }
+        }
+    }
+}
+
+template <typename T>
+// FIXME: NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void KalmanFilterBank<T>::update_covariance()
+{
+    ssize_t const n = m_state_size;
+    ssize_t const m = m_measurement_size;
+    ssize_t const nt = m_ntrack;
+
+    // A <- I - K H
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T * a = lane(m_a, (i * n) + j);
+            fill_lane(a, i == j ? T(1) : T(0));
+            for (ssize_t k = 0; k < m; ++k)
+            {
+                T const h = m_h(k, j);
+                if (h != T(0))
+                {
+                    axpy_lane(a, T(0) - h, lane(m_k, (i * m) + k));
+                }
+            }
+        }
+    }
+    // A P
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T * ap = lane(m_np, (i * n) + j);
+            fill_lane(ap, T(0));
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const * a = lane(m_a, (i * n) + k);
+                T const * p = lane(m_p, (k * n) + j);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    ap[t] += a[t] * p[t];
+                }
+            }
+        }
+    }
+    // K R
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < m; ++j)
+        {
+            T * kr = lane(m_kr, (i * m) + j);
+            fill_lane(kr, T(0));
+            for (ssize_t k = 0; k < m; ++k)
+            {
+                T const r = m_r(k, j);
+                if (r != T(0))
+                {
+                    axpy_lane(kr, r, lane(m_k, (i * m) + k));
+                }
+            }
+        }
+    }
+    // P <- (A P) A^H + (K R) K^H, lower triangle
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j <= i; ++j)
+        {
+            T * p = lane(m_p, (i * n) + j);
+            fill_lane(p, T(0));
+            for (ssize_t k = 0; k < n; ++k)
+            {
+                T const * ap = lane(m_np, (i * n) + k);
+                T const * a = lane(m_a, (j * n) + k);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    p[t] += conj_mul(ap[t], a[t]);
+                }
+            }
+            for (ssize_t k = 0; k < m; ++k)
+            {
+                T const * kr = lane(m_kr, (i * m) + k);
+                T const * kk = lane(m_k, (j * m) + k);
+                for (ssize_t t = 0; t < nt; ++t)
+                {
+                    p[t] += conj_mul(kr[t], kk[t]);
+                }
+            }
+        }
+    }
+    mirror_lower(m_p, n);
+}
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
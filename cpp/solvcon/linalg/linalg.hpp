@@ -12,6 +12,7 @@
 #include <solvcon/linalg/factorization.hpp>
 #include <solvcon/linalg/lu_factorization.hpp>
 #include <solvcon/linalg/kalman_filter.hpp>
+#include <solvcon/linalg/kalman_filter_bank.hpp>
 #ifdef MM_HAS_VENDOR_LAPACK
 #include <solvcon/linalg/EigenSystem.hpp>
 #endif
@@ -17,15 +17,192 @@
 #include <cstdint>
 #include <format>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <solvcon/buffer/buffer.hpp>
+#include <solvcon/buffer/gemm.hpp>
+#include <solvcon/math/math.hpp>
+#include <solvcon/parallel/ThreadPool.hpp>
 
 namespace solvcon
 {
 
+namespace detail
+{
+
+/**
+ * Unblocked LU with partial pivoting of the panel of columns [k0, k0+kb) of
+ * the row-major n-by-n matrix @p a, over rows [k0, n).  A pivot swaps the
+ * whole rows, and the elimination updates the panel columns only.  The
+ * extents may be std::integral_constant so that a small matrix is factorized
+ * with fully unrolled loops.
+ *
+ * @return The first step whose pivot is at the singular tolerance, or -1.
+ */
+template <typename T, typename N, typename K>
+ssize_t lu_factorize_panel(T * a, N n, ssize_t k0, K kb, int64_t * piv)
+{
+    using real_type = typename select_real_t<T>::type;
+    // Absolute threshold (~100 * machine eps); works for well-scaled inputs.
+    // TODO: make it relative to matrix/column magnitude for better robustness.
+    real_type const singular_tol = real_type(100) * std::numeric_limits<real_type>::epsilon();
+
+    ssize_t const kend = k0 + kb;
+    for (ssize_t k = k0; k < kend; ++k)
+    {
+        // Find the row in [k, n) with the largest absolute value in column
+        // k.  abs() returns real_type even for complex T.
+        // The search and the swap are branch-free, since the pivot rows of
+        // a batch of small matrices are not predictable.
+        real_type max_val = abs(a[(k * n) + k]);
+        ssize_t max_row = k;
+        for (ssize_t i = k + 1; i < n; ++i)
+        {
+            real_type const val = abs(a[(i * n) + k]);
+            bool const larger = val > max_val;
+            max_val = larger ? val : max_val;
+            max_row = larger ? i : max_row;
+        }
+        piv[k] = static_cast<int64_t>(max_row);
+        T * const ak_swap = a + (max_row * n);
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T const tmp = a[(k * n) + j];
+            a[(k * n) + j] = ak_swap[j];
+            ak_swap[j] = tmp;
+        }
+
+        // Reject both exact singularity (pivot = 0, e.g. duplicate rows) and
+        // near-singularity (pivot at noise level).
+        T const * ak = a + (k * n);
+        if (abs(ak[k]) <= singular_tol)
+        {
+            return k;
+        }
+
+        // Store the multiplier l(i,k) = a(i,k) / a(k,k) in the lower
+        // triangle and subtract l(i,k) * row_k from row_i in the panel.
+        for (ssize_t i = k + 1; i < n; ++i)
+        {
+            T * ai = a + (i * n);
+            ai[k] = ai[k] / ak[k];
+            T const l = ai[k];
+            for (ssize_t j = k + 1; j < kend; ++j)
+            {
+                ai[j] = ai[j] - l * ak[j];
+            }
+        }
+    }
+    return -1;
+}
+
+template <typename T, ssize_t N>
+ssize_t lu_factorize_fixed(T * a, int64_t * piv)
+{
+    using extent = std::integral_constant<ssize_t, N>;
+    return lu_factorize_panel(a, extent{}, 0, extent{}, piv);
+}
+
+/**
+ * Unblocked LU of the row-major n-by-n matrix @p a.  The sizes of the small
+ * systems of the boundary treatments (up to 8) take unrolled kernels.
+ *
+ * @return The first step whose pivot is at the singular tolerance, or -1.
+ */
+template <typename T>
+ssize_t lu_factorize_unblocked(T * a, ssize_t n, int64_t * piv)
+{
+    switch (n)
+    {
+    case 1: return lu_factorize_fixed<T, 1>(a, piv);
+    case 2: return lu_factorize_fixed<T, 2>(a, piv);
+    case 3: return lu_factorize_fixed<T, 3>(a, piv);
+    case 4: return lu_factorize_fixed<T, 4>(a, piv);
+    case 5: return lu_factorize_fixed<T, 5>(a, piv);
+    case 6: return lu_factorize_fixed<T, 6>(a, piv);
+    case 7: return lu_factorize_fixed<T, 7>(a, piv);
+    case 8: return lu_factorize_fixed<T, 8>(a, piv);
+    default: return lu_factorize_panel(a, n, 0, n, piv);
+    }
+}
+
+/**
+ * Right-looking blocked LU of the row-major n-by-n matrix @p a with panels
+ * of @p block_size columns.  After a panel is factorized, the block row to
+ * its right is solved against the unit lower triangle of the panel,
+ *
+ *   U12 <- L11^{-1} A12,
+ *
+ * and the trailing matrix takes the rank-block_size update
+ *
+ *   A22 <- A22 - L21 U12
+ *
+ * by gemm_native() on @p pool, so that the O(n^3) work runs in the packed,
+ * register-blocked kernel.  The pivots and the factors are those of the
+ * unblocked algorithm up to rounding.
+ *
+ * @return The first step whose pivot is at the singular tolerance, or -1.
+ */
+template <typename T>
+ssize_t lu_factorize_blocked(T * a, ssize_t n, ssize_t block_size, int64_t * piv, ThreadPool * pool)
+{
+    std::vector<T> product;
+    GemmWorkspace<T> workspace;
+    for (ssize_t k0 = 0; k0 < n; k0 += block_size)
+    {
+        ssize_t const kb = std::min(block_size, n - k0);
+        ssize_t const failed = lu_factorize_panel(a, n, k0, kb, piv);
+        if (failed >= 0)
+        {
+            return failed;
+        }
+        ssize_t const k1 = k0 + kb;
+        ssize_t const rest = n - k1;
+        if (rest == 0)
+        {
+            break;
+        }
+
+        // U12 <- L11^{-1} A12
+        for (ssize_t k = k0; k < k1; ++k)
+        {
+            T const * ak = a + (k * n);
+            for (ssize_t i = k + 1; i < k1; ++i)
+            {
+                T * ai = a + (i * n);
+                T const l = ai[k];
+                for (ssize_t j = k1; j < n; ++j)
+                {
+                    ai[j] = ai[j] - l * ak[j];
+                }
+            }
+        }
+
+        // A22 <- A22 - L21 U12
+        product.resize(static_cast<size_t>(rest * rest));
+        GemmOperand<T> const l21{a + (k1 * n) + k0, n, 1};
+        GemmOperand<T> const u12{a + (k0 * n) + k1, n, 1};
+        gemm_native(rest, rest, kb, l21, u12, product.data(), rest, workspace, pool);
+        for (ssize_t i = 0; i < rest; ++i)
+        {
+            T * ai = a + ((k1 + i) * n) + k1;
+            T const * pi = product.data() + (i * rest);
+            for (ssize_t j = 0; j < rest; ++j)
+            {
+                ai[j] -= pi[j];
+            }
+        }
+    }
+    return -1;
+}
+
+} /* end namespace detail */
+
 /**
  * Stateful LU decomposition with partial pivoting for general (non-symmetric)
  * matrices.
@@ -48,6 +225,13 @@ namespace solvcon
  * so that multiple solve()/inv() calls reuse the O(n^3) factorization instead
  * of redoing it.
  *
+ * A matrix of BLOCKED_MIN_SIZE or more rows is factorized by the
+ * right-looking blocked algorithm (detail::lu_factorize_blocked()) in panels
+ * of BLOCK_SIZE columns, whose trailing updates run in the native GEMM on the
+ * matmul_nthread() threads.  A smaller matrix fits in cache and is faster to
+ * factorize unblocked.  For many small matrices of one size, see
+ * LuFactorizationBatch<T>.
+ *
  * Supported element types: float, double, Complex<float>, Complex<double>.
  *
  * @ingroup group_numerics
@@ -67,6 +251,11 @@ public:
     using array_type = SimpleArray<value_type>;
     using pivot_type = SimpleArray<int64_t>;
 
+    /// Panel width of the blocked factorization.
+    static constexpr ssize_t BLOCK_SIZE = 64;
+    /// Smallest dimension factorized by the blocked algorithm.
+    static constexpr ssize_t BLOCKED_MIN_SIZE = 256;
+
     /**
      * Factorize a square matrix into PA = LU.
      *
@@ -178,71 +367,36 @@ LuFactorization<T>::LuFactorization(array_type const & a)
     const auto n = a.shape(0);
 
     // Working copy of the input matrix.  The algorithm modifies m_lu
-    // in-place, overwriting it with the combined L and U factors.
-    std::copy(a.begin(), a.end(), m_lu.begin());
+    // in-place, overwriting it with the combined L and U factors.  Copy by
+    // index so that a strided input (e.g. a transposed view) is honored.
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            m_lu(i, j) = a(i, j);
+        }
+    }
 
     // piv[k] records which row was swapped with row k at step k.
     // Initialize with std::iota so piv[k] = k (identity permutation).
     std::iota(m_piv.begin(), m_piv.end(), int64_t{0});
 
-    // Main elimination loop.  For each column k, we:
-    //   1. Search column k (rows k..n-1) for the largest absolute value
-    //      (partial pivoting) to improve numerical stability.
-    //   2. Swap the pivot row with row k.
-    //   3. Check for singularity.
-    //   4. Compute multipliers and update the trailing submatrix.
-    for (ssize_t k = 0; k < n; ++k)
+    // For each column k, partial pivoting picks the largest absolute value
+    // in rows k..n-1, the pivot row is swapped with row k, and the
+    // multipliers below the pivot update the trailing submatrix.
+    ssize_t failed = -1;
+    if (n < BLOCKED_MIN_SIZE)
     {
-        // Step 1: Find the pivot -- the row in [k, n) with the largest
-        // absolute value in column k.  Note: abs() returns real_type even
-        // for complex value_type, so all comparison variables must be real.
-        real_type max_val = abs(m_lu(k, k));
-        ssize_t max_row = k;
-        for (ssize_t i = k + 1; i < n; ++i)
-        {
-            real_type const val = abs(m_lu(i, k));
-            if (val > max_val)
-            {
-                max_val = val;
-                max_row = i;
-            }
-        }
-        m_piv[k] = static_cast<int64_t>(max_row);
-
-        // Step 2: Swap rows k and max_row in the full working matrix.
-        if (max_row != k)
-        {
-            for (ssize_t j = 0; j < n; ++j)
-            {
-                std::swap(m_lu(k, j), m_lu(max_row, j));
-            }
-        }
-
-        // Step 3: Reject both exact singularity (pivot = 0, e.g. duplicate
-        // rows) and near-singularity (pivot at noise level).
-        real_type const pivot = abs(m_lu(k, k));
-        const auto eps = std::numeric_limits<real_type>::epsilon();
-
-        // Absolute threshold (~100 * machine eps); works for well-scaled inputs.
-        // TODO: make it relative to matrix/column magnitude for better robustness.
-        real_type const singular_tol = real_type(100) * eps;
-        if (pivot <= singular_tol)
-        {
-            throw std::runtime_error("LuFactorization: LU decomposition failed: singular or near-singular matrix.");
-        }
-
-        // Step 4: Gaussian elimination.  For each row below the pivot,
-        // compute the multiplier l(i,k) = a(i,k) / a(k,k) and store it
-        // in the lower triangle.  Then subtract l(i,k) * row_k from row_i
-        // in the trailing submatrix (columns k+1..n-1).
-        for (ssize_t i = k + 1; i < n; ++i)
-        {
-            m_lu(i, k) = m_lu(i, k) / m_lu(k, k); // multiplier stored in L
-            for (ssize_t j = k + 1; j < n; ++j)
-            {
-                m_lu(i, j) = m_lu(i, j) - m_lu(i, k) * m_lu(k, j);
-            }
-        }
+        failed = detail::lu_factorize_unblocked(m_lu.data(), n, m_piv.data());
+    }
+    else
+    {
+        std::shared_ptr<ThreadPool> const pool = detail::matmul_thread_pool();
+        failed = detail::lu_factorize_blocked(m_lu.data(), n, BLOCK_SIZE, m_piv.data(), pool.get());
+    }
+    if (failed >= 0)
+    {
+        throw std::runtime_error("LuFactorization: LU decomposition failed: singular or near-singular matrix.");
     }
 }
 
@@ -255,7 +409,13 @@ typename LuFactorization<T>::array_type LuFactorization<T>::forward_substitution
 
     // Copy b into y so we can apply the permutation in-place.
     array_type y(y_shape);
-    std::copy(b.begin(), b.end(), y.begin());
+    for (ssize_t i = 0; i < m; ++i)
+    {
+        for (ssize_t k = 0; k < ncols; ++k)
+        {
+            y(i, k) = b(i, k);
+        }
+    }
 
     // Apply the row permutation P to b.  The swaps are replayed in the
     // same order they were recorded during factorization (k = 0, 1, ...).
@@ -385,6 +545,317 @@ typename LuFactorization<T>::value_type LuFactorization<T>::det() const
     return negate ? value_type{0} - result : result;
 }
 
+/**
+ * LU decompositions with partial pivoting of a batch of same-size square
+ * matrices, e.g., the small dense systems that implicit boundary treatments
+ * solve for every boundary face.
+ *
+ * The input is a 3D SimpleArray of shape (nbatch, n, n).  Matrix b is
+ * factorized into P_b A_b = L_b U_b with the kernel of LuFactorization<T>, so
+ * lu()[b] and piv()[b] hold what LuFactorization<T>(A_b) would.  The batch is
+ * split in contiguous chunks over the matmul_nthread() threads when it is
+ * large enough, and each matrix is processed whole by one thread, so the
+ * results do not depend on the thread count.  The sizes up to 8 take fully
+ * unrolled kernels.
+ *
+ * @ingroup group_numerics
+ */
+template <typename T>
+class LuFactorizationBatch
+{
+
+    static_assert(
+        is_real_v<T> || is_complex_v<T>,
+        "LuFactorizationBatch<T> requires T to be a real or complex number type");
+
+public:
+
+    using value_type = T;
+    using real_type = typename detail::select_real_t<value_type>::type;
+    using array_type = SimpleArray<value_type>;
+    using pivot_type = SimpleArray<int64_t>;
+
+    /**
+     * Factorize every matrix of the batch.
+     *
+     * @param a  3D SimpleArray of shape (nbatch, n, n).
+     * @throws std::invalid_argument if a is not a batch of square matrices.
+     * @throws std::runtime_error    if a matrix is singular or near-singular;
+     *         the message names the lowest such index.
+     */
+    explicit LuFactorizationBatch(array_type const & a);
+
+    LuFactorizationBatch() = delete;
+    LuFactorizationBatch(LuFactorizationBatch const &) = default;
+    LuFactorizationBatch(LuFactorizationBatch &&) = default;
+    LuFactorizationBatch & operator=(LuFactorizationBatch const &) = default;
+    LuFactorizationBatch & operator=(LuFactorizationBatch &&) = default;
+    ~LuFactorizationBatch() = default;
+
+    /// The combined LU matrices of shape (nbatch, n, n).
+    array_type const & lu() const { return m_lu; }
+
+    /// The pivot vectors of shape (nbatch, n).
+    pivot_type const & piv() const { return m_piv; }
+
+    /// Number of matrices in the batch.
+    ssize_t nbatch() const { return static_cast<ssize_t>(m_lu.shape(0)); }
+
+    /// Dimension of each factorized square matrix.
+    ssize_t n() const { return static_cast<ssize_t>(m_lu.shape(1)); }
+
+    /**
+     * Solve A_b x_b = b_b for every matrix of the batch.
+     *
+     * @param b  Right-hand sides of shape (nbatch, n), or (nbatch, n, m) for
+     *           m right-hand sides per matrix.
+     * @return   The solutions with the same shape as b.
+     * @throws std::invalid_argument if the shape of b does not match.
+     */
+    array_type solve(array_type const & b) const;
+
+    /// Inverses of shape (nbatch, n, n).
+    array_type inv() const;
+
+    /// Determinants of shape (nbatch).
+    array_type det() const;
+
+private:
+
+    static small_vector<ssize_t> validate_shape(array_type const & a);
+
+    /// Call fn(first, last) over the batch, split over the threads when the
+    /// work of @p cost per matrix is large enough.
+    template <typename F>
+    void for_each_chunk(size_t cost, F && fn) const;
+
+    /// Solve in place for the nrhs columns of the row-major n-by-nrhs x.
+    void solve_one(ssize_t ibatch, value_type * x, ssize_t nrhs) const;
+
+    array_type m_lu;
+    pivot_type m_piv;
+
+    static constexpr size_t PARALLEL_MIN_WORK = 1 << 16;
+
+}; /* end class LuFactorizationBatch */
+
+template <typename T>
+small_vector<ssize_t> LuFactorizationBatch<T>::validate_shape(array_type const & a)
+{
+    if (a.ndim() != 3 || a.shape(1) != a.shape(2))
+    {
+        throw std::invalid_argument(std::format(
+            "LuFactorizationBatch: a must be a 3D SimpleArray of square matrices, but got shape {}",
+            detail::format_shape(a.shape())));
+    }
+    return a.shape();
+}
+
+template <typename T>
+LuFactorizationBatch<T>::LuFactorizationBatch(array_type const & a)
+    : m_lu(validate_shape(a))
+    , m_piv(small_vector<ssize_t>{a.shape(0), a.shape(1)})
+{
+    ssize_t const nb = a.shape(0);
+    ssize_t const m = a.shape(1);
+
+    // A dense input is copied from its first element, which need not be the
+    // start of its buffer.  A strided input is copied by index.
+    if (a.is_c_contiguous())
+    {
+        std::copy_n(a.logical_data(), a.size(), m_lu.data());
+    }
+    else
+    {
+        for (ssize_t b = 0; b < nb; ++b)
+        {
+            for (ssize_t i = 0; i < m; ++i)
+            {
+                for (ssize_t j = 0; j < m; ++j)
+                {
+                    m_lu(b, i, j) = a(b, i, j);
+                }
+            }
+        }
+    }
+    std::iota(m_piv.begin(), m_piv.end(), int64_t{0});
+
+    value_type * const lu = m_lu.data();
+    int64_t * const piv = m_piv.data();
+    for_each_chunk(
+        static_cast<size_t>(m * m * m),
+        [&](ssize_t first, ssize_t last)
+        {
+            for (ssize_t b = first; b < last; ++b)
+            {
+                if (detail::lu_factorize_unblocked(lu + (b * m * m), m, piv + (b * m)) >= 0)
+                {
+                    throw std::runtime_error(std::format(
+                        "LuFactorizationBatch: LU decomposition failed: singular or near-singular matrix at index {}.",
+                        b));
+                }
+            }
+        });
+}
+
+template <typename T>
+template <typename F>
+void LuFactorizationBatch<T>::for_each_chunk(size_t cost, F && fn) const
+{
+    ssize_t const nb = nbatch();
+    if (cost * static_cast<size_t>(nb) >= PARALLEL_MIN_WORK)
+    {
+        std::shared_ptr<ThreadPool> const pool = detail::matmul_thread_pool();
+        if (pool->nthread() > 1)
+        {
+            pool->parallel_for(ssize_t(0), nb, fn);
+            return;
+        }
+    }
+    fn(ssize_t(0), nb);
+}
+
+template <typename T>
+void LuFactorizationBatch<T>::solve_one(ssize_t ibatch, value_type * x, ssize_t nrhs) const
+{
+    ssize_t const m = n();
+    value_type const * const lu = m_lu.data() + (ibatch * m * m);
+    int64_t const * const piv = m_piv.data() + (ibatch * m);
+
+    // Replay the row swaps in the order they were recorded.
+    for (ssize_t i = 0; i < m; ++i)
+    {
+        if (piv[i] != i)
+        {
+            std::swap_ranges(x + (i * nrhs), x + ((i + 1) * nrhs), x + (piv[i] * nrhs));
+        }
+    }
+    // L y = P b, with the unit diagonal of L implied.
+    for (ssize_t i = 1; i < m; ++i)
+    {
+        value_type * xi = x + (i * nrhs);
+        for (ssize_t j = 0; j < i; ++j)
+        {
+            value_type const l = lu[(i * m) + j];
+            value_type const * xj = x + (j * nrhs);
+            for (ssize_t k = 0; k < nrhs; ++k)
+            {
+                xi[k] = xi[k] - l * xj[k];
+            }
+        }
+    }
+    // U x = y
+    for (ssize_t i = m - 1; i >= 0; --i)
+    {
+        value_type * xi = x + (i * nrhs);
+        for (ssize_t j = i + 1; j < m; ++j)
+        {
+            value_type const u = lu[(i * m) + j];
+            value_type const * xj = x + (j * nrhs);
+            for (ssize_t k = 0; k < nrhs; ++k)
+            {
+                xi[k] = xi[k] - u * xj[k];
+            }
+        }
+        value_type const d = lu[(i * m) + i];
+        for (ssize_t k = 0; k < nrhs; ++k)
+        {
+            xi[k] = xi[k] / d;
+        }
+    }
+}
+
+template <typename T>
+typename LuFactorizationBatch<T>::array_type LuFactorizationBatch<T>::solve(array_type const & b) const
+{
+    if ((b.ndim() != 2 && b.ndim() != 3) || b.shape(0) != nbatch() || b.shape(1) != n())
+    {
+        throw std::invalid_argument(std::format(
+            "LuFactorizationBatch::solve: b must be of shape ({}, {}) or ({}, {}, m), but got shape {}",
+            nbatch(),
+            n(),
+            nbatch(),
+            n(),
+            detail::format_shape(b.shape())));
+    }
+
+    ssize_t const m = n();
+    ssize_t const nrhs = b.ndim() == 3 ? b.shape(2) : 1;
+    array_type x(b.shape());
+    if (b.is_c_contiguous())
+    {
+        std::copy_n(b.logical_data(), b.size(), x.data());
+    }
+    else
+    {
+        for (ssize_t ib = 0; ib < nbatch(); ++ib)
+        {
+            for (ssize_t i = 0; i < m; ++i)
+            {
+                for (ssize_t k = 0; k < nrhs; ++k)
+                {
+                    x.data((((ib * m) + i) * nrhs) + k) = b.ndim() == 3 ? b(ib, i, k) : b(ib, i);
+                }
+            }
+        }
+    }
+    value_type * const data = x.data();
+    for_each_chunk(
+        static_cast<size_t>(m * m * nrhs),
+        [&](ssize_t first, ssize_t last)
+        {
+            for (ssize_t ib = first; ib < last; ++ib)
+            {
+                solve_one(ib, data + (ib * m * nrhs), nrhs);
+            }
+        });
+    return x;
+}
+
+template <typename T>
+typename LuFactorizationBatch<T>::array_type LuFactorizationBatch<T>::inv() const
+{
+    ssize_t const m = n();
+    array_type x(m_lu.shape(), value_type{0});
+    value_type * const data = x.data();
+    for_each_chunk(
+        static_cast<size_t>(m * m * m),
+        [&](ssize_t first, ssize_t last)
+        {
+            for (ssize_t ib = first; ib < last; ++ib)
+            {
+                value_type * xb = data + (ib * m * m);
+                for (ssize_t i = 0; i < m; ++i)
+                {
+                    xb[(i * m) + i] = value_type{1};
+                }
+                solve_one(ib, xb, m);
+            }
+        });
+    return x;
+}
+
+template <typename T>
+typename LuFactorizationBatch<T>::array_type LuFactorizationBatch<T>::det() const
+{
+    ssize_t const m = n();
+    array_type ret(small_vector<ssize_t>{nbatch()});
+    for (ssize_t ib = 0; ib < nbatch(); ++ib)
+    {
+        value_type const * lu = m_lu.data() + (ib * m * m);
+        int64_t const * piv = m_piv.data() + (ib * m);
+        value_type result{1};
+        bool negate = false;
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            result *= lu[(i * m) + i];
+            negate = piv[i] != i ? !negate : negate;
+        }
+        ret(ib) = negate ? value_type{0} - result : result;
+    }
+    return ret;
+}
+
 /**
  * Free function wrapper for LU factorization with partial pivoting.
  *
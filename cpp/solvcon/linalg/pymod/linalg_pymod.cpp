@@ -27,6 +27,7 @@ void initialize_linalg(pybind11::module & mod)
         wrap_factorization(mod);
         wrap_states_info(mod);
         wrap_kalman_filter(mod);
+        wrap_kalman_filter_bank(mod);
         wrap_EigenSystem(mod);
         wrap_LuFactorization(mod);
     };
@@ -22,6 +22,7 @@ void initialize_linalg(pybind11::module & mod);
 void wrap_factorization(pybind11::module & mod);
 void wrap_states_info(pybind11::module & mod);
 void wrap_kalman_filter(pybind11::module & mod);
+void wrap_kalman_filter_bank(pybind11::module & mod);
 void wrap_EigenSystem(pybind11::module & mod);
 void wrap_LuFactorization(pybind11::module & mod);
 
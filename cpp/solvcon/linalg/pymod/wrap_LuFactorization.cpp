@@ -83,6 +83,62 @@ WrapLuFactorization<T>::WrapLuFactorization(pybind11::module & mod, char const *
             "Compute det(A) using the cached LU factors.");
 }
 
+template <typename T>
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapLuFactorizationBatch
+    : public WrapBase<WrapLuFactorizationBatch<T>, LuFactorizationBatch<T>>
+{
+
+    using root_base_type = WrapBase<WrapLuFactorizationBatch<T>, LuFactorizationBatch<T>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+    using array_type = SimpleArray<T>;
+
+    friend root_base_type;
+
+    WrapLuFactorizationBatch(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapLuFactorizationBatch */
+
+template <typename T>
+WrapLuFactorizationBatch<T>::WrapLuFactorizationBatch(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : root_base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def(
+            py::init(
+                [](array_type const & a)
+                {
+                    return std::make_unique<wrapped_type>(a);
+                }),
+            py::arg("a"));
+
+    (*this)
+        .def_property_readonly(
+            "lu",
+            &wrapped_type::lu,
+            py::return_value_policy::reference_internal)
+        .def_property_readonly(
+            "piv",
+            &wrapped_type::piv,
+            py::return_value_policy::reference_internal)
+        .def_property_readonly("nbatch", &wrapped_type::nbatch)
+        .def_property_readonly("n", &wrapped_type::n)
+        .def(
+            "solve",
+            &wrapped_type::solve,
+            py::arg("b"),
+            "Solve A[i] x[i] = b[i] for every matrix using the cached LU factors.")
+        .def(
+            "inv",
+            &wrapped_type::inv,
+            "Compute A[i]^(-1) for every matrix using the cached LU factors.")
+        .def(
+            "det",
+            &wrapped_type::det,
+            "Compute det(A[i]) for every matrix using the cached LU factors.");
+}
+
 void wrap_LuFactorization(pybind11::module & mod)
 {
     WrapLuFactorization<float>::commit(
@@ -93,6 +149,14 @@ void wrap_LuFactorization(pybind11::module & mod)
         mod, "LuFactorizationComplex64", "LU factorization (complex64)");
     WrapLuFactorization<Complex<double>>::commit(
         mod, "LuFactorizationComplex128", "LU factorization (complex128)");
+    WrapLuFactorizationBatch<float>::commit(
+        mod, "LuFactorizationBatchFloat32", "Batched LU factorization (float32)");
+    WrapLuFactorizationBatch<double>::commit(
+        mod, "LuFactorizationBatchFloat64", "Batched LU factorization (float64)");
+    WrapLuFactorizationBatch<Complex<float>>::commit(
+        mod, "LuFactorizationBatchComplex64", "Batched LU factorization (complex64)");
+    WrapLuFactorizationBatch<Complex<double>>::commit(
+        mod, "LuFactorizationBatchComplex128", "Batched LU factorization (complex128)");
 }
 
 } /* end namespace python */
@@ -147,23 +147,123 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapKalmanFilter
                 py::arg("z"))
             .def(
                 "batch_filter",
-                [](wrapped_type & self, array_type const & zs, array_type const & us)
+                [](wrapped_type & self, array_type const & zs, array_type const & us, std::string const & mode)
                 {
-                    return self.batch_filter(zs, us);
+                    return self.batch_filter(zs, us, kalman_batch_mode_from_string(mode));
                 },
                 py::arg("zs"),
-                py::arg("us"))
+                py::arg("us"),
+                py::arg("mode") = "standard")
             .def(
                 "batch_filter",
-                [](wrapped_type & self, array_type const & zs)
+                [](wrapped_type & self, array_type const & zs, std::string const & mode)
                 {
-                    return self.batch_filter(zs);
+                    return self.batch_filter(zs, kalman_batch_mode_from_string(mode));
                 },
-                py::arg("zs"));
+                py::arg("zs"),
+                py::arg("mode") = "standard")
+            .def(
+                "steady_state_covariance",
+                &wrapped_type::steady_state_covariance)
+            .def(
+                "steady_state_gain",
+                &wrapped_type::steady_state_gain);
     }
 
 }; /* end class WrapKalmanFilter */
 
+template <typename T>
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapKalmanFilterBank
+    : public WrapBase<WrapKalmanFilterBank<T>, KalmanFilterBank<T>>
+{
+    using base_type = WrapBase<WrapKalmanFilterBank<T>, KalmanFilterBank<T>>;
+    using wrapped_type = typename base_type::wrapped_type;
+    using array_type = SimpleArray<T>;
+    using real_type = typename wrapped_type::real_type;
+
+    friend base_type;
+
+    WrapKalmanFilterBank(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        auto const make_b = [](py::object const & b, array_type const & x)
+        {
+            if (b.is_none())
+            {
+                return array_type(small_vector<ssize_t>{x.ndim() == 2 ? x.shape(1) : 0, 0});
+            }
+            return b.cast<array_type>();
+        };
+
+        (*this)
+            .def(
+                py::init(
+                    [make_b](array_type const & x,
+                             array_type const & f,
+                             py::object const & b,
+                             array_type const & h,
+                             real_type process_noise,
+                             real_type measurement_noise,
+                             real_type jitter)
+                    {
+                        return wrapped_type(x, f, make_b(b, x), h, process_noise, measurement_noise, jitter);
+                    }),
+                py::arg("x"),
+                py::arg("f"),
+                py::arg("b") = py::none(),
+                py::arg("h"),
+                py::arg("process_noise"),
+                py::arg("measurement_noise"),
+                py::arg("jitter") = static_cast<real_type>(1e-9))
+            .def(
+                py::init(
+                    [make_b](array_type const & x,
+                             array_type const & f,
+                             py::object const & b,
+                             array_type const & h,
+                             array_type const & q,
+                             array_type const & r,
+                             array_type const & p,
+                             real_type jitter)
+                    {
+                        return wrapped_type(x, f, make_b(b, x), h, q, r, p, jitter);
+                    }),
+                py::arg("x"),
+                py::arg("f"),
+                py::arg("b") = py::none(),
+                py::arg("h"),
+                py::arg("q"),
+                py::arg("r"),
+                py::arg("p"),
+                py::arg("jitter") = static_cast<real_type>(1e-9))
+            .def_property_readonly("ntrack", &wrapped_type::ntrack)
+            .def_property_readonly("state_size", &wrapped_type::state_size)
+            .def_property_readonly("measurement_size", &wrapped_type::measurement_size)
+            .def_property_readonly("control_size", &wrapped_type::control_size)
+            .def_property_readonly("states", &wrapped_type::states)
+            .def_property_readonly("covariances", &wrapped_type::covariances)
+            .def("state", &wrapped_type::state, py::arg("track"))
+            .def("covariance", &wrapped_type::covariance, py::arg("track"))
+            .def("set_track", &wrapped_type::set_track, py::arg("track"), py::arg("x"), py::arg("p"))
+            .def(
+                "predict",
+                [](wrapped_type & self)
+                { self.predict(); })
+            .def(
+                "predict",
+                [](wrapped_type & self, array_type const & us)
+                { self.predict(us); },
+                py::arg("us"))
+            .def(
+                "update",
+                &wrapped_type::update,
+                py::arg("zs"));
+    }
+
+}; /* end class WrapKalmanFilterBank */
+
 void wrap_states_info(pybind11::module & mod)
 {
     WrapKalmanStateInfo<float>::commit(mod, "KalmanStateInfoFp32", "KalmanStateInfoFp32");
@@ -180,6 +280,14 @@ void wrap_kalman_filter(pybind11::module & mod)
     WrapKalmanFilter<Complex<double>>::commit(mod, "KalmanFilterComplex128", "Kalman Filter (complex double)");
 }
 
+void wrap_kalman_filter_bank(pybind11::module & mod)
+{
+    WrapKalmanFilterBank<float>::commit(mod, "KalmanFilterBankFp32", "Bank of Kalman filters sharing one model (float)");
+    WrapKalmanFilterBank<double>::commit(mod, "KalmanFilterBankFp64", "Bank of Kalman filters sharing one model (double)");
+    WrapKalmanFilterBank<Complex<float>>::commit(mod, "KalmanFilterBankComplex64", "Bank of Kalman filters sharing one model (complex float)");
+    WrapKalmanFilterBank<Complex<double>>::commit(mod, "KalmanFilterBankComplex128", "Bank of Kalman filters sharing one model (complex double)");
+}
+
 } /* end namespace python */
 
 } /* end namespace solvcon */
@@ -73,6 +73,19 @@ inline auto real(T const & val)
     }
 }
 
+template <typename T>
+inline T conj(T const & val)
+{
+    if constexpr (is_complex_v<T>)
+    {
+        return val.conj();
+    }
+    else
+    {
+        return val;
+    }
+}
+
 template <typename T>
 inline auto abs(T const & val)
 {
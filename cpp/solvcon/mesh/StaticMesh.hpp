@@ -15,9 +15,12 @@
 #include <solvcon/base.hpp>
 #include <solvcon/toggle/toggle.hpp>
 #include <solvcon/buffer/buffer.hpp>
+#include <solvcon/parallel/ThreadPool.hpp>
 
 #include <cmath>
+#include <format>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <numeric>
@@ -250,6 +253,53 @@ public:
 
 }; /* end class StaticMeshBc */
 
+/**
+ * Entity ordering applied by StaticMesh::reorder.
+ */
+enum class MeshOrdering : uint8_t
+{
+    RCM = 0, ///< Reverse Cuthill-McKee over the face-neighbor cell graph.
+    HILBERT = 1, ///< Hilbert curve through the cell centroids.
+    MORTON = 2, ///< Morton (Z-order) curve through the cell centroids.
+}; /* end enum class MeshOrdering */
+
+inline MeshOrdering mesh_ordering_from_string(std::string const & ordering)
+{
+    if (ordering == "rcm")
+    {
+        return MeshOrdering::RCM;
+    }
+    if (ordering == "hilbert")
+    {
+        return MeshOrdering::HILBERT;
+    }
+    if (ordering == "morton")
+    {
+        return MeshOrdering::MORTON;
+    }
+    throw std::invalid_argument(
+        std::format("StaticMesh: ordering '{}' not supported", ordering));
+}
+
+namespace inout
+{
+class Snapshot;
+} /* end namespace inout */
+
+/**
+ * Permutations produced by StaticMesh::reorder.  Each array maps a new index
+ * to the old one (new-to-old), so old_array[cell] gathers a per-cell array of
+ * the old numbering into the new one.
+ *
+ * @ingroup group_mesh
+ */
+struct StaticMeshPermutation
+{
+    SimpleArray<int32_t> node;
+    SimpleArray<int32_t> face;
+    SimpleArray<int32_t> cell;
+}; /* end struct StaticMeshPermutation */
+
 /**
  * Static unstructured mesh storing nodes, faces, and cells of mixed element
  * types.
@@ -307,6 +357,7 @@ public:
         , m_clfcs(small_vector<ssize_t>{static_cast<ssize_t>(ncell), CLMFC + 1})
         , m_ednds(small_vector<ssize_t>{0, 2})
         , m_bndfcs(small_vector<ssize_t>{0, StaticMeshBc::BFREL})
+        , m_pool(ThreadPool::shared(ThreadPool::toggle_nthread("mesh.nthread")))
     {
     }
     StaticMesh() = delete;
@@ -360,6 +411,13 @@ public:
     // Helpers for interior data.
 public:
 
+    // Threads build_faces_from_cells and build_edge are partitioned over.
+    // The initial count is read from the toggle "mesh.nthread" (1 when it is
+    // not declared); 0 selects one thread per hardware thread.  The
+    // connectivity does not depend on the count.
+    size_t nthread() const { return m_pool->nthread(); }
+    void set_nthread(size_t nthread);
+
     void build_interior(bool do_metric, bool do_edge = true)
     {
         build_faces_from_cells();
@@ -403,6 +461,28 @@ private:
     std::tuple<ssize_t, ssize_t, ssize_t> count_ghost() const;
     void fill_ghost();
 
+    // Renumbering for memory locality.
+public:
+
+    /**
+     * Renumber the cells by @p ordering, then the faces and the nodes in the
+     * order the renumbered cells first reference them, so that neighboring
+     * entities sit close in memory.
+     *
+     * The interior must be built; the Hilbert and Morton orderings also need
+     * the metric (cell centroids).  Every table, including the ghost rows,
+     * bndfcs, and the boundary-condition groups, is rewritten consistently.
+     * The ghost entities, the order of bndfcs, and the face orientation stay
+     * as they are, so the result equals building the permuted mesh.  Reorder
+     * before constructing a solver on the mesh.
+     *
+     * @return the new-to-old node, face, and cell permutations.
+     */
+    StaticMeshPermutation reorder(MeshOrdering ordering);
+
+    // Restores the counts of a saved mesh without rebuilding it.
+    friend class inout::Snapshot;
+
     // Shape data.
 private:
 
@@ -453,6 +533,8 @@ private:                                                                \
 
 #undef MM_DECL_StaticMesh_ARRAY
 
+    std::shared_ptr<ThreadPool> m_pool;
+
 }; /* end class StaticMesh */
 
 } /* end namespace solvcon */
@@ -5,7 +5,14 @@
 
 #include <solvcon/mesh/StaticMesh.hpp>
 
-#include <set>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
 
 namespace solvcon
 {
@@ -13,6 +20,168 @@ namespace solvcon
 namespace detail
 {
 
+/// Finalizer of splitmix64, spreading every input bit over the hash.
+inline uint64_t mix_hash(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * Return the exclusive prefix sum of count(i) for i in [0, n), with the total
+ * appended, computed over the chunks of the pool.
+ */
+template <typename F>
+std::vector<size_t> exclusive_scan(ThreadPool & pool, size_t n, F && count)
+{
+    std::vector<size_t> ret(n + 1, 0);
+    size_t const nchunk = std::max(std::min(pool.nthread(), n), size_t(1));
+    std::vector<size_t> sums(nchunk, 0);
+    pool.run(
+        nchunk,
+        [&](size_t ichunk)
+        {
+            size_t sum = 0;
+            for (size_t i = n * ichunk / nchunk; i < n * (ichunk + 1) / nchunk; ++i)
+            {
+                ret[i] = sum;
+                sum += count(i);
+            }
+            sums[ichunk] = sum;
+        });
+    ret[n] = std::accumulate(sums.begin(), sums.end(), size_t(0));
+    std::exclusive_scan(sums.begin(), sums.end(), sums.begin(), size_t(0));
+    pool.run(
+        nchunk,
+        [&](size_t ichunk)
+        {
+            for (size_t i = n * ichunk / nchunk; i < n * (ichunk + 1) / nchunk; ++i)
+            {
+                ret[i] += sums[ichunk];
+            }
+        });
+    return ret;
+}
+
+constexpr uint32_t NO_DUPLICATE = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Find the first occurrence of each of n keys, in parallel.
+ *
+ * The item indices are scattered into one shard per thread by the high bits
+ * of hash(i), keeping them in ascending order within a shard, so a key lives
+ * in exactly one shard.  Each thread then owns the open-addressing table of
+ * its shard and needs no locking.  Because a shard is scanned in ascending
+ * order, the first item inserted for a key is its lowest index.
+ *
+ * @param[out] first   first[i] is the lowest index holding the key of i.
+ * @param[out] second  When not null, second[i] of a first occurrence i is the
+ *                     second lowest index holding the key, or NO_DUPLICATE.
+ */
+template <typename Hash, typename Equal>
+void find_duplicates(
+    ThreadPool & pool, size_t n, Hash && hash, Equal && equal, std::vector<uint32_t> & first, std::vector<uint32_t> * second)
+{
+    if (n >= NO_DUPLICATE)
+    {
+        throw std::length_error(std::format("StaticMesh: {} items exceed the deduplication limit", n));
+    }
+    first.resize(n);
+    if (second != nullptr)
+    {
+        second->assign(n, NO_DUPLICATE);
+    }
+    std::vector<uint64_t> hashes(n);
+    pool.parallel_for(
+        size_t(0),
+        n,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                hashes[i] = hash(i);
+            }
+        });
+
+    size_t const nshard = std::max(std::min(pool.nthread(), n), size_t(1));
+    auto shard_of = [nshard](uint64_t h)
+    { return static_cast<size_t>((h >> 32) % nshard); };
+
+    // Stable scatter of the indices into the shards: count, offset, place.
+    std::vector<size_t> offsets(nshard * nshard, 0);
+    pool.run(
+        nshard,
+        [&](size_t ichunk)
+        {
+            for (size_t i = n * ichunk / nshard; i < n * (ichunk + 1) / nshard; ++i)
+            {
+                ++offsets[(ichunk * nshard) + shard_of(hashes[i])];
+            }
+        });
+    std::vector<size_t> shard_begin(nshard + 1, 0);
+    size_t acc = 0;
+    for (size_t ishard = 0; ishard < nshard; ++ishard)
+    {
+        shard_begin[ishard] = acc;
+        for (size_t ichunk = 0; ichunk < nshard; ++ichunk)
+        {
+            size_t const count = offsets[(ichunk * nshard) + ishard];
+            offsets[(ichunk * nshard) + ishard] = acc;
+            acc += count;
+        }
+    }
+    shard_begin[nshard] = acc;
+    std::vector<uint32_t> items(n);
+    pool.run(
+        nshard,
+        [&](size_t ichunk)
+        {
+            size_t * const offset = &offsets[ichunk * nshard];
+            for (size_t i = n * ichunk / nshard; i < n * (ichunk + 1) / nshard; ++i)
+            {
+                items[offset[shard_of(hashes[i])]++] = static_cast<uint32_t>(i);
+            }
+        });
+
+    pool.run(
+        nshard,
+        [&](size_t ishard)
+        {
+            size_t const begin = shard_begin[ishard];
+            size_t const end = shard_begin[ishard + 1];
+            size_t const mask = std::bit_ceil(std::max((end - begin) * 2, size_t(16))) - 1;
+            std::vector<uint32_t> table(mask + 1, NO_DUPLICATE);
+            for (size_t k = begin; k < end; ++k)
+            {
+                uint32_t const i = items[k];
+                uint64_t const h = hashes[i];
+                for (size_t slot = h & mask;; slot = (slot + 1) & mask)
+                {
+                    uint32_t const j = table[slot];
+                    if (j == NO_DUPLICATE)
+                    {
+                        table[slot] = i;
+                        first[i] = i;
+                        break;
+                    }
+                    if (hashes[j] == h && equal(j, i))
+                    {
+                        first[i] = j;
+                        if (second != nullptr && (*second)[j] == NO_DUPLICATE)
+                        {
+                            (*second)[j] = i;
+                        }
+                        break;
+                    }
+                }
+            }
+        });
+}
+
 template <typename N>
 struct FaceBuilder
     : public StaticMeshConstant
@@ -308,249 +477,222 @@ struct FaceBuilder
     }
 
     // Data members.
+    ThreadPool & pool;
     size_t nnode = 0;
-    size_t nface = 0;
-    size_t mface = 0;
     SimpleArray<int_type> const & cltpn;
     SimpleArray<int_type> const & clnds;
+    std::vector<size_t> clofs{}; // first face of each cell before deduplication.
+    size_t mface = 0;
+    size_t nface = 0;
     SimpleArray<int_type> clfcs{};
     SimpleArray<int_type> fctpn{};
     SimpleArray<int_type> fcnds{};
     SimpleArray<int_type> fccls{};
-    std::vector<uint_type> dedupmap{};
+    std::vector<int_type> fcown{}; // cell of each face before deduplication.
 
     // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-    FaceBuilder(size_t nnode_in, SimpleArray<int_type> const & cltpn_in, SimpleArray<int_type> const & clnds_in)
-        : nnode(nnode_in)
-        , nface(count_mface(cltpn_in))
-        , mface(nface)
+    FaceBuilder(ThreadPool & pool_in, size_t nnode_in, SimpleArray<int_type> const & cltpn_in, SimpleArray<int_type> const & clnds_in)
+        : pool(pool_in)
+        , nnode(nnode_in)
         , cltpn(cltpn_in)
         , clnds(clnds_in)
+        , clofs(exclusive_scan(
+              pool_in,
+              static_cast<size_t>(cltpn_in.nbody()),
+              [&cltpn_in](size_t icl)
+              { return static_cast<size_t>(CellType::by_id(static_cast<uint8_t>(cltpn_in(icl))).nface()); }))
+        , mface(clofs.back())
+        , nface(mface)
         , clfcs(shape_type{cltpn.nbody(), CLMFC + 1}, -1)
         , fctpn(shape_type{static_cast<ssize_t>(mface)}, -1)
         , fcnds(shape_type{static_cast<ssize_t>(mface), FCMND + 1}, -1)
-        , fccls(shape_type{static_cast<ssize_t>(mface), FCREL}, -1)
-        , dedupmap(mface)
+        , fcown(mface, -1)
     {
         populate();
-        make_dedupmap();
-        remap_face();
-    }
-
-    static size_t count_mface(SimpleArray<int_type> const & tcltpn)
-    {
-        // clang-format off
-        return std::accumulate
-        (
-            tcltpn.body(), tcltpn.body()+tcltpn.nbody(), static_cast<size_t>(0)
-          , [](size_t a, uint8_t b){ return a + static_cast<size_t>(CellType::by_id(b).nface()); }
-        );
-        // clang-format on
+        deduplicate();
     }
 
+    /**
+     * Extract the faces of every cell, cell icl writing its faces from
+     * clofs[icl] on.  Cells write disjoint rows and run in parallel.
+     */
     void populate()
     {
-        int_type ifc = 0;
-        for (int icl = 0; icl < static_cast<int_type>(cltpn.nbody()); ++icl)
-        {
-            switch (cltpn(icl))
+        auto const ncell = static_cast<int_type>(cltpn.nbody());
+        pool.parallel_for(
+            int_type(0),
+            ncell,
+            [this](int_type first, int_type last)
             {
-            case CellType::POINT:
-                ifc += static_cast<int_type>(add_point(icl, ifc));
-                break;
-            case CellType::LINE:
-                ifc += static_cast<int_type>(add_line(icl, ifc));
-                break;
-            case CellType::QUADRILATERAL:
-                ifc += static_cast<int_type>(add_quadrilateral(icl, ifc));
-                break;
-            case CellType::TRIANGLE:
-                ifc += static_cast<int_type>(add_triangle(icl, ifc));
-                break;
-            case CellType::HEXAHEDRON:
-                ifc += static_cast<int_type>(add_hexahedron(icl, ifc));
-                break;
-            case CellType::TETRAHEDRON:
-                ifc += static_cast<int_type>(add_tetrahedron(icl, ifc));
-                break;
-            case CellType::PRISM:
-                ifc += static_cast<int_type>(add_prism(icl, ifc));
-                break;
-            case CellType::PYRAMID:
-                ifc += static_cast<int_type>(add_pyramid(icl, ifc));
-                break;
-            default:
-                break;
-            }
-        }
-    }
-
-    SimpleArray<int_type> make_ndfcs()
-    {
-        // first pass: get the maximum number of faces.
-        std::vector<size_t> ndnfc(nnode, 0);
-        for (size_t ifc = 0; ifc < mface; ++ifc)
-        {
-            int_type const fcnnd = fcnds(ifc, 0);
-            for (int_type const * p = fcnds.vptr(ifc, 1); p != fcnds.vptr(ifc, fcnnd + 1); ++p)
-            {
-                ndnfc[*p] += 1;
-            }
-        }
-
-        // second pass: scan again to build hash table.
-        size_t const ndmfc = *std::max_element(ndnfc.begin(), ndnfc.end());
-        SimpleArray<int_type> ndfcs(shape_type{static_cast<ssize_t>(nnode), static_cast<ssize_t>(ndmfc) + 1});
-        for (size_t ind = 0; ind < nnode; ++ind)
-        {
-            ndfcs(ind, 0) = 0;
-            for (size_t it = 1; it <= ndmfc; ++it)
-            {
-                ndfcs(ind, it) = -1;
-            }
-        }
-        for (size_t ifc = 0; ifc < mface; ++ifc)
-        {
-            int_type const fcnnd = fcnds(ifc, 0);
-            for (int_type const * p = fcnds.vptr(ifc, 1); p != fcnds.vptr(ifc, fcnnd + 1); ++p)
-            {
-                ndfcs(*p, 0) += 1;
-                ndfcs(*p, ndfcs(*p, 0)) = static_cast<int_type>(ifc);
-            }
-        }
-
-        return ndfcs;
+                for (int_type icl = first; icl < last; ++icl)
+                {
+                    auto const ifc = static_cast<int_type>(clofs[icl]);
+                    size_t nfc = 0;
+                    switch (cltpn(icl))
+                    {
+                    case CellType::POINT:
+                        nfc = add_point(icl, ifc);
+                        break;
+                    case CellType::LINE:
+                        nfc = add_line(icl, ifc);
+                        break;
+                    case CellType::QUADRILATERAL:
+                        nfc = add_quadrilateral(icl, ifc);
+                        break;
+                    case CellType::TRIANGLE:
+                        nfc = add_triangle(icl, ifc);
+                        break;
+                    case CellType::HEXAHEDRON:
+                        nfc = add_hexahedron(icl, ifc);
+                        break;
+                    case CellType::TETRAHEDRON:
+                        nfc = add_tetrahedron(icl, ifc);
+                        break;
+                    case CellType::PRISM:
+                        nfc = add_prism(icl, ifc);
+                        break;
+                    case CellType::PYRAMID:
+                        nfc = add_pyramid(icl, ifc);
+                        break;
+                    default:
+                        break;
+                    }
+                    std::fill_n(fcown.begin() + ifc, nfc, icl);
+                }
+            });
     }
 
     /**
-     * @brief Build the (hash) table to know what faces connect to each node.
+     * Merge the faces having the same type and node set.
+     *
+     * The faces are keyed by their type and sorted nodes and hashed into
+     * shards (see find_duplicates).  The first occurrence of a face is kept,
+     * and the kept faces are numbered in their original order, the cell of the
+     * first occurrence becoming fccls[0] and the cell of the second fccls[1].
+     * That is the numbering the serial node-to-face scan used to produce.
      */
-    void make_dedupmap()
+    void deduplicate()
     {
-        auto const & ndfcs = make_ndfcs();
+        using key_type = std::array<int_type, FCMND + 1>;
+        std::vector<key_type> keys(mface);
+        pool.parallel_for(
+            size_t(0),
+            mface,
+            [this, &keys](size_t first, size_t last)
+            {
+                for (size_t ifc = first; ifc < last; ++ifc)
+                {
+                    key_type & key = keys[ifc];
+                    key.fill(-1);
+                    key[0] = fctpn(ifc);
+                    int_type const nnd = fcnds(ifc, 0);
+                    std::copy_n(fcnds.vptr(ifc, 1), nnd, key.begin() + 1);
+                    std::sort(key.begin() + 1, key.begin() + 1 + nnd);
+                }
+            });
 
-        auto check_match = [this](int_type const ifc, int_type const jfc)
-        {
-            int_type cond = 0;
-            // scan all nodes in ifc and jfc to see if all the same.
-            for (int_type jnf = 1; jnf <= fcnds(jfc, 0); ++jnf)
+        std::vector<uint32_t> dup;
+        std::vector<uint32_t> second;
+        find_duplicates(
+            pool,
+            mface,
+            [&keys](size_t ifc)
             {
-                // clang-format off
-                auto result = std::find
-                (
-                    fcnds.vptr(ifc, 1)
-                  , fcnds.vptr(ifc, fcnds(ifc, 0)+1)
-                  , fcnds(jfc, jnf)
-                );
-                // clang-format off
-                if (result != fcnds.vptr(ifc, fcnds(ifc, 0)+1))
+                uint64_t h = 0;
+                for (int_type const v : keys[ifc])
                 {
-                    ++cond;
+                    h = mix_hash(h ^ static_cast<uint32_t>(v));
                 }
-            }
-            return cond;
-        };
+                return h;
+            },
+            [&keys](size_t ifc, size_t jfc)
+            { return keys[ifc] == keys[jfc]; },
+            dup,
+            &second);
 
-        // scan for duplicated faces and build duplication map.
-        std::iota(dedupmap.begin(), dedupmap.end(), 0);
-        for (size_t ifc = 0 ; ifc < mface ; ++ifc)
-        {
-            if (dedupmap[ifc] == ifc)
+        std::vector<size_t> const newfc = exclusive_scan(
+            pool, mface, [&dup](size_t ifc)
+            { return static_cast<size_t>(dup[ifc] == ifc ? 1 : 0); });
+        nface = newfc.back();
+
+        // Compact the kept faces and build the face neighboring.
+        SimpleArray<int_type> nfctpn(shape_type{static_cast<ssize_t>(nface)});
+        SimpleArray<int_type> nfcnds(shape_type{static_cast<ssize_t>(nface), FCMND + 1});
+        SimpleArray<int_type> nfccls(shape_type{static_cast<ssize_t>(nface), FCREL}, -1);
+        pool.parallel_for(
+            size_t(0),
+            mface,
+            [&](size_t first, size_t last)
             {
-                int_type const ind = fcnds(ifc, 1); // take only the FIRST node of a face.
-                for (int_type it = 1 ; it <= ndfcs(ind, 0) ; ++it)
+                for (size_t ifc = first; ifc < last; ++ifc)
                 {
-                    size_t const jfc = ndfcs(ind, it);
-                    // test for duplication.
-                    if
-                    (
-                        (jfc != ifc)
-                     && (fctpn(jfc) == fctpn(ifc))
-                     && (check_match(static_cast<int_type>(ifc), static_cast<int_type>(jfc)) == fcnds(static_cast<int_type>(jfc), 0))
-                    )
+                    if (dup[ifc] != ifc)
                     {
-                        dedupmap[jfc] = static_cast<uint_type>(ifc);  // record duplication.
+                        continue;
+                    }
+                    size_t const jfc = newfc[ifc];
+                    nfctpn(jfc) = fctpn(ifc);
+                    std::copy_n(fcnds.vptr(ifc, 0), FCMND + 1, nfcnds.vptr(jfc, 0));
+                    nfccls(jfc, 0) = fcown[ifc];
+                    if (second[ifc] != NO_DUPLICATE)
+                    {
+                        nfccls(jfc, 1) = fcown[second[ifc]];
                     }
                 }
-            }
-        }
-    }
+            });
 
-    void remap_face()
-    {
-        // use the duplication map to remap nodes in faces, and build renewed map.
-        std::vector<int_type> map2(mface);
-        {
-            size_t jfc = 0;
-            for (size_t ifc = 0 ; ifc < mface ; ++ifc)
+        // Rebuild the faces in cells with the renewed face numbers.
+        pool.parallel_for(
+            ssize_t(0),
+            cltpn.nbody(),
+            [&](ssize_t first, ssize_t last)
             {
-                if (dedupmap[ifc] == ifc)
+                for (ssize_t icl = first; icl < last; ++icl)
                 {
-                    //std::copy(fcnds.vptr(ifc, 0), fcnds.vptr(ifc, CellType::FCMND), fcnds.vptr(jfc));
-                    for (int_type inf = 0 ; inf <= FCMND ; ++inf)
+                    for (int_type ifl = 1; ifl <= clfcs(icl, 0); ++ifl)
                     {
-                        fcnds(jfc, inf) = fcnds(ifc, inf);
+                        int_type & ifc = clfcs(icl, ifl);
+                        ifc = static_cast<int_type>(newfc[dup[ifc]]);
                     }
-                    fctpn(jfc) = fctpn(ifc);
-                    map2[ifc] = static_cast<int_type>(jfc);
-                    // increment j-face.
-                    jfc += 1;
                 }
-                else
-                {
-                    map2[ifc] = map2[dedupmap[ifc]];
-                }
-            }
-            nface = jfc; // record deduplicated number of face.
-        }
+            });
 
-        // rebuild faces in cells and build face neighboring, according to the
-        // renewed face map.
-        size_t const ncell = cltpn.nbody();
-        for (size_t icl = 0 ; icl < ncell ; ++icl)
-        {
-            for (int_type ifl = 1 ; ifl <= clfcs(icl, 0) ; ++ifl)
-            {
-                int_type const ifc = clfcs(icl, ifl);
-                int_type const jfc = map2[ifc];
-                // rebuild faces in cells.
-                clfcs(icl, ifl) = jfc;
-                // build face neighboring.
-                if      (-1 == fccls(jfc, 0)) { fccls(jfc, 0) = static_cast<int_type>(icl); }
-                else if (-1 == fccls(jfc, 1)) { fccls(jfc, 1) = static_cast<int_type>(icl); }
-            }
-        }
+        fctpn.swap(nfctpn);
+        fcnds.swap(nfcnds);
+        fccls.swap(nfccls);
     }
 
     void rebuild_fctpn(decltype(fctpn) & ofctpn)
     {
-        ofctpn.remake(shape_type{static_cast<ssize_t>(nface)});
-        std::copy(fctpn.vptr(0), fctpn.vptr(nface), ofctpn.vptr(0));
+        ofctpn.swap(fctpn);
     }
 
     void rebuild_fcnds(decltype(fcnds) & ofcnds)
     {
-        ofcnds.remake(shape_type{static_cast<ssize_t>(nface), FCMND+1});
-        std::copy(fcnds.vptr(0, 0), fcnds.vptr(nface, 0), ofcnds.vptr(0, 0));
+        ofcnds.swap(fcnds);
     }
 
     void rebuild_fccls(decltype(fccls) & ofccls)
     {
-        ofccls.remake(shape_type{static_cast<ssize_t>(nface), FCREL});
-        std::copy(fccls.vptr(0, 0), fccls.vptr(nface, 0), ofccls.vptr(0, 0));
+        ofccls.swap(fccls);
     }
 
 }; /* end struct FaceBuilder */
 
 } /* end namespace detail */
 
+void StaticMesh::set_nthread(size_t nthread)
+{
+    m_pool = ThreadPool::shared(nthread);
+}
+
 /**
  * Extract interier faces from node list of cells.  Subroutine is designed to
  * handle all types of cells.
  */
 void StaticMesh::build_faces_from_cells()
 {
-    detail::FaceBuilder<number_base> fb(m_nnode, m_cltpn, m_clnds);
+    detail::FaceBuilder<number_base> fb(*m_pool, m_nnode, m_cltpn, m_clnds);
     m_nface = static_cast<uint_type>(fb.nface);
 
     // recreate member tables.
@@ -563,50 +705,72 @@ void StaticMesh::build_faces_from_cells()
     std::copy(fb.clfcs.vptr(0, 0), fb.clfcs.vptr(m_ncell, 0), m_clfcs.vptr(0, 0));
 }
 
+/**
+ * Collect the distinct edges of the faces, lower node first, in the order
+ * they first appear.  Like the faces, the edges are deduplicated by hashing
+ * in parallel.
+ */
 void StaticMesh::build_edge()
 {
-    using etype = std::pair<int32_t, int32_t>;
-    std::set<etype> known_edges;
-    std::vector<etype> edges;
+    ThreadPool & pool = *m_pool;
 
-    size_t nedge_max = 0;
-    for (uint32_t ifc = 0; ifc < nface(); ++ifc)
-    {
-        nedge_max += fcnds(ifc, 0);
-    }
-    edges.reserve(nedge_max);
-    // Can we optimize the memory allocation for the known_edges (std::set) too?
-
-    for (uint32_t ifc = 0; ifc < nface(); ++ifc)
-    {
-        for (int32_t inf = 1; inf <= fcnds(ifc, 0); ++inf)
+    // One packed (lower, higher) node pair per edge occurrence.
+    std::vector<size_t> const fcofs = detail::exclusive_scan(
+        pool, nface(), [this](size_t ifc)
+        { return static_cast<size_t>(m_fcnds(ifc, 0)); });
+    std::vector<uint64_t> keys(fcofs.back());
+    pool.parallel_for(
+        size_t(0),
+        static_cast<size_t>(nface()),
+        [this, &fcofs, &keys](size_t first, size_t last)
         {
-            // Determine the edge of this node index.
-            unsigned int const idx1 = (fcnds(ifc, 0) == inf) ? 1 : inf+1;
-            int32_t nd0 = fcnds(ifc, inf);
-            int32_t nd1 = fcnds(ifc, idx1);
-            if (nd0 > nd1) // Lower node index goes first.
+            for (size_t ifc = first; ifc < last; ++ifc)
             {
-                std::swap(nd0, nd1);
-            }
-            // Add the edge to the container array.
-            etype const edge(nd0, nd1);
-            if (0 == known_edges.count(edge))
-            {
-                edges.push_back(edge);
-                known_edges.insert(edge);
+                int32_t const nnd = m_fcnds(ifc, 0);
+                for (int32_t inf = 1; inf <= nnd; ++inf)
+                {
+                    // Determine the edge of this node index.
+                    int32_t nd0 = m_fcnds(ifc, inf);
+                    int32_t nd1 = m_fcnds(ifc, (nnd == inf) ? 1 : inf + 1);
+                    if (nd0 > nd1) // Lower node index goes first.
+                    {
+                        std::swap(nd0, nd1);
+                    }
+                    keys[fcofs[ifc] + inf - 1] = (static_cast<uint64_t>(static_cast<uint32_t>(nd0)) << 32) | static_cast<uint32_t>(nd1);
+                }
             }
-        }
-    }
+        });
+
+    std::vector<uint32_t> dup;
+    detail::find_duplicates(
+        pool,
+        keys.size(),
+        [&keys](size_t ied)
+        { return detail::mix_hash(keys[ied]); },
+        [&keys](size_t ied, size_t jed)
+        { return keys[ied] == keys[jed]; },
+        dup,
+        nullptr);
+    std::vector<size_t> const newed = detail::exclusive_scan(
+        pool, keys.size(), [&dup](size_t ied)
+        { return static_cast<size_t>(dup[ied] == ied ? 1 : 0); });
 
     // Build the edge node array and populate.
-    m_ednds.remake(small_vector<ssize_t>{static_cast<ssize_t>(edges.size()), 2}, 0);
-    for (size_t ied = 0; ied < edges.size(); ++ied)
-    {
-        etype const edge = edges[ied];
-        m_ednds(ied, 0) = edge.first;
-        m_ednds(ied, 1) = edge.second;
-    }
+    m_ednds.remake(small_vector<ssize_t>{static_cast<ssize_t>(newed.back()), 2}, 0);
+    pool.parallel_for(
+        size_t(0),
+        keys.size(),
+        [this, &keys, &dup, &newed](size_t first, size_t last)
+        {
+            for (size_t ied = first; ied < last; ++ied)
+            {
+                if (dup[ied] == ied)
+                {
+                    m_ednds(newed[ied], 0) = static_cast<int32_t>(keys[ied] >> 32);
+                    m_ednds(newed[ied], 1) = static_cast<int32_t>(keys[ied] & 0xffffffff);
+                }
+            }
+        });
 }
 
 /**
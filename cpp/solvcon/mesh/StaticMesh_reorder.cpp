@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * Renumbering of StaticMesh entities for memory locality.  The solvers gather
+ * neighbor-cell data through fccls and clfcs, and the gathers hit the cache
+ * only when neighbors have close indices.
+ */
+
+#include <solvcon/mesh/StaticMesh.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace solvcon
+{
+
+namespace detail
+{
+
+using index_vector = std::vector<int32_t>;
+
+/**
+ * Face-neighbor cell graph in the compressed sparse row layout.  Ghost
+ * neighbors are left out.
+ */
+struct CellGraph
+{
+    explicit CellGraph(StaticMesh const & mh)
+        : offset(mh.ncell() + 1, 0)
+    {
+        auto const ncell = static_cast<int32_t>(mh.ncell());
+        neighbor.reserve(static_cast<size_t>(ncell) * StaticMesh::CLMFC);
+        for (int32_t icl = 0; icl < ncell; ++icl)
+        {
+            for (int32_t ifl = 1; ifl <= mh.clfcs(icl, 0); ++ifl)
+            {
+                int32_t const jcl = mh.fcrcl(mh.clfcs(icl, ifl), icl);
+                if (jcl >= 0 && jcl != icl)
+                {
+                    neighbor.push_back(jcl);
+                }
+            }
+            offset[icl + 1] = static_cast<int32_t>(neighbor.size());
+        }
+    }
+
+    int32_t degree(int32_t icl) const { return offset[icl + 1] - offset[icl]; }
+
+    index_vector offset;
+    index_vector neighbor;
+}; /* end struct CellGraph */
+
+/**
+ * Breadth-first search from @p root that records the level of each reached
+ * cell in @p level and returns the cells of the last level.  The levels are
+ * reset to -1 before returning so the buffer can be reused.
+ */
+std::pair<int32_t, index_vector> bfs_last_level(CellGraph const & graph, int32_t root, index_vector & level)
+{
+    index_vector queue{root};
+    level[root] = 0;
+    for (size_t it = 0; it < queue.size(); ++it)
+    {
+        int32_t const icl = queue[it];
+        for (int32_t in = graph.offset[icl]; in < graph.offset[icl + 1]; ++in)
+        {
+            int32_t const jcl = graph.neighbor[in];
+            if (level[jcl] < 0)
+            {
+                level[jcl] = level[icl] + 1;
+                queue.push_back(jcl);
+            }
+        }
+    }
+    int32_t const depth = level[queue.back()];
+    index_vector last;
+    for (int32_t const icl : queue)
+    {
+        if (level[icl] == depth)
+        {
+            last.push_back(icl);
+        }
+        level[icl] = -1;
+    }
+    return {depth, std::move(last)};
+}
+
+/**
+ * Pseudo-peripheral cell of the component of @p seed, by the George-Liu
+ * iteration: restart from the lowest-degree cell of the last BFS level while
+ * the eccentricity grows.
+ */
+int32_t pseudo_peripheral(CellGraph const & graph, int32_t seed, index_vector & level)
+{
+    int32_t root = seed;
+    auto [depth, last] = bfs_last_level(graph, root, level);
+    while (true)
+    {
+        int32_t const cand = *std::min_element(
+            last.begin(),
+            last.end(),
+            [&](int32_t a, int32_t b)
+            { return graph.degree(a) < graph.degree(b); });
+        auto [cdepth, clast] = bfs_last_level(graph, cand, level);
+        if (cdepth <= depth)
+        {
+            return root;
+        }
+        root = cand;
+        depth = cdepth;
+        last = std::move(clast);
+    }
+}
+
+index_vector order_rcm(StaticMesh const & mh)
+{
+    CellGraph const graph(mh);
+    auto const ncell = static_cast<int32_t>(mh.ncell());
+
+    // Seed each component from its lowest-degree cell.
+    index_vector seeds(ncell);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(
+        seeds.begin(),
+        seeds.end(),
+        [&](int32_t a, int32_t b)
+        { return graph.degree(a) < graph.degree(b); });
+
+    index_vector order;
+    order.reserve(ncell);
+    index_vector level(ncell, -1);
+    std::vector<bool> visited(ncell, false);
+    index_vector adjacent;
+    for (int32_t const seed : seeds)
+    {
+        if (visited[seed])
+        {
+            continue;
+        }
+        int32_t const root = pseudo_peripheral(graph, seed, level);
+        size_t head = order.size();
+        order.push_back(root);
+        visited[root] = true;
+        for (; head < order.size(); ++head)
+        {
+            int32_t const icl = order[head];
+            adjacent.clear();
+            for (int32_t in = graph.offset[icl]; in < graph.offset[icl + 1]; ++in)
+            {
+                int32_t const jcl = graph.neighbor[in];
+                if (!visited[jcl])
+                {
+                    visited[jcl] = true;
+                    adjacent.push_back(jcl);
+                }
+            }
+            std::stable_sort(
+                adjacent.begin(),
+                adjacent.end(),
+                [&](int32_t a, int32_t b)
+                { return graph.degree(a) < graph.degree(b); });
+            order.insert(order.end(), adjacent.begin(), adjacent.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/**
+ * Hilbert index of quantized coordinates by Skilling's transpose algorithm
+ * ("Programming the Hilbert curve", AIP Conf. Proc. 707, 2004).
+ */
+template <size_t NDIM>
+uint64_t hilbert_key(std::array<uint32_t, NDIM> x, uint32_t nbit)
+{
+    uint32_t const top = uint32_t(1) << (nbit - 1);
+    // Inverse undo of the excess work.
+    for (uint32_t q = top; q > 1; q >>= 1)
+    {
+        uint32_t const p = q - 1;
+        for (size_t i = 0; i < NDIM; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                uint32_t const t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+    // Gray encode.
+    for (size_t i = 1; i < NDIM; ++i)
+    {
+        x[i] ^= x[i - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t q = top; q > 1; q >>= 1)
+    {
+        if (x[NDIM - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (size_t i = 0; i < NDIM; ++i)
+    {
+        x[i] ^= t;
+    }
+    // Interleave the transposed bits, most significant first.
+    uint64_t key = 0;
+    for (uint32_t ib = nbit; ib-- > 0;)
+    {
+        for (size_t i = 0; i < NDIM; ++i)
+        {
+            key = (key << 1) | ((x[i] >> ib) & 1);
+        }
+    }
+    return key;
+}
+
+template <size_t NDIM>
+uint64_t morton_key(std::array<uint32_t, NDIM> const & x, uint32_t nbit)
+{
+    uint64_t key = 0;
+    for (uint32_t ib = nbit; ib-- > 0;)
+    {
+        for (size_t i = 0; i < NDIM; ++i)
+        {
+            key = (key << 1) | ((x[i] >> ib) & 1);
+        }
+    }
+    return key;
+}
+
+template <size_t NDIM>
+index_vector order_curve(StaticMesh const & mh, MeshOrdering ordering)
+{
+    // Fit the key in 64 bits.
+    constexpr uint32_t nbit = 63 / NDIM;
+    constexpr double scale = static_cast<double>((uint64_t(1) << nbit) - 1);
+    auto const ncell = static_cast<int32_t>(mh.ncell());
+
+    std::array<double, NDIM> lo;
+    std::array<double, NDIM> hi;
+    lo.fill(std::numeric_limits<double>::max());
+    hi.fill(std::numeric_limits<double>::lowest());
+    for (int32_t icl = 0; icl < ncell; ++icl)
+    {
+        for (size_t d = 0; d < NDIM; ++d)
+        {
+            lo[d] = std::min(lo[d], mh.clcnd(icl, d));
+            hi[d] = std::max(hi[d], mh.clcnd(icl, d));
+        }
+    }
+    // One scale for all axes keeps the curve cells square.
+    double extent = 0.0;
+    for (size_t d = 0; d < NDIM; ++d)
+    {
+        extent = std::max(extent, hi[d] - lo[d]);
+    }
+    double const factor = (extent > 0.0) ? scale / extent : 0.0;
+
+    std::vector<std::pair<uint64_t, int32_t>> keys(ncell);
+    for (int32_t icl = 0; icl < ncell; ++icl)
+    {
+        std::array<uint32_t, NDIM> x;
+        for (size_t d = 0; d < NDIM; ++d)
+        {
+            x[d] = static_cast<uint32_t>((mh.clcnd(icl, d) - lo[d]) * factor);
+        }
+        uint64_t const key = (MeshOrdering::HILBERT == ordering) ? hilbert_key<NDIM>(x, nbit) : morton_key<NDIM>(x, nbit);
+        keys[icl] = {key, icl};
+    }
+    std::sort(keys.begin(), keys.end());
+
+    index_vector order(ncell);
+    for (int32_t inew = 0; inew < ncell; ++inew)
+    {
+        order[inew] = keys[inew].second;
+    }
+    return order;
+}
+
+/**
+ * Order @p nentity entities by their first reference from the counted
+ * connectivity @p table walked in the row order @p rows.  Unreferenced
+ * entities keep their relative order at the end.
+ */
+index_vector order_by_reference(SimpleArray<int32_t> const & table, index_vector const & rows, size_t nentity)
+{
+    index_vector order;
+    order.reserve(nentity);
+    std::vector<bool> seen(nentity, false);
+    for (int32_t const irow : rows)
+    {
+        for (int32_t icol = 1; icol <= table(irow, 0); ++icol)
+        {
+            int32_t const ient = table(irow, icol);
+            if (ient >= 0 && !seen[ient])
+            {
+                seen[ient] = true;
+                order.push_back(ient);
+            }
+        }
+    }
+    for (size_t ient = 0; ient < nentity; ++ient)
+    {
+        if (!seen[ient])
+        {
+            order.push_back(static_cast<int32_t>(ient));
+        }
+    }
+    return order;
+}
+
+index_vector invert(index_vector const & order)
+{
+    index_vector renum(order.size());
+    for (size_t inew = 0; inew < order.size(); ++inew)
+    {
+        renum[order[inew]] = static_cast<int32_t>(inew);
+    }
+    return renum;
+}
+
+// Gather the body rows of arr by the new-to-old order; ghost rows stay.
+template <typename T>
+void permute_rows(SimpleArray<T> & arr, index_vector const & order)
+{
+    if (order.empty())
+    {
+        return;
+    }
+    SimpleArray<T> const src(arr);
+    auto const width = static_cast<size_t>(arr.stride(0));
+    for (size_t inew = 0; inew < order.size(); ++inew)
+    {
+        std::copy_n(src.vptr(order[inew]), width, arr.vptr(static_cast<ssize_t>(inew)));
+    }
+}
+
+// Renumber the non-negative indices in columns [0, ncol) of every row.
+void renumber_columns(SimpleArray<int32_t> & arr, index_vector const & renum, ssize_t ncol)
+{
+    for (ssize_t irow = -static_cast<ssize_t>(arr.nghost()); irow < static_cast<ssize_t>(arr.nbody()); ++irow)
+    {
+        for (ssize_t icol = 0; icol < ncol; ++icol)
+        {
+            int32_t & val = arr(irow, icol);
+            if (val >= 0)
+            {
+                val = renum[val];
+            }
+        }
+    }
+}
+
+// Renumber the non-negative indices of a counted table, whose first column
+// holds the number of indices in the row.
+void renumber_counted(SimpleArray<int32_t> & arr, index_vector const & renum)
+{
+    for (ssize_t irow = -static_cast<ssize_t>(arr.nghost()); irow < static_cast<ssize_t>(arr.nbody()); ++irow)
+    {
+        for (int32_t icol = 1; icol <= arr(irow, 0); ++icol)
+        {
+            int32_t & val = arr(irow, icol);
+            if (val >= 0)
+            {
+                val = renum[val];
+            }
+        }
+    }
+}
+
+SimpleArray<int32_t> to_array(index_vector const & order)
+{
+    SimpleArray<int32_t> arr(small_vector<ssize_t>{static_cast<ssize_t>(order.size())});
+    std::copy(order.begin(), order.end(), arr.begin());
+    return arr;
+}
+
+} /* end namespace detail */
+
+StaticMeshPermutation StaticMesh::reorder(MeshOrdering ordering)
+{
+    if (0 == m_nface)
+    {
+        throw std::runtime_error("StaticMesh::reorder: interior is not built");
+    }
+
+    detail::index_vector clord;
+    switch (ordering)
+    {
+    case MeshOrdering::RCM:
+        clord = detail::order_rcm(*this);
+        break;
+    case MeshOrdering::HILBERT:
+    case MeshOrdering::MORTON:
+        if (2 == m_ndim)
+        {
+            clord = detail::order_curve<2>(*this, ordering);
+        }
+        else if (3 == m_ndim)
+        {
+            clord = detail::order_curve<3>(*this, ordering);
+        }
+        else
+        {
+            throw std::invalid_argument(std::format("StaticMesh::reorder: ndim {} must be 2 or 3", m_ndim));
+        }
+        break;
+    default:
+        throw std::invalid_argument("StaticMesh::reorder: unknown ordering");
+    }
+    detail::index_vector const fcord = detail::order_by_reference(m_clfcs, clord, m_nface);
+    detail::index_vector const ndord = detail::order_by_reference(m_clnds, clord, m_nnode);
+    detail::index_vector const clnum = detail::invert(clord);
+    detail::index_vector const fcnum = detail::invert(fcord);
+    detail::index_vector const ndnum = detail::invert(ndord);
+
+    // Rewrite the indices in every row, ghost rows included.
+    detail::renumber_counted(m_clnds, ndnum);
+    detail::renumber_counted(m_clfcs, fcnum);
+    detail::renumber_counted(m_fcnds, ndnum);
+    detail::renumber_columns(m_fccls, clnum, 2);
+    detail::renumber_columns(m_ednds, ndnum, 2);
+    detail::renumber_columns(m_bndfcs, fcnum, 1);
+    for (auto const & bnd : m_bcs)
+    {
+        detail::renumber_columns(bnd->facn(), fcnum, 1);
+    }
+
+    // Move the body rows to the new positions.
+    detail::permute_rows(m_ndcrd, ndord);
+    detail::permute_rows(m_fccnd, fcord);
+    detail::permute_rows(m_fcnml, fcord);
+    detail::permute_rows(m_fcara, fcord);
+    detail::permute_rows(m_fctpn, fcord);
+    detail::permute_rows(m_fcnds, fcord);
+    detail::permute_rows(m_fccls, fcord);
+    detail::permute_rows(m_clcnd, clord);
+    detail::permute_rows(m_clvol, clord);
+    detail::permute_rows(m_cltpn, clord);
+    detail::permute_rows(m_clgrp, clord);
+    detail::permute_rows(m_clnds, clord);
+    detail::permute_rows(m_clfcs, clord);
+
+    return StaticMeshPermutation{detail::to_array(ndord), detail::to_array(fcord), detail::to_array(clord)};
+}
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
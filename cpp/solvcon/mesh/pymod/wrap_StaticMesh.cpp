@@ -103,13 +103,26 @@ WrapStaticMesh::WrapStaticMesh(pybind11::module & mod, char const * pyname, char
         .def_property_readonly("ngstface", &wrapped_type::ngstface)
         .def_property_readonly("ngstcell", &wrapped_type::ngstcell)
         .def_property_readonly("nedge", &wrapped_type::nedge)
-        .def_property_readonly("nbcs", &wrapped_type::nbcs);
+        .def_property_readonly("nbcs", &wrapped_type::nbcs)
+        .def_property("nthread", &wrapped_type::nthread, &wrapped_type::set_nthread);
 
     (*this)
         .def_timed("build_interior", &wrapped_type::build_interior, py::arg("do_metric") = true, py::arg("build_edge") = true)
         .def_timed("build_boundary", &wrapped_type::build_boundary)
         .def_timed("build_ghost", &wrapped_type::build_ghost)
-        .def_timed("build_edge", &wrapped_type::build_edge);
+        .def_timed("build_edge", &wrapped_type::build_edge)
+        .def_timed(
+            "reorder",
+            [](wrapped_type & self, std::string const & ordering)
+            {
+                StaticMeshPermutation perm = self.reorder(mesh_ordering_from_string(ordering));
+                py::dict ret;
+                ret["node"] = py::cast(std::move(perm.node));
+                ret["face"] = py::cast(std::move(perm.face));
+                ret["cell"] = py::cast(std::move(perm.cell));
+                return ret;
+            },
+            py::arg("ordering") = "rcm");
 
     (*this)
         .def(
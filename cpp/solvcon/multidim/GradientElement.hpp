@@ -163,6 +163,108 @@ private:
 
 }; /* end class GradientElement */
 
+/**
+ * Gradient-element solves of a block of up to WIDTH cells in
+ * structure-of-arrays layout, specialized on the dimension.
+ *
+ * set() forms the adjugate and the determinant of every fundamental gradient
+ * element of one cell (lane) once, instead of once per equation.  solve()
+ * then reconstructs one gradient per lane for a fundamental gradient element
+ * slot with the lane as the innermost loop index, so the compiler vectorizes
+ * across cells.  A slot past the nfge() of a lane holds a zero adjugate and a
+ * unit determinant, and solves to a zero gradient.  Each lane repeats the
+ * arithmetic of GradientElement::solve_gradient(), so the gradients are
+ * bit-identical to it.
+ *
+ * @ingroup group_multidim
+ */
+template <size_t NDIM>
+class GradientElementBlock
+{
+
+public:
+
+    static_assert(NDIM == 2 || NDIM == 3, "GradientElementBlock: NDIM must be 2 or 3");
+
+    using real_type = GradientElement::real_type;
+
+    static constexpr size_t WIDTH = 16;
+    static constexpr size_t NFGE_MAX = GradientElementType::NFGE_MAX;
+
+    using lane_type = std::array<real_type, WIDTH>;
+    // One NDIM-vector per lane: component d of lane l is [d][l].
+    using vector_type = std::array<lane_type, NDIM>;
+
+    void set(size_t lane, GradientElement const & gelem)
+    {
+        auto const nfge = static_cast<size_t>(gelem.nfge());
+        for (size_t ifge = 0; ifge < nfge; ++ifge)
+        {
+            GradientElement::ge_matrix_type const dst = gelem.displacement_matrix(static_cast<GradientElement::int_type>(ifge));
+            GradientElement::ge_matrix_type const adj = GradientElement::adjugate(dst, NDIM);
+            for (size_t i = 0; i < NDIM; ++i)
+            {
+                for (size_t j = 0; j < NDIM; ++j)
+                {
+                    m_adj[ifge][i][j][lane] = adj[i][j];
+                }
+            }
+            m_det[ifge][lane] = GradientElement::determinant(dst, NDIM);
+        }
+        for (size_t ifge = nfge; ifge < NFGE_MAX; ++ifge)
+        {
+            clear_slot(ifge, lane);
+        }
+    }
+
+    /// Make @p lane an empty cell with no fundamental gradient element.
+    void clear(size_t lane)
+    {
+        for (size_t ifge = 0; ifge < NFGE_MAX; ++ifge)
+        {
+            clear_slot(ifge, lane);
+        }
+    }
+
+    /// Solve the gradients of slot @p ifge of every lane from the solution
+    /// deltas @p udf at its NDIM gradient evaluation points.
+    void solve(size_t ifge, vector_type const & udf, vector_type & grad) const
+    {
+        auto const & adj = m_adj[ifge];
+        lane_type const & det = m_det[ifge];
+        for (size_t i = 0; i < NDIM; ++i)
+        {
+            for (size_t lane = 0; lane < WIDTH; ++lane)
+            {
+                real_type acc = 0.0;
+                for (size_t j = 0; j < NDIM; ++j)
+                {
+                    acc += adj[i][j][lane] * udf[j][lane];
+                }
+                grad[i][lane] = acc / det[lane];
+            }
+        }
+    }
+
+private:
+
+    void clear_slot(size_t ifge, size_t lane)
+    {
+        for (size_t i = 0; i < NDIM; ++i)
+        {
+            for (size_t j = 0; j < NDIM; ++j)
+            {
+                m_adj[ifge][i][j][lane] = 0.0;
+            }
+        }
+        m_det[ifge][lane] = 1.0;
+    }
+
+    std::array<std::array<std::array<lane_type, NDIM>, NDIM>, NFGE_MAX> m_adj = {};
+    std::array<lane_type, NFGE_MAX> m_det = {};
+
+}; /* end class GradientElementBlock */
+
 } /* end namespace solvcon */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -13,9 +13,11 @@
  */
 
 #include <solvcon/mesh/mesh.hpp>
+#include <solvcon/parallel/ThreadPool.hpp>
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace solvcon
@@ -101,6 +103,15 @@ public:
     void set_taumin(real_type v) { m_taumin = v; }
     void set_tauscale(real_type v) { m_tauscale = v; }
 
+    // Threads the cell loops of calc_solt, calc_soln, calc_cfl and calc_dsoln
+    // are partitioned over.  The initial count is read from the toggle
+    // "multidim.nthread" (1 when it is not declared); 0 selects one thread per
+    // hardware thread.  Every cell writes only its own rows, so the solution
+    // does not depend on the count.
+    size_t nthread() const { return m_pool->nthread(); }
+    void set_nthread(size_t nthread);
+    ThreadPool & thread_pool() { return *m_pool; }
+
     SimpleArray<real_type> & cevol() { return m_cevol; }
     SimpleArray<real_type> & cecnd() { return m_cecnd; }
     SimpleArray<real_type> & sfcnd() { return m_sfcnd; }
@@ -116,6 +127,14 @@ public:
     SimpleArray<real_type> & cflc() { return m_cflc; }
     SimpleArray<real_type> & gamma() { return m_gamma; }
 
+    SimpleArray<real_type> const & so0c() const { return m_so0c; }
+    SimpleArray<real_type> const & so0n() const { return m_so0n; }
+    SimpleArray<real_type> const & so1c() const { return m_so1c; }
+    SimpleArray<real_type> const & so1n() const { return m_so1n; }
+    SimpleArray<real_type> const & cflo() const { return m_cflo; }
+    SimpleArray<real_type> const & cflc() const { return m_cflc; }
+    SimpleArray<real_type> const & gamma() const { return m_gamma; }
+
     void prepare_ce();
 
     void init_solution(real_type gamma, real_type rho, std::array<real_type, 3> const & velocity, real_type p);
@@ -172,6 +191,11 @@ private:
     void prepare_ce_2d();
     void prepare_ce_3d();
 
+    // calc_dsoln over the cells [first, last), in blocks of
+    // GradientElementBlock<NDIM>::WIDTH cells.
+    template <size_t NDIM>
+    void calc_dsoln_range(int_type first, int_type last);
+
     std::shared_ptr<StaticMesh> m_mesh;
     real_type m_time_increment = 0.0;
 
@@ -208,6 +232,8 @@ private:
     // Registered boundary conditions applied by bc_soln / bc_dsoln.
     std::vector<EulerBoundary> m_boundaries;
 
+    std::shared_ptr<ThreadPool> m_pool;
+
 }; /* end class EulerCore */
 
 } /* end namespace solvcon */
@@ -5,6 +5,7 @@
 
 #include <solvcon/multidim/euler.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <stdexcept>
@@ -22,12 +23,18 @@ EulerCore::EulerCore(
     , m_ncell(static_cast<int_type>(mesh->ncell()))
     , m_ngstcell(static_cast<int_type>(mesh->ngstcell()))
     , m_neq(mesh->ndim() + 2)
+    , m_pool(ThreadPool::shared(ThreadPool::toggle_nthread("multidim.nthread")))
 {
     initialize_arrays();
     initialize_solution();
     prepare_ce();
 }
 
+void EulerCore::set_nthread(size_t nthread)
+{
+    m_pool = ThreadPool::shared(nthread);
+}
+
 void EulerCore::initialize_arrays()
 {
     ssize_t const total = m_ngstcell + m_ncell;
@@ -7,128 +7,202 @@
  * Order-1 solution marching (gradient reconstruction) for the Euler CESE
  * solver.  calc_dsoln it builds a per-cell GradientElement, solves a gradient
  * on every fundamental gradient element, and reduces them with the W-1/2
- * weighting and W-3/4 limiter into the new order-1 solution so1n.
+ * weighting and W-3/4 limiter into the new order-1 solution so1n.  The solves
+ * and the W-1/2 weights of a block of cells are computed together in a
+ * GradientElementBlock, vectorized across the cells.
  */
 
 #include <solvcon/multidim/euler.hpp>
 #include <solvcon/multidim/GradientElement.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 namespace solvcon
 {
 
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void EulerCore::calc_dsoln()
 {
-    constexpr size_t NFGE_MAX = GradientElementType::NFGE_MAX;
-    constexpr size_t NEQ_MAX = 5;
+    auto kernel = [this](int_type first, int_type last)
+    {
+        if (2 == m_ndim)
+        {
+            calc_dsoln_range<2>(first, last);
+        }
+        else
+        {
+            calc_dsoln_range<3>(first, last);
+        }
+    };
+    m_pool->parallel_for(int_type(0), m_ncell, kernel);
+}
+
+template <size_t NDIM>
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void EulerCore::calc_dsoln_range(int_type first, int_type last)
+{
+    using block_type = GradientElementBlock<NDIM>;
+    using lane_type = typename block_type::lane_type;
+    using vector_type = typename block_type::vector_type;
+    constexpr size_t WIDTH = block_type::WIDTH;
+    constexpr size_t NFGE_MAX = block_type::NFGE_MAX;
+    // Density, momentum, and energy.
+    constexpr size_t NEQ = NDIM + 2;
     // Floor that keeps the inverse weighting and the sigma_max bounds finite.
     constexpr real_type ALMOST_ZERO = 1.e-200;
 
-    size_t const ndim = m_ndim;
-    auto const neq = static_cast<size_t>(m_neq);
+    // The per-block working set, about 40 KB in 3D, is kept off the stack.
+    struct Scratch
+    {
+        block_type block;
+        // Solution deltas at the gradient evaluation points and the solved
+        // gradients, per fundamental gradient element and equation.
+        std::array<std::array<vector_type, NEQ>, NFGE_MAX> udf = {};
+        std::array<std::array<vector_type, NEQ>, NFGE_MAX> grad = {};
+        // W-1/2 weights, turned into the W-3/4 limiter deltas per cell.
+        std::array<std::array<lane_type, NEQ>, NFGE_MAX> widv = {};
+    }; /* end struct Scratch */
+    auto scratch = std::make_unique<Scratch>();
+    block_type & block = scratch->block;
+    auto & udf = scratch->udf;
+    auto & grad = scratch->grad;
+    auto & widv = scratch->widv;
+
     real_type const hdt = m_time_increment * 0.5;
     auto const & msh = *m_mesh;
+    std::vector<GradientElement> gelems;
+    gelems.reserve(WIDTH);
 
-    for (int_type icl = 0; icl < m_ncell; ++icl)
+    for (int_type block_first = first; block_first < last; block_first += static_cast<int_type>(WIDTH))
     {
-        // Per-cell weighting cap and gradient-element spread from the CFL.
-        real_type const acfl = std::fabs(m_cflc(icl));
-        real_type const sgm0 = m_sigma0 / acfl;
-        real_type const tau = m_taumin + acfl * m_tauscale;
-
-        GradientElement const gelem(msh, m_cecnd, icl, tau);
-        int_type const nfge = gelem.nfge();
-        real_type const ofg1 = gelem.nfge_inverse();
-
-        std::array<std::array<GradientElement::ge_vector_type, NEQ_MAX>, NFGE_MAX> grad = {};
-        std::array<std::array<real_type, NEQ_MAX>, NFGE_MAX> widv = {};
-        std::array<real_type, NEQ_MAX> wacc = {};
-        std::array<real_type, NEQ_MAX> sigma_max = {};
-
-        // Per fundamental gradient element: interpolate the solution deltas,
-        // solve the gradient, and accumulate the W-1/2 weighting.
-        for (int_type ifge = 0; ifge < nfge; ++ifge)
+        size_t const nlane = std::min(WIDTH, static_cast<size_t>(last - block_first));
+
+        // Gather, cell by cell: build the gradient element and interpolate
+        // the solution deltas of its fundamental gradient elements.
+        gelems.clear();
+        size_t nfge_block = 0;
+        for (size_t lane = 0; lane < nlane; ++lane)
         {
-            GradientElementType::face_list_type const & tface = gelem.faces(ifge);
-            // Solution deltas at the gradient evaluation points: udf[ieq][ivx].
-            std::array<GradientElement::ge_vector_type, NEQ_MAX> udf = {};
-            for (size_t ivx = 0; ivx < ndim; ++ivx)
+            int_type const icl = block_first + static_cast<int_type>(lane);
+            // Gradient-element spread from the CFL.
+            real_type const tau = m_taumin + std::fabs(m_cflc(icl)) * m_tauscale;
+            GradientElement const & gelem = gelems.emplace_back(msh, m_cecnd, icl, tau);
+            block.set(lane, gelem);
+            auto const nfge = static_cast<size_t>(gelem.nfge());
+            nfge_block = std::max(nfge_block, nfge);
+            for (size_t ifge = 0; ifge < nfge; ++ifge)
             {
-                int_type const ifl = tface[ivx] - 1;
-                int_type const jcl = gelem.rcl(ifl);
-                for (size_t ieq = 0; ieq < neq; ++ieq)
+                GradientElementType::face_list_type const & tface = gelem.faces(static_cast<int_type>(ifge));
+                for (size_t ivx = 0; ivx < NDIM; ++ivx)
                 {
-                    // Taylor interpolation about the neighbor cell, relative to
-                    // the self new-step solution.
-                    real_type val = m_so0c(jcl, ieq) + hdt * m_so0t(jcl, ieq) - m_so0n(icl, ieq);
-                    for (size_t d = 0; d < ndim; ++d)
+                    int_type const ifl = tface[ivx] - 1;
+                    int_type const jcl = gelem.rcl(ifl);
+                    for (size_t ieq = 0; ieq < NEQ; ++ieq)
                     {
-                        val += gelem.jdis(ifl, static_cast<int_type>(d)) * m_so1c(jcl, ieq, d);
+                        // Taylor interpolation about the neighbor cell, relative to
+                        // the self new-step solution.
+                        real_type val = m_so0c(jcl, ieq) + hdt * m_so0t(jcl, ieq) - m_so0n(icl, ieq);
+                        for (size_t d = 0; d < NDIM; ++d)
+                        {
+                            val += gelem.jdis(ifl, static_cast<int_type>(d)) * m_so1c(jcl, ieq, d);
+                        }
+                        udf[ifge][ieq][ivx][lane] = val;
                     }
-                    udf[ieq][ivx] = val;
                 }
             }
-            for (size_t ieq = 0; ieq < neq; ++ieq)
+        }
+        for (size_t lane = nlane; lane < WIDTH; ++lane)
+        {
+            block.clear(lane);
+        }
+
+        // Across the cells of the block: solve every gradient and its W-1/2
+        // weight (alpha = 1), the inverse gradient magnitude.
+        for (size_t ifge = 0; ifge < nfge_block; ++ifge)
+        {
+            for (size_t ieq = 0; ieq < NEQ; ++ieq)
             {
-                GradientElement::ge_vector_type const g = gelem.solve_gradient(ifge, udf[ieq]);
-                grad[ifge][ieq] = g;
-                real_type sq = 0.0;
-                for (size_t d = 0; d < ndim; ++d)
+                vector_type & g = grad[ifge][ieq];
+                block.solve(ifge, udf[ifge][ieq], g);
+                for (size_t lane = 0; lane < WIDTH; ++lane)
                 {
-                    sq += g[d] * g[d];
+                    real_type sq = 0.0;
+                    for (size_t d = 0; d < NDIM; ++d)
+                    {
+                        sq += g[d][lane] * g[d][lane];
+                    }
+                    widv[ifge][ieq][lane] = 1.0 / std::sqrt(sq + ALMOST_ZERO);
                 }
-                // W-1/2 weighting (alpha = 1): inverse gradient magnitude.
-                real_type const wgt = 1.0 / std::sqrt(sq + ALMOST_ZERO);
-                wacc[ieq] += wgt;
-                widv[ifge][ieq] = wgt;
             }
         }
 
-        // W-3/4 limiter delta and the per-equation sigma_max cap.
-        std::array<std::array<real_type, 2>, NEQ_MAX> wpa = {}; // {max, min}
-        for (int_type ifge = 0; ifge < nfge; ++ifge)
+        // Cell by cell: the W-3/4 limiter and the weighted reduction of the
+        // per-element gradients into so1n.
+        for (size_t lane = 0; lane < nlane; ++lane)
         {
-            for (size_t ieq = 0; ieq < neq; ++ieq)
+            int_type const icl = block_first + static_cast<int_type>(lane);
+            // Per-cell weighting cap from the CFL.
+            real_type const sgm0 = m_sigma0 / std::fabs(m_cflc(icl));
+            GradientElement const & gelem = gelems[lane];
+            auto const nfge = static_cast<size_t>(gelem.nfge());
+            real_type const ofg1 = gelem.nfge_inverse();
+
+            std::array<real_type, NEQ> wacc = {};
+            for (size_t ifge = 0; ifge < nfge; ++ifge)
             {
-                real_type const wgt = widv[ifge][ieq] / wacc[ieq] - ofg1;
-                widv[ifge][ieq] = wgt;
-                wpa[ieq][0] = std::fmax(wpa[ieq][0], wgt);
-                wpa[ieq][1] = std::fmin(wpa[ieq][1], wgt);
+                for (size_t ieq = 0; ieq < NEQ; ++ieq)
+                {
+                    wacc[ieq] += widv[ifge][ieq][lane];
+                }
+            }
+            std::array<std::array<real_type, 2>, NEQ> wpa = {}; // {max, min}
+            for (size_t ifge = 0; ifge < nfge; ++ifge)
+            {
+                for (size_t ieq = 0; ieq < NEQ; ++ieq)
+                {
+                    real_type const wgt = widv[ifge][ieq][lane] / wacc[ieq] - ofg1;
+                    widv[ifge][ieq][lane] = wgt;
+                    wpa[ieq][0] = std::fmax(wpa[ieq][0], wgt);
+                    wpa[ieq][1] = std::fmin(wpa[ieq][1], wgt);
+                }
+            }
+            std::array<real_type, NEQ> sigma_max = {};
+            for (size_t ieq = 0; ieq < NEQ; ++ieq)
+            {
+                real_type const sm = std::fmin(
+                    (1.0 - ofg1) / (wpa[ieq][0] + ALMOST_ZERO),
+                    -ofg1 / (wpa[ieq][1] - ALMOST_ZERO));
+                sigma_max[ieq] = std::fmin(sm, sgm0);
             }
-        }
-        for (size_t ieq = 0; ieq < neq; ++ieq)
-        {
-            real_type const sm = std::fmin(
-                (1.0 - ofg1) / (wpa[ieq][0] + ALMOST_ZERO),
-                -ofg1 / (wpa[ieq][1] - ALMOST_ZERO));
-            sigma_max[ieq] = std::fmin(sm, sgm0);
-        }
 
-        // Weighted reduction of the per-element gradients into so1n.
-        for (size_t ieq = 0; ieq < neq; ++ieq)
-        {
-            for (size_t d = 0; d < ndim; ++d)
+            for (size_t ieq = 0; ieq < NEQ; ++ieq)
             {
-                m_so1n(icl, ieq, d) = 0.0;
+                for (size_t d = 0; d < NDIM; ++d)
+                {
+                    m_so1n(icl, ieq, d) = 0.0;
+                }
             }
-        }
-        for (int_type isub = 0; isub < nfge; ++isub)
-        {
-            for (size_t ieq = 0; ieq < neq; ++ieq)
+            for (size_t isub = 0; isub < nfge; ++isub)
             {
-                real_type const wgt = ofg1 + sigma_max[ieq] * widv[isub][ieq];
-                for (size_t d = 0; d < ndim; ++d)
+                for (size_t ieq = 0; ieq < NEQ; ++ieq)
                 {
-                    m_so1n(icl, ieq, d) += wgt * grad[isub][ieq][d];
+                    real_type const wgt = ofg1 + sigma_max[ieq] * widv[isub][ieq][lane];
+                    for (size_t d = 0; d < NDIM; ++d)
+                    {
+                        m_so1n(icl, ieq, d) += wgt * grad[isub][ieq][d][lane];
+                    }
                 }
             }
         }
     }
 }
 
+template void EulerCore::calc_dsoln_range<2>(int_type first, int_type last);
+template void EulerCore::calc_dsoln_range<3>(int_type first, int_type last);
+
 } /* end namespace solvcon */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
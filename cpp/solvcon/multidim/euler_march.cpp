@@ -162,33 +162,36 @@ template <size_t NDIM>
 void calc_solt_impl(EulerCore & ec)
 {
     constexpr size_t neq = NDIM + 2;
-    auto const & msh = *ec.mesh();
     SimpleArray<double> & so0c = ec.so0c();
     SimpleArray<double> & so0t = ec.so0t();
     SimpleArray<double> & so1c = ec.so1c();
     SimpleArray<double> & gamma = ec.gamma();
-    EulerJacobian<NDIM> jaco;
-    for (int32_t icl = -ec.ngstcell(); icl < ec.ncell(); ++icl)
+    auto kernel = [&](int32_t first, int32_t last)
     {
-        std::array<double, neq> sol = {};
-        for (size_t ieq = 0; ieq < neq; ++ieq)
-        {
-            sol[ieq] = so0c(icl, ieq);
-        }
-        jaco.update(gamma(icl), sol);
-        for (size_t ieq = 0; ieq < neq; ++ieq)
+        EulerJacobian<NDIM> jaco;
+        for (int32_t icl = first; icl < last; ++icl)
         {
-            double val = 0.0;
-            for (size_t idm = 0; idm < NDIM; ++idm)
+            std::array<double, neq> sol = {};
+            for (size_t ieq = 0; ieq < neq; ++ieq)
+            {
+                sol[ieq] = so0c(icl, ieq);
+            }
+            jaco.update(gamma(icl), sol);
+            for (size_t ieq = 0; ieq < neq; ++ieq)
             {
-                for (size_t jeq = 0; jeq < neq; ++jeq)
+                double val = 0.0;
+                for (size_t idm = 0; idm < NDIM; ++idm)
                 {
-                    val += jaco.jacos[ieq][jeq][idm] * so1c(icl, jeq, idm);
+                    for (size_t jeq = 0; jeq < neq; ++jeq)
+                    {
+                        val += jaco.jacos[ieq][jeq][idm] * so1c(icl, jeq, idm);
+                    }
                 }
+                so0t(icl, ieq) = -val;
             }
-            so0t(icl, ieq) = -val;
         }
-    }
+    };
+    ec.thread_pool().parallel_for(-ec.ngstcell(), ec.ncell(), kernel);
 }
 
 // so0n = CESE space-time flux integral over the BCEs, per real cell. Neighbor
@@ -215,92 +218,95 @@ void calc_soln_impl(EulerCore & ec)
     double const dt = ec.time_increment();
     double const qdt = dt * 0.25;
     double const hdt = dt * 0.5;
-    EulerJacobian<NDIM> jaco;
-
-    for (int32_t icl = 0; icl < ec.ncell(); ++icl)
+    auto kernel = [&](int32_t first, int32_t last)
     {
-        int32_t const clnfc = msh.clfcs(icl, 0);
-        std::array<double, neq> acc = {};
-
-        for (int32_t ifl = 1; ifl <= clnfc; ++ifl)
+        EulerJacobian<NDIM> jaco;
+        for (int32_t icl = first; icl < last; ++icl)
         {
-            int32_t const ifc = msh.clfcs(icl, ifl);
-            int32_t const jcl = msh.fcrcl(ifc, icl);
+            int32_t const clnfc = msh.clfcs(icl, 0);
+            std::array<double, neq> acc = {};
 
-            // Neighbor CE centroid (cell-centroid mirror for ghost cells).
-            std::array<double, NDIM> jcecnd = {};
-            for (size_t d = 0; d < NDIM; ++d)
+            for (int32_t ifl = 1; ifl <= clnfc; ++ifl)
             {
-                jcecnd[d] = (jcl >= 0) ? cecnd(jcl, d) : msh.clcnd(jcl, d);
-            }
-            // Self BCE geometry for this face.
-            double const bvol = cevol(icl, ifl);
-            std::array<double, NDIM> bcnd = {};
-            for (size_t d = 0; d < NDIM; ++d)
-            {
-                bcnd[d] = cecnd(icl, static_cast<size_t>(ifl) * NDIM + d);
-            }
+                int32_t const ifc = msh.clfcs(icl, ifl);
+                int32_t const jcl = msh.fcrcl(ifc, icl);
 
-            // Spatial flux (given time): neighbor solution reconstructed at the
-            // BCE centroid, weighted by the BCE volume.
-            for (size_t ieq = 0; ieq < neq; ++ieq)
-            {
-                double fusp = so0c(jcl, ieq);
+                // Neighbor CE centroid (cell-centroid mirror for ghost cells).
+                std::array<double, NDIM> jcecnd = {};
                 for (size_t d = 0; d < NDIM; ++d)
                 {
-                    fusp += (bcnd[d] - jcecnd[d]) * so1c(jcl, ieq, d);
+                    jcecnd[d] = (jcl >= 0) ? cecnd(jcl, d) : msh.clcnd(jcl, d);
+                }
+                // Self BCE geometry for this face.
+                double const bvol = cevol(icl, ifl);
+                std::array<double, NDIM> bcnd = {};
+                for (size_t d = 0; d < NDIM; ++d)
+                {
+                    bcnd[d] = cecnd(icl, static_cast<size_t>(ifl) * NDIM + d);
                 }
-                acc[ieq] += fusp * bvol;
-            }
-
-            // Temporal flux (given space): Jacobian of the neighbor state,
-            // with the neighbor gamma (ghost rows carry it too).
-            std::array<double, neq> jsol = {};
-            for (size_t ieq = 0; ieq < neq; ++ieq)
-            {
-                jsol[ieq] = so0c(jcl, ieq);
-            }
-            jaco.update(gamma(jcl), jsol);
 
-            int32_t const fcnnd = msh.fcnds(ifc, 0);
-            size_t const sf_base = static_cast<size_t>(ifl - 1) * fcmnd;
-            for (int32_t inf = 0; inf < fcnnd; ++inf)
-            {
-                size_t const sfi = sf_base + static_cast<size_t>(inf);
-                // Solution at the sub-face center.
-                std::array<double, neq> usfc = {};
+                // Spatial flux (given time): neighbor solution reconstructed at the
+                // BCE centroid, weighted by the BCE volume.
                 for (size_t ieq = 0; ieq < neq; ++ieq)
                 {
-                    usfc[ieq] = qdt * so0t(jcl, ieq);
+                    double fusp = so0c(jcl, ieq);
                     for (size_t d = 0; d < NDIM; ++d)
                     {
-                        usfc[ieq] += (sfcnd(icl, sfi, d) - jcecnd[d]) * so1c(jcl, ieq, d);
+                        fusp += (bcnd[d] - jcecnd[d]) * so1c(jcl, ieq, d);
                     }
+                    acc[ieq] += fusp * bvol;
                 }
-                // Flux derivative dotted with the sub-face normal.
+
+                // Temporal flux (given space): Jacobian of the neighbor state,
+                // with the neighbor gamma (ghost rows carry it too).
+                std::array<double, neq> jsol = {};
                 for (size_t ieq = 0; ieq < neq; ++ieq)
                 {
-                    double dot = 0.0;
-                    for (size_t d2 = 0; d2 < NDIM; ++d2)
+                    jsol[ieq] = so0c(jcl, ieq);
+                }
+                jaco.update(gamma(jcl), jsol);
+
+                int32_t const fcnnd = msh.fcnds(ifc, 0);
+                size_t const sf_base = static_cast<size_t>(ifl - 1) * fcmnd;
+                for (int32_t inf = 0; inf < fcnnd; ++inf)
+                {
+                    size_t const sfi = sf_base + static_cast<size_t>(inf);
+                    // Solution at the sub-face center.
+                    std::array<double, neq> usfc = {};
+                    for (size_t ieq = 0; ieq < neq; ++ieq)
                     {
-                        double dfcn = jaco.fcn[ieq][d2];
-                        for (size_t jeq = 0; jeq < neq; ++jeq)
+                        usfc[ieq] = qdt * so0t(jcl, ieq);
+                        for (size_t d = 0; d < NDIM; ++d)
                         {
-                            dfcn += jaco.jacos[ieq][jeq][d2] * usfc[jeq];
+                            usfc[ieq] += (sfcnd(icl, sfi, d) - jcecnd[d]) * so1c(jcl, ieq, d);
                         }
-                        dot += dfcn * sfnml(icl, sfi, d2);
                     }
-                    acc[ieq] -= hdt * dot;
+                    // Flux derivative dotted with the sub-face normal.
+                    for (size_t ieq = 0; ieq < neq; ++ieq)
+                    {
+                        double dot = 0.0;
+                        for (size_t d2 = 0; d2 < NDIM; ++d2)
+                        {
+                            double dfcn = jaco.fcn[ieq][d2];
+                            for (size_t jeq = 0; jeq < neq; ++jeq)
+                            {
+                                dfcn += jaco.jacos[ieq][jeq][d2] * usfc[jeq];
+                            }
+                            dot += dfcn * sfnml(icl, sfi, d2);
+                        }
+                        acc[ieq] -= hdt * dot;
+                    }
                 }
             }
-        }
 
-        double const cvol = cevol(icl, 0);
-        for (size_t ieq = 0; ieq < neq; ++ieq)
-        {
-            so0n(icl, ieq) = acc[ieq] / cvol;
+            double const cvol = cevol(icl, 0);
+            for (size_t ieq = 0; ieq < neq; ++ieq)
+            {
+                so0n(icl, ieq) = acc[ieq] / cvol;
+            }
         }
-    }
+    };
+    ec.thread_pool().parallel_for(0, ec.ncell(), kernel);
 }
 
 } /* end namespace detail */
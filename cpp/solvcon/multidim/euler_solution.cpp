@@ -111,52 +111,56 @@ void EulerCore::calc_cfl()
     real_type const hdt = m_time_increment / 2.0;
     auto const & msh = *m_mesh;
 
-    for (int_type icl = 0; icl < m_ncell; ++icl)
+    auto kernel = [&](int_type first, int_type last)
     {
-        int_type const clnfc = msh.clfcs(icl, 0);
-
-        // Estimate the minimal CCE-centroid-to-BCE-centroid distance.
-        real_type dist = std::numeric_limits<real_type>::max();
-        for (int_type ifl = 1; ifl <= clnfc; ++ifl)
+        for (int_type icl = first; icl < last; ++icl)
         {
-            size_t const bce_col = static_cast<size_t>(ifl) * ndim;
-            real_type d2 = 0.0;
-            for (size_t d = 0; d < ndim; ++d)
+            int_type const clnfc = msh.clfcs(icl, 0);
+
+            // Estimate the minimal CCE-centroid-to-BCE-centroid distance.
+            real_type dist = std::numeric_limits<real_type>::max();
+            for (int_type ifl = 1; ifl <= clnfc; ++ifl)
             {
-                real_type const diff = m_cecnd(icl, bce_col + d) - m_cecnd(icl, d);
-                d2 += diff * diff;
+                size_t const bce_col = static_cast<size_t>(ifl) * ndim;
+                real_type d2 = 0.0;
+                for (size_t d = 0; d < ndim; ++d)
+                {
+                    real_type const diff = m_cecnd(icl, bce_col + d) - m_cecnd(icl, d);
+                    d2 += diff * diff;
+                }
+                dist = std::min(dist, std::sqrt(d2));
             }
-            dist = std::min(dist, std::sqrt(d2));
-        }
 
-        // Wave speed from the new-step solution.
-        real_type const ga = m_gamma(icl);
-        real_type const ga1 = ga - 1.0;
-        real_type const density = m_so0n(icl, 0);
-        real_type momsq = 0.0;
-        for (size_t d = 0; d < ndim; ++d)
-        {
-            real_type const mom = m_so0n(icl, 1 + d);
-            momsq += mom * mom;
+            // Wave speed from the new-step solution.
+            real_type const ga = m_gamma(icl);
+            real_type const ga1 = ga - 1.0;
+            real_type const density = m_so0n(icl, 0);
+            real_type momsq = 0.0;
+            for (size_t d = 0; d < ndim; ++d)
+            {
+                real_type const mom = m_so0n(icl, 1 + d);
+                momsq += mom * mom;
+            }
+            real_type const ke = momsq / (2.0 * density);
+            real_type const energy = m_so0n(icl, m_neq - 1);
+            real_type const pr = ga1 * (energy - ke);
+            // Clamp pressure to be non-negative for the square root.
+            real_type const pr_adj = (pr + std::fabs(pr)) / 2.0;
+            real_type const wspd =
+                std::sqrt(ga * pr_adj / density) + std::sqrt(momsq) / density;
+
+            // CFL number.
+            real_type const cflo = hdt * wspd / dist;
+            m_cflo(icl) = cflo;
+            // If the pressure is null, force the clamped CFL to be 1.
+            m_cflc(icl) = (cflo - 1.0) * pr_adj / (pr_adj + TINY) + 1.0;
+
+            // Rewrite the stored energy from the pressure-positive value, adding
+            // TINY so a null pressure stays strictly positive.
+            m_so0n(icl, m_neq - 1) = pr_adj / ga1 + ke + TINY;
         }
-        real_type const ke = momsq / (2.0 * density);
-        real_type const energy = m_so0n(icl, m_neq - 1);
-        real_type const pr = ga1 * (energy - ke);
-        // Clamp pressure to be non-negative for the square root.
-        real_type const pr_adj = (pr + std::fabs(pr)) / 2.0;
-        real_type const wspd =
-            std::sqrt(ga * pr_adj / density) + std::sqrt(momsq) / density;
-
-        // CFL number.
-        real_type const cflo = hdt * wspd / dist;
-        m_cflo(icl) = cflo;
-        // If the pressure is null, force the clamped CFL to be 1.
-        m_cflc(icl) = (cflo - 1.0) * pr_adj / (pr_adj + TINY) + 1.0;
-
-        // Rewrite the stored energy from the pressure-positive value, adding
-        // TINY so a null pressure stays strictly positive.
-        m_so0n(icl, m_neq - 1) = pr_adj / ga1 + ke + TINY;
-    }
+    };
+    m_pool->parallel_for(int_type(0), m_ncell, kernel);
 }
 
 } /* end namespace solvcon */
@@ -314,6 +314,7 @@ WrapEulerCore & WrapEulerCore::wrap_march()
         .def_property("sigma0", &wrapped_type::sigma0, &wrapped_type::set_sigma0)
         .def_property("taumin", &wrapped_type::taumin, &wrapped_type::set_taumin)
         .def_property("tauscale", &wrapped_type::tauscale, &wrapped_type::set_tauscale)
+        .def_property("nthread", &wrapped_type::nthread, &wrapped_type::set_nthread)
         .def_timed("march", &wrapped_type::march, py::arg("steps"))
         .def_timed("march_substep", &wrapped_type::march_substep)
         .def_timed("update", &wrapped_type::update)
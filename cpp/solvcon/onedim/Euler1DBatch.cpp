@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/onedim/Euler1DBatch.hpp>
+#include <cmath>
+#include <format>
+
+namespace solvcon
+{
+
+namespace onedim
+{
+
+std::ostream & operator<<(std::ostream & os, const Euler1DBatch & sol)
+{
+    os << "Euler1DBatch(ncoord=" << sol.ncoord() << ", nbatch=" << sol.nbatch()
+       << ", time_increment=" << sol.time_increment() << ")";
+    return os;
+}
+
+void Euler1DBatch::initialize_data(size_t ncoord, size_t nbatch)
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::initialize_data");
+    if (0 == ncoord % 2)
+    {
+        throw std::invalid_argument("ncoord cannot be even");
+    }
+    if (0 == nbatch)
+    {
+        throw std::invalid_argument("nbatch cannot be zero");
+    }
+    auto const coord_count = static_cast<ssize_t>(ncoord);
+    auto const batch_count = static_cast<ssize_t>(nbatch);
+    m_nbatch = nbatch;
+    m_coord = SimpleArray<double>(/*length*/ ncoord);
+    m_cfl = SimpleArray<double>(/*shape*/ small_vector<ssize_t>{coord_count, batch_count}, /*value*/ 0.0);
+    m_so0 = SimpleArray<double>(/*shape*/ small_vector<ssize_t>{coord_count, NVAR, batch_count}, /*value*/ 0.0);
+    m_so1 = SimpleArray<double>(/*shape*/ small_vector<ssize_t>{coord_count, NVAR, batch_count}, /*value*/ 0.0);
+    m_gamma = SimpleArray<double>(/*shape*/ small_vector<ssize_t>{coord_count, batch_count}, /*value*/ 1.4);
+}
+
+SimpleArray<double> Euler1DBatch::density() const
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::density");
+    SimpleArray<double> ret(small_vector<ssize_t>{static_cast<ssize_t>(ncoord()), static_cast<ssize_t>(m_nbatch)});
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        for (size_t ib = 0; ib < m_nbatch; ++ib)
+        {
+            ret(it, ib) = m_so0(it, 0, ib);
+        }
+    }
+    return ret;
+}
+
+SimpleArray<double> Euler1DBatch::velocity() const
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::velocity");
+    SimpleArray<double> ret(small_vector<ssize_t>{static_cast<ssize_t>(ncoord()), static_cast<ssize_t>(m_nbatch)});
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        for (size_t ib = 0; ib < m_nbatch; ++ib)
+        {
+            ret(it, ib) = m_so0(it, 1, ib) / (m_so0(it, 0, ib) + TINY);
+        }
+    }
+    return ret;
+}
+
+SimpleArray<double> Euler1DBatch::pressure() const
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::pressure");
+    SimpleArray<double> ret(small_vector<ssize_t>{static_cast<ssize_t>(ncoord()), static_cast<ssize_t>(m_nbatch)});
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        for (size_t ib = 0; ib < m_nbatch; ++ib)
+        {
+            // Same as Euler1DCore::pressure().
+            double val = m_so0(it, 1, ib);
+            val *= val;
+            val /= 2.0 * m_so0(it, 0, ib) + TINY;
+            val = m_so0(it, 2, ib) - val;
+            val *= m_gamma(it, ib) - 1.0;
+            ret(it, ib) = val;
+        }
+    }
+    return ret;
+}
+
+void Euler1DBatch::set_member(size_t ib, Euler1DCore const & core)
+{
+    if (ib >= m_nbatch)
+    {
+        throw std::out_of_range(std::format("Euler1DBatch::set_member: ib {} >= nbatch {}", ib, m_nbatch));
+    }
+    if (core.ncoord() != ncoord())
+    {
+        throw std::invalid_argument(
+            std::format("Euler1DBatch::set_member: core ncoord {} != batch ncoord {}", core.ncoord(), ncoord()));
+    }
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        m_gamma(it, ib) = core.gamma()(it);
+        m_cfl(it, ib) = core.cfl()(it);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            m_so0(it, iv, ib) = core.so0()(it, iv);
+            m_so1(it, iv, ib) = core.so1()(it, iv);
+        }
+    }
+}
+
+std::shared_ptr<Euler1DCore> Euler1DBatch::get_member(size_t ib) const
+{
+    if (ib >= m_nbatch)
+    {
+        throw std::out_of_range(std::format("Euler1DBatch::get_member: ib {} >= nbatch {}", ib, m_nbatch));
+    }
+    auto ret = Euler1DCore::construct(ncoord(), m_time_increment);
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        ret->coord()(it) = m_coord(it);
+        ret->gamma()(it) = m_gamma(it, ib);
+        ret->cfl()(it) = m_cfl(it, ib);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            ret->so0()(it, iv) = m_so0(it, iv, ib);
+            ret->so1()(it, iv) = m_so1(it, iv, ib);
+        }
+    }
+    return ret;
+}
+
+void Euler1DBatch::calc_cfl(int_type ic, size_t first, size_t count, double hdt)
+{
+    double const dxneg = m_coord(ic) - m_coord(ic - 1);
+    double const dxpos = m_coord(ic + 1) - m_coord(ic);
+    double const * ga = &m_gamma(ic, first);
+    double const * u0 = &m_so0(ic, 0, first);
+    double const * u1 = &m_so0(ic, 1, first);
+    double const * u2 = &m_so0(ic, 2, first);
+    double * cfl = &m_cfl(ic, first);
+    for (size_t iw = 0; iw < count; ++iw)
+    {
+        cfl[iw] = Euler1DKernel::calc_cfl(ga[iw], u0[iw], u1[iw], u2[iw], dxneg, dxpos, hdt);
+    }
+}
+
+void Euler1DBatch::update_cfl(bool odd_plane)
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::update_cfl");
+    const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    const auto stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
+    const double hdt = m_time_increment / 2;
+    for (int_type it = start; it < stop; it += 2)
+    {
+        calc_cfl(it, 0, m_nbatch, hdt);
+    }
+}
+
+void Euler1DBatch::treat_boundary()
+{
+    /* Non-reflecting boundary condition (NRBC) type 3 with $\lambda=0$
+     * (the third set in Chang 05); see Euler1DCore::treat_boundary_so0(). */
+    size_t const right = ncoord() - 2;
+    for (size_t iv = 0; iv < NVAR; ++iv)
+    {
+        for (size_t ib = 0; ib < m_nbatch; ++ib)
+        {
+            m_so0(1, iv, ib) = m_so0(2, iv, ib);
+            m_so0(right, iv, ib) = m_so0(right - 1, iv, ib);
+            m_so1(1, iv, ib) = m_so1(2, iv, ib);
+            m_so1(right, iv, ib) = m_so1(right - 1, iv, ib);
+        }
+    }
+}
+
+} /* end namespace onedim */
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
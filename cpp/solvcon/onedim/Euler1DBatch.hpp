@@ -0,0 +1,293 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Batch of independent one-dimensional Euler problems marched together.
+ *
+ * @ingroup group_onedim
+ */
+
+#include <solvcon/onedim/Euler1DCore.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace solvcon
+{
+
+namespace onedim
+{
+
+/**
+ * A batch of independent one-dimensional Euler problems on the same grid.
+ *
+ * @ingroup group_onedim
+ *
+ * The nbatch problems share the coordinate and the time increment, and each
+ * has its own heat capacity ratio and solution.  The batch index is the
+ * fastest-varying one: so0 and so1 are of shape (ncoord, NVAR, nbatch) and
+ * gamma and cfl are of shape (ncoord, nbatch), so that every kernel loop runs
+ * contiguously over the batch and vectorizes.  A problem marched in the batch
+ * gives bit-for-bit the same solution as an Euler1DCore marched alone.
+ */
+class Euler1DBatch
+    : public std::enable_shared_from_this<Euler1DBatch>
+{
+
+public:
+
+    constexpr static size_t BOUND_COUNT = Euler1DCore::BOUND_COUNT;
+    static constexpr uint8_t NVAR = Euler1DCore::NVAR;
+    static constexpr double TINY = Euler1DCore::TINY;
+    /// Number of problems a kernel loop works on at once.
+    static constexpr size_t BATCH_WIDTH = 64;
+
+private:
+
+    struct ctor_passkey
+    {
+    }; /* end struct ctor_passkey */
+
+public:
+
+    std::shared_ptr<Euler1DBatch> clone()
+    {
+        auto ret = std::make_shared<Euler1DBatch>(*this);
+        return ret;
+    }
+
+    template <class... Args>
+    static std::shared_ptr<Euler1DBatch> construct(Args &&... args)
+    {
+        return std::make_shared<Euler1DBatch>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Euler1DBatch(size_t ncoord, size_t nbatch, double time_increment, ctor_passkey const &)
+        : m_time_increment(time_increment)
+    {
+        initialize_data(ncoord, nbatch);
+    }
+
+    Euler1DBatch() = delete;
+    Euler1DBatch(Euler1DBatch const &) = default;
+    Euler1DBatch(Euler1DBatch &&) = default;
+    Euler1DBatch & operator=(Euler1DBatch const &) = default;
+    Euler1DBatch & operator=(Euler1DBatch &&) = default;
+    ~Euler1DBatch() = default;
+
+    void initialize_data(size_t ncoord, size_t nbatch);
+
+    double time_increment() const { return m_time_increment; }
+
+    size_t ncoord() const { return m_coord.size(); }
+    size_t nbatch() const { return m_nbatch; }
+    SimpleArray<double> const & coord() const { return m_coord; }
+    SimpleArray<double> & coord() { return m_coord; }
+
+    SimpleArray<double> const & cfl() const { return m_cfl; }
+    SimpleArray<double> & cfl() { return m_cfl; }
+
+    SimpleArray<double> const & so0() const { return m_so0; }
+    SimpleArray<double> & so0() { return m_so0; }
+
+    SimpleArray<double> const & so1() const { return m_so1; }
+    SimpleArray<double> & so1() { return m_so1; }
+
+    SimpleArray<double> const & gamma() const { return m_gamma; }
+    SimpleArray<double> & gamma() { return m_gamma; }
+
+    SimpleArray<double> density() const;
+    SimpleArray<double> velocity() const;
+    SimpleArray<double> pressure() const;
+
+    /// Copy gamma, cfl, so0, and so1 of a single problem into member ib.  The
+    /// coordinate is shared by the batch and is not copied.
+    void set_member(size_t ib, Euler1DCore const & core);
+    /// Extract member ib into a standalone Euler1DCore.
+    std::shared_ptr<Euler1DCore> get_member(size_t ib) const;
+
+    void update_cfl(bool odd_plane);
+    template <size_t ALPHA>
+    void march_half_alpha(bool odd_plane);
+    void treat_boundary();
+
+    void setup_march() { update_cfl(false); }
+    template <size_t ALPHA>
+    void march_alpha(size_t steps);
+
+private:
+
+    /// Flux and derived variables of the solution elements at a grid point
+    /// for up to BATCH_WIDTH problems.
+    struct Derived
+    {
+        std::array<std::array<double, BATCH_WIDTH>, NVAR> flux_ll;
+        std::array<std::array<double, BATCH_WIDTH>, NVAR> flux_lr;
+        std::array<std::array<double, BATCH_WIDTH>, NVAR> up;
+    }; /* end struct Derived */
+
+    void derive(int_type ic, size_t first, size_t count, Derived & out) const;
+    void calc_cfl(int_type ic, size_t first, size_t count, double hdt);
+
+    size_t m_nbatch = 0;
+    real_type m_time_increment = 0;
+    SimpleArray<double> m_coord;
+    SimpleArray<double> m_cfl;
+    SimpleArray<double> m_so0;
+    SimpleArray<double> m_so1;
+    SimpleArray<double> m_gamma;
+}; /* end class Euler1DBatch */
+
+std::ostream & operator<<(std::ostream & os, const Euler1DBatch & sol);
+
+/**
+ * Evaluate the kernel at grid point ic for count problems from first.
+ *
+ * The arithmetic is the same as Euler1DKernel::derive(),
+ * Euler1DKernel::calc_flux_ll(), and Euler1DKernel::calc_flux_lr() expression
+ * by expression, so the batch gives bit-for-bit the solution of Euler1DCore.
+ * It is written out with scalars because the kernel object is too large for
+ * the compiler to inline and vectorize across the batch.
+ */
+inline void Euler1DBatch::derive(int_type ic, size_t first, size_t count, Derived & out) const
+{
+    constexpr double tiny = Euler1DKernel::tiny;
+    double const hdt = m_time_increment / 2.0;
+    double const qdt = hdt / 2.0;
+    // The geometry is shared by the batch.
+    double const x = m_coord(ic);
+    double const xneg = m_coord(ic - 1);
+    double const xpos = m_coord(ic + 1);
+    double const xctr = (xpos + xneg) * 0.5;
+    double const dxctr = x - xctr;
+    double const deltax_ll = xpos - x;
+    double const dxmid_ll = 0.5 * (x + xpos) - xctr;
+    double const deltax_lr = x - xneg;
+    double const dxmid_lr = 0.5 * (x + xneg) - xctr;
+
+    double const * gap = &m_gamma(ic, first);
+    double const * u0p = &m_so0(ic, 0, first);
+    double const * u1p = &m_so0(ic, 1, first);
+    double const * u2p = &m_so0(ic, 2, first);
+    double const * ux0p = &m_so1(ic, 0, first);
+    double const * ux1p = &m_so1(ic, 1, first);
+    double const * ux2p = &m_so1(ic, 2, first);
+    for (size_t iw = 0; iw < count; ++iw)
+    {
+        double const ga = gap[iw];
+        double const u[3] = {u0p[iw], u1p[iw], u2p[iw]};
+        double const ux[3] = {ux0p[iw], ux1p[iw], ux2p[iw]};
+
+        // Jacobian; the first row is (0, 1, 0).
+        double const j10 = (ga - 3.0) / 2.0 * u[1] * u[1] / (u[0] * u[0] + tiny);
+        double const j11 = -(ga - 3.0) * u[1] / (u[0] + tiny);
+        double const j12 = ga - 1.0;
+        double const j20 = (ga - 1.0) * u[1] * u[1] * u[1] / (u[0] * u[0] * u[0] + tiny) - ga * u[1] * u[2] / (u[0] * u[0] + tiny);
+        double const j21 = ga * u[2] / (u[0] + tiny) - 3.0 / 2.0 * (ga - 1.0) * u[1] * u[1] / (u[0] * u[0] + tiny);
+        double const j22 = ga * u[1] / (u[0] + tiny);
+
+        double const f[3] = {
+            u[1],
+            (ga - 1.0) * u[2] + (3.0 - ga) / 2.0 * u[1] * u[1] / (u[0] + tiny),
+            ga * u[1] * u[2] / (u[0] + tiny) - (ga - 1.0) / 2.0 * u[1] * u[1] * u[1] / (u[0] * u[0] + tiny)};
+
+        // Also ut = -fx
+        double const ut[3] = {
+            -0.0 * ux[0] - 1.0 * ux[1] - 0.0 * ux[2],
+            -j10 * ux[0] - j11 * ux[1] - j12 * ux[2],
+            -j20 * ux[0] - j21 * ux[1] - j22 * ux[2]};
+
+        // ft = d[f,u] \cdot ut
+        double const ft[3] = {
+            0.0 * ut[0] + 1.0 * ut[1] + 0.0 * ut[2],
+            j10 * ut[0] + j11 * ut[1] + j12 * ut[2],
+            j20 * ut[0] + j21 * ut[1] + j22 * ut[2]};
+
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            out.up[iv][iw] = u[iv] + dxctr * ux[iv] + hdt * ut[iv];
+            out.flux_ll[iv][iw] = deltax_ll * (u[iv] + dxmid_ll * ux[iv]) + hdt * (f[iv] - (dxctr * ut[iv]) + (qdt * ft[iv]));
+            out.flux_lr[iv][iw] = deltax_lr * (u[iv] + dxmid_lr * ux[iv]) - hdt * (f[iv] - (dxctr * ut[iv]) + (qdt * ft[iv]));
+        }
+    }
+}
+
+/**
+ * Advance a half step of all problems.
+ *
+ * It fuses the so0, cfl, and so1 updates of Euler1DCore::march_half1_alpha()
+ * and Euler1DCore::march_half2_alpha() into one sweep over the grid.  The
+ * sweep is repeated for every BATCH_WIDTH problems, whose derived values are
+ * kept in local buffers that the compiler knows do not alias the solution.
+ */
+template <size_t ALPHA>
+inline void Euler1DBatch::march_half_alpha(bool odd_plane)
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DBatch::march_half_alpha");
+
+    const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    const auto stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
+    const double hdt = m_time_increment / 2;
+    for (size_t first = 0; first < m_nbatch; first += BATCH_WIDTH)
+    {
+        size_t const count = std::min(BATCH_WIDTH, m_nbatch - first);
+        // Derived values at xneg and xpos solution elements.
+        std::array<Derived, 2> der; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        Derived * dern = der.data();
+        Derived * derp = dern + 1;
+        derive(start, first, count, *derp);
+        for (int_type ic = start; ic < stop; ic += 2)
+        {
+            calc_cfl(ic, first, count, hdt);
+            // Update the derived values (avoid duplicate expensiave calculation).
+            std::swap(dern, derp);
+            derive(ic + 2, first, count, *derp);
+            double const dx = m_coord(ic + 2) - m_coord(ic);
+            double const dxn = m_coord(ic + 1) - m_coord(ic);
+            double const dxp = m_coord(ic + 2) - m_coord(ic + 1);
+            for (size_t iv = 0; iv < NVAR; ++iv)
+            {
+                std::array<double, BATCH_WIDTH> const & fll = dern->flux_ll[iv];
+                std::array<double, BATCH_WIDTH> const & flr = derp->flux_lr[iv];
+                std::array<double, BATCH_WIDTH> const & upn = dern->up[iv];
+                std::array<double, BATCH_WIDTH> const & upp = derp->up[iv];
+                double * u = &m_so0(ic + 1, iv, first);
+                double * ux = &m_so1(ic + 1, iv, first);
+                for (size_t iw = 0; iw < count; ++iw)
+                {
+                    // Calculate the variables using flux conservation.
+                    const double utp = (fll[iw] + flr[iw]) / dx;
+                    u[iw] = utp;
+                    // Calculate the gradient.
+                    const double duxn = (utp - upn[iw]) / dxn;
+                    const double duxp = (upp[iw] - utp) / dxp;
+                    const double fan = pow<ALPHA>(std::abs(duxn));
+                    const double fap = pow<ALPHA>(std::abs(duxp));
+                    ux[iw] = (fap * duxn + fan * duxp) / (fap + fan + Euler1DKernel::tiny);
+                }
+            }
+        }
+    }
+}
+
+template <size_t ALPHA>
+inline void Euler1DBatch::march_alpha(size_t steps)
+{
+    for (size_t it = 0; it < steps; ++it)
+    {
+        march_half_alpha<ALPHA>(/*odd_plane*/ false);
+        treat_boundary();
+        march_half_alpha<ALPHA>(/*odd_plane*/ true);
+    }
+}
+
+} /* end namespace onedim */
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -75,21 +75,7 @@ void Euler1DCore::update_cfl(bool odd_plane)
     const double hdt = m_time_increment / 2;
     for (int_type it = start; it < stop; it += 2)
     {
-        const double ga = m_gamma(it);
-        // TODO: I didn't verify the formula.
-        // wave speed.
-        double wspd = m_so0(it, 1);
-        wspd *= wspd;
-        const double ke = wspd / (2.0 * m_so0(it, 0));
-        double pr = (ga - 1.0) * (m_so0(it, 2) - ke);
-        pr = (pr + std::abs(pr)) / 2.0;
-        wspd = std::sqrt(ga * pr / m_so0(it, 0)) + std::sqrt(wspd) / m_so0(it, 0); // NOLINT(readability-math-missing-parentheses)
-        // CFL.
-        const double dxpos = m_coord(it + 1) - m_coord(it);
-        const double dxneg = m_coord(it) - m_coord(it - 1);
-        const double cfl = hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
-        // Set back.
-        m_cfl(it) = cfl;
+        m_cfl(it) = calc_cfl(it, hdt);
     }
 }
 
@@ -17,6 +17,8 @@
 #include <solvcon/math/math.hpp>
 #include <solvcon/buffer/buffer.hpp>
 #include <solvcon/toggle/toggle.hpp>
+#include <algorithm>
+#include <format>
 #include <memory>
 
 namespace solvcon
@@ -43,6 +45,10 @@ class Euler1DCore
 public:
 
     constexpr static size_t BOUND_COUNT = 2;
+    /// Default number of grid points in a tile of the blocked march.
+    constexpr static size_t TILE_SIZE = 4096;
+    /// Default number of time steps a tile is advanced at once.
+    constexpr static size_t TILE_STEPS = 8;
     static constexpr uint8_t NVAR = 3;
     static constexpr double TINY = 1.e-100;
     static constexpr double R = 8.31446261815324;
@@ -130,9 +136,15 @@ public:
     void march_half2_alpha();
     template <size_t ALPHA>
     void march_alpha(size_t steps);
+    template <size_t ALPHA>
+    void march_alpha_blocked(size_t steps, size_t tile_size = TILE_SIZE, size_t tile_steps = TILE_STEPS);
 
 private:
 
+    double calc_cfl(int_type it, double hdt) const;
+    template <size_t ALPHA>
+    void march_half_range_alpha(bool odd_plane, int_type lower, int_type upper);
+
     real_type m_time_increment = 0;
     SimpleArray<double> m_coord;
     SimpleArray<double> m_cfl;
@@ -243,6 +255,23 @@ struct Euler1DKernel
         return *this;
     }
 
+    /// CFL number of a solution element from the conserved variables and
+    /// the distances to the neighboring grid points.
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    static double calc_cfl(double ga, double u0, double u1, double u2, double dxneg, double dxpos, double hdt)
+    {
+        // TODO: I didn't verify the formula.
+        // wave speed.
+        double wspd = u1;
+        wspd *= wspd;
+        const double ke = wspd / (2.0 * u0);
+        double pr = (ga - 1.0) * (u2 - ke);
+        pr = (pr + std::abs(pr)) / 2.0;
+        wspd = std::sqrt(ga * pr / u0) + std::sqrt(wspd) / u0; // NOLINT(readability-math-missing-parentheses)
+        // CFL.
+        return hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
+    }
+
     std::array<double, 3> calc_flux_ll()
     {
         const double deltax = xpos - x;
@@ -281,6 +310,18 @@ struct Euler1DKernel
     std::array<double, 3> up; //< Derived variable.
 }; /* end struct Euler1DKernel */
 
+inline double Euler1DCore::calc_cfl(int_type it, double hdt) const
+{
+    return Euler1DKernel::calc_cfl(
+        m_gamma(it),
+        m_so0(it, 0),
+        m_so0(it, 1),
+        m_so0(it, 2),
+        m_coord(it) - m_coord(it - 1),
+        m_coord(it + 1) - m_coord(it),
+        hdt);
+}
+
 template <size_t ALPHA>
 inline void Euler1DCore::march_half_so1_alpha(bool odd_plane)
 {
@@ -348,6 +389,126 @@ inline void Euler1DCore::march_alpha(size_t steps)
     }
 }
 
+/**
+ * Advance one half step only for the solution points in [lower, upper).
+ *
+ * The so0, cfl, and so1 updates and the left and right boundary treatment of
+ * march_half1_alpha() and march_half2_alpha() are fused into a single sweep,
+ * so that every kernel is derived once instead of twice.  The arithmetic is
+ * the same as the full-sweep functions.
+ */
+template <size_t ALPHA>
+inline void Euler1DCore::march_half_range_alpha(bool odd_plane, int_type lower, int_type upper)
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DCore::march_half_range_alpha");
+
+    const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    const auto stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
+    // The first kernel point at or after lower - 1 with the parity of start.
+    int_type first = std::max(start, lower - 1);
+    first += (first - start) % 2;
+    const int_type last = std::min(stop, upper - 1);
+    if (first < last)
+    {
+        const double hdt = m_time_increment / 2;
+        // Kernal at xneg solution element.
+        Euler1DKernel kernxn{};
+        kernxn
+            .set_time_increment(m_time_increment);
+        // Kernal at xpos solution element.
+        Euler1DKernel kernxp{};
+        kernxp
+            .set_time_increment(m_time_increment)
+            .set_value(first, m_gamma, m_coord, m_so0, m_so1)
+            .derive();
+        for (int_type ic = first; ic < last; ic += 2)
+        {
+            m_cfl(ic) = calc_cfl(ic, hdt);
+            kernxn = kernxp;
+            kernxp
+                .set_value(ic + 2, m_gamma, m_coord, m_so0, m_so1)
+                .derive();
+            // Calculate the variables using flux conservation.
+            const std::array<double, 3> flux_ll = kernxn.calc_flux_ll();
+            const std::array<double, 3> flux_lr = kernxp.calc_flux_lr();
+            double const dx = m_coord(ic + 2) - m_coord(ic);
+            m_so0(ic + 1, 0) = (flux_ll[0] + flux_lr[0]) / dx;
+            m_so0(ic + 1, 1) = (flux_ll[1] + flux_lr[1]) / dx;
+            m_so0(ic + 1, 2) = (flux_ll[2] + flux_lr[2]) / dx;
+            // Calculate the gradient.
+            for (size_t iv = 0; iv < 3; ++iv)
+            {
+                const double utp = m_so0(ic + 1, iv);
+                const double duxn = (utp - kernxn.up[iv]) / (kernxn.xpos - kernxn.x);
+                const double duxp = (kernxp.up[iv] - utp) / (kernxp.x - kernxp.xneg);
+                const double fan = pow<ALPHA>(std::abs(duxn));
+                const double fap = pow<ALPHA>(std::abs(duxp));
+                m_so1(ic + 1, iv) = (fap * duxn + fan * duxp) / (fap + fan + Euler1DKernel::tiny);
+            }
+        }
+    }
+
+    if (!odd_plane)
+    {
+        // The boundary points take the value of the even plane of the
+        // previous half step next to them; see treat_boundary_so0().
+        for (int_type const ic : {int_type(1), static_cast<int_type>(ncoord() - 2)})
+        {
+            if (lower <= ic && ic < upper)
+            {
+                int_type const inner = ic == 1 ? 2 : ic - 1;
+                for (size_t iv = 0; iv < 3; ++iv)
+                {
+                    m_so0(ic, iv) = m_so0(inner, iv);
+                    m_so1(ic, iv) = m_so1(inner, iv);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * March the solution like march_alpha() with temporal blocking.
+ *
+ * The grid is cut into tiles of tile_size points, and each tile is advanced
+ * by up to tile_steps time steps while it stays in cache.  A half step
+ * updates a point from its two neighbors of the previous half step, so the
+ * range of a tile is skewed one point to the left every half step.  Earlier
+ * tiles have then already produced the values on the left, and the values on
+ * the right are not yet overwritten.  The result is bit-for-bit identical to
+ * march_alpha(), while the arrays are streamed from memory once per
+ * tile_steps steps instead of several times per half step.
+ */
+template <size_t ALPHA>
+inline void Euler1DCore::march_alpha_blocked(size_t steps, size_t tile_size, size_t tile_steps)
+{
+    SOLVCON_PROFILE_SCOPE("Euler1DCore::march_alpha_blocked");
+
+    if (0 == tile_size || 0 == tile_steps)
+    {
+        throw std::invalid_argument(std::format(
+            "Euler1DCore::march_alpha_blocked: tile_size ({}) and tile_steps ({}) must be positive",
+            tile_size,
+            tile_steps));
+    }
+    auto const ncrd = static_cast<int_type>(ncoord());
+    auto const width = static_cast<int_type>(std::min(tile_size, ncoord()));
+    for (size_t done = 0; done < steps;)
+    {
+        size_t const nstep = std::min(tile_steps, steps - done);
+        auto const nhalf = static_cast<int_type>(nstep * 2);
+        // The last tile must reach the right end in its last half step.
+        for (int_type lower = 0; lower - nhalf + 1 < ncrd; lower += width)
+        {
+            for (int_type ih = 0; ih < nhalf; ++ih)
+            {
+                march_half_range_alpha<ALPHA>(/*odd_plane*/ ih % 2 == 1, lower - ih, lower + width - ih);
+            }
+        }
+        done += nstep;
+    }
+}
+
 } /* end namespace onedim */
 } /* end namespace solvcon */
 
@@ -10,5 +10,6 @@
  */
 
 #include <solvcon/onedim/Euler1DCore.hpp>
+#include <solvcon/onedim/Euler1DBatch.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -147,18 +147,143 @@ protected:
                 {
                     self.template march_alpha<ALPHA>(steps);
                 },
-                py::arg("steps"));
+                py::arg("steps"))
+            .def_timed(
+                std::format("march_alpha{}_blocked", ALPHA).c_str(),
+                [](wrapped_type & self, size_t steps, size_t tile_size, size_t tile_steps)
+                {
+                    self.template march_alpha_blocked<ALPHA>(steps, tile_size, tile_steps);
+                },
+                py::arg("steps"),
+                py::arg("tile_size") = wrapped_type::TILE_SIZE,
+                py::arg("tile_steps") = wrapped_type::TILE_STEPS);
 
         return *this;
     }
 
 }; /* end class WrapEuler1DCore */
 
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapEuler1DBatch
+    : public WrapBase<WrapEuler1DBatch, Euler1DBatch, std::shared_ptr<Euler1DBatch>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapEuler1DBatch, Euler1DBatch, std::shared_ptr<Euler1DBatch>>;
+    using wrapper_type = typename base_type::wrapper_type;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend base_type;
+
+protected:
+
+    WrapEuler1DBatch(pybind11::module & mod, const char * pyname, const char * clsdoc)
+        : base_type(mod, pyname, clsdoc)
+    {
+
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t ncoord, size_t nbatch, double time_increment)
+                    {
+                        return wrapped_type::construct(ncoord, nbatch, time_increment);
+                    }),
+                py::arg("ncoord"),
+                py::arg("nbatch"),
+                py::arg("time_increment"))
+            .def("__str__", &detail::to_str<wrapped_type>)
+            .def_timed("clone", &wrapped_type::clone)
+            .def_property_readonly_static(
+                "nvar",
+                [](py::handle const &)
+                { return static_cast<size_t>(wrapped_type::NVAR); })
+            .def_property_readonly("time_increment", &wrapped_type::time_increment)
+            .def_property_readonly("ncoord", &wrapped_type::ncoord)
+            .def_property_readonly("nbatch", &wrapped_type::nbatch);
+
+        (*this)
+            .def_property_readonly(
+                "density",
+                [](wrapped_type & self)
+                { return to_ndarray(self.density()); })
+            .def_property_readonly(
+                "velocity",
+                [](wrapped_type & self)
+                { return to_ndarray(self.velocity()); })
+            .def_property_readonly(
+                "pressure",
+                [](wrapped_type & self)
+                { return to_ndarray(self.pressure()); });
+
+        (*this)
+            .def_property_readonly(
+                "gamma",
+                [](wrapped_type & self)
+                { return to_ndarray(self.gamma()); })
+            .def_property_readonly(
+                "coord",
+                [](wrapped_type & self)
+                { return to_ndarray(self.coord()); })
+            .def_property_readonly(
+                "cfl",
+                [](wrapped_type & self)
+                { return to_ndarray(self.cfl()); })
+            .def_property_readonly(
+                "so0",
+                [](wrapped_type & self)
+                { return to_ndarray(self.so0()); })
+            .def_property_readonly(
+                "so1",
+                [](wrapped_type & self)
+                { return to_ndarray(self.so1()); });
+
+        (*this)
+            .def("set_member", &wrapped_type::set_member, py::arg("ib"), py::arg("core"))
+            .def("get_member", &wrapped_type::get_member, py::arg("ib"))
+            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"))
+            .def_timed("treat_boundary", &wrapped_type::treat_boundary)
+            .def_timed("setup_march", &wrapped_type::setup_march);
+
+        (*this)
+            .def_group_march<1>()
+            .def_group_march<2>();
+    }
+
+    template <size_t ALPHA>
+    wrapper_type & def_group_march()
+    {
+        // NOLINTNEXTLINE(misc-unused-alias-decls)
+        namespace py = pybind11;
+
+        (*this)
+            .def_timed(
+                std::format("march_half_alpha{}", ALPHA).c_str(),
+                [](wrapped_type & self, bool odd_plane)
+                {
+                    self.template march_half_alpha<ALPHA>(odd_plane);
+                },
+                py::arg("odd_plane"))
+            .def_timed(
+                std::format("march_alpha{}", ALPHA).c_str(),
+                [](wrapped_type & self, size_t steps)
+                {
+                    self.template march_alpha<ALPHA>(steps);
+                },
+                py::arg("steps"));
+
+        return *this;
+    }
+
+}; /* end class WrapEuler1DBatch */
+
 void wrap_onedim(pybind11::module & mod)
 {
     mod.doc() = "One-dimensional space-time CESE method code";
 
     WrapEuler1DCore::commit(mod, "Euler1DCore", "Solve the Euler equation");
+    WrapEuler1DBatch::commit(mod, "Euler1DBatch", "Solve a batch of independent Euler problems on the same grid");
 }
 
 } /* end namespace python */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <solvcon/parallel/ThreadPool.hpp>
+#include <solvcon/toggle/toggle.hpp>
+
+#include <map>
+#include <stdexcept>
+
+namespace solvcon
+{
+
+namespace
+{
+
+// Set while the thread executes a chunk, so a nested run() goes serial.
+thread_local bool t_in_task = false; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+} /* end namespace */
+
+size_t ThreadPool::hardware_nthread()
+{
+    size_t const n = std::thread::hardware_concurrency();
+    return (n == 0) ? 1 : n;
+}
+
+size_t ThreadPool::toggle_nthread(std::string const & key)
+{
+    int32_t const nthread = Toggle::instance().get<int32_t>(key, 1);
+    return (nthread <= 0) ? hardware_nthread() : static_cast<size_t>(nthread);
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::shared(size_t nthread)
+{
+    if (nthread == 0)
+    {
+        nthread = hardware_nthread();
+    }
+    static std::mutex mutex;
+    static std::map<size_t, std::shared_ptr<ThreadPool>> pools;
+    std::scoped_lock const guard(mutex);
+    std::shared_ptr<ThreadPool> & pool = pools[nthread];
+    if (!pool)
+    {
+        pool = std::make_shared<ThreadPool>(nthread);
+    }
+    return pool;
+}
+
+ThreadPool::ThreadPool(size_t nthread)
+{
+    if (nthread == 0)
+    {
+        nthread = hardware_nthread();
+    }
+    m_workers.reserve(nthread - 1);
+    for (size_t iworker = 0; iworker < nthread - 1; ++iworker)
+    {
+        m_workers.emplace_back([this, iworker]()
+                               { work(iworker); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock const guard(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread & worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::run(size_t nchunk, task_type const & task)
+{
+    if (nchunk > nthread())
+    {
+        throw std::invalid_argument("ThreadPool::run: nchunk exceeds nthread");
+    }
+    if (nchunk <= 1 || t_in_task)
+    {
+        for (size_t ichunk = 0; ichunk < nchunk; ++ichunk)
+        {
+            task(ichunk);
+        }
+        return;
+    }
+
+    std::scoped_lock const run_guard(m_run_mutex);
+    {
+        std::scoped_lock const guard(m_mutex);
+        m_task = &task;
+        m_nchunk = nchunk;
+        m_pending = nchunk - 1;
+        m_errors.assign(nchunk, nullptr);
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    // The caller takes the first chunk.
+    t_in_task = true;
+    try
+    {
+        task(0);
+    }
+    catch (...)
+    {
+        m_errors[0] = std::current_exception();
+    }
+    t_in_task = false;
+
+    {
+        std::unique_lock lock(m_mutex);
+        m_done.wait(lock, [this]()
+                    { return m_pending == 0; });
+        m_task = nullptr;
+    }
+
+    for (std::exception_ptr const & error : m_errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void ThreadPool::work(size_t iworker)
+{
+    size_t const ichunk = iworker + 1;
+    uint64_t seen = 0;
+    while (true)
+    {
+        task_type const * task = nullptr;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this, seen]()
+                        { return m_stop || m_generation != seen; });
+            if (m_stop)
+            {
+                return;
+            }
+            seen = m_generation;
+            if (ichunk >= m_nchunk)
+            {
+                continue;
+            }
+            task = m_task;
+        }
+
+        t_in_task = true;
+        try
+        {
+            (*task)(ichunk);
+        }
+        catch (...)
+        {
+            // Each chunk owns its slot; the caller reads them after m_done.
+            m_errors[ichunk] = std::current_exception();
+        }
+        t_in_task = false;
+
+        bool last = false;
+        {
+            std::scoped_lock const guard(m_mutex);
+            last = (--m_pending == 0);
+        }
+        if (last)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,136 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * A fixed-size pool of worker threads for static, data-parallel loops.
+ *
+ * @ingroup group_core
+ */
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace solvcon
+{
+
+/**
+ * Fixed-size thread pool running static, contiguous partitions of an index
+ * range.
+ *
+ * parallel_for() splits [begin, end) into nthread() balanced chunks in index
+ * order and always assigns chunk i to the same thread, so a loop whose
+ * iterations write disjoint data produces bit-identical results for any
+ * thread count. The calling thread runs the first chunk itself, so a pool of
+ * one thread spawns no workers and runs everything inline.
+ *
+ * An exception thrown by a chunk is rethrown on the calling thread after all
+ * chunks finish; when several chunks throw, the one of the lowest chunk wins.
+ * A parallel_for() issued from inside a running chunk executes serially on
+ * that thread instead of deadlocking on the busy workers.
+ *
+ * @ingroup group_core
+ */
+class ThreadPool
+{
+
+public:
+
+    using task_type = std::function<void(size_t)>;
+
+    /// Number of hardware threads, or 1 when it cannot be detected.
+    static size_t hardware_nthread();
+
+    /// Thread count set by the integer toggle @p key: 1 when the toggle is
+    /// not declared, and hardware_nthread() when it is 0 or negative.
+    static size_t toggle_nthread(std::string const & key);
+
+    /// Process-wide pool of @p nthread threads (0 means hardware_nthread()),
+    /// created on first use.  Every subsystem asking for the same count gets
+    /// the same workers, and concurrent run() calls on it take turns.
+    static std::shared_ptr<ThreadPool> shared(size_t nthread);
+
+    /// Create a pool of @p nthread threads including the caller; 0 means
+    /// hardware_nthread().
+    explicit ThreadPool(size_t nthread);
+
+    ThreadPool() = delete;
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool & operator=(ThreadPool const &) = delete;
+    ThreadPool & operator=(ThreadPool &&) = delete;
+    ~ThreadPool();
+
+    size_t nthread() const { return m_workers.size() + 1; }
+
+    /**
+     * Call fn(first, last) over contiguous chunks covering [begin, end).
+     *
+     * Chunk i spans [begin + n*i/k, begin + n*(i+1)/k) with n = end - begin
+     * and k = min(nthread(), n).
+     */
+    template <std::integral I, typename F>
+    void parallel_for(I begin, I end, F && fn)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+        auto const count = static_cast<size_t>(end - begin);
+        size_t const nchunk = std::min(nthread(), count);
+        if (nchunk <= 1)
+        {
+            fn(begin, end);
+            return;
+        }
+        auto chunk = [&](size_t ichunk)
+        {
+            I const first = begin + static_cast<I>(count * ichunk / nchunk);
+            I const last = begin + static_cast<I>(count * (ichunk + 1) / nchunk);
+            fn(first, last);
+        };
+        run(nchunk, chunk);
+    }
+
+    /// Call task(i) for i in [0, nchunk), chunk i on thread i.
+    void run(size_t nchunk, task_type const & task);
+
+private:
+
+    void work(size_t iworker);
+
+    std::vector<std::thread> m_workers;
+
+    // Serializes concurrent callers of run().
+    std::mutex m_run_mutex;
+
+    // Guards the dispatch state below.
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    task_type const * m_task = nullptr;
+    size_t m_nchunk = 0;
+    size_t m_pending = 0;
+    uint64_t m_generation = 0;
+    bool m_stop = false;
+    std::vector<std::exception_ptr> m_errors;
+
+}; /* end class ThreadPool */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
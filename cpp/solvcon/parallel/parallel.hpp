@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Shared-memory parallel execution helpers.
+ *
+ * @ingroup group_core
+ */
+
+#include <solvcon/parallel/ThreadPool.hpp>
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -206,13 +206,19 @@ std::enable_if_t<is_simple_array_v<S>, pybind11::array> to_ndarray(S && sarr)
     {
         stride.push_back(static_cast<py::ssize_t>(v) * itemsize);
     }
-    return py::array(
+    py::array ret(
         py::detail::npy_format_descriptor<T>::dtype(), // Numpy dtype
         shape, // Buffer dimensions
         stride, // Strides (in bytes) for each index
         sarr.logical_data(), // Pointer to buffer
         py::cast(sarr.buffer().shared_from_this()) // Create the Python object owning the buffer
     );
+    if (!sarr.buffer().is_writable())
+    {
+        // Writing to a read-only file view would fault.
+        ret.attr("flags").attr("writeable") = false;
+    }
+    return ret;
 }
 
 template <typename T>
@@ -0,0 +1,456 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * AVX2 backend of the SIMD dispatch layer.
+ *
+ * @ingroup group_core
+ */
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+
+#include <solvcon/simd/avx2/avx2_type.hpp>
+#include <solvcon/simd/simd_generic.hpp>
+
+namespace solvcon
+{
+
+namespace simd
+{
+
+namespace avx2
+{
+
+#if defined(__x86_64__) || defined(_M_X64)
+// Each functor forwards to the lane operation of the vector traits V. The
+// operation is absent when AVX2 has no instruction for the lane type, and
+// transform_binary then takes the scalar loop.
+struct vec_add
+{
+    template <typename V>
+    SOLVCON_SIMD_TARGET_AVX2 static auto apply(typename V::type a, typename V::type b) -> decltype(V::add(a, b)) { return V::add(a, b); } // NOLINT(fuchsia-trailing-return)
+}; /* end struct vec_add */
+struct vec_sub
+{
+    template <typename V>
+    SOLVCON_SIMD_TARGET_AVX2 static auto apply(typename V::type a, typename V::type b) -> decltype(V::sub(a, b)) { return V::sub(a, b); } // NOLINT(fuchsia-trailing-return)
+}; /* end struct vec_sub */
+struct vec_mul
+{
+    template <typename V>
+    SOLVCON_SIMD_TARGET_AVX2 static auto apply(typename V::type a, typename V::type b) -> decltype(V::mul(a, b)) { return V::mul(a, b); } // NOLINT(fuchsia-trailing-return)
+}; /* end struct vec_mul */
+struct vec_div
+{
+    template <typename V>
+    SOLVCON_SIMD_TARGET_AVX2 static auto apply(typename V::type a, typename V::type b) -> decltype(V::div(a, b)) { return V::div(a, b); } // NOLINT(fuchsia-trailing-return)
+}; /* end struct vec_div */
+
+template <typename T, std::invocable<T, T> ScalarOp, typename VecOp>
+SOLVCON_SIMD_TARGET_AVX2 void transform_binary(T * dest, T const * dest_end, T const * src1, T const * src2, ScalarOp scalar_op, VecOp)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        generic::transform_binary<T>(dest, dest_end, src1, src2, scalar_op);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        if constexpr (!requires(vec_t v) { VecOp::template apply<ops>(v, v); })
+        {
+            generic::transform_binary<T>(dest, dest_end, src1, src2, scalar_op);
+        }
+        else
+        {
+            constexpr size_t N_lane = type::vector_lane<T>;
+
+            // Counted trip form for the same reason as the NEON backend: it
+            // avoids forming a pointer before the buffer on sub-lane inputs.
+            size_t const blocks = static_cast<size_t>(dest_end - dest) / N_lane;
+            T * ptr = dest;
+            for (size_t i = 0; i < blocks; ++i)
+            {
+                vec_t const v1 = ops::load(src1);
+                vec_t const v2 = ops::load(src2);
+                ops::store(ptr, VecOp::template apply<ops>(v1, v2));
+                ptr += N_lane;
+                src1 += N_lane;
+                src2 += N_lane;
+            }
+            while (ptr < dest_end)
+            {
+                *ptr = scalar_op(*src1, *src2);
+                ++ptr;
+                ++src1;
+                ++src2;
+            }
+        }
+    }
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 void add(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    transform_binary<T>(dest, dest_end, src1, src2, std::plus<T>{}, vec_add{});
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 void sub(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    transform_binary<T>(dest, dest_end, src1, src2, std::minus<T>{}, vec_sub{});
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 void mul(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    transform_binary<T>(dest, dest_end, src1, src2, std::multiplies<T>{}, vec_mul{});
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 void div(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    transform_binary<T>(dest, dest_end, src1, src2, std::divides<T>{}, vec_div{});
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 const T * check_between(T const * start, T const * end, T const & min_val, T const & max_val)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::check_between<T>(start, end, min_val, max_val);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        constexpr size_t N_lane = type::vector_lane<T>;
+
+        vec_t const min_vec = ops::dup(min_val);
+        vec_t const max_vec = ops::dup(max_val);
+
+        size_t const blocks = static_cast<size_t>(end - start) / N_lane;
+        T const * ptr = start;
+        for (size_t block = 0; block < blocks; ++block)
+        {
+            // The vector test only tells a block holds an out-of-range value.
+            // Rescanning the block returns the lowest-index one, which callers
+            // report as the first offending element.
+            if (ops::any_outside(ops::load(ptr), min_vec, max_vec))
+            {
+                return generic::check_between<T>(ptr, ptr + N_lane, min_val, max_val);
+            }
+            ptr += N_lane;
+        }
+
+        return generic::check_between<T>(ptr, end, min_val, max_val);
+    }
+}
+
+namespace detail
+{
+
+// Spill a vector and fold its lanes into init in lane order.
+template <typename T, typename BinaryOp>
+SOLVCON_SIMD_TARGET_AVX2 T fold_lanes(type::vector_t<T> vec, T init, BinaryOp op)
+{
+    T lanes[type::vector_lane<T>]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    type::vector_ops<T>::store(lanes, vec);
+    for (T const & lane : lanes)
+    {
+        init = op(init, lane);
+    }
+    return init;
+}
+
+} /* end namespace detail */
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 T sum(T const * start, T const * end)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::sum<T>(start, end);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        constexpr size_t N_lane = type::vector_lane<T>;
+
+        // Four accumulators hide the latency of the vector add. The lanes are
+        // folded once at the end, so the floating-point sum is reassociated.
+        vec_t acc0 = ops::dup(T(0));
+        vec_t acc1 = acc0;
+        vec_t acc2 = acc0;
+        vec_t acc3 = acc0;
+        size_t const n = static_cast<size_t>(end - start);
+        T const * ptr = start;
+        for (size_t i = 0; i < n / (4 * N_lane); ++i)
+        {
+            acc0 = ops::add(acc0, ops::load(ptr));
+            acc1 = ops::add(acc1, ops::load(ptr + N_lane));
+            acc2 = ops::add(acc2, ops::load(ptr + 2 * N_lane));
+            acc3 = ops::add(acc3, ops::load(ptr + 3 * N_lane));
+            ptr += 4 * N_lane;
+        }
+        for (size_t i = 0; i < n % (4 * N_lane) / N_lane; ++i)
+        {
+            acc0 = ops::add(acc0, ops::load(ptr));
+            ptr += N_lane;
+        }
+        acc0 = ops::add(ops::add(acc0, acc1), ops::add(acc2, acc3));
+        T ret = detail::fold_lanes<T>(acc0, T(0), std::plus<T>{});
+        while (ptr < end)
+        {
+            ret += *ptr;
+            ++ptr;
+        }
+        return ret;
+    }
+}
+
+template <std::floating_point T>
+SOLVCON_SIMD_TARGET_AVX2 T sum_kahan(T const * start, T const * end)
+{
+    using ops = type::vector_ops<T>;
+    using vec_t = type::vector_t<T>;
+    constexpr size_t N_lane = type::vector_lane<T>;
+
+    // Every lane carries its own compensation term.
+    vec_t acc = ops::dup(T(0));
+    vec_t comp = acc;
+    size_t const blocks = static_cast<size_t>(end - start) / N_lane;
+    T const * ptr = start;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        vec_t const y = ops::sub(ops::load(ptr), comp);
+        vec_t const t = ops::add(acc, y);
+        comp = ops::sub(ops::sub(t, acc), y);
+        acc = t;
+        ptr += N_lane;
+    }
+
+    // The lane sums, the negated lane compensations, and the tail go through
+    // the same compensated scalar update.
+    T sacc = T(0);
+    T scomp = T(0);
+    auto const step = [&sacc, &scomp](T v)
+    {
+        T const y = v - scomp;
+        T const t = sacc + y;
+        scomp = (t - sacc) - y;
+        sacc = t;
+    };
+    T acc_lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    T comp_lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    ops::store(acc_lanes, acc);
+    ops::store(comp_lanes, comp);
+    for (size_t i = 0; i < N_lane; ++i)
+    {
+        step(acc_lanes[i]);
+        step(-comp_lanes[i]);
+    }
+    while (ptr < end)
+    {
+        step(*ptr);
+        ++ptr;
+    }
+    return sacc;
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 T dot(T const * start, T const * end, T const * other)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::dot<T>(start, end, other);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        if constexpr (!requires(vec_t v) { ops::mul(v, v); })
+        {
+            return generic::dot<T>(start, end, other);
+        }
+        else
+        {
+            constexpr size_t N_lane = type::vector_lane<T>;
+
+            vec_t acc0 = ops::dup(T(0));
+            vec_t acc1 = acc0;
+            size_t const n = static_cast<size_t>(end - start);
+            T const * ptr = start;
+            for (size_t i = 0; i < n / (2 * N_lane); ++i)
+            {
+                acc0 = ops::add(acc0, ops::mul(ops::load(ptr), ops::load(other)));
+                acc1 = ops::add(acc1, ops::mul(ops::load(ptr + N_lane), ops::load(other + N_lane)));
+                ptr += 2 * N_lane;
+                other += 2 * N_lane;
+            }
+            if (n % (2 * N_lane) >= N_lane)
+            {
+                acc0 = ops::add(acc0, ops::mul(ops::load(ptr), ops::load(other)));
+                ptr += N_lane;
+                other += N_lane;
+            }
+            T ret = detail::fold_lanes<T>(ops::add(acc0, acc1), T(0), std::plus<T>{});
+            while (ptr < end)
+            {
+                ret += *ptr * *other;
+                ++ptr;
+                ++other;
+            }
+            return ret;
+        }
+    }
+}
+
+// The vector extremum updates as ops::min(x, acc), which keeps acc when x is
+// NaN like the scalar loop in the generic backend.
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 T min(T const * start, T const * end, T init)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::min<T>(start, end, init);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        constexpr size_t N_lane = type::vector_lane<T>;
+
+        vec_t acc0 = ops::dup(init);
+        vec_t acc1 = acc0;
+        size_t const n = static_cast<size_t>(end - start);
+        T const * ptr = start;
+        for (size_t i = 0; i < n / (2 * N_lane); ++i)
+        {
+            acc0 = ops::min(ops::load(ptr), acc0);
+            acc1 = ops::min(ops::load(ptr + N_lane), acc1);
+            ptr += 2 * N_lane;
+        }
+        if (n % (2 * N_lane) >= N_lane)
+        {
+            acc0 = ops::min(ops::load(ptr), acc0);
+            ptr += N_lane;
+        }
+        T lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+        ops::store(lanes, ops::min(acc1, acc0));
+        return generic::min<T>(ptr, end, generic::min<T>(lanes, lanes + N_lane, init));
+    }
+}
+
+template <typename T>
+SOLVCON_SIMD_TARGET_AVX2 T max(T const * start, T const * end, T init)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::max<T>(start, end, init);
+    }
+    else
+    {
+        using ops = type::vector_ops<T>;
+        using vec_t = type::vector_t<T>;
+        constexpr size_t N_lane = type::vector_lane<T>;
+
+        vec_t acc0 = ops::dup(init);
+        vec_t acc1 = acc0;
+        size_t const n = static_cast<size_t>(end - start);
+        T const * ptr = start;
+        for (size_t i = 0; i < n / (2 * N_lane); ++i)
+        {
+            acc0 = ops::max(ops::load(ptr), acc0);
+            acc1 = ops::max(ops::load(ptr + N_lane), acc1);
+            ptr += 2 * N_lane;
+        }
+        if (n % (2 * N_lane) >= N_lane)
+        {
+            acc0 = ops::max(ops::load(ptr), acc0);
+            ptr += N_lane;
+        }
+        T lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+        ops::store(lanes, ops::max(acc1, acc0));
+        return generic::max<T>(ptr, end, generic::max<T>(lanes, lanes + N_lane, init));
+    }
+}
+
+#else
+template <typename T>
+const T * check_between(T const * start, T const * end, T const & min_val, T const & max_val)
+{
+    return generic::check_between<T>(start, end, min_val, max_val);
+}
+
+template <typename T>
+void add(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    generic::add<T>(dest, dest_end, src1, src2);
+}
+
+template <typename T>
+void sub(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    generic::sub<T>(dest, dest_end, src1, src2);
+}
+
+template <typename T>
+void mul(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    generic::mul<T>(dest, dest_end, src1, src2);
+}
+
+template <typename T>
+void div(T * dest, T const * dest_end, T const * src1, T const * src2)
+{
+    generic::div<T>(dest, dest_end, src1, src2);
+}
+
+template <typename T>
+T sum(T const * start, T const * end)
+{
+    return generic::sum<T>(start, end);
+}
+
+template <std::floating_point T>
+T sum_kahan(T const * start, T const * end)
+{
+    return generic::sum_kahan<T>(start, end);
+}
+
+template <typename T>
+T dot(T const * start, T const * end, T const * other)
+{
+    return generic::dot<T>(start, end, other);
+}
+
+template <typename T>
+T min(T const * start, T const * end, T init)
+{
+    return generic::min<T>(start, end, init);
+}
+
+template <typename T>
+T max(T const * start, T const * end, T init)
+{
+    return generic::max<T>(start, end, init);
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
+} /* end namespace avx2 */
+
+} /* end namespace simd */
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
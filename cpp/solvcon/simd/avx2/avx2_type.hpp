@@ -0,0 +1,308 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Vector types and lane operations of the AVX2 SIMD backend.
+ *
+ * @ingroup group_core
+ */
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// The library is built for the baseline x86-64 ISA and picks the backend at
+// run time, so GCC and Clang need the target attribute to emit AVX2 in the
+// functions of this backend. MSVC accepts the intrinsics without it.
+#if defined(__GNUC__) || defined(__clang__)
+#define SOLVCON_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SOLVCON_SIMD_TARGET_AVX2
+#endif
+
+namespace solvcon
+{
+
+namespace simd
+{
+
+namespace avx2
+{
+
+namespace type
+{
+
+namespace detail
+{
+
+template <typename T>
+struct vector
+{
+    static constexpr size_t N_lane = 0;
+}; /* end struct vector */
+
+// All integer widths share __m256i and the lane width selects the intrinsic.
+// AVX2 has no 8-bit or 64-bit multiplication, so mul() is absent for them and
+// the backend falls back to the scalar loop.
+template <typename T>
+struct integer_vector
+{
+    using type = __m256i;
+    static constexpr size_t N_lane = sizeof(__m256i) / sizeof(T);
+
+    SOLVCON_SIMD_TARGET_AVX2 static type load(T const * ptr)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<type const *>(ptr)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static void store(T * ptr, type vec)
+    {
+        _mm256_storeu_si256(reinterpret_cast<type *>(ptr), vec); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static type dup(T val)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm256_set1_epi8(static_cast<char>(val));
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm256_set1_epi16(static_cast<short>(val));
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_set1_epi32(static_cast<int>(val));
+        }
+        else
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(val));
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static type add(type a, type b)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm256_add_epi8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm256_add_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_add_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_add_epi64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static type sub(type a, type b)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm256_sub_epi8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm256_sub_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_sub_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_sub_epi64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static type mul(type a, type b)
+    requires(sizeof(T) == 2 || sizeof(T) == 4)
+    {
+        if constexpr (sizeof(T) == 2)
+        {
+            return _mm256_mullo_epi16(a, b);
+        }
+        else
+        {
+            return _mm256_mullo_epi32(a, b);
+        }
+    }
+
+    // AVX2 only compares signed integers. Flipping the sign bit maps the
+    // unsigned order onto the signed one.
+    SOLVCON_SIMD_TARGET_AVX2 static type cmpgt(type a, type b)
+    {
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            type const bias = dup(static_cast<T>(T(1) << (sizeof(T) * 8 - 1)));
+            a = _mm256_xor_si256(a, bias);
+            b = _mm256_xor_si256(b, bias);
+        }
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm256_cmpgt_epi8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm256_cmpgt_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm256_cmpgt_epi32(a, b);
+        }
+        else
+        {
+            return _mm256_cmpgt_epi64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX2 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        type const mask = _mm256_or_si256(cmpgt(min_vec, vec), cmpgt(vec, max_vec));
+        return !_mm256_testz_si256(mask, mask);
+    }
+
+    // Lane-wise a < b ? a : b. There is no 64-bit min instruction, so those
+    // lanes blend on cmpgt().
+    SOLVCON_SIMD_TARGET_AVX2 static type min(type a, type b)
+    {
+        constexpr bool is_signed = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1)
+        {
+            return is_signed ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return is_signed ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return is_signed ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+        }
+        else
+        {
+            return _mm256_blendv_epi8(b, a, cmpgt(b, a));
+        }
+    }
+
+    // Lane-wise a > b ? a : b.
+    SOLVCON_SIMD_TARGET_AVX2 static type max(type a, type b)
+    {
+        constexpr bool is_signed = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1)
+        {
+            return is_signed ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return is_signed ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return is_signed ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+        }
+        else
+        {
+            return _mm256_blendv_epi8(b, a, cmpgt(a, b));
+        }
+    }
+}; /* end struct integer_vector */
+
+// clang-format off
+template <> struct vector<uint8_t> : integer_vector<uint8_t> {};
+template <> struct vector<uint16_t> : integer_vector<uint16_t> {};
+template <> struct vector<uint32_t> : integer_vector<uint32_t> {};
+template <> struct vector<uint64_t> : integer_vector<uint64_t> {};
+template <> struct vector<int8_t> : integer_vector<int8_t> {};
+template <> struct vector<int16_t> : integer_vector<int16_t> {};
+template <> struct vector<int32_t> : integer_vector<int32_t> {};
+template <> struct vector<int64_t> : integer_vector<int64_t> {};
+// clang-format on
+
+template <>
+struct vector<float>
+{
+    using type = __m256;
+    static constexpr size_t N_lane = 8;
+
+    SOLVCON_SIMD_TARGET_AVX2 static type load(float const * ptr) { return _mm256_loadu_ps(ptr); }
+    SOLVCON_SIMD_TARGET_AVX2 static void store(float * ptr, type vec) { _mm256_storeu_ps(ptr, vec); }
+    SOLVCON_SIMD_TARGET_AVX2 static type dup(float val) { return _mm256_set1_ps(val); }
+    SOLVCON_SIMD_TARGET_AVX2 static type add(type a, type b) { return _mm256_add_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type div(type a, type b) { return _mm256_div_ps(a, b); }
+    // minps/maxps return the second operand when either one is NaN, which
+    // matches the scalar a < b ? a : b.
+    SOLVCON_SIMD_TARGET_AVX2 static type min(type a, type b) { return _mm256_min_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type max(type a, type b) { return _mm256_max_ps(a, b); }
+
+    // Ordered predicates are false for NaN, as the scalar comparisons are.
+    SOLVCON_SIMD_TARGET_AVX2 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        type const mask = _mm256_or_ps(_mm256_cmp_ps(vec, min_vec, _CMP_LT_OQ), _mm256_cmp_ps(vec, max_vec, _CMP_GT_OQ));
+        return _mm256_movemask_ps(mask) != 0;
+    }
+}; /* end struct vector */
+
+template <>
+struct vector<double>
+{
+    using type = __m256d;
+    static constexpr size_t N_lane = 4;
+
+    SOLVCON_SIMD_TARGET_AVX2 static type load(double const * ptr) { return _mm256_loadu_pd(ptr); }
+    SOLVCON_SIMD_TARGET_AVX2 static void store(double * ptr, type vec) { _mm256_storeu_pd(ptr, vec); }
+    SOLVCON_SIMD_TARGET_AVX2 static type dup(double val) { return _mm256_set1_pd(val); }
+    SOLVCON_SIMD_TARGET_AVX2 static type add(type a, type b) { return _mm256_add_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type div(type a, type b) { return _mm256_div_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type min(type a, type b) { return _mm256_min_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX2 static type max(type a, type b) { return _mm256_max_pd(a, b); }
+
+    SOLVCON_SIMD_TARGET_AVX2 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        type const mask = _mm256_or_pd(_mm256_cmp_pd(vec, min_vec, _CMP_LT_OQ), _mm256_cmp_pd(vec, max_vec, _CMP_GT_OQ));
+        return _mm256_movemask_pd(mask) != 0;
+    }
+}; /* end struct vector */
+
+} /* end namespace detail */
+
+template <typename T>
+using vector_ops = detail::vector<T>;
+
+template <typename T>
+using vector_t = typename detail::vector<T>::type;
+
+template <typename T>
+inline constexpr size_t vector_lane = detail::vector<T>::N_lane;
+
+template <typename T>
+inline constexpr bool has_vectype = detail::vector<T>::N_lane > 0;
+
+} /* end namespace type */
+
+} /* end namespace avx2 */
+
+} /* end namespace simd */
+
+} /* end namespace solvcon */
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
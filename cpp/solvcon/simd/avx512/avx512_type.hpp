@@ -0,0 +1,295 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Vector types and lane operations of the AVX-512 SIMD backend.
+ *
+ * @ingroup group_core
+ */
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// The backend uses the byte/word (BW) and doubleword/quadword (DQ) extensions
+// for the 8-bit, 16-bit, and 64-bit lanes, so detect_simd() only reports
+// SIMD_AVX512 when F, BW, and DQ are all present.
+#if defined(__GNUC__) || defined(__clang__)
+#define SOLVCON_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+#else
+#define SOLVCON_SIMD_TARGET_AVX512
+#endif
+
+namespace solvcon
+{
+
+namespace simd
+{
+
+namespace avx512
+{
+
+namespace type
+{
+
+namespace detail
+{
+
+template <typename T>
+struct vector
+{
+    static constexpr size_t N_lane = 0;
+}; /* end struct vector */
+
+// All integer widths share __m512i and the lane width selects the intrinsic.
+// There is no 8-bit multiplication, so mul() is absent for it and the backend
+// falls back to the scalar loop.
+template <typename T>
+struct integer_vector
+{
+    using type = __m512i;
+    static constexpr size_t N_lane = sizeof(__m512i) / sizeof(T);
+
+    SOLVCON_SIMD_TARGET_AVX512 static type load(T const * ptr) { return _mm512_loadu_si512(ptr); }
+    SOLVCON_SIMD_TARGET_AVX512 static void store(T * ptr, type vec) { _mm512_storeu_si512(ptr, vec); }
+
+    SOLVCON_SIMD_TARGET_AVX512 static type dup(T val)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm512_set1_epi8(static_cast<char>(val));
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm512_set1_epi16(static_cast<short>(val));
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm512_set1_epi32(static_cast<int>(val));
+        }
+        else
+        {
+            return _mm512_set1_epi64(static_cast<long long>(val));
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX512 static type add(type a, type b)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm512_add_epi8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm512_add_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm512_add_epi32(a, b);
+        }
+        else
+        {
+            return _mm512_add_epi64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX512 static type sub(type a, type b)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            return _mm512_sub_epi8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return _mm512_sub_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm512_sub_epi32(a, b);
+        }
+        else
+        {
+            return _mm512_sub_epi64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX512 static type mul(type a, type b)
+    requires(sizeof(T) != 1)
+    {
+        if constexpr (sizeof(T) == 2)
+        {
+            return _mm512_mullo_epi16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return _mm512_mullo_epi32(a, b);
+        }
+        else
+        {
+            return _mm512_mullo_epi64(a, b);
+        }
+    }
+
+    // Lane-wise a < b ? a : b and a > b ? a : b. AVX-512 has the signed and
+    // unsigned forms for every width.
+    SOLVCON_SIMD_TARGET_AVX512 static type min(type a, type b)
+    {
+        constexpr bool is_signed = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1)
+        {
+            return is_signed ? _mm512_min_epi8(a, b) : _mm512_min_epu8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return is_signed ? _mm512_min_epi16(a, b) : _mm512_min_epu16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return is_signed ? _mm512_min_epi32(a, b) : _mm512_min_epu32(a, b);
+        }
+        else
+        {
+            return is_signed ? _mm512_min_epi64(a, b) : _mm512_min_epu64(a, b);
+        }
+    }
+
+    SOLVCON_SIMD_TARGET_AVX512 static type max(type a, type b)
+    {
+        constexpr bool is_signed = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1)
+        {
+            return is_signed ? _mm512_max_epi8(a, b) : _mm512_max_epu8(a, b);
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return is_signed ? _mm512_max_epi16(a, b) : _mm512_max_epu16(a, b);
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return is_signed ? _mm512_max_epi32(a, b) : _mm512_max_epu32(a, b);
+        }
+        else
+        {
+            return is_signed ? _mm512_max_epi64(a, b) : _mm512_max_epu64(a, b);
+        }
+    }
+
+    // AVX-512 compares into mask registers and has unsigned predicates, so no
+    // sign-bit flipping is needed as in the AVX2 backend.
+    SOLVCON_SIMD_TARGET_AVX512 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        constexpr bool is_signed = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1)
+        {
+            return is_signed ? (_mm512_cmplt_epi8_mask(vec, min_vec) | _mm512_cmpgt_epi8_mask(vec, max_vec)) != 0
+                             : (_mm512_cmplt_epu8_mask(vec, min_vec) | _mm512_cmpgt_epu8_mask(vec, max_vec)) != 0;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return is_signed ? (_mm512_cmplt_epi16_mask(vec, min_vec) | _mm512_cmpgt_epi16_mask(vec, max_vec)) != 0
+                             : (_mm512_cmplt_epu16_mask(vec, min_vec) | _mm512_cmpgt_epu16_mask(vec, max_vec)) != 0;
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return is_signed ? (_mm512_cmplt_epi32_mask(vec, min_vec) | _mm512_cmpgt_epi32_mask(vec, max_vec)) != 0
+                             : (_mm512_cmplt_epu32_mask(vec, min_vec) | _mm512_cmpgt_epu32_mask(vec, max_vec)) != 0;
+        }
+        else
+        {
+            return is_signed ? (_mm512_cmplt_epi64_mask(vec, min_vec) | _mm512_cmpgt_epi64_mask(vec, max_vec)) != 0
+                             : (_mm512_cmplt_epu64_mask(vec, min_vec) | _mm512_cmpgt_epu64_mask(vec, max_vec)) != 0;
+        }
+    }
+}; /* end struct integer_vector */
+
+// clang-format off
+template <> struct vector<uint8_t> : integer_vector<uint8_t> {};
+template <> struct vector<uint16_t> : integer_vector<uint16_t> {};
+template <> struct vector<uint32_t> : integer_vector<uint32_t> {};
+template <> struct vector<uint64_t> : integer_vector<uint64_t> {};
+template <> struct vector<int8_t> : integer_vector<int8_t> {};
+template <> struct vector<int16_t> : integer_vector<int16_t> {};
+template <> struct vector<int32_t> : integer_vector<int32_t> {};
+template <> struct vector<int64_t> : integer_vector<int64_t> {};
+// clang-format on
+
+template <>
+struct vector<float>
+{
+    using type = __m512;
+    static constexpr size_t N_lane = 16;
+
+    SOLVCON_SIMD_TARGET_AVX512 static type load(float const * ptr) { return _mm512_loadu_ps(ptr); }
+    SOLVCON_SIMD_TARGET_AVX512 static void store(float * ptr, type vec) { _mm512_storeu_ps(ptr, vec); }
+    SOLVCON_SIMD_TARGET_AVX512 static type dup(float val) { return _mm512_set1_ps(val); }
+    SOLVCON_SIMD_TARGET_AVX512 static type add(type a, type b) { return _mm512_add_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type div(type a, type b) { return _mm512_div_ps(a, b); }
+    // minps/maxps return the second operand when either one is NaN, which
+    // matches the scalar a < b ? a : b.
+    SOLVCON_SIMD_TARGET_AVX512 static type min(type a, type b) { return _mm512_min_ps(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type max(type a, type b) { return _mm512_max_ps(a, b); }
+
+    // Ordered predicates are false for NaN, as the scalar comparisons are.
+    SOLVCON_SIMD_TARGET_AVX512 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        return (_mm512_cmp_ps_mask(vec, min_vec, _CMP_LT_OQ) | _mm512_cmp_ps_mask(vec, max_vec, _CMP_GT_OQ)) != 0;
+    }
+}; /* end struct vector */
+
+template <>
+struct vector<double>
+{
+    using type = __m512d;
+    static constexpr size_t N_lane = 8;
+
+    SOLVCON_SIMD_TARGET_AVX512 static type load(double const * ptr) { return _mm512_loadu_pd(ptr); }
+    SOLVCON_SIMD_TARGET_AVX512 static void store(double * ptr, type vec) { _mm512_storeu_pd(ptr, vec); }
+    SOLVCON_SIMD_TARGET_AVX512 static type dup(double val) { return _mm512_set1_pd(val); }
+    SOLVCON_SIMD_TARGET_AVX512 static type add(type a, type b) { return _mm512_add_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type sub(type a, type b) { return _mm512_sub_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type mul(type a, type b) { return _mm512_mul_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type div(type a, type b) { return _mm512_div_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type min(type a, type b) { return _mm512_min_pd(a, b); }
+    SOLVCON_SIMD_TARGET_AVX512 static type max(type a, type b) { return _mm512_max_pd(a, b); }
+
+    SOLVCON_SIMD_TARGET_AVX512 static bool any_outside(type vec, type min_vec, type max_vec)
+    {
+        return (_mm512_cmp_pd_mask(vec, min_vec, _CMP_LT_OQ) | _mm512_cmp_pd_mask(vec, max_vec, _CMP_GT_OQ)) != 0;
+    }
+}; /* end struct vector */
+
+} /* end namespace detail */
+
+template <typename T>
+using vector_ops = detail::vector<T>;
+
+template <typename T>
+using vector_t = typename detail::vector<T>::type;
+
+template <typename T>
+inline constexpr size_t vector_lane = detail::vector<T>::N_lane;
+
+template <typename T>
+inline constexpr bool has_vectype = detail::vector<T>::N_lane > 0;
+
+} /* end namespace type */
+
+} /* end namespace avx512 */
+
+} /* end namespace simd */
+
+} /* end namespace solvcon */
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
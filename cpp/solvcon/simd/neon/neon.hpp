@@ -5,6 +5,7 @@
  * BSD 3-Clause License, see COPYING
  */
 
+#include <cmath>
 #include <concepts>
 #include <cstdint>
 #include <cstdio>
@@ -97,6 +98,16 @@ struct vec_div
     template <typename V>
     static auto operator()(V a, V b) -> decltype(vdivq(a, b)) { return vdivq(a, b); }
 }; /* end struct vec_div */
+struct vec_min
+{
+    template <typename V>
+    static auto operator()(V a, V b) -> decltype(vminq(a, b)) { return vminq(a, b); }
+}; /* end struct vec_min */
+struct vec_max
+{
+    template <typename V>
+    static auto operator()(V a, V b) -> decltype(vmaxq(a, b)) { return vmaxq(a, b); }
+}; /* end struct vec_max */
 // NOLINTEND(fuchsia-trailing-return)
 
 template <typename T, std::invocable<T, T> ScalarOp, typename VecOp>
@@ -208,19 +219,21 @@ const T * check_between(T const * start, T const * end, T const & min_val, T con
             // Inspect both bounds in one pass so the lowest-index failing lane
             // wins; callers report this pointer as the first out-of-range
             // element.
-            auto const ge_vec = (cmpvec_t)vcgeq(data_vec, max_vec); // NOLINT(modernize-avoid-c-style-cast)
+            // The upper bound is inclusive like the generic backend; max < x
+            // spells x > max with the vcltq alias.
+            auto const gt_vec = (cmpvec_t)vcltq(max_vec, data_vec); // NOLINT(modernize-avoid-c-style-cast)
             auto const lt_vec = (cmpvec_t)vcltq(data_vec, min_vec); // NOLINT(modernize-avoid-c-style-cast)
-            bool const out_of_range = vgetq<0>(ge_vec) || vgetq<1>(ge_vec) || vgetq<0>(lt_vec) || vgetq<1>(lt_vec);
+            bool const out_of_range = vgetq<0>(gt_vec) || vgetq<1>(gt_vec) || vgetq<0>(lt_vec) || vgetq<1>(lt_vec);
 
             if (out_of_range)
             {
-                T ge_val[N_lane] = {}; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+                T gt_val[N_lane] = {}; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
                 T lt_val[N_lane] = {}; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
-                vst1q(ge_val, ge_vec);
+                vst1q(gt_val, gt_vec);
                 vst1q(lt_val, lt_vec);
                 for (size_t i = 0; i < N_lane; ++i)
                 {
-                    if (ge_val[i] || lt_val[i])
+                    if (gt_val[i] || lt_val[i])
                     {
                         return ptr + i;
                     }
@@ -244,6 +257,216 @@ const T * check_between(T const * start, T const * end, T const & min_val, T con
     }
 }
 
+template <typename T>
+T sum(T const * start, T const * end)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::sum<T>(start, end);
+    }
+    else
+    {
+        using vec_t = type::vector_t<T>;
+        constexpr size_t N_lane = type::vector_lane<T>;
+
+        // Four accumulators hide the latency of the vector add. The lanes are
+        // folded once at the end, so the floating-point sum is reassociated.
+        vec_t acc0 = vdupq(T(0));
+        vec_t acc1 = acc0;
+        vec_t acc2 = acc0;
+        vec_t acc3 = acc0;
+        size_t const n = static_cast<size_t>(end - start);
+        T const * ptr = start;
+        for (size_t i = 0; i < n / (4 * N_lane); ++i)
+        {
+            acc0 = vaddq(acc0, vld1q(ptr));
+            acc1 = vaddq(acc1, vld1q(ptr + N_lane));
+            acc2 = vaddq(acc2, vld1q(ptr + 2 * N_lane));
+            acc3 = vaddq(acc3, vld1q(ptr + 3 * N_lane));
+            ptr += 4 * N_lane;
+        }
+        for (size_t i = 0; i < n % (4 * N_lane) / N_lane; ++i)
+        {
+            acc0 = vaddq(acc0, vld1q(ptr));
+            ptr += N_lane;
+        }
+        T lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+        vst1q(lanes, vaddq(vaddq(acc0, acc1), vaddq(acc2, acc3)));
+        T ret = T(0);
+        for (T const & lane : lanes)
+        {
+            ret += lane;
+        }
+        while (ptr < end)
+        {
+            ret += *ptr;
+            ++ptr;
+        }
+        return ret;
+    }
+}
+
+template <std::floating_point T>
+T sum_kahan(T const * start, T const * end)
+{
+    using vec_t = type::vector_t<T>;
+    constexpr size_t N_lane = type::vector_lane<T>;
+
+    // Every lane carries its own compensation term.
+    vec_t acc = vdupq(T(0));
+    vec_t comp = acc;
+    size_t const blocks = static_cast<size_t>(end - start) / N_lane;
+    T const * ptr = start;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        vec_t const y = vsubq(vld1q(ptr), comp);
+        vec_t const t = vaddq(acc, y);
+        comp = vsubq(vsubq(t, acc), y);
+        acc = t;
+        ptr += N_lane;
+    }
+
+    // The lane sums, the negated lane compensations, and the tail go through
+    // the same compensated scalar update.
+    T sacc = T(0);
+    T scomp = T(0);
+    auto const step = [&sacc, &scomp](T v)
+    {
+        T const y = v - scomp;
+        T const t = sacc + y;
+        scomp = (t - sacc) - y;
+        sacc = t;
+    };
+    T acc_lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    T comp_lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    vst1q(acc_lanes, acc);
+    vst1q(comp_lanes, comp);
+    for (size_t i = 0; i < N_lane; ++i)
+    {
+        step(acc_lanes[i]);
+        step(-comp_lanes[i]);
+    }
+    while (ptr < end)
+    {
+        step(*ptr);
+        ++ptr;
+    }
+    return sacc;
+}
+
+template <typename T>
+T dot(T const * start, T const * end, T const * other)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return generic::dot<T>(start, end, other);
+    }
+    else
+    {
+        using vec_t = type::vector_t<T>;
+        if constexpr (!std::invocable<vec_mul, vec_t, vec_t>)
+        {
+            return generic::dot<T>(start, end, other);
+        }
+        else
+        {
+            constexpr size_t N_lane = type::vector_lane<T>;
+
+            vec_t acc = vdupq(T(0));
+            size_t const blocks = static_cast<size_t>(end - start) / N_lane;
+            T const * ptr = start;
+            for (size_t i = 0; i < blocks; ++i)
+            {
+                acc = vaddq(acc, vmulq(vld1q(ptr), vld1q(other)));
+                ptr += N_lane;
+                other += N_lane;
+            }
+            T lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+            vst1q(lanes, acc);
+            T ret = T(0);
+            for (T const & lane : lanes)
+            {
+                ret += lane;
+            }
+            while (ptr < end)
+            {
+                ret += *ptr * *other;
+                ++ptr;
+                ++other;
+            }
+            return ret;
+        }
+    }
+}
+
+// Reduce with a lane-wise vector extremum. There is no 64-bit integer
+// vminq/vmaxq, so those take the scalar loop. vminq_f32/vminq_f64 propagate
+// NaN while the scalar loop skips it, so a NaN left in the lanes sends a
+// floating-point input back through the scalar loop.
+template <typename T, typename VecOp, typename ScalarOp>
+T reduce_extremum(T const * start, T const * end, T init, VecOp vec_op, ScalarOp scalar_op)
+{
+    if constexpr (!type::has_vectype<T>)
+    {
+        return scalar_op(start, end, init);
+    }
+    else
+    {
+        using vec_t = type::vector_t<T>;
+        if constexpr (!std::invocable<VecOp, vec_t, vec_t>)
+        {
+            return scalar_op(start, end, init);
+        }
+        else
+        {
+            constexpr size_t N_lane = type::vector_lane<T>;
+
+            vec_t acc0 = vdupq(init);
+            vec_t acc1 = acc0;
+            size_t const n = static_cast<size_t>(end - start);
+            T const * ptr = start;
+            for (size_t i = 0; i < n / (2 * N_lane); ++i)
+            {
+                acc0 = vec_op(vld1q(ptr), acc0);
+                acc1 = vec_op(vld1q(ptr + N_lane), acc1);
+                ptr += 2 * N_lane;
+            }
+            if (n % (2 * N_lane) >= N_lane)
+            {
+                acc0 = vec_op(vld1q(ptr), acc0);
+                ptr += N_lane;
+            }
+            T lanes[N_lane]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+            vst1q(lanes, vec_op(acc1, acc0));
+            if constexpr (std::floating_point<T>)
+            {
+                for (T const & lane : lanes)
+                {
+                    if (std::isnan(lane))
+                    {
+                        return scalar_op(start, end, init);
+                    }
+                }
+            }
+            return scalar_op(ptr, end, scalar_op(lanes, lanes + N_lane, init));
+        }
+    }
+}
+
+template <typename T>
+T min(T const * start, T const * end, T init)
+{
+    return reduce_extremum<T>(start, end, init, vec_min{}, [](T const * s, T const * e, T i)
+                              { return generic::min<T>(s, e, i); });
+}
+
+template <typename T>
+T max(T const * start, T const * end, T init)
+{
+    return reduce_extremum<T>(start, end, init, vec_max{}, [](T const * s, T const * e, T i)
+                              { return generic::max<T>(s, e, i); });
+}
+
 #else
 template <typename T>
 const T * check_between(T const * start, T const * end, T const & min_val, T const & max_val)
@@ -275,6 +498,36 @@ void div(T * dest, T const * dest_end, T const * src1, T const * src2)
     generic::div<T>(dest, dest_end, src1, src2);
 }
 
+template <typename T>
+T sum(T const * start, T const * end)
+{
+    return generic::sum<T>(start, end);
+}
+
+template <std::floating_point T>
+T sum_kahan(T const * start, T const * end)
+{
+    return generic::sum_kahan<T>(start, end);
+}
+
+template <typename T>
+T dot(T const * start, T const * end, T const * other)
+{
+    return generic::dot<T>(start, end, other);
+}
+
+template <typename T>
+T min(T const * start, T const * end, T init)
+{
+    return generic::min<T>(start, end, init);
+}
+
+template <typename T>
+T max(T const * start, T const * end, T init)
+{
+    return generic::max<T>(start, end, init);
+}
+
 #endif /* defined(__aarch64__) */
 
 } /* end namespace neon */
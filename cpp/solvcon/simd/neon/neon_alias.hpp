@@ -277,6 +277,58 @@ inline static type::vector_t<double> vmulq(type::vector_t<double> vec_a, type::v
     return vmulq_f64(vec_a, vec_b);
 }
 
+#define DECL_MM_IMPL_VMINQ(N)                                                                                          \
+    inline static type::vector_t<utype_t(N)> vminq(type::vector_t<utype_t(N)> vec_a, type::vector_t<utype_t(N)> vec_b) \
+    {                                                                                                                  \
+        return vminq_u##N(vec_a, vec_b);                                                                               \
+    }                                                                                                                  \
+    inline static type::vector_t<stype_t(N)> vminq(type::vector_t<stype_t(N)> vec_a, type::vector_t<stype_t(N)> vec_b) \
+    {                                                                                                                  \
+        return vminq_s##N(vec_a, vec_b);                                                                               \
+    }
+
+DECL_MM_IMPL_VMINQ(8)
+DECL_MM_IMPL_VMINQ(16)
+DECL_MM_IMPL_VMINQ(32)
+
+#undef DECL_MM_IMPL_VMINQ
+
+inline static type::vector_t<float> vminq(type::vector_t<float> vec_a, type::vector_t<float> vec_b)
+{
+    return vminq_f32(vec_a, vec_b);
+}
+
+inline static type::vector_t<double> vminq(type::vector_t<double> vec_a, type::vector_t<double> vec_b)
+{
+    return vminq_f64(vec_a, vec_b);
+}
+
+#define DECL_MM_IMPL_VMAXQ(N)                                                                                          \
+    inline static type::vector_t<utype_t(N)> vmaxq(type::vector_t<utype_t(N)> vec_a, type::vector_t<utype_t(N)> vec_b) \
+    {                                                                                                                  \
+        return vmaxq_u##N(vec_a, vec_b);                                                                               \
+    }                                                                                                                  \
+    inline static type::vector_t<stype_t(N)> vmaxq(type::vector_t<stype_t(N)> vec_a, type::vector_t<stype_t(N)> vec_b) \
+    {                                                                                                                  \
+        return vmaxq_s##N(vec_a, vec_b);                                                                               \
+    }
+
+DECL_MM_IMPL_VMAXQ(8)
+DECL_MM_IMPL_VMAXQ(16)
+DECL_MM_IMPL_VMAXQ(32)
+
+#undef DECL_MM_IMPL_VMAXQ
+
+inline static type::vector_t<float> vmaxq(type::vector_t<float> vec_a, type::vector_t<float> vec_b)
+{
+    return vmaxq_f32(vec_a, vec_b);
+}
+
+inline static type::vector_t<double> vmaxq(type::vector_t<double> vec_a, type::vector_t<double> vec_b)
+{
+    return vmaxq_f64(vec_a, vec_b);
+}
+
 inline static type::vector_t<float> vdivq(type::vector_t<float> vec_a, type::vector_t<float> vec_b)
 {
     return vdivq_f32(vec_a, vec_b);
@@ -8,6 +8,8 @@
 #include <solvcon/simd/simd_generic.hpp>
 #include <solvcon/simd/simd_support.hpp>
 
+#include <solvcon/simd/avx2/avx2.hpp>
+#include <solvcon/simd/avx512/avx512.hpp>
 #include <solvcon/simd/neon/neon.hpp>
 
 namespace solvcon
@@ -16,7 +18,8 @@ namespace solvcon
 namespace simd
 {
 
-// Check if each element from start to end (excluded end) is within the range [min_val, max_val)
+// Check if each element from start to end (excluded end) is within the range [min_val, max_val].
+// Return the first element outside the range, or nullptr if none is.
 template <typename T>
 const T * check_between(T const * start, T const * end, T const & min_val, T const & max_val)
 {
@@ -26,6 +29,14 @@ const T * check_between(T const * start, T const * end, T const & min_val, T con
         return neon::check_between<T>(start, end, min_val, max_val);
         break;
 
+    case detail::SIMD_AVX2:
+        return avx2::check_between<T>(start, end, min_val, max_val);
+        break;
+
+    case detail::SIMD_AVX512:
+        return avx512::check_between<T>(start, end, min_val, max_val);
+        break;
+
     default:
         return generic::check_between<T>(start, end, min_val, max_val);
     }
@@ -41,6 +52,14 @@ void add(T * dest, T const * dest_end, T const * src1, T const * src2)
         return neon::add<T>(dest, dest_end, src1, src2);
         break;
 
+    case SIMD_AVX2:
+        return avx2::add<T>(dest, dest_end, src1, src2);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::add<T>(dest, dest_end, src1, src2);
+        break;
+
     default:
         return generic::add<T>(dest, dest_end, src1, src2);
     }
@@ -56,6 +75,14 @@ void sub(T * dest, T const * dest_end, T const * src1, T const * src2)
         return neon::sub<T>(dest, dest_end, src1, src2);
         break;
 
+    case SIMD_AVX2:
+        return avx2::sub<T>(dest, dest_end, src1, src2);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::sub<T>(dest, dest_end, src1, src2);
+        break;
+
     default:
         return generic::sub<T>(dest, dest_end, src1, src2);
     }
@@ -71,6 +98,14 @@ void mul(T * dest, T const * dest_end, T const * src1, T const * src2)
         return neon::mul<T>(dest, dest_end, src1, src2);
         break;
 
+    case SIMD_AVX2:
+        return avx2::mul<T>(dest, dest_end, src1, src2);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::mul<T>(dest, dest_end, src1, src2);
+        break;
+
     default:
         return generic::mul<T>(dest, dest_end, src1, src2);
     }
@@ -86,15 +121,169 @@ void div(T * dest, T const * dest_end, T const * src1, T const * src2)
         return neon::div<T>(dest, dest_end, src1, src2);
         break;
 
+    case SIMD_AVX2:
+        return avx2::div<T>(dest, dest_end, src1, src2);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::div<T>(dest, dest_end, src1, src2);
+        break;
+
     default:
         return generic::div<T>(dest, dest_end, src1, src2);
     }
 }
 
+// Sum the elements from start to end (excluded end). The vector backends keep
+// several partial sums, so a floating-point result is reassociated and may
+// differ from summing in element order in the last bits.
+template <typename T>
+T sum(T const * start, T const * end)
+{
+    using namespace detail; // FIXME: NOLINT(google-build-using-namespace)
+    switch (detect_simd())
+    {
+    case SIMD_NEON:
+        return neon::sum<T>(start, end);
+        break;
+
+    case SIMD_AVX2:
+        return avx2::sum<T>(start, end);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::sum<T>(start, end);
+        break;
+
+    default:
+        return generic::sum<T>(start, end);
+    }
+}
+
+// Pairwise summation over the vector sum. The rounding error grows with the
+// logarithm of the length instead of linearly.
+template <std::floating_point T>
+T sum_pairwise(T const * start, T const * end)
+{
+    constexpr size_t leaf = 1024;
+    size_t const n = static_cast<size_t>(end - start);
+    if (n <= leaf)
+    {
+        return sum<T>(start, end);
+    }
+    T const * const mid = start + n / 2;
+    return sum_pairwise<T>(start, mid) + sum_pairwise<T>(mid, end);
+}
+
+// Kahan compensated summation, with the compensation carried per lane.
+template <std::floating_point T>
+T sum_kahan(T const * start, T const * end)
+{
+    using namespace detail; // FIXME: NOLINT(google-build-using-namespace)
+    switch (detect_simd())
+    {
+    case SIMD_NEON:
+        return neon::sum_kahan<T>(start, end);
+        break;
+
+    case SIMD_AVX2:
+        return avx2::sum_kahan<T>(start, end);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::sum_kahan<T>(start, end);
+        break;
+
+    default:
+        return generic::sum_kahan<T>(start, end);
+    }
+}
+
+// Sum of the products of [start, end) and the same number of elements from
+// other.
+template <typename T>
+T dot(T const * start, T const * end, T const * other)
+{
+    using namespace detail; // FIXME: NOLINT(google-build-using-namespace)
+    switch (detect_simd())
+    {
+    case SIMD_NEON:
+        return neon::dot<T>(start, end, other);
+        break;
+
+    case SIMD_AVX2:
+        return avx2::dot<T>(start, end, other);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::dot<T>(start, end, other);
+        break;
+
+    default:
+        return generic::dot<T>(start, end, other);
+    }
+}
+
+// Smallest and largest of init and the elements from start to end (excluded
+// end). An element replaces the running value only when it compares strictly
+// smaller (larger), so NaN elements are skipped.
+template <typename T>
+T min(T const * start, T const * end, T init)
+{
+    using namespace detail; // FIXME: NOLINT(google-build-using-namespace)
+    switch (detect_simd())
+    {
+    case SIMD_NEON:
+        return neon::min<T>(start, end, init);
+        break;
+
+    case SIMD_AVX2:
+        return avx2::min<T>(start, end, init);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::min<T>(start, end, init);
+        break;
+
+    default:
+        return generic::min<T>(start, end, init);
+    }
+}
+
+template <typename T>
+T max(T const * start, T const * end, T init)
+{
+    using namespace detail; // FIXME: NOLINT(google-build-using-namespace)
+    switch (detect_simd())
+    {
+    case SIMD_NEON:
+        return neon::max<T>(start, end, init);
+        break;
+
+    case SIMD_AVX2:
+        return avx2::max<T>(start, end, init);
+        break;
+
+    case SIMD_AVX512:
+        return avx512::max<T>(start, end, init);
+        break;
+
+    default:
+        return generic::max<T>(start, end, init);
+    }
+}
+
+// The range must not be empty; the first element seeds the result.
+template <typename T>
+T min(T const * start, T const * end)
+{
+    return min<T>(start + 1, end, *start);
+}
+
 template <typename T>
 T max(T const * start, T const * end)
 {
-    return generic::max<T>(start, end);
+    return max<T>(start + 1, end, *start);
 }
 
 } /* end namespace simd */
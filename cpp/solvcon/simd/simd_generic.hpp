@@ -6,6 +6,7 @@
  */
 
 #include <concepts>
+#include <cstddef>
 #include <functional>
 
 namespace solvcon
@@ -67,18 +68,116 @@ inline void div(T * dest, T const * dest_end, T const * src1, T const * src2)
     transform_binary<T>(dest, dest_end, src1, src2, std::divides<T>{});
 }
 
+// Reductions over [start, end). The four independent accumulators break the
+// dependency chain of a single running sum, so the floating-point result is
+// summed in a different order from the element order.
 template <typename T>
-T max(T const * start, T const * end)
+T sum(T const * start, T const * end)
+{
+    T acc0 = T(0);
+    T acc1 = T(0);
+    T acc2 = T(0);
+    T acc3 = T(0);
+    size_t const blocks = static_cast<size_t>(end - start) / 4;
+    T const * ptr = start;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        acc0 += ptr[0];
+        acc1 += ptr[1];
+        acc2 += ptr[2];
+        acc3 += ptr[3];
+        ptr += 4;
+    }
+    T ret = (acc0 + acc1) + (acc2 + acc3);
+    while (ptr < end)
+    {
+        ret += *ptr;
+        ++ptr;
+    }
+    return ret;
+}
+
+// Kahan compensated summation. The error stays bounded independently of the
+// length, at about four times the flops of the plain sum.
+template <std::floating_point T>
+T sum_kahan(T const * start, T const * end)
+{
+    T acc = T(0);
+    T comp = T(0);
+    for (T const * ptr = start; ptr < end; ++ptr)
+    {
+        T const y = *ptr - comp;
+        T const t = acc + y;
+        comp = (t - acc) - y;
+        acc = t;
+    }
+    return acc;
+}
+
+// Sum of the element-wise products of [start, end) and the range beginning
+// at other.
+template <typename T>
+T dot(T const * start, T const * end, T const * other)
+{
+    T acc0 = T(0);
+    T acc1 = T(0);
+    size_t const blocks = static_cast<size_t>(end - start) / 2;
+    T const * ptr = start;
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        acc0 += ptr[0] * other[0];
+        acc1 += ptr[1] * other[1];
+        ptr += 2;
+        other += 2;
+    }
+    T ret = acc0 + acc1;
+    while (ptr < end)
+    {
+        ret += *ptr * *other;
+        ++ptr;
+        ++other;
+    }
+    return ret;
+}
+
+// The running extremum starts at init and only moves on a strict compare, so
+// NaN elements never replace it.
+template <typename T>
+T min(T const * start, T const * end, T init)
+{
+    for (T const * ptr = start; ptr < end; ++ptr)
+    {
+        if (*ptr < init)
+        {
+            init = *ptr;
+        }
+    }
+    return init;
+}
+
+template <typename T>
+T max(T const * start, T const * end, T init)
 {
-    T max_val = *start;
-    for (T const * ptr = start + 1; ptr < end; ++ptr)
+    for (T const * ptr = start; ptr < end; ++ptr)
     {
-        if (*ptr > max_val)
+        if (*ptr > init)
         {
-            max_val = *ptr;
+            init = *ptr;
         }
     }
-    return max_val;
+    return init;
+}
+
+template <typename T>
+T min(T const * start, T const * end)
+{
+    return min<T>(start + 1, end, *start);
+}
+
+template <typename T>
+T max(T const * start, T const * end)
+{
+    return max<T>(start + 1, end, *start);
 }
 
 } /* end namespace generic */
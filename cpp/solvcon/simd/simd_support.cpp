@@ -26,6 +26,96 @@ namespace simd
 namespace detail
 {
 
+#if defined(__x86_64__) || defined(_M_X64)
+// Report the widest extension the SIMD backends dispatch to. The AVX-512
+// backend needs the F, BW, and DQ subsets together. Both paths also require
+// the operating system to save the wide registers on context switch.
+static SimdFeature detect_x86_simd()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq"))
+    {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("avx"))
+    {
+        return SIMD_AVX;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return SIMD_SSE42;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return SIMD_SSE41;
+    }
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        return SIMD_SSSE3;
+    }
+    if (__builtin_cpu_supports("sse3"))
+    {
+        return SIMD_SSE3;
+    }
+    return SIMD_SSE2; // Baseline of x86-64.
+#elifdef _MSC_VER
+    // Bit positions follow the Intel SDM, Vol. 2A, CPUID, Tables 3-10 and 3-8:
+    // https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sdm.html
+    int regs[4] = {}; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    __cpuid(regs, 0);
+    int const max_leaf = regs[0];
+    __cpuid(regs, 1);
+    int const ecx1 = regs[2];
+    bool const has_osxsave = ecx1 & (1 << 27);
+    unsigned long long const xcr0 = has_osxsave ? _xgetbv(0) : 0;
+    bool const os_ymm = (xcr0 & 0x6) == 0x6; // XMM and YMM state.
+    bool const os_zmm = (xcr0 & 0xe6) == 0xe6; // Plus opmask and ZMM state.
+    int ebx7 = 0;
+    if (max_leaf >= 7)
+    {
+        __cpuidex(regs, 7, 0);
+        ebx7 = regs[1];
+    }
+    if (os_zmm && (ebx7 & (1 << 16)) && (ebx7 & (1 << 17)) && (ebx7 & (1 << 30)))
+    {
+        return SIMD_AVX512;
+    }
+    if (os_ymm && (ebx7 & (1 << 5)))
+    {
+        return SIMD_AVX2;
+    }
+    if (os_ymm && (ecx1 & (1 << 28)))
+    {
+        return SIMD_AVX;
+    }
+    if (ecx1 & (1 << 20))
+    {
+        return SIMD_SSE42;
+    }
+    if (ecx1 & (1 << 19))
+    {
+        return SIMD_SSE41;
+    }
+    if (ecx1 & (1 << 9))
+    {
+        return SIMD_SSSE3;
+    }
+    if (ecx1 & 1)
+    {
+        return SIMD_SSE3;
+    }
+    return SIMD_SSE2;
+#else
+    return SIMD_SSE2;
+#endif
+}
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
 SimdFeature detect_simd()
 {
     static SimdFeature CurrentFeature = SIMD_UNKNOWN;
@@ -58,6 +148,8 @@ SimdFeature detect_simd()
         CurrentFeature = SIMD_NEON;
     }
 #endif
+#elif defined(__x86_64__) || defined(_M_X64)
+    CurrentFeature = detect_x86_simd();
 #endif /* defined(__aarch64__) || defined(__arm__) */
 
     if (CurrentFeature == SIMD_UNKNOWN)
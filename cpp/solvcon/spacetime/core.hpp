@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include <solvcon/parallel/ThreadPool.hpp>
 #include <solvcon/solvcon.hpp>
 
 namespace solvcon
@@ -676,6 +677,18 @@ class Selm;
 /**
  * Algorithmic definition for solution.  It holds the type information for the
  * CE and SE.
+ *
+ * The element loops of update_cfl(), march_half_so0(), and
+ * march_half_so1_alpha() write each element of one plane from the other and
+ * are cut into contiguous chunks over nthread() threads; the result does not
+ * depend on the thread count.  A single-variable solver whose x-plane fluxes
+ * and so0p() take the linear form of LinearScalarSelm may set
+ * soa_march_supported and supply its t-plane flux and CFL number as the
+ * static flux_tp() and calc_cfl(); the loops then read the coordinate and
+ * solution arrays directly instead of going through element proxies, so that
+ * the compiler can vectorize them.
+ * The array path reproduces the proxy arithmetic operation by operation and
+ * gives bit-identical results; set_soa_march(false) selects the proxy path.
  */
 template <typename ST, typename CE, typename SE>
 class SolverBase
@@ -720,6 +733,7 @@ public:
     SolverBase(
         std::shared_ptr<Grid> const & grid, value_type time_increment, size_t nvar, ctor_passkey const &)
         : m_field(grid, time_increment, nvar)
+        , m_pool(ThreadPool::shared(ThreadPool::toggle_nthread("spacetime.nthread")))
     {
     }
 
@@ -794,6 +808,15 @@ public:
     SE const selm_at(int_type ielm, bool odd_plane) const { return m_field.selm_at<SE>(ielm, odd_plane); }
     SE selm_at(int_type ielm, bool odd_plane) { return m_field.selm_at<SE>(ielm, odd_plane); }
 
+    // The initial count is read from the toggle "spacetime.nthread" (1 when it
+    // is not declared); 0 selects one thread per hardware thread.
+    size_t nthread() const { return m_pool->nthread(); }
+    void set_nthread(size_t nthread) { m_pool = ThreadPool::shared(nthread); }
+
+    /// True when the element loops take the array path; see the class doc.
+    bool soa_march() const { return ST::soa_march_supported && m_soa_march; }
+    void set_soa_march(bool value) { m_soa_march = value; }
+
     void update_cfl(bool odd_plane);
     void march_half_so0(bool odd_plane);
     template <size_t ALPHA>
@@ -809,9 +832,27 @@ public:
     template <size_t ALPHA>
     void march_alpha(size_t steps);
 
+protected:
+
+    /// Overridden as true by a solver that supplies the array path.
+    static constexpr bool soa_march_supported = false;
+
 private:
 
+    /// Ranges shorter than this are not worth waking the threads for.
+    static constexpr int_type PARALLEL_MIN_COUNT = 16384;
+
+    template <typename F>
+    void for_chunks(int_type start, int_type stop, F && fn);
+
+    void update_cfl_soa(bool odd_plane, int_type first, int_type last);
+    void march_half_so0_soa(bool odd_plane, int_type first, int_type last);
+    template <size_t ALPHA>
+    void march_half_so1_alpha_soa(bool odd_plane, int_type first, int_type last);
+
     Field m_field;
+    std::shared_ptr<ThreadPool> m_pool;
+    bool m_soa_march = true;
 
 }; /* end class SolverBase */
 
@@ -943,16 +984,44 @@ SolverBase<ST, CE, SE>::set_cfl(typename SolverBase<ST, CE, SE>::array_type cons
     for (uint_type it = 0; it < nselm; ++it) { selm(it, odd_plane).cfl() = arr[it]; }
 }
 
+template <typename ST, typename CE, typename SE>
+template <typename F>
+inline void SolverBase<ST, CE, SE>::for_chunks(int_type start, int_type stop, F && fn)
+{
+    if (m_pool->nthread() <= 1 || stop - start < PARALLEL_MIN_COUNT)
+    {
+        fn(start, stop);
+    }
+    else
+    {
+        m_pool->parallel_for(start, stop, fn);
+    }
+}
+
 template <typename ST, typename CE, typename SE>
 inline void SolverBase<ST, CE, SE>::march_half_so0(bool odd_plane)
 {
     const int_type start = odd_plane ? -1 : 0;
     const auto stop = static_cast<int_type>(grid().ncelm());
-    for (int_type ic = start; ic < stop; ++ic)
-    {
-        auto ce = celm(ic, odd_plane);
-        ce.selm_tp().so0(0) = ce.calc_so0(0);
-    }
+    for_chunks(
+        start,
+        stop,
+        [this, odd_plane](int_type first, int_type last)
+        {
+            if constexpr (ST::soa_march_supported)
+            {
+                if (m_soa_march)
+                {
+                    march_half_so0_soa(odd_plane, first, last);
+                    return;
+                }
+            }
+            for (int_type ic = first; ic < last; ++ic)
+            {
+                auto ce = celm(ic, odd_plane);
+                ce.selm_tp().so0(0) = ce.calc_so0(0);
+            }
+        });
 }
 
 template <typename ST, typename CE, typename SE>
@@ -960,10 +1029,24 @@ inline void SolverBase<ST, CE, SE>::update_cfl(bool odd_plane)
 {
     const int_type start = odd_plane ? -1 : 0;
     const auto stop = static_cast<int_type>(grid().nselm());
-    for (int_type ic = start; ic < stop; ++ic)
-    {
-        selm(ic, odd_plane).update_cfl();
-    }
+    for_chunks(
+        start,
+        stop,
+        [this, odd_plane](int_type first, int_type last)
+        {
+            if constexpr (ST::soa_march_supported)
+            {
+                if (m_soa_march)
+                {
+                    update_cfl_soa(odd_plane, first, last);
+                    return;
+                }
+            }
+            for (int_type ic = first; ic < last; ++ic)
+            {
+                selm(ic, odd_plane).update_cfl();
+            }
+        });
 }
 
 template <typename ST, typename CE, typename SE>
@@ -972,10 +1055,105 @@ inline void SolverBase<ST, CE, SE>::march_half_so1_alpha(bool odd_plane)
 {
     const int_type start = odd_plane ? -1 : 0;
     const auto stop = static_cast<int_type>(grid().ncelm());
-    for (int_type ic = start; ic < stop; ++ic)
+    for_chunks(
+        start,
+        stop,
+        [this, odd_plane](int_type first, int_type last)
+        {
+            if constexpr (ST::soa_march_supported)
+            {
+                if (m_soa_march)
+                {
+                    march_half_so1_alpha_soa<ALPHA>(odd_plane, first, last);
+                    return;
+                }
+            }
+            for (int_type ic = first; ic < last; ++ic)
+            {
+                auto ce = celm(ic, odd_plane);
+                ce.selm_tp().so1(0) = ce.template calc_so1_alpha<ALPHA>(0);
+            }
+        });
+}
+
+/*
+ * The array path.  Celm ic on a plane sits at coordinate index c and its
+ * three solution elements at c-1 (xn), c+1 (xp), and c (tp, on the other
+ * plane); the solution element at index j spans [x[j-1], x[j+1]].  Each
+ * expression below spells out the corresponding Celm and Selm member
+ * functions in the same order of operations.
+ */
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::update_cfl_soa(bool odd_plane, int_type first, int_type last)
+{
+    real_type const * const x = grid().xcoord().data();
+    real_type const * const so0 = m_field.so0().data();
+    real_type * const cfl = m_field.cfl().data();
+    const real_type hdt = m_field.hdt();
+    const size_t base = grid().xindex_selm(first, odd_plane);
+    const auto count = static_cast<size_t>(last - first);
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t j = base + 2 * k;
+        const real_type hdx = std::min(x[j] - x[j - 1], x[j + 1] - x[j]);
+        cfl[j] = ST::calc_cfl(so0[j], hdt, hdx);
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::march_half_so0_soa(bool odd_plane, int_type first, int_type last)
+{
+    real_type const * const x = grid().xcoord().data();
+    real_type * const so0 = m_field.so0().data();
+    real_type const * const so1 = m_field.so1().data();
+    const real_type hdt = m_field.hdt();
+    const real_type qdt = m_field.qdt();
+    const size_t base = grid().xindex_celm(first, odd_plane);
+    const auto count = static_cast<size_t>(last - first);
+    for (size_t k = 0; k < count; ++k)
+    {
+        const size_t c = base + 2 * k;
+        const size_t n = c - 1;
+        const size_t p = c + 1;
+        const real_type xctr_n = (x[n - 1] + x[c]) / 2;
+        const real_type xctr_p = (x[c] + x[p + 1]) / 2;
+        const real_type xp_n = (x[c] - x[n]) * (so0[n] + (0.5 * (x[n] + x[c]) - xctr_n) * so1[n]);
+        const real_type tp_n = ST::flux_tp(so0[n], so1[n], x[n] - xctr_n, hdt, qdt);
+        const real_type xn_p = (x[p] - x[c]) * (so0[p] + (0.5 * (x[p] + x[c]) - xctr_p) * so1[p]);
+        const real_type tp_p = ST::flux_tp(so0[p], so1[p], x[p] - xctr_p, hdt, qdt);
+        const real_type flux_ll = xp_n + tp_n;
+        const real_type flux_ur = xn_p - tp_p;
+        so0[c] = (flux_ll + flux_ur) / (x[c + 1] - x[c - 1]);
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_half_so1_alpha_soa(bool odd_plane, int_type first, int_type last)
+{
+    real_type const * const x = grid().xcoord().data();
+    real_type const * const so0 = m_field.so0().data();
+    real_type * const so1 = m_field.so1().data();
+    const real_type hdt = m_field.hdt();
+    constexpr real_type tiny = std::numeric_limits<real_type>::min();
+    const size_t base = grid().xindex_celm(first, odd_plane);
+    const auto count = static_cast<size_t>(last - first);
+    for (size_t k = 0; k < count; ++k)
     {
-        auto ce = celm(ic, odd_plane);
-        ce.selm_tp().so1(0) = ce.template calc_so1_alpha<ALPHA>(0);
+        const size_t c = base + 2 * k;
+        const size_t n = c - 1;
+        const size_t p = c + 1;
+        const real_type xctr_n = (x[n - 1] + x[c]) / 2;
+        const real_type xctr_p = (x[c] + x[p + 1]) / 2;
+        const real_type upn = (so0[n] + (x[n] - xctr_n) * so1[n]) - hdt * so1[n];
+        const real_type upp = (so0[p] + (x[p] - xctr_p) * so1[p]) - hdt * so1[p];
+        const real_type utp = so0[c];
+        const real_type duxn = (utp - upn) / (x[c] - x[n]);
+        const real_type duxp = (upp - utp) / (x[p] - x[c]);
+        const real_type fan = pow<ALPHA>(std::fabs(duxn));
+        const real_type fap = pow<ALPHA>(std::fabs(duxp));
+        so1[c] = (fap * duxn + fan * duxp) / (fap + fan + tiny);
     }
 }
 
@@ -43,6 +43,26 @@ public:
         return construct_impl(grid, time_increment, 1);
     }
 
+    static constexpr bool soa_march_supported = true;
+
+    /**
+     * Flux for the forward branch on the t-plane from the solution u, its
+     * gradient u_x, and the displacement of the element center.
+     */
+    static value_type flux_tp(value_type u, value_type u_x, value_type displacement, value_type hdt, value_type qdt)
+    {
+        const value_type u_2 = u * u;
+        value_type ret = 0.5 * u_2; /* f(u) */
+        ret += displacement * u * u_x; /* displacement in x */
+        ret -= qdt * u_2 * u_x; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type calc_cfl(value_type u, value_type hdt, value_type hdx)
+    {
+        return std::fabs(u) * hdt / hdx;
+    }
+
 }; /* end class InviscidBurgersSolver */
 
 /**
@@ -82,13 +102,7 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tn(size_t iv) const
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tp(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    const value_type u = so0(iv);
-    const value_type u_2 = u * u;
-    value_type ret = 0.5 * u_2; /* f(u) */
-    ret += displacement * u * so1(iv); /* displacement in x */
-    ret -= qdt() * u_2 * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return InviscidBurgersSolver::flux_tp(so0(iv), so1(iv), x() - xctr(), hdt(), qdt());
 }
 
 /**
@@ -105,7 +119,7 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::so0p(size_t iv) cons
 inline void InviscidBurgersSelm::update_cfl()
 {
     const value_type hdx = std::min(dxneg(), dxpos());
-    this->cfl() = std::fabs(so0(0)) * field().hdt() / hdx;
+    this->cfl() = InviscidBurgersSolver::calc_cfl(so0(0), field().hdt(), hdx);
 }
 
 } /* end namespace spacetime */
@@ -40,6 +40,23 @@ public:
         return construct_impl(grid, time_increment, 1);
     }
 
+    static constexpr bool soa_march_supported = true;
+
+    /// Flux for the forward branch on the t-plane from the solution u, its
+    /// gradient u_x, and the displacement of the element center.
+    static value_type flux_tp(value_type u, value_type u_x, value_type displacement, value_type hdt, value_type qdt)
+    {
+        value_type ret = u; /* f(u) */
+        ret += displacement * u_x; /* displacement in x; f_u == 1 */
+        ret -= qdt * u_x; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type calc_cfl(value_type /*u*/, value_type hdt, value_type hdx)
+    {
+        return hdt / hdx;
+    }
+
 }; /* end class LinearScalarSolver */
 
 inline LinearScalarSelm::value_type LinearScalarSelm::xn(size_t iv) const
@@ -65,11 +82,7 @@ inline LinearScalarSelm::value_type LinearScalarSelm::tn(size_t iv) const
 
 inline LinearScalarSelm::value_type LinearScalarSelm::tp(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    value_type ret = so0(iv); /* f(u) */
-    ret += displacement * so1(iv); /* displacement in x; f_u == 1 */
-    ret -= qdt() * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return LinearScalarSolver::flux_tp(so0(iv), so1(iv), x() - xctr(), hdt(), qdt());
 }
 
 inline LinearScalarSelm::value_type LinearScalarSelm::so0p(size_t iv) const
@@ -83,7 +96,7 @@ inline LinearScalarSelm::value_type LinearScalarSelm::so0p(size_t iv) const
 inline void LinearScalarSelm::update_cfl()
 {
     const value_type hdx = std::min(dxneg(), dxpos());
-    this->cfl() = field().hdt() / hdx;
+    this->cfl() = LinearScalarSolver::calc_cfl(so0(0), field().hdt(), hdx);
 }
 
 } /* end namespace spacetime */
@@ -321,6 +321,8 @@ protected:
                     return rarr; },
                 py::arg("odd_plane") = false)
             .def_property_readonly("nvar", &wrapped_type::nvar)
+            .def_property("nthread", &wrapped_type::nthread, &wrapped_type::set_nthread)
+            .def_property("soa_march", &wrapped_type::soa_march, &wrapped_type::set_soa_march)
             .def_property(
                 "time_increment", &wrapped_type::time_increment, &wrapped_type::set_time_increment)
             .def_property_readonly("dt", &wrapped_type::dt)
@@ -0,0 +1,1199 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+/**
+ * @file
+ * Planned fast Fourier transforms with cached tables and scratch buffers.
+ *
+ * @ingroup group_numerics
+ */
+
+#include <solvcon/math/math.hpp>
+#include <solvcon/buffer/buffer.hpp>
+#include <solvcon/buffer/loop.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace solvcon
+{
+
+namespace detail
+{
+
+size_t bit_reverse(size_t n, size_t bits);
+size_t next_power_of_two(size_t n);
+/// Radices (4, 2, 3, 5, 7) whose product is n, or empty if n is 1 or has
+/// another prime factor.
+std::vector<size_t> smooth_radices(size_t n);
+/// Smallest length not less than n whose prime factors are 2, 3, 5, and 7.
+size_t next_smooth_length(size_t n);
+
+/**
+ * Complex FFT of one length on a contiguous line, in place.
+ *
+ * A power-of-two length runs the iterative Cooley-Tukey algorithm: the bit
+ * reversal permutation from a table, an optional radix-2 stage, and radix-4
+ * passes that each fuse two radix-2 stages, with the twiddle factors of every
+ * pass stored contiguously.  Other lengths whose prime factors are 2, 3, 5,
+ * and 7 run the mixed-radix Stockham algorithm, which ping-pongs between the
+ * data and the scratch buffer and needs no digit reversal.  Only a length with
+ * a larger prime factor uses the Bluestein algorithm, on a convolution kernel
+ * of the next such smooth length, with the chirp and the transformed filter
+ * computed once.  backward() uses the positive exponent and multiplies by
+ * scale; it conjugates in place rather than copying the data.
+ */
+template <typename T>
+class FourierKernel
+{
+
+public:
+
+    using complex_type = Complex<T>;
+
+    explicit FourierKernel(size_t size);
+
+    FourierKernel() = delete;
+    FourierKernel(FourierKernel const &) = delete;
+    FourierKernel(FourierKernel &&) = delete;
+    FourierKernel & operator=(FourierKernel const &) = delete;
+    FourierKernel & operator=(FourierKernel &&) = delete;
+    ~FourierKernel() = default;
+
+    size_t size() const { return m_size; }
+
+    void forward(complex_type * data);
+    void backward(complex_type * data, T scale);
+
+private:
+
+    /// One pass of the mixed-radix algorithm over a sub-length of the data.
+    struct Stage
+    {
+        size_t radix;
+        size_t span; // Number of butterflies per sub-transform.
+        size_t stride; // Distance between the interleaved sub-transforms.
+        size_t twiddle; // Offset of the (radix - 1) * span twiddle factors.
+        size_t root; // Offset of the radix * radix roots of unity.
+    }; /* end struct Stage */
+
+    void forward_pow2(complex_type * data) const;
+    void forward_mixed(complex_type * data);
+    void forward_bluestein(complex_type * data);
+
+    void make_pow2();
+    void make_mixed(std::vector<size_t> const & radices);
+    void make_bluestein();
+
+    template <size_t R>
+    void mixed_pass(Stage const & stage, complex_type const * x, complex_type * y) const;
+
+    static complex_type unit(size_t numerator, size_t denominator);
+
+    size_t m_size;
+    bool m_pow2;
+    std::vector<Stage> m_stages;
+    std::vector<complex_type> m_roots;
+    bool m_radix2_first = false;
+    std::vector<size_t> m_bitrev;
+    // Twiddle factors of the passes.  The radix-4 pass of quarter size h holds
+    // exp(-2 pi i k / (4h)) then exp(-2 pi i 2k / (4h)) for k < h; see
+    // make_mixed() for the mixed-radix stages.
+    std::vector<complex_type> m_twiddles;
+
+    // Bluestein: chirp exp(-pi i k^2 / n), the transformed filter scaled by
+    // the inverse of the convolution length, and the convolution scratch,
+    // which the mixed-radix stages share as the ping-pong buffer.
+    std::unique_ptr<FourierKernel<T>> m_conv;
+    std::vector<complex_type> m_chirp;
+    std::vector<complex_type> m_filter;
+    std::vector<complex_type> m_scratch;
+
+}; /* end class FourierKernel */
+
+template <typename T>
+typename FourierKernel<T>::complex_type FourierKernel<T>::unit(size_t numerator, size_t denominator)
+{
+    // Evaluate in double for the accuracy of the float tables.
+    double const angle = -2.0 * pi<double> * static_cast<double>(numerator) / static_cast<double>(denominator);
+    return complex_type{static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+}
+
+template <typename T>
+FourierKernel<T>::FourierKernel(size_t size)
+    : m_size(size)
+    , m_pow2(size != 0 && (size & (size - 1)) == 0)
+{
+    if (m_pow2)
+    {
+        make_pow2();
+    }
+    else if (m_size > 1)
+    {
+        std::vector<size_t> radices = smooth_radices(m_size);
+        if (radices.empty())
+        {
+            make_bluestein();
+        }
+        else
+        {
+            make_mixed(radices);
+        }
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::make_pow2()
+{
+    size_t bits = 0;
+    while ((size_t(1) << bits) < m_size)
+    {
+        ++bits;
+    }
+    m_bitrev.resize(m_size);
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        m_bitrev[i] = bit_reverse(i, bits);
+    }
+    m_radix2_first = (bits % 2) == 1;
+    for (size_t h = m_radix2_first ? 2 : 1; 4 * h <= m_size; h *= 4)
+    {
+        for (size_t k = 0; k < h; ++k)
+        {
+            m_twiddles.push_back(unit(k, 4 * h));
+        }
+        for (size_t k = 0; k < h; ++k)
+        {
+            m_twiddles.push_back(unit(2 * k, 4 * h));
+        }
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::make_mixed(std::vector<size_t> const & radices)
+{
+    // The pass of radix p over the sub-length l = p * span twiddles output
+    // t of butterfly i by exp(-2 pi i t / l), for 0 < t < p.
+    size_t length = m_size;
+    for (size_t const radix : radices)
+    {
+        Stage stage{radix, length / radix, m_size / length, m_twiddles.size(), m_roots.size()};
+        for (size_t i = 0; i < stage.span; ++i)
+        {
+            for (size_t t = 1; t < radix; ++t)
+            {
+                m_twiddles.push_back(unit(i * t, length));
+            }
+        }
+        for (size_t r = 0; r < radix; ++r)
+        {
+            for (size_t t = 0; t < radix; ++t)
+            {
+                m_roots.push_back(unit((r * t) % radix, radix));
+            }
+        }
+        m_stages.push_back(stage);
+        length = stage.span;
+    }
+    m_scratch.resize(m_size);
+}
+
+template <typename T>
+void FourierKernel<T>::make_bluestein()
+{
+    size_t const nconv = next_smooth_length(2 * m_size - 1);
+    m_conv = std::make_unique<FourierKernel<T>>(nconv);
+    m_chirp.resize(m_size);
+    m_filter.assign(nconv, complex_type{0.0, 0.0});
+    m_scratch.resize(nconv);
+    for (size_t k = 0; k < m_size; ++k)
+    {
+        // k^2 mod 2n keeps the angle small and accurate.
+        auto const k2 = static_cast<size_t>((static_cast<uint64_t>(k) * k) % (2 * m_size));
+        m_chirp[k] = unit(k2, 2 * m_size);
+    }
+    T const scale = T(1) / static_cast<T>(nconv);
+    m_filter[0] = complex_type{scale, 0.0};
+    for (size_t k = 1; k < m_size; ++k)
+    {
+        m_filter[k] = m_chirp[k].conj() * scale;
+        m_filter[nconv - k] = m_filter[k];
+    }
+    m_conv->forward(m_filter.data());
+}
+
+template <typename T>
+void FourierKernel<T>::forward(complex_type * data)
+{
+    if (m_pow2)
+    {
+        forward_pow2(data);
+    }
+    else if (!m_stages.empty())
+    {
+        forward_mixed(data);
+    }
+    else if (m_size > 1)
+    {
+        forward_bluestein(data);
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::backward(complex_type * data, T scale)
+{
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        data[i].imag_v = -data[i].imag_v;
+    }
+    forward(data);
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        data[i].real_v *= scale;
+        data[i].imag_v *= -scale;
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::forward_pow2(complex_type * data) const
+{
+    size_t const n = m_size;
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t const j = m_bitrev[i];
+        if (i < j)
+        {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    size_t h = 1;
+    if (m_radix2_first)
+    {
+        for (size_t i = 0; i < n; i += 2)
+        {
+            complex_type const a = data[i];
+            complex_type const b = data[i + 1];
+            data[i] = a + b;
+            data[i + 1] = a - b;
+        }
+        h = 2;
+    }
+
+    // Each radix-4 pass does the radix-2 stages of half sizes h and 2h.
+    complex_type const * tw = m_twiddles.data();
+    for (; 4 * h <= n; h *= 4)
+    {
+        complex_type const * w1 = tw;
+        complex_type const * w2 = tw + h;
+        for (size_t i = 0; i < n; i += 4 * h)
+        {
+            complex_type * x0 = data + i;
+            complex_type * x1 = x0 + h;
+            complex_type * x2 = x1 + h;
+            complex_type * x3 = x2 + h;
+            for (size_t k = 0; k < h; ++k)
+            {
+                T const w2r = w2[k].real_v;
+                T const w2i = w2[k].imag_v;
+                T const w1r = w1[k].real_v;
+                T const w1i = w1[k].imag_v;
+                // First stage: butterflies of (x0, x1) and (x2, x3).
+                T const b1r = (x1[k].real_v * w2r) - (x1[k].imag_v * w2i);
+                T const b1i = (x1[k].real_v * w2i) + (x1[k].imag_v * w2r);
+                T const b3r = (x3[k].real_v * w2r) - (x3[k].imag_v * w2i);
+                T const b3i = (x3[k].real_v * w2i) + (x3[k].imag_v * w2r);
+                T const y0r = x0[k].real_v + b1r;
+                T const y0i = x0[k].imag_v + b1i;
+                T const y1r = x0[k].real_v - b1r;
+                T const y1i = x0[k].imag_v - b1i;
+                T const y2r = x2[k].real_v + b3r;
+                T const y2i = x2[k].imag_v + b3i;
+                T const y3r = x2[k].real_v - b3r;
+                T const y3i = x2[k].imag_v - b3i;
+                // Second stage: the twiddle of y3 is w1 times -i.
+                T const t2r = (y2r * w1r) - (y2i * w1i);
+                T const t2i = (y2r * w1i) + (y2i * w1r);
+                T const t3r = (y3r * w1i) + (y3i * w1r);
+                T const t3i = (y3i * w1i) - (y3r * w1r);
+                x0[k] = complex_type{y0r + t2r, y0i + t2i};
+                x2[k] = complex_type{y0r - t2r, y0i - t2i};
+                x1[k] = complex_type{y1r + t3r, y1i + t3i};
+                x3[k] = complex_type{y1r - t3r, y1i - t3i};
+            }
+        }
+        tw += 2 * h;
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::forward_mixed(complex_type * data)
+{
+    complex_type * x = data;
+    complex_type * y = m_scratch.data();
+    for (Stage const & stage : m_stages)
+    {
+        switch (stage.radix)
+        {
+        case 2: mixed_pass<2>(stage, x, y); break;
+        case 3: mixed_pass<3>(stage, x, y); break;
+        case 4: mixed_pass<4>(stage, x, y); break;
+        case 5: mixed_pass<5>(stage, x, y); break;
+        default: mixed_pass<7>(stage, x, y); break;
+        }
+        std::swap(x, y);
+    }
+    if (x != data)
+    {
+        std::copy_n(x, m_size, data);
+    }
+}
+
+/**
+ * Decimation-in-frequency Stockham pass: butterfly i of the interleaved
+ * sub-transform q reads the R inputs span apart, and writes its outputs R
+ * apart from index R * i, so that the next pass finds its sub-transforms
+ * interleaved with stride * R.
+ */
+template <typename T>
+template <size_t R>
+void FourierKernel<T>::mixed_pass(Stage const & stage, complex_type const * x, complex_type * y) const
+{
+    size_t const span = stage.span;
+    size_t const stride = stage.stride;
+    complex_type const * tw = m_twiddles.data() + stage.twiddle;
+    complex_type const * root = m_roots.data() + stage.root;
+    for (size_t i = 0; i < span; ++i)
+    {
+        complex_type const * w = tw + (i * (R - 1));
+        for (size_t q = 0; q < stride; ++q)
+        {
+            complex_type a[R];
+            for (size_t r = 0; r < R; ++r)
+            {
+                a[r] = x[q + (stride * (i + (r * span)))];
+            }
+            complex_type b[R];
+            if constexpr (R == 2)
+            {
+                b[0] = a[0] + a[1];
+                b[1] = a[0] - a[1];
+            }
+            else if constexpr (R == 4)
+            {
+                // The roots of unity of radix 4 are 1, -i, -1, and i.
+                complex_type const s02 = a[0] + a[2];
+                complex_type const d02 = a[0] - a[2];
+                complex_type const s13 = a[1] + a[3];
+                complex_type const d13 = a[1] - a[3];
+                b[0] = s02 + s13;
+                b[1] = complex_type{d02.real_v + d13.imag_v, d02.imag_v - d13.real_v};
+                b[2] = s02 - s13;
+                b[3] = complex_type{d02.real_v - d13.imag_v, d02.imag_v + d13.real_v};
+            }
+            else
+            {
+                for (size_t t = 0; t < R; ++t)
+                {
+                    complex_type sum = a[0];
+                    for (size_t r = 1; r < R; ++r)
+                    {
+                        sum += a[r] * root[(r * R) + t];
+                    }
+                    b[t] = sum;
+                }
+            }
+            complex_type * out = y + q + (stride * R * i);
+            out[0] = b[0];
+            for (size_t t = 1; t < R; ++t)
+            {
+                out[stride * t] = b[t] * w[t - 1];
+            }
+        }
+    }
+}
+
+template <typename T>
+void FourierKernel<T>::forward_bluestein(complex_type * data)
+{
+    size_t const nconv = m_scratch.size();
+    complex_type * a = m_scratch.data();
+    for (size_t k = 0; k < m_size; ++k)
+    {
+        a[k] = data[k] * m_chirp[k];
+    }
+    std::fill(a + m_size, a + nconv, complex_type{0.0, 0.0});
+    m_conv->forward(a);
+    for (size_t k = 0; k < nconv; ++k)
+    {
+        a[k] *= m_filter[k];
+    }
+    // The filter carries the 1/nconv of the inverse transform.
+    m_conv->backward(a, T(1));
+    for (size_t k = 0; k < m_size; ++k)
+    {
+        data[k] = a[k] * m_chirp[k];
+    }
+}
+
+} /* end namespace detail */
+
+/**
+ * Plan of discrete Fourier transforms of a fixed shape.
+ *
+ * @ingroup group_numerics
+ *
+ * Like an FFTW plan, a FourierPlan computes the bit reversal, twiddle, and
+ * Bluestein tables for its shape once, keeps the scratch buffers, and is then
+ * executed on any number of arrays.  The shape holds the lengths of the
+ * transformed axes; a shape of rank 2 or 3 plans a 2D or 3D transform.  The
+ * transformed axes of an array end at the axis argument (the last axis by
+ * default), and every other axis is a batch, so a rank-1 plan transforms the
+ * lines of an array along any axis.
+ *
+ * fft() and ifft() are the complex transforms, with ifft() scaled by the
+ * inverse of the number of elements like numpy.fft.ifftn().  rfft() takes
+ * real input and writes the n/2+1 non-negative frequencies of the last
+ * transformed axis; irfft() inverts it into an array of the planned shape.
+ * An even real length is transformed as a complex signal of half the length.
+ * The output arrays are supplied by the caller and may be strided.  A plan
+ * is not to be executed by several threads at once because of its scratch
+ * buffers.
+ */
+template <typename T>
+class FourierPlan
+    : public std::enable_shared_from_this<FourierPlan<T>>
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    }; /* end struct ctor_passkey */
+
+public:
+
+    using real_type = T;
+    using complex_type = Complex<T>;
+    using shape_type = small_vector<ssize_t>;
+    using real_array_type = SimpleArray<T>;
+    using complex_array_type = SimpleArray<complex_type>;
+
+    template <class... Args>
+    static std::shared_ptr<FourierPlan<T>> construct(Args &&... args)
+    {
+        return std::make_shared<FourierPlan<T>>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    FourierPlan(shape_type const & shape, ctor_passkey const &);
+
+    FourierPlan() = delete;
+    FourierPlan(FourierPlan const &) = delete;
+    FourierPlan(FourierPlan &&) = delete;
+    FourierPlan & operator=(FourierPlan const &) = delete;
+    FourierPlan & operator=(FourierPlan &&) = delete;
+    ~FourierPlan() = default;
+
+    shape_type const & shape() const { return m_shape; }
+    size_t rank() const { return m_shape.size(); }
+    /// Number of elements in the planned shape.
+    size_t size() const;
+
+    void fft(complex_array_type const & in, complex_array_type & out, ssize_t axis = -1);
+    void ifft(complex_array_type const & in, complex_array_type & out, ssize_t axis = -1);
+    void rfft(real_array_type const & in, complex_array_type & out, ssize_t axis = -1);
+    void irfft(complex_array_type const & in, real_array_type & out, ssize_t axis = -1);
+
+    /// Number of lines transformed together along a strided axis.
+    static constexpr ssize_t LINE_BLOCK = 8;
+
+private:
+
+    using kernel_type = detail::FourierKernel<T>;
+
+    enum class Operand : size_t
+    {
+        in = 0,
+        out = 1,
+    }; /* end enum class Operand */
+
+    /// Index of the first transformed axis of an array of ndim axes.
+    size_t first_axis(size_t ndim, ssize_t axis, char const * op) const;
+    void validate_shape(shape_type const & shape, size_t first, bool half, char const * op) const;
+    static void validate_same_batch(shape_type const & lhs, shape_type const & rhs, size_t last, char const * op);
+
+    kernel_type & kernel(size_t length);
+
+    /// Transform the lines along an axis of the complex data in place.
+    void transform_axis(
+        complex_type * data,
+        shape_type const & shape,
+        shape_type const & stride,
+        size_t axis,
+        bool inverse,
+        T scale);
+    static void copy_array(complex_array_type const & in, complex_array_type & out);
+
+    void rfft_line(T const * in, ssize_t in_stride, complex_type * out, ssize_t out_stride);
+    void irfft_line(complex_type const * in, ssize_t in_stride, T * out, ssize_t out_stride, T scale);
+
+    shape_type m_shape;
+    std::vector<std::unique_ptr<kernel_type>> m_kernels;
+    // Real transform of the last axis: e^{-2 pi i k / n} for k <= n/2.
+    std::vector<complex_type> m_real_twiddles;
+    std::vector<complex_type> m_line;
+    complex_array_type m_work;
+
+}; /* end class FourierPlan */
+
+template <typename T>
+FourierPlan<T>::FourierPlan(shape_type const & shape, ctor_passkey const &)
+    : m_shape(shape)
+{
+    if (m_shape.empty())
+    {
+        throw std::invalid_argument("FourierPlan: the shape must have at least one axis");
+    }
+    for (ssize_t const length : m_shape)
+    {
+        if (length <= 0)
+        {
+            throw std::invalid_argument(std::format("FourierPlan: invalid length {} in the shape", length));
+        }
+        kernel(static_cast<size_t>(length));
+    }
+    auto const nreal = static_cast<size_t>(m_shape[m_shape.size() - 1]);
+    if (nreal % 2 == 0)
+    {
+        kernel(nreal / 2);
+        m_real_twiddles.resize((nreal / 2) + 1);
+        for (size_t k = 0; k <= nreal / 2; ++k)
+        {
+            double const angle = -2.0 * pi<double> * static_cast<double>(k) / static_cast<double>(nreal);
+            m_real_twiddles[k] = complex_type{static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle))};
+        }
+    }
+}
+
+template <typename T>
+size_t FourierPlan<T>::size() const
+{
+    size_t ret = 1;
+    for (ssize_t const length : m_shape)
+    {
+        ret *= static_cast<size_t>(length);
+    }
+    return ret;
+}
+
+template <typename T>
+typename FourierPlan<T>::kernel_type & FourierPlan<T>::kernel(size_t length)
+{
+    for (auto const & k : m_kernels)
+    {
+        if (k->size() == length)
+        {
+            return *k;
+        }
+    }
+    m_kernels.push_back(std::make_unique<kernel_type>(length));
+    return *m_kernels.back();
+}
+
+template <typename T>
+size_t FourierPlan<T>::first_axis(size_t ndim, ssize_t axis, char const * op) const
+{
+    auto const sndim = static_cast<ssize_t>(ndim);
+    ssize_t const last = axis < 0 ? axis + sndim : axis;
+    auto const srank = static_cast<ssize_t>(rank());
+    if (last < 0 || last >= sndim || last + 1 < srank)
+    {
+        throw std::invalid_argument(std::format(
+            "FourierPlan::{}(): axis {} does not fit {} transformed axes in an array of {} dimensions",
+            op,
+            axis,
+            rank(),
+            ndim));
+    }
+    return static_cast<size_t>(last + 1 - srank);
+}
+
+template <typename T>
+void FourierPlan<T>::validate_shape(shape_type const & shape, size_t first, bool half, char const * op) const
+{
+    for (size_t i = 0; i < rank(); ++i)
+    {
+        ssize_t expected = m_shape[i];
+        if (half && i + 1 == rank())
+        {
+            expected = (expected / 2) + 1;
+        }
+        if (shape[first + i] != expected)
+        {
+            throw std::invalid_argument(std::format(
+                "FourierPlan::{}(): array shape {} does not match the plan shape {}",
+                op,
+                detail::format_shape(shape),
+                detail::format_shape(m_shape)));
+        }
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::validate_same_batch(shape_type const & lhs, shape_type const & rhs, size_t last, char const * op)
+{
+    bool same = lhs.size() == rhs.size();
+    for (size_t i = 0; same && i < lhs.size(); ++i)
+    {
+        same = i == last || lhs[i] == rhs[i];
+    }
+    if (!same)
+    {
+        throw std::invalid_argument(std::format(
+            "FourierPlan::{}(): shape mismatch: in={} out={}",
+            op,
+            detail::format_shape(lhs),
+            detail::format_shape(rhs)));
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::copy_array(complex_array_type const & in, complex_array_type & out)
+{
+    if (in.logical_data() == out.logical_data() && in.stride() == out.stride())
+    {
+        return;
+    }
+    if (in.is_c_contiguous() && out.is_c_contiguous())
+    {
+        std::copy_n(in.logical_data(), in.size(), out.logical_data());
+        return;
+    }
+    detail::LoopDomain const domain(in.shape());
+    detail::MappedOffsetCursor::mapping_type const mappings{
+        detail::OperandMapping(in.stride()),
+        detail::OperandMapping(out.stride()),
+    };
+    for (detail::MappedOffsetCursor cursor(domain, mappings); cursor; cursor.advance())
+    {
+        out.logical_data()[cursor.offset(Operand::out)] = in.logical_data()[cursor.offset(Operand::in)];
+    }
+}
+
+/**
+ * The lines along a contiguous axis are transformed where they are.  The
+ * lines along a strided axis are gathered into the scratch buffer
+ * LINE_BLOCK at a time when a neighbouring axis is contiguous, so that each
+ * row is read and written as a whole.
+ */
+template <typename T>
+void FourierPlan<T>::transform_axis(
+    complex_type * data,
+    shape_type const & shape,
+    shape_type const & stride,
+    size_t axis,
+    bool inverse,
+    T scale)
+{
+    ssize_t const n = shape[axis];
+    ssize_t const s = stride[axis];
+    kernel_type & kern = kernel(static_cast<size_t>(n));
+    auto run = [&](complex_type * line)
+    {
+        if (inverse)
+        {
+            kern.backward(line, scale);
+        }
+        else
+        {
+            kern.forward(line);
+        }
+    };
+
+    // Block the lines over the innermost other axis if it is contiguous.
+    size_t block_axis = shape.size();
+    for (size_t a = shape.size(); a > 0; --a)
+    {
+        if (a - 1 != axis)
+        {
+            block_axis = stride[a - 1] == 1 && s != 1 ? a - 1 : shape.size();
+            break;
+        }
+    }
+    shape_type outer_shape;
+    shape_type outer_stride;
+    for (size_t a = 0; a < shape.size(); ++a)
+    {
+        if (a != axis && a != block_axis)
+        {
+            outer_shape.push_back(shape[a]);
+            outer_stride.push_back(stride[a]);
+        }
+    }
+    ssize_t const nblock = block_axis < shape.size() ? shape[block_axis] : 1;
+    ssize_t const width = block_axis < shape.size() ? LINE_BLOCK : 1;
+    if (s != 1)
+    {
+        m_line.resize(static_cast<size_t>(n * width));
+    }
+
+    detail::LoopDomain const domain(outer_shape);
+    detail::MappedOffsetCursor::mapping_type const mappings{detail::OperandMapping(outer_stride)};
+    for (detail::MappedOffsetCursor cursor(domain, mappings); cursor; cursor.advance())
+    {
+        complex_type * base = data + cursor.offset(Operand::in);
+        if (s == 1)
+        {
+            run(base);
+            continue;
+        }
+        for (ssize_t j0 = 0; j0 < nblock; j0 += width)
+        {
+            ssize_t const nj = std::min(width, nblock - j0);
+            complex_type * line = m_line.data();
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                complex_type const * row = base + (i * s) + j0;
+                for (ssize_t j = 0; j < nj; ++j)
+                {
+                    line[(j * n) + i] = row[j];
+                }
+            }
+            for (ssize_t j = 0; j < nj; ++j)
+            {
+                run(line + (j * n));
+            }
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                complex_type * row = base + (i * s) + j0;
+                for (ssize_t j = 0; j < nj; ++j)
+                {
+                    row[j] = line[(j * n) + i];
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::fft(complex_array_type const & in, complex_array_type & out, ssize_t axis)
+{
+    size_t const first = first_axis(in.ndim(), axis, "fft");
+    validate_shape(in.shape(), first, /* half */ false, "fft");
+    validate_same_batch(in.shape(), out.shape(), in.ndim(), "fft");
+    copy_array(in, out);
+    for (size_t i = rank(); i > 0; --i)
+    {
+        transform_axis(out.logical_data(), out.shape(), out.stride(), first + i - 1, /* inverse */ false, T(1));
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::ifft(complex_array_type const & in, complex_array_type & out, ssize_t axis)
+{
+    size_t const first = first_axis(in.ndim(), axis, "ifft");
+    validate_shape(in.shape(), first, /* half */ false, "ifft");
+    validate_same_batch(in.shape(), out.shape(), in.ndim(), "ifft");
+    copy_array(in, out);
+    // The first transformed axis is done last and applies the scale.
+    for (size_t i = rank(); i > 0; --i)
+    {
+        T const scale = i == 1 ? T(1) / static_cast<T>(size()) : T(1);
+        transform_axis(out.logical_data(), out.shape(), out.stride(), first + i - 1, /* inverse */ true, scale);
+    }
+}
+
+/**
+ * The even real signal x of length n = 2m is transformed as the complex
+ * signal z[j] = x[2j] + i x[2j+1] of length m, and the spectrum is separated
+ * with X[k] = (Z[k] + conj(Z[m-k])) / 2 - i e^{-2 pi i k / n} (Z[k] -
+ * conj(Z[m-k])) / 2.  An odd length takes the complex transform.
+ */
+template <typename T>
+void FourierPlan<T>::rfft_line(T const * in, ssize_t in_stride, complex_type * out, ssize_t out_stride)
+{
+    auto const n = static_cast<size_t>(m_shape[rank() - 1]);
+    if (n % 2 != 0)
+    {
+        m_line.resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_line[i] = complex_type{in[static_cast<ssize_t>(i) * in_stride], T(0)};
+        }
+        kernel(n).forward(m_line.data());
+        for (size_t k = 0; k <= n / 2; ++k)
+        {
+            out[static_cast<ssize_t>(k) * out_stride] = m_line[k];
+        }
+        return;
+    }
+    size_t const m = n / 2;
+    m_line.resize(m);
+    for (size_t j = 0; j < m; ++j)
+    {
+        m_line[j] = complex_type{in[static_cast<ssize_t>(2 * j) * in_stride], in[static_cast<ssize_t>((2 * j) + 1) * in_stride]};
+    }
+    kernel(m).forward(m_line.data());
+    complex_type const * z = m_line.data();
+    out[0] = complex_type{z[0].real_v + z[0].imag_v, T(0)};
+    out[static_cast<ssize_t>(m) * out_stride] = complex_type{z[0].real_v - z[0].imag_v, T(0)};
+    for (size_t k = 1; k < m; ++k)
+    {
+        complex_type const zk = z[k];
+        complex_type const zc = z[m - k].conj();
+        T const er = (zk.real_v + zc.real_v) * T(0.5);
+        T const ei = (zk.imag_v + zc.imag_v) * T(0.5);
+        // Zo = (Z[k] - conj(Z[m-k])) / (2i)
+        T const or_ = (zk.imag_v - zc.imag_v) * T(0.5);
+        T const oi = -(zk.real_v - zc.real_v) * T(0.5);
+        complex_type const w = m_real_twiddles[k];
+        out[static_cast<ssize_t>(k) * out_stride] = complex_type{
+            er + (w.real_v * or_) - (w.imag_v * oi),
+            ei + (w.real_v * oi) + (w.imag_v * or_)};
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::irfft_line(complex_type const * in, ssize_t in_stride, T * out, ssize_t out_stride, T scale)
+{
+    auto const n = static_cast<size_t>(m_shape[rank() - 1]);
+    if (n % 2 != 0)
+    {
+        // Rebuild the Hermitian spectrum and take the complex transform.
+        m_line.resize(n);
+        m_line[0] = complex_type{in[0].real_v, T(0)};
+        for (size_t k = 1; k <= n / 2; ++k)
+        {
+            m_line[k] = in[static_cast<ssize_t>(k) * in_stride];
+            m_line[n - k] = m_line[k].conj();
+        }
+        kernel(n).backward(m_line.data(), scale);
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[static_cast<ssize_t>(i) * out_stride] = m_line[i].real_v;
+        }
+        return;
+    }
+    size_t const m = n / 2;
+    m_line.resize(m);
+    T const x0 = in[0].real_v;
+    T const xm = in[static_cast<ssize_t>(m) * in_stride].real_v;
+    m_line[0] = complex_type{(x0 + xm) * T(0.5), (x0 - xm) * T(0.5)};
+    for (size_t k = 1; k < m; ++k)
+    {
+        complex_type const xk = in[static_cast<ssize_t>(k) * in_stride];
+        complex_type const xc = in[static_cast<ssize_t>(m - k) * in_stride].conj();
+        T const er = (xk.real_v + xc.real_v) * T(0.5);
+        T const ei = (xk.imag_v + xc.imag_v) * T(0.5);
+        T const dr = (xk.real_v - xc.real_v) * T(0.5);
+        T const di = (xk.imag_v - xc.imag_v) * T(0.5);
+        // Zo = (X[k] - conj(X[m-k])) / 2 * conj(e^{-2 pi i k / n})
+        complex_type const w = m_real_twiddles[k];
+        T const or_ = (dr * w.real_v) + (di * w.imag_v);
+        T const oi = (di * w.real_v) - (dr * w.imag_v);
+        // Z = Ze + i Zo
+        m_line[k] = complex_type{er - oi, ei + or_};
+    }
+    // The half-length inverse normalizes by 1/m rather than 1/n.
+    kernel(m).backward(m_line.data(), scale * T(2));
+    for (size_t j = 0; j < m; ++j)
+    {
+        out[static_cast<ssize_t>(2 * j) * out_stride] = m_line[j].real_v;
+        out[static_cast<ssize_t>((2 * j) + 1) * out_stride] = m_line[j].imag_v;
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::rfft(real_array_type const & in, complex_array_type & out, ssize_t axis)
+{
+    size_t const first = first_axis(in.ndim(), axis, "rfft");
+    size_t const last = first + rank() - 1;
+    validate_shape(in.shape(), first, /* half */ false, "rfft");
+    validate_shape(out.shape(), first, /* half */ true, "rfft");
+    validate_same_batch(in.shape(), out.shape(), last, "rfft");
+
+    // Real-to-complex lines along the last transformed axis.
+    shape_type outer_shape;
+    shape_type in_stride;
+    shape_type out_stride;
+    for (size_t a = 0; a < in.shape().size(); ++a)
+    {
+        if (a != last)
+        {
+            outer_shape.push_back(in.shape(a));
+            in_stride.push_back(in.stride(a));
+            out_stride.push_back(out.stride(a));
+        }
+    }
+    detail::LoopDomain const domain(outer_shape);
+    detail::MappedOffsetCursor::mapping_type const mappings{
+        detail::OperandMapping(in_stride),
+        detail::OperandMapping(out_stride),
+    };
+    for (detail::MappedOffsetCursor cursor(domain, mappings); cursor; cursor.advance())
+    {
+        rfft_line(
+            in.logical_data() + cursor.offset(Operand::in),
+            in.stride(last),
+            out.logical_data() + cursor.offset(Operand::out),
+            out.stride(last));
+    }
+    // Complex transforms along the other axes.
+    for (size_t i = rank() - 1; i > 0; --i)
+    {
+        transform_axis(out.logical_data(), out.shape(), out.stride(), first + i - 1, /* inverse */ false, T(1));
+    }
+}
+
+template <typename T>
+void FourierPlan<T>::irfft(complex_array_type const & in, real_array_type & out, ssize_t axis)
+{
+    size_t const first = first_axis(out.ndim(), axis, "irfft");
+    size_t const last = first + rank() - 1;
+    validate_shape(out.shape(), first, /* half */ false, "irfft");
+    validate_shape(in.shape(), first, /* half */ true, "irfft");
+    validate_same_batch(in.shape(), out.shape(), last, "irfft");
+
+    // The other axes are inverted first, on a copy kept by the plan so that
+    // the input is not modified.
+    complex_type const * src = in.logical_data();
+    shape_type src_stride = in.stride();
+    if (rank() > 1)
+    {
+        if (m_work.shape() != in.shape())
+        {
+            m_work = complex_array_type(in.shape());
+        }
+        copy_array(in, m_work);
+        for (size_t i = rank() - 1; i > 0; --i)
+        {
+            transform_axis(m_work.logical_data(), m_work.shape(), m_work.stride(), first + i - 1, /* inverse */ true, T(1));
+        }
+        src = m_work.logical_data();
+        src_stride = m_work.stride();
+    }
+
+    T const scale = T(1) / static_cast<T>(size());
+    shape_type outer_shape;
+    shape_type in_stride;
+    shape_type out_stride;
+    for (size_t a = 0; a < out.shape().size(); ++a)
+    {
+        if (a != last)
+        {
+            outer_shape.push_back(out.shape(a));
+            in_stride.push_back(src_stride[a]);
+            out_stride.push_back(out.stride(a));
+        }
+    }
+    detail::LoopDomain const domain(outer_shape);
+    detail::MappedOffsetCursor::mapping_type const mappings{
+        detail::OperandMapping(in_stride),
+        detail::OperandMapping(out_stride),
+    };
+    for (detail::MappedOffsetCursor cursor(domain, mappings); cursor; cursor.advance())
+    {
+        irfft_line(
+            src + cursor.offset(Operand::in),
+            src_stride[last],
+            out.logical_data() + cursor.offset(Operand::out),
+            out.stride(last),
+            scale);
+    }
+}
+
+/**
+ * Bounded LRU cache of FourierPlan objects shared by the threads of a process.
+ *
+ * @ingroup group_numerics
+ *
+ * acquire() hands out a plan of a shape for the exclusive use of the caller.
+ * An idle plan of the shape is reused when the cache holds one, so that the
+ * tables and the scratch buffers are made only once; otherwise a new plan is
+ * constructed outside the lock.  Releasing the returned pointer puts the plan
+ * back as the most recently used, and destroys the least recently used idle
+ * plans beyond the capacity.  Threads transforming the same shape at once get
+ * distinct plans.  FourierTransform::fft() and ifft() use instance().
+ */
+template <typename T>
+class FourierPlanCache
+{
+
+public:
+
+    using plan_type = FourierPlan<T>;
+    using shape_type = typename plan_type::shape_type;
+
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+
+    explicit FourierPlanCache(size_t capacity = DEFAULT_CAPACITY)
+        : m_state(std::make_shared<State>(capacity))
+    {
+    }
+
+    FourierPlanCache(FourierPlanCache const &) = delete;
+    FourierPlanCache(FourierPlanCache &&) = delete;
+    FourierPlanCache & operator=(FourierPlanCache const &) = delete;
+    FourierPlanCache & operator=(FourierPlanCache &&) = delete;
+    ~FourierPlanCache() = default;
+
+    /// The cache of the process.
+    static FourierPlanCache<T> & instance();
+
+    std::shared_ptr<plan_type> acquire(shape_type const & shape);
+
+    size_t capacity() const;
+    void set_capacity(size_t capacity);
+    /// Number of idle plans in the cache.
+    size_t size() const;
+    /// Number of acquire() calls served by an idle plan.
+    size_t nhit() const;
+    /// Number of acquire() calls that constructed a plan.
+    size_t nmiss() const;
+    /// Destroy the idle plans.
+    void clear();
+
+private:
+
+    using list_type = std::list<std::shared_ptr<plan_type>>;
+
+    // The released plans hold the state, so that a plan may outlive the cache.
+    struct State
+    {
+        explicit State(size_t capacity_in)
+            : capacity(capacity_in)
+        {
+        }
+
+        /// Move the idle plans beyond the capacity to evicted.
+        void trim(list_type & evicted)
+        {
+            while (idle.size() > capacity)
+            {
+                evicted.splice(evicted.end(), idle, std::prev(idle.end()));
+            }
+        }
+
+        std::mutex mutex;
+        size_t capacity;
+        size_t nhit = 0;
+        size_t nmiss = 0;
+        list_type idle; // The most recently used first.
+    }; /* end struct State */
+
+    std::shared_ptr<State> m_state;
+
+}; /* end class FourierPlanCache */
+
+template <typename T>
+FourierPlanCache<T> & FourierPlanCache<T>::instance()
+{
+    static FourierPlanCache<T> cache;
+    return cache;
+}
+
+template <typename T>
+std::shared_ptr<typename FourierPlanCache<T>::plan_type> FourierPlanCache<T>::acquire(shape_type const & shape)
+{
+    std::shared_ptr<plan_type> plan;
+    {
+        std::lock_guard<std::mutex> const lock(m_state->mutex);
+        auto const it = std::find_if(
+            m_state->idle.begin(),
+            m_state->idle.end(),
+            [&shape](std::shared_ptr<plan_type> const & p)
+            { return p->shape() == shape; });
+        if (it != m_state->idle.end())
+        {
+            plan = std::move(*it);
+            m_state->idle.erase(it);
+            ++m_state->nhit;
+        }
+        else
+        {
+            ++m_state->nmiss;
+        }
+    }
+    if (!plan)
+    {
+        plan = plan_type::construct(shape);
+    }
+    plan_type * const raw = plan.get();
+    return std::shared_ptr<plan_type>(
+        raw,
+        [state = m_state, plan = std::move(plan)](plan_type *) mutable
+        {
+            list_type evicted;
+            try
+            {
+                std::lock_guard<std::mutex> const lock(state->mutex);
+                state->idle.push_front(std::move(plan));
+                state->trim(evicted);
+            }
+            catch (...)
+            {
+                // Failing to cache the plan only drops it.
+            }
+        });
+}
+
+template <typename T>
+size_t FourierPlanCache<T>::capacity() const
+{
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    return m_state->capacity;
+}
+
+template <typename T>
+void FourierPlanCache<T>::set_capacity(size_t capacity)
+{
+    list_type evicted;
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    m_state->capacity = capacity;
+    m_state->trim(evicted);
+}
+
+template <typename T>
+size_t FourierPlanCache<T>::size() const
+{
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    return m_state->idle.size();
+}
+
+template <typename T>
+size_t FourierPlanCache<T>::nhit() const
+{
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    return m_state->nhit;
+}
+
+template <typename T>
+size_t FourierPlanCache<T>::nmiss() const
+{
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    return m_state->nmiss;
+}
+
+template <typename T>
+void FourierPlanCache<T>::clear()
+{
+    list_type evicted;
+    std::lock_guard<std::mutex> const lock(m_state->mutex);
+    evicted.swap(m_state->idle);
+}
+
+} /* end namespace solvcon */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -29,6 +29,45 @@ size_t next_power_of_two(size_t n)
     return power;
 }
 
+std::vector<size_t> smooth_radices(size_t n)
+{
+    std::vector<size_t> radices;
+    if (n == 0)
+    {
+        return radices;
+    }
+    // Radix 4 takes the most work per pass; a lone factor 2 is left for
+    // radix 2.
+    while (n % 4 == 0)
+    {
+        radices.push_back(4);
+        n /= 4;
+    }
+    for (size_t const radix : {size_t(2), size_t(3), size_t(5), size_t(7)})
+    {
+        while (n % radix == 0)
+        {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    if (n != 1)
+    {
+        radices.clear();
+    }
+    return radices;
+}
+
+size_t next_smooth_length(size_t n)
+{
+    size_t length = std::max(n, size_t(1));
+    while (length > 1 && smooth_radices(length).empty())
+    {
+        ++length;
+    }
+    return length;
+}
+
 } /* end namespace detail */
 
 } /* end namespace solvcon */
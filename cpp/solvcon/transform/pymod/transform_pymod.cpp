@@ -25,6 +25,7 @@ void initialize_transform(pybind11::module & mod)
     auto initialize_impl = [](pybind11::module & mod)
     {
         wrap_FourierTransform(mod);
+        wrap_FourierPlan(mod);
     };
 
     OneTimeInitializer<transform_pymod_tag>::me()(mod, initialize_impl);
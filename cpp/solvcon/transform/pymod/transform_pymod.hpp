@@ -19,6 +19,7 @@ namespace python
 
 void initialize_transform(pybind11::module & mod);
 void wrap_FourierTransform(pybind11::module & mod);
+void wrap_FourierPlan(pybind11::module & mod);
 
 } /* end namespace python */
 
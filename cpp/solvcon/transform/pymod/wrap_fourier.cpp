@@ -40,11 +40,66 @@ class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapFourierTransform
 
 }; /* end class WrapFourierTransform */
 
+template <typename T>
+class SOLVCON_PYTHON_WRAPPER_VISIBILITY WrapFourierPlan
+    : public WrapBase<WrapFourierPlan<T>, solvcon::FourierPlan<T>, std::shared_ptr<solvcon::FourierPlan<T>>>
+{
+    using root_base_type = WrapBase<WrapFourierPlan<T>, solvcon::FourierPlan<T>, std::shared_ptr<solvcon::FourierPlan<T>>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+    using shape_type = typename wrapped_type::shape_type;
+
+    friend root_base_type;
+
+    WrapFourierPlan(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_timed(
+                py::init(
+                    [](ssize_t length)
+                    { return wrapped_type::construct(shape_type{length}); }),
+                py::arg("shape"))
+            .def_timed(
+                py::init(
+                    [](std::vector<ssize_t> const & shape)
+                    { return wrapped_type::construct(shape_type(shape)); }),
+                py::arg("shape"))
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.rank());
+                    for (size_t i = 0; i < self.rank(); ++i)
+                    {
+                        ret[i] = self.shape()[i];
+                    }
+                    return ret;
+                })
+            .def_property_readonly("rank", &wrapped_type::rank)
+            .def_property_readonly("size", &wrapped_type::size)
+            .def_timed("fft", &wrapped_type::fft, py::arg("input"), py::arg("output"), py::arg("axis") = -1)
+            .def_timed("ifft", &wrapped_type::ifft, py::arg("input"), py::arg("output"), py::arg("axis") = -1)
+            .def_timed("rfft", &wrapped_type::rfft, py::arg("input"), py::arg("output"), py::arg("axis") = -1)
+            .def_timed("irfft", &wrapped_type::irfft, py::arg("input"), py::arg("output"), py::arg("axis") = -1)
+            //
+            ;
+    }
+
+}; /* end class WrapFourierPlan */
+
 void wrap_FourierTransform(pybind11::module & mod)
 {
     WrapFourierTransform::commit(mod, "FourierTransform", "Fourier transform library");
 }
 
+void wrap_FourierPlan(pybind11::module & mod)
+{
+    WrapFourierPlan<float>::commit(mod, "FourierPlanFloat32", "Planned Fourier transforms of float32");
+    WrapFourierPlan<double>::commit(mod, "FourierPlanFloat64", "Planned Fourier transforms of float64");
+}
+
 } /* end namespace python */
 
 } /* end namespace solvcon */
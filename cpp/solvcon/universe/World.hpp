@@ -25,7 +25,9 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace solvcon
@@ -267,6 +269,32 @@ struct RTreeValueOps<ShapeEntry<T>, BoundBox3d<T>>
     static BoundBox3d<T> calc_bound_box(ShapeEntry<T> const & entry) { return entry.bbox; }
 }; /* end struct RTreeValueOps */
 
+/**
+ * Entry of the diagnostics broad phase: the pad index of one segment or curve
+ * and its bounding box. The box is in double, the precision the diagnostic
+ * predicates use.
+ *
+ * @ingroup group_geometry
+ */
+struct GeometryEntry
+{
+    size_t index;
+    BoundBox3d<double> bbox;
+    bool operator==(GeometryEntry const & other) const { return index == other.index; }
+}; /* end struct GeometryEntry */
+
+/**
+ * RTreeValueOps specialization that gives the R-tree the bounding box of a
+ * GeometryEntry.
+ *
+ * @ingroup group_geometry
+ */
+template <>
+struct RTreeValueOps<GeometryEntry, BoundBox3d<double>>
+{
+    static BoundBox3d<double> calc_bound_box(GeometryEntry const & entry) { return entry.bbox; }
+}; /* end struct RTreeValueOps */
+
 /**
  * Manage all geometry entities.
  *
@@ -313,6 +341,7 @@ public:
         , m_segments(segment_pad_type::construct(/* ndim */ 3))
         , m_curves(curve_pad_type::construct(/* ndim */ 3))
         , m_rtree(std::make_unique<rtree_type>())
+        , m_diagnostics_cache(std::make_unique<DiagnosticsCache>())
     {
     }
 
@@ -358,7 +387,12 @@ public:
         check_size(i, m_segments->size(), "segment");
         return m_segments->get(i);
     }
-    std::shared_ptr<segment_pad_type> const & segments() { return m_segments; }
+    /// The pad is editable, so handing it out invalidates diagnostics().
+    std::shared_ptr<segment_pad_type> const & segments()
+    {
+        m_pads_exposed = true;
+        return m_segments;
+    }
 
     void add_bezier(bezier_type const & bezier)
     {
@@ -377,7 +411,12 @@ public:
         check_size(i, m_curves->size(), "bezier");
         return m_curves->get_at(i);
     }
-    std::shared_ptr<curve_pad_type> const & curves() { return m_curves; }
+    /// The pad is editable, so handing it out invalidates diagnostics().
+    std::shared_ptr<curve_pad_type> const & curves()
+    {
+        m_pads_exposed = true;
+        return m_curves;
+    }
 
     /**
      * Add a triangle by decomposing it into 3 segments in the pad.
@@ -559,6 +598,10 @@ public:
     /// Pick the live shape at world point (x, y).
     int32_t pick_shape(value_type x, value_type y, value_type tol) const;
 
+    /// The live shape whose outline passes nearest to world point (x, y) and
+    /// no farther than max_distance, or -1 when there is none.
+    int32_t nearest_shape(value_type x, value_type y, value_type max_distance) const;
+
     /**
      * Query the R-tree for shapes whose bounding box overlaps the viewport.
      */
@@ -587,11 +630,36 @@ public:
      */
     std::string describe_state(DescribeLevel level = DescribeLevel::BASIC) const;
 
+    /**
+     * Derived facts for the "diagnostics" level, kept up to date
+     * incrementally: only the shapes changed since the last call, and the
+     * geometry added since, are evaluated again. The result equals
+     * compute_diagnostics(). Edits made directly through the pads returned by
+     * segments() and curves() bypass the change tracking, so once a pad has
+     * been handed out the next call starts over from scratch, and so does
+     * every call while a handle to a pad is still held.
+     */
+    WorldDiagnostics const & diagnostics() const;
+
+    /**
+     * Derived facts for the "diagnostics" level, computed from scratch:
+     * proper crossings between live segments and between a live segment and
+     * a live curve, and degenerate shapes/primitives.
+     */
+    WorldDiagnostics compute_diagnostics() const;
+
 private:
 
     /// Stamp the world as changed; see state_stamp().
     void mark_changed() { ++m_state_stamp; }
 
+    /// Stamp the world as changed and queue the shape for the diagnostics.
+    void mark_shape_changed(int32_t shape_id)
+    {
+        m_diagnostics_cache->queue_shape(shape_id);
+        mark_changed();
+    }
+
     /// 2D endpoints of segment i, as [x0, y0, x1, y1].
     std::vector<double> segment_coords(size_t i) const
     {
@@ -626,12 +694,6 @@ private:
     /// Distance from point (px, py) to the segment (ax, ay)-(bx, by).
     static T point_segment_distance(T px, T py, T ax, T ay, T bx, T by);
 
-    /**
-     * Derived facts for the "diagnostics" level: proper crossings between
-     * live segments and degenerate shapes/primitives.
-     */
-    WorldDiagnostics compute_diagnostics() const;
-
     /**
      * Owner id of each segment and curve: a live shape id, -1 for bare
      * geometry, or the dead sentinel for geometry whose shape was removed.
@@ -640,9 +702,90 @@ private:
 
     /**
      * Append every proper crossing between two live segments, in ascending
-     * index order so the output is deterministic.
+     * index order so the output is deterministic, and then every crossing of
+     * a live segment and a live curve, by segment, curve, and curve parameter.
+     * An R-tree over the segment boxes selects the candidate pairs.
+     */
+    void append_intersections(
+        WorldDiagnostics & diag, small_vector<int32_t> const & seg_owner, small_vector<int32_t> const & curve_owner) const;
+
+    /**
+     * Bounding box of segment i in double, grown by the diagnostic tolerance
+     * so that the broad phase keeps every pair the predicates could accept.
+     */
+    BoundBox3d<double> segment_diag_bbox(size_t i) const;
+
+    /// Bounding box of the control points of curve i, grown like segment_diag_bbox.
+    BoundBox3d<double> curve_diag_bbox(size_t i) const;
+
+    /**
+     * Per-primitive results behind diagnostics(). Crossings are keyed by the
+     * pad indices of the pair, so the ordered maps give the order of
+     * compute_diagnostics() without sorting, and the partner lists find the
+     * crossings to drop when one side changes.
+     */
+    struct DiagnosticsCache
+    {
+        using tree_type = RTree<GeometryEntry, BoundBox3d<double>>;
+        using index_pair_type = std::pair<size_t, size_t>;
+        using crossing_type = small_vector<double, 2>;
+
+        void queue_shape(int32_t shape_id)
+        {
+            auto const sid = static_cast<size_t>(shape_id);
+            if (sid >= queued.size())
+            {
+                queued.resize(sid + 1, false);
+            }
+            if (!queued[sid])
+            {
+                queued[sid] = true;
+                dirty_shapes.push_back(shape_id);
+            }
+        }
+
+        std::vector<int32_t> dirty_shapes; ///< Shapes changed since the last sync.
+        std::vector<bool> queued; ///< Whether a shape is in dirty_shapes.
+        size_t nsegment = 0; ///< Segments seen by the last sync.
+        size_t ncurve = 0; ///< Curves seen by the last sync.
+        uint64_t stamp = 0; ///< World state stamp of result.
+        std::optional<WorldDiagnostics> result; ///< Assembled at stamp.
+
+        small_vector<int32_t> seg_owner; ///< As from compute_geometry_owners().
+        small_vector<int32_t> curve_owner;
+        std::vector<GeometryEntry> seg_entries; ///< Entry of each segment as last put in seg_tree.
+        std::vector<GeometryEntry> curve_entries;
+        std::vector<bool> seg_indexed; ///< Whether a segment is in seg_tree.
+        std::vector<bool> curve_indexed;
+        tree_type seg_tree; ///< Live segments.
+        tree_type curve_tree; ///< Live curves.
+
+        std::map<index_pair_type, crossing_type> seg_seg; ///< Keyed by (i, j), i < j.
+        std::map<index_pair_type, std::vector<crossing_type>> seg_curve; ///< Keyed by (segment, curve).
+        std::vector<std::vector<size_t>> seg_seg_partners; ///< Segments each segment crosses.
+        std::vector<std::vector<size_t>> seg_curve_partners; ///< Curves each segment crosses.
+        std::vector<std::vector<size_t>> curve_seg_partners; ///< Segments each curve crosses.
+
+        std::map<int32_t, WorldDegeneracy> shape_degeneracies; ///< Of live shapes.
+        std::vector<WorldDegeneracy> bare_segment_degeneracies; ///< In segment order.
+        std::vector<WorldDegeneracy> bare_curve_degeneracies; ///< In curve order.
+    }; /* end struct DiagnosticsCache */
+
+    /**
+     * Bring m_diagnostics_cache up to date: take the geometry appended since
+     * the last sync and the queued shapes, drop their old crossings and index
+     * entries, and test them again against the live geometry.
      */
-    void append_intersections(WorldDiagnostics & diag, small_vector<int32_t> const & seg_owner) const;
+    void sync_diagnostics() const;
+
+    /// Start m_diagnostics_cache over, with every shape queued.
+    void reset_diagnostics() const;
+
+    /// Drop the crossings and the index entry of segment i from the cache.
+    void unlink_segment_diagnostics(size_t i) const;
+
+    /// Drop the crossings and the index entry of curve i from the cache.
+    void unlink_curve_diagnostics(size_t i) const;
 
     /// Append the degeneracy (if any) of one live shape, dispatched by type.
     void append_shape_degeneracy(WorldDiagnostics & diag, int32_t sid, ShapeRecord const & rec) const;
@@ -711,6 +854,8 @@ private:
     size_t m_nshape = 0; ///< Count of live (non-DEAD) shapes.
     uint64_t m_state_stamp = 0; ///< Moves on every change; see state_stamp().
     std::unique_ptr<rtree_type> m_rtree; ///< Spatial index for shapes for viewport query.
+    mutable std::unique_ptr<DiagnosticsCache> m_diagnostics_cache; ///< Backs diagnostics().
+    mutable bool m_pads_exposed = false; ///< segments() or curves() handed out since the last reset.
 
     /// The kind of an undoable shape change.
     enum class ShapeOp : uint8_t
@@ -788,7 +933,7 @@ int32_t World<T>::register_shape(ShapeType type,
     // Record the creation so undo removes the shape and redo brings it back
     // with the same type.
     record_op({.op = ShapeOp::CREATE, .shape_id = shape_id, .type = type});
-    mark_changed();
+    mark_shape_changed(shape_id);
 
     return shape_id;
 }
@@ -971,7 +1116,7 @@ void World<T>::apply_translate(int32_t shape_id, value_type dx, value_type dy)
     }
     // Reinsert with updated bounding box.
     m_rtree->insert(ShapeEntry<T>{shape_id, compute_shape_bbox(rec)});
-    mark_changed();
+    mark_shape_changed(shape_id);
 }
 
 template <typename T>
@@ -1037,7 +1182,7 @@ void World<T>::apply_rotate(int32_t shape_id, value_type angle, value_type cx, v
     }
     // Reinsert with updated bounding box.
     m_rtree->insert(ShapeEntry<T>{shape_id, compute_shape_bbox(rec)});
-    mark_changed();
+    mark_shape_changed(shape_id);
 }
 
 template <typename T>
@@ -1134,6 +1279,22 @@ int32_t World<T>::pick_shape(value_type x, value_type y, value_type tol) const
     return best;
 }
 
+template <typename T>
+int32_t World<T>::nearest_shape(value_type x, value_type y, value_type max_distance) const
+{
+    // The outline lies inside the shape box, so the box distance bounds the
+    // outline distance from below, which is what lets nearest() prune by box.
+    std::vector<ShapeEntry<T>> hits;
+    m_rtree->nearest(
+        bbox_type(x, y, T(0), x, y, T(0)),
+        1,
+        hits,
+        max_distance,
+        [&](ShapeEntry<T> const & entry)
+        { return shape_point_distance(m_shape_registry[static_cast<size_t>(entry.shape_id)], x, y); });
+    return hits.empty() ? -1 : hits.front().shape_id;
+}
+
 template <typename T>
 void World<T>::kill_shape(int32_t shape_id)
 {
@@ -1141,7 +1302,7 @@ void World<T>::kill_shape(int32_t shape_id)
     m_rtree->remove(ShapeEntry<T>{shape_id, compute_shape_bbox(rec)});
     rec.type = ShapeType::DEAD;
     --m_nshape;
-    mark_changed();
+    mark_shape_changed(shape_id);
 }
 
 template <typename T>
@@ -1153,7 +1314,7 @@ void World<T>::revive_shape(int32_t shape_id, ShapeType type)
     rec.type = type;
     ++m_nshape;
     m_rtree->insert(ShapeEntry<T>{shape_id, compute_shape_bbox(rec)});
-    mark_changed();
+    mark_shape_changed(shape_id);
 }
 
 template <typename T>
@@ -1381,6 +1542,8 @@ void World<T>::clear()
     m_shape_registry.clear();
     m_nshape = 0;
     m_rtree = std::make_unique<rtree_type>();
+    m_diagnostics_cache = std::make_unique<DiagnosticsCache>();
+    m_pads_exposed = false;
     m_undo_stack.clear();
     m_redo_stack.clear();
     m_in_operation = false;
@@ -1494,7 +1657,7 @@ std::string World<T>::describe_state(DescribeLevel level) const
 
     if (level == DescribeLevel::DIAGNOSTICS)
     {
-        state.diagnostics() = compute_diagnostics();
+        state.diagnostics() = diagnostics();
     }
     return state.to_json();
 }
@@ -1507,7 +1670,7 @@ WorldDiagnostics World<T>::compute_diagnostics() const
     compute_geometry_owners(seg_owner, curve_owner);
 
     WorldDiagnostics diag;
-    append_intersections(diag, seg_owner);
+    append_intersections(diag, seg_owner, curve_owner);
 
     for (size_t sid = 0; sid < m_shape_registry.size(); ++sid)
     {
@@ -1521,6 +1684,306 @@ WorldDiagnostics World<T>::compute_diagnostics() const
     return diag;
 }
 
+template <typename T>
+WorldDiagnostics const & World<T>::diagnostics() const
+{
+    // A handle still held elsewhere may edit the pad again after this call.
+    bool const pads_shared = m_segments.use_count() > 1 || m_curves.use_count() > 1;
+    if (m_pads_exposed || pads_shared)
+    {
+        reset_diagnostics();
+        m_pads_exposed = pads_shared;
+    }
+    DiagnosticsCache & cache = *m_diagnostics_cache;
+    if (cache.result && cache.stamp == m_state_stamp)
+    {
+        return *cache.result;
+    }
+    sync_diagnostics();
+
+    WorldDiagnostics diag;
+    for (auto const & [key, point] : cache.seg_seg)
+    {
+        diag.add_intersection(cache.seg_owner[key.first], cache.seg_owner[key.second], point[0], point[1]);
+    }
+    for (auto const & [key, points] : cache.seg_curve)
+    {
+        for (auto const & point : points)
+        {
+            diag.add_intersection(cache.seg_owner[key.first], cache.curve_owner[key.second], point[0], point[1]);
+        }
+    }
+    for (auto const & [sid, degeneracy] : cache.shape_degeneracies)
+    {
+        diag.add_degeneracy(degeneracy);
+    }
+    for (auto const & degeneracy : cache.bare_segment_degeneracies)
+    {
+        diag.add_degeneracy(degeneracy);
+    }
+    for (auto const & degeneracy : cache.bare_curve_degeneracies)
+    {
+        diag.add_degeneracy(degeneracy);
+    }
+    cache.result = std::move(diag);
+    cache.stamp = m_state_stamp;
+    return *cache.result;
+}
+
+template <typename T>
+void World<T>::reset_diagnostics() const
+{
+    m_diagnostics_cache = std::make_unique<DiagnosticsCache>();
+    for (size_t sid = 0; sid < m_shape_registry.size(); ++sid)
+    {
+        m_diagnostics_cache->queue_shape(static_cast<int32_t>(sid));
+    }
+}
+
+template <typename T>
+void World<T>::sync_diagnostics() const
+{
+    constexpr int32_t dead_owner = std::numeric_limits<int32_t>::min();
+    DiagnosticsCache & cache = *m_diagnostics_cache;
+    size_t const nsegment = m_segments->size();
+    size_t const ncurve = m_curves->size();
+
+    // Geometry appended since the last sync starts out bare; the shapes that
+    // own it are queued and claim it below.
+    std::vector<size_t> segs;
+    std::vector<size_t> curves;
+    for (size_t i = cache.nsegment; i < nsegment; ++i)
+    {
+        cache.seg_owner.push_back(-1);
+        cache.seg_entries.push_back(GeometryEntry{i, segment_diag_bbox(i)});
+        cache.seg_indexed.push_back(false);
+        cache.seg_seg_partners.emplace_back();
+        cache.seg_curve_partners.emplace_back();
+        segs.push_back(i);
+    }
+    for (size_t i = cache.ncurve; i < ncurve; ++i)
+    {
+        cache.curve_owner.push_back(-1);
+        cache.curve_entries.push_back(GeometryEntry{i, curve_diag_bbox(i)});
+        cache.curve_indexed.push_back(false);
+        cache.curve_seg_partners.emplace_back();
+        curves.push_back(i);
+    }
+
+    for (int32_t const sid : cache.dirty_shapes)
+    {
+        cache.queued[static_cast<size_t>(sid)] = false;
+        ShapeRecord const & rec = m_shape_registry[static_cast<size_t>(sid)];
+        int32_t const owner = (rec.type == ShapeType::DEAD) ? dead_owner : sid;
+        for (size_t i = rec.segment_offset; i < rec.segment_offset + rec.segment_count; ++i)
+        {
+            cache.seg_owner[i] = owner;
+            segs.push_back(i);
+        }
+        for (size_t i = rec.curve_offset; i < rec.curve_offset + rec.curve_count; ++i)
+        {
+            cache.curve_owner[i] = owner;
+            curves.push_back(i);
+        }
+        cache.shape_degeneracies.erase(sid);
+        if (rec.type != ShapeType::DEAD)
+        {
+            WorldDiagnostics found;
+            append_shape_degeneracy(found, sid, rec);
+            if (!found.degeneracies().empty())
+            {
+                cache.shape_degeneracies.emplace(sid, found.degeneracies().front());
+            }
+        }
+    }
+    cache.dirty_shapes.clear();
+    std::ranges::sort(segs);
+    segs.erase(std::unique(segs.begin(), segs.end()), segs.end());
+    std::ranges::sort(curves);
+    curves.erase(std::unique(curves.begin(), curves.end()), curves.end());
+
+    // Bare geometry never changes after it is added, so its degeneracies are
+    // found once.
+    for (size_t i = cache.nsegment; i < nsegment; ++i)
+    {
+        if (cache.seg_owner[i] == -1 && detail::is_zero_length(m_segments->x0(i), m_segments->y0(i), m_segments->x1(i), m_segments->y1(i)))
+        {
+            cache.bare_segment_degeneracies.emplace_back(-1, "segment", "zero-length");
+        }
+    }
+    for (size_t i = cache.ncurve; i < ncurve; ++i)
+    {
+        if (cache.curve_owner[i] == -1 && detail::is_coincident_controls(m_curves->x0(i), m_curves->y0(i), m_curves->x1(i), m_curves->y1(i), m_curves->x2(i), m_curves->y2(i), m_curves->x3(i), m_curves->y3(i)))
+        {
+            cache.bare_curve_degeneracies.emplace_back(-1, "bezier", "coincident-controls");
+        }
+    }
+    cache.nsegment = nsegment;
+    cache.ncurve = ncurve;
+
+    // Take the changed geometry out, then put the live part back at its
+    // current place.
+    for (size_t const i : segs)
+    {
+        unlink_segment_diagnostics(i);
+    }
+    for (size_t const i : curves)
+    {
+        unlink_curve_diagnostics(i);
+    }
+    // An empty tree, as on the first sync, is bulk-loaded instead.
+    auto reindex = [](std::vector<size_t> const & indices,
+                      small_vector<int32_t> const & owner,
+                      std::vector<GeometryEntry> & entries,
+                      std::vector<bool> & indexed,
+                      typename DiagnosticsCache::tree_type & tree,
+                      auto const & bbox_of)
+    {
+        std::vector<GeometryEntry> added;
+        for (size_t const i : indices)
+        {
+            if (owner[i] != dead_owner)
+            {
+                entries[i] = GeometryEntry{i, bbox_of(i)};
+                added.push_back(entries[i]);
+                indexed[i] = true;
+            }
+        }
+        if (tree.empty())
+        {
+            tree.bulk_load(added);
+        }
+        else
+        {
+            for (GeometryEntry const & entry : added)
+            {
+                tree.insert(entry);
+            }
+        }
+    };
+    reindex(segs, cache.seg_owner, cache.seg_entries, cache.seg_indexed, cache.seg_tree, [this](size_t i)
+            { return segment_diag_bbox(i); });
+    reindex(curves, cache.curve_owner, cache.curve_entries, cache.curve_indexed, cache.curve_tree, [this](size_t i)
+            { return curve_diag_bbox(i); });
+
+    // Test the changed geometry against everything live.  A pair of two
+    // changed segments is tested once, from its lower index; a changed
+    // segment has already met every changed curve.
+    auto const changed = [](std::vector<size_t> const & sorted, size_t i)
+    { return std::ranges::binary_search(sorted, i); };
+    std::vector<GeometryEntry> hits;
+    for (size_t const i : segs)
+    {
+        if (!cache.seg_indexed[i])
+        {
+            continue;
+        }
+        double const x0 = m_segments->x0(i);
+        double const y0 = m_segments->y0(i);
+        double const x1 = m_segments->x1(i);
+        double const y1 = m_segments->y1(i);
+        cache.seg_tree.search(cache.seg_entries[i].bbox, hits);
+        for (GeometryEntry const & hit : hits)
+        {
+            size_t const j = hit.index;
+            if (j == i || (j < i && changed(segs, j)))
+            {
+                continue;
+            }
+            auto const crossing = detail::segment_proper_intersection(
+                x0, y0, x1, y1, m_segments->x0(j), m_segments->y0(j), m_segments->x1(j), m_segments->y1(j));
+            if (crossing)
+            {
+                cache.seg_seg.emplace(std::minmax(i, j), *crossing);
+                cache.seg_seg_partners[i].push_back(j);
+                cache.seg_seg_partners[j].push_back(i);
+            }
+        }
+        hits.clear();
+        cache.curve_tree.search(cache.seg_entries[i].bbox, hits);
+        for (GeometryEntry const & hit : hits)
+        {
+            size_t const ic = hit.index;
+            std::array<double, 4> const cx = {m_curves->x0(ic), m_curves->x1(ic), m_curves->x2(ic), m_curves->x3(ic)};
+            std::array<double, 4> const cy = {m_curves->y0(ic), m_curves->y1(ic), m_curves->y2(ic), m_curves->y3(ic)};
+            auto crossings = detail::segment_bezier_crossings(x0, y0, x1, y1, cx, cy);
+            if (!crossings.empty())
+            {
+                cache.seg_curve.emplace(std::make_pair(i, ic), std::move(crossings));
+                cache.seg_curve_partners[i].push_back(ic);
+                cache.curve_seg_partners[ic].push_back(i);
+            }
+        }
+    }
+    for (size_t const ic : curves)
+    {
+        if (!cache.curve_indexed[ic])
+        {
+            continue;
+        }
+        std::array<double, 4> const cx = {m_curves->x0(ic), m_curves->x1(ic), m_curves->x2(ic), m_curves->x3(ic)};
+        std::array<double, 4> const cy = {m_curves->y0(ic), m_curves->y1(ic), m_curves->y2(ic), m_curves->y3(ic)};
+        hits.clear();
+        cache.seg_tree.search(cache.curve_entries[ic].bbox, hits);
+        for (GeometryEntry const & hit : hits)
+        {
+            size_t const i = hit.index;
+            if (changed(segs, i))
+            {
+                continue;
+            }
+            auto crossings = detail::segment_bezier_crossings(
+                m_segments->x0(i), m_segments->y0(i), m_segments->x1(i), m_segments->y1(i), cx, cy);
+            if (!crossings.empty())
+            {
+                cache.seg_curve.emplace(std::make_pair(i, ic), std::move(crossings));
+                cache.seg_curve_partners[i].push_back(ic);
+                cache.curve_seg_partners[ic].push_back(i);
+            }
+        }
+    }
+}
+
+template <typename T>
+void World<T>::unlink_segment_diagnostics(size_t i) const
+{
+    DiagnosticsCache & cache = *m_diagnostics_cache;
+    for (size_t const j : cache.seg_seg_partners[i])
+    {
+        cache.seg_seg.erase(std::minmax(i, j));
+        std::erase(cache.seg_seg_partners[j], i);
+    }
+    cache.seg_seg_partners[i].clear();
+    for (size_t const ic : cache.seg_curve_partners[i])
+    {
+        cache.seg_curve.erase(std::make_pair(i, ic));
+        std::erase(cache.curve_seg_partners[ic], i);
+    }
+    cache.seg_curve_partners[i].clear();
+    if (cache.seg_indexed[i])
+    {
+        cache.seg_tree.remove(cache.seg_entries[i]);
+        cache.seg_indexed[i] = false;
+    }
+}
+
+template <typename T>
+void World<T>::unlink_curve_diagnostics(size_t i) const
+{
+    DiagnosticsCache & cache = *m_diagnostics_cache;
+    for (size_t const is : cache.curve_seg_partners[i])
+    {
+        cache.seg_curve.erase(std::make_pair(is, i));
+        std::erase(cache.seg_curve_partners[is], i);
+    }
+    cache.curve_seg_partners[i].clear();
+    if (cache.curve_indexed[i])
+    {
+        cache.curve_tree.remove(cache.curve_entries[i]);
+        cache.curve_indexed[i] = false;
+    }
+}
+
 template <typename T>
 void World<T>::compute_geometry_owners(small_vector<int32_t> & seg_owner, small_vector<int32_t> & curve_owner) const
 {
@@ -1543,21 +2006,40 @@ void World<T>::compute_geometry_owners(small_vector<int32_t> & seg_owner, small_
 }
 
 template <typename T>
-void World<T>::append_intersections(WorldDiagnostics & diag, small_vector<int32_t> const & seg_owner) const
+void World<T>::append_intersections(
+    WorldDiagnostics & diag, small_vector<int32_t> const & seg_owner, small_vector<int32_t> const & curve_owner) const
 {
     constexpr int32_t dead_owner = std::numeric_limits<int32_t>::min();
+    std::vector<GeometryEntry> entries;
+    for (size_t i = 0; i < m_segments->size(); ++i)
+    {
+        if (seg_owner[i] != dead_owner)
+        {
+            entries.push_back(GeometryEntry{i, segment_diag_bbox(i)});
+        }
+    }
+    FlatRTree<GeometryEntry, BoundBox3d<double>> const tree(entries);
+
+    std::vector<GeometryEntry> hits;
+    std::vector<size_t> candidates;
     for (size_t i = 0; i < m_segments->size(); ++i)
     {
         if (seg_owner[i] == dead_owner)
         {
             continue;
         }
-        for (size_t j = i + 1; j < m_segments->size(); ++j)
+        tree.search(segment_diag_bbox(i), hits);
+        candidates.clear();
+        for (GeometryEntry const & hit : hits)
         {
-            if (seg_owner[j] == dead_owner)
+            if (hit.index > i)
             {
-                continue;
+                candidates.push_back(hit.index);
             }
+        }
+        std::ranges::sort(candidates);
+        for (size_t const j : candidates)
+        {
             auto const hit = detail::segment_proper_intersection(
                 m_segments->x0(i), m_segments->y0(i), m_segments->x1(i), m_segments->y1(i), m_segments->x0(j), m_segments->y0(j), m_segments->x1(j), m_segments->y1(j));
             if (hit)
@@ -1566,6 +2048,63 @@ void World<T>::append_intersections(WorldDiagnostics & diag, small_vector<int32_
             }
         }
     }
+
+    // Segment-curve pairs, collected per curve and then put in segment order.
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t ic = 0; ic < m_curves->size(); ++ic)
+    {
+        if (curve_owner[ic] == dead_owner)
+        {
+            continue;
+        }
+        hits.clear();
+        tree.search(curve_diag_bbox(ic), hits);
+        for (GeometryEntry const & hit : hits)
+        {
+            pairs.emplace_back(hit.index, ic);
+        }
+    }
+    std::ranges::sort(pairs);
+    for (auto const & [is, ic] : pairs)
+    {
+        std::array<double, 4> const cx = {m_curves->x0(ic), m_curves->x1(ic), m_curves->x2(ic), m_curves->x3(ic)};
+        std::array<double, 4> const cy = {m_curves->y0(ic), m_curves->y1(ic), m_curves->y2(ic), m_curves->y3(ic)};
+        for (auto const & point : detail::segment_bezier_crossings(m_segments->x0(is), m_segments->y0(is), m_segments->x1(is), m_segments->y1(is), cx, cy))
+        {
+            diag.add_intersection(seg_owner[is], curve_owner[ic], point[0], point[1]);
+        }
+    }
+}
+
+template <typename T>
+BoundBox3d<double> World<T>::segment_diag_bbox(size_t i) const
+{
+    double const x0 = m_segments->x0(i);
+    double const y0 = m_segments->y0(i);
+    double const x1 = m_segments->x1(i);
+    double const y1 = m_segments->y1(i);
+    double const pad = detail::diag_eps * detail::diag_scale({x0, y0, x1, y1});
+    return {std::min(x0, x1) - pad, std::min(y0, y1) - pad, 0.0, std::max(x0, x1) + pad, std::max(y0, y1) + pad, 0.0};
+}
+
+template <typename T>
+BoundBox3d<double> World<T>::curve_diag_bbox(size_t i) const
+{
+    double const x0 = m_curves->x0(i);
+    double const y0 = m_curves->y0(i);
+    double const x1 = m_curves->x1(i);
+    double const y1 = m_curves->y1(i);
+    double const x2 = m_curves->x2(i);
+    double const y2 = m_curves->y2(i);
+    double const x3 = m_curves->x3(i);
+    double const y3 = m_curves->y3(i);
+    double const pad = detail::diag_eps * detail::diag_scale({x0, y0, x1, y1, x2, y2, x3, y3});
+    return {std::min({x0, x1, x2, x3}) - pad,
+            std::min({y0, y1, y2, y3}) - pad,
+            0.0,
+            std::max({x0, x1, x2, x3}) + pad,
+            std::max({y0, y1, y2, y3}) + pad,
+            0.0};
 }
 
 template <typename T>
@@ -7,12 +7,13 @@
 
 /**
  * @file
- * Derived geometric facts for the "diagnostics" level of World::describe_state.
- * These are facts a careful viewer could read off the rendered image but that
- * the basic state never spells out: proper crossings between drawn segments,
- * and shapes that have collapsed to a lower dimension. They sit in a distinct
- * level so the basic output stays a byte-for-byte subset for callers that do
- * not ask for them.
+ * Derived geometric facts for the "diagnostics" level of
+ * World::describe_state. These are facts a careful viewer could read off the
+ * rendered image but that the basic state never spells out: proper crossings
+ * between drawn segments and between a segment and a drawn curve, and shapes
+ * that have collapsed to a lower dimension. They sit in a distinct level so
+ * the basic output stays a byte-for-byte subset for callers that do not ask
+ * for them.
  *
  * @ingroup group_geometry
  */
@@ -21,6 +22,7 @@
 #include <solvcon/serialization/SerializableItem.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <initializer_list>
@@ -34,7 +36,8 @@ namespace solvcon
 {
 
 /**
- * One proper crossing between two drawn segments.
+ * One proper crossing between two drawn segments, or between a drawn segment
+ * and a cubic Bezier curve.
  *
  * @ingroup group_geometry
  */
@@ -62,7 +65,7 @@ public:
 
 private:
 
-    std::vector<int32_t> m_shapes; ///< the two owning shape ids; -1 marks a bare segment
+    std::vector<int32_t> m_shapes; ///< the two owning shape ids (segment first); -1 marks bare geometry
     std::vector<double> m_point; ///< {x, y} of the crossing
 
 }; /* end class WorldIntersection */
@@ -132,6 +135,14 @@ public:
         m_degeneracies.emplace_back(shape, std::move(type), std::move(reason));
     }
 
+    void add_degeneracy(WorldDegeneracy degeneracy)
+    {
+        m_degeneracies.push_back(std::move(degeneracy));
+    }
+
+    std::vector<WorldIntersection> const & intersections() const { return m_intersections; }
+    std::vector<WorldDegeneracy> const & degeneracies() const { return m_degeneracies; }
+
     MM_DECL_SERIALIZABLE(
         register_member("intersections", m_intersections);
         register_member("degeneracies", m_degeneracies);)
@@ -212,6 +223,108 @@ inline std::optional<small_vector<double, 2>> segment_proper_intersection(
     return small_vector<double, 2>{diag_norm_zero(ax0 + t * dax), diag_norm_zero(ay0 + t * day)};
 }
 
+/**
+ * Append to @p roots the parameters in [t0, t1] where the cubic with the
+ * Bernstein coefficients @p coef crosses zero, a zero value counting as
+ * positive.
+ * A span whose coefficients share a sign holds no root (convex hull
+ * property); any other span is halved by de Casteljau until it is narrower
+ * than diag_eps, where the root is linearly interpolated.
+ */
+inline void cubic_sign_changes(std::array<double, 4> const & coef, double t0, double t1, std::vector<double> & roots)
+{
+    bool const nonnegative = std::ranges::all_of(coef, [](double c)
+                                                 { return c >= 0.0; });
+    bool const negative = std::ranges::all_of(coef, [](double c)
+                                              { return c < 0.0; });
+    if (nonnegative || negative)
+    {
+        return;
+    }
+    if (t1 - t0 <= diag_eps)
+    {
+        if ((coef[0] < 0.0) != (coef[3] < 0.0))
+        {
+            double const t = t0 + (t1 - t0) * coef[0] / (coef[0] - coef[3]);
+            // A touch from the negative side changes sign into and out of the
+            // same zero; the two cancel, as a touch is not a crossing.
+            if (!roots.empty() && t - roots.back() <= diag_eps)
+            {
+                roots.pop_back();
+            }
+            else
+            {
+                roots.push_back(t);
+            }
+        }
+        return;
+    }
+    double const c01 = 0.5 * (coef[0] + coef[1]);
+    double const c12 = 0.5 * (coef[1] + coef[2]);
+    double const c23 = 0.5 * (coef[2] + coef[3]);
+    double const c012 = 0.5 * (c01 + c12);
+    double const c123 = 0.5 * (c12 + c23);
+    double const mid = 0.5 * (c012 + c123);
+    double const tm = 0.5 * (t0 + t1);
+    cubic_sign_changes({coef[0], c01, c012, mid}, t0, tm, roots);
+    cubic_sign_changes({mid, c123, c23, coef[3]}, tm, t1, roots);
+}
+
+/**
+ * The points strictly interior to both the segment (ax0, ay0)-(ax1, ay1) and
+ * the cubic Bezier with control points (cx[k], cy[k]) where the curve crosses
+ * the segment, in ascending curve parameter. A curve that only touches the
+ * segment's line, lies on it, or meets the segment at an endpoint of either
+ * does not cross it.
+ */
+inline std::vector<small_vector<double, 2>> segment_bezier_crossings(
+    double ax0, double ay0, double ax1, double ay1, std::array<double, 4> const & cx, std::array<double, 4> const & cy)
+{
+    std::vector<small_vector<double, 2>> crossings;
+    double const dax = ax1 - ax0;
+    double const day = ay1 - ay0;
+    double const len2 = dax * dax + day * day;
+    double const scale = diag_scale({ax0, ay0, ax1, ay1, cx[0], cy[0], cx[1], cy[1], cx[2], cy[2], cx[3], cy[3]});
+    if (std::sqrt(len2) <= diag_eps * scale)
+    {
+        return crossings;
+    }
+    // The signed distance of the curve from the segment's line, scaled by the
+    // segment length, is the cubic whose Bernstein coefficients are the
+    // distances of the control points. Snap the ones within round-off of the
+    // line so a curve lying on it has no crossings.
+    double const tol = diag_eps * std::sqrt(len2) * scale;
+    std::array<double, 4> dist{};
+    for (size_t k = 0; k < 4; ++k)
+    {
+        double const d = diag_cross(dax, day, cx[k] - ax0, cy[k] - ay0);
+        dist[k] = std::abs(d) <= tol ? 0.0 : d;
+    }
+    std::vector<double> roots;
+    cubic_sign_changes(dist, 0.0, 1.0, roots);
+    for (double const t : roots)
+    {
+        if (t <= diag_eps || t >= 1.0 - diag_eps)
+        {
+            continue;
+        }
+        double const u = 1.0 - t;
+        double const b0 = u * u * u;
+        double const b1 = 3.0 * u * u * t;
+        double const b2 = 3.0 * u * t * t;
+        double const b3 = t * t * t;
+        double const x = b0 * cx[0] + b1 * cx[1] + b2 * cx[2] + b3 * cx[3];
+        double const y = b0 * cy[0] + b1 * cy[1] + b2 * cy[2] + b3 * cy[3];
+        double const s = ((x - ax0) * dax + (y - ay0) * day) / len2;
+        if (s <= diag_eps || s >= 1.0 - diag_eps)
+        {
+            continue;
+        }
+        crossings.push_back(small_vector<double, 2>{diag_norm_zero(x), diag_norm_zero(y)});
+    }
+    return crossings;
+}
+
 /// A segment whose endpoints coincide (it renders as a point, not a line).
 inline bool is_zero_length(double x0, double y0, double x1, double y1)
 {
@@ -2780,12 +2780,17 @@ BoundBox3d<T> PolygonPad<T>::calc_bound_box(size_t polygon_id) const
 template <typename T>
 void PolygonPad<T>::rebuild_rtree()
 {
-    m_rtree = std::make_unique<rtree_type>();
+    // Bulk-load all edges at once rather than inserting them one by one.
+    std::vector<segment_type> edges;
     for (size_t i = 0; i < m_begins.size(); ++i)
     {
         polygon_type const polygon = get_polygon(i);
-        rebuild_polygon_rtree(polygon);
+        for (size_t j = 0; j < polygon.nnode(); ++j)
+        {
+            edges.push_back(polygon.edge(j));
+        }
     }
+    m_rtree = std::make_unique<rtree_type>(std::span<segment_type const>(edges));
 }
 
 template <typename T>
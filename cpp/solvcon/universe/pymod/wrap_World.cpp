@@ -151,6 +151,12 @@ WrapWorld<T> & WrapWorld<T>::wrap_management()
             py::arg("x"),
             py::arg("y"),
             py::arg("tol"))
+        .def(
+            "nearest_shape",
+            &wrapped_type::nearest_shape,
+            py::arg("x"),
+            py::arg("y"),
+            py::arg("max_distance"))
         .def(
             "query_visible",
             &wrapped_type::query_visible,
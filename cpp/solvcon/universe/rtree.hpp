@@ -7,7 +7,9 @@
 
 /**
  * @file
- * R-tree spatial index for 2D and 3D bounding boxes.
+ * R-tree spatial index for 2D and 3D bounding boxes: the dynamic RTree, which
+ * can also be bulk-loaded and answers box, nearest-neighbour, radius, and
+ * batched queries, and the read-only, array-backed FlatRTree.
  *
  * @ingroup group_geometry
  */
@@ -16,10 +18,16 @@
 // https://doi.org/10.1145/971697.602266
 
 #include <solvcon/base.hpp>
+#include <solvcon/parallel/ThreadPool.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <queue>
+#include <span>
 #include <type_traits>
 #include <vector>
 
@@ -134,6 +142,81 @@ struct RTreeValueOps
     static B calc_group_bound_box(std::vector<E> const & items);
 }; /* end struct RTreeValueOps */
 
+namespace detail
+{
+
+/// Euclidean distance between the closest points of @p a and @p b; 0 when
+/// they overlap.
+template <typename B>
+typename B::value_type box_distance(B const & a, B const & b)
+{
+    using value_type = typename B::value_type;
+    auto gap = [](value_type a_min, value_type a_max, value_type b_min, value_type b_max)
+    { return std::max({value_type(0), b_min - a_max, a_min - b_max}); };
+    value_type const dx = gap(a.min_x(), a.max_x(), b.min_x(), b.max_x());
+    value_type const dy = gap(a.min_y(), a.max_y(), b.min_y(), b.max_y());
+    value_type const dz = gap(a.min_z(), a.max_z(), b.min_z(), b.max_z());
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/// Twice the center of @p box along @p axis (0, 1, or 2).
+template <typename B>
+typename B::value_type str_center(B const & box, size_t axis)
+{
+    switch (axis)
+    {
+    case 0: return box.min_x() + box.max_x();
+    case 1: return box.min_y() + box.max_y();
+    default: return box.min_z() + box.max_z();
+    }
+}
+
+template <typename B>
+// FIXME: NOLINTNEXTLINE(misc-no-recursion)
+void str_sort(std::vector<B> const & boxes, std::vector<size_t>::iterator first, std::vector<size_t>::iterator last, size_t axis, size_t ndim, size_t node_size)
+{
+    auto const count = static_cast<size_t>(last - first);
+    if (count <= node_size)
+    {
+        return;
+    }
+    std::sort(first, last, [&](size_t a, size_t b)
+              { return str_center(boxes[a], axis) < str_center(boxes[b], axis); });
+    if (axis + 1 == ndim)
+    {
+        return;
+    }
+    // Cut the run into slabs of whole nodes, as many along this axis as the
+    // remaining axes get together.
+    size_t const nnode = (count + node_size - 1) / node_size;
+    auto const nslab = static_cast<size_t>(std::ceil(std::pow(static_cast<double>(nnode), 1.0 / static_cast<double>(ndim - axis))));
+    size_t const slab = node_size * ((nnode + nslab - 1) / nslab);
+    for (auto it = first; it < last; it += static_cast<ptrdiff_t>(std::min(slab, static_cast<size_t>(last - it))))
+    {
+        str_sort(boxes, it, it + static_cast<ptrdiff_t>(std::min(slab, static_cast<size_t>(last - it))), axis + 1, ndim, node_size);
+    }
+}
+
+/**
+ * Order @p boxes for Sort-Tile-Recursive packing (Leutenegger, Lopez, and
+ * Edgington, 1997) into nodes of @p node_size entries. The boxes are sorted
+ * by center along x into slabs, each slab along y, and, unless all boxes
+ * share one z plane, each run along z; every node_size consecutive entries
+ * of the returned order then make a compact node. O(n log n).
+ */
+template <typename B>
+std::vector<size_t> str_order(std::vector<B> const & boxes, size_t node_size)
+{
+    std::vector<size_t> order(boxes.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    bool const planar = std::ranges::all_of(boxes, [&](B const & box)
+                                            { return box.min_z() == boxes.front().min_z() && box.max_z() == boxes.front().max_z(); });
+    str_sort(boxes, order.begin(), order.end(), 0, planar ? 2 : 3, node_size);
+    return order;
+}
+
+} /* end namespace detail */
+
 /**
  * R-tree node structure.
  *
@@ -230,7 +313,13 @@ struct RTreeNode
  * R-tree spatial index based on Guttman's 1984 R-tree paper.
  *
  * Supports insert, search by bounding box, and remove. A node holds at
- * most MAX_ITEMS_PER_NODE entries and splits when it overflows.
+ * most MAX_ITEMS_PER_NODE entries and splits when it overflows. A tree can
+ * also be built at once from all its items by bulk_load(), which packs them
+ * far faster than inserting them one by one and gives a better tree.
+ *
+ * Besides search(), nearest() returns the k items closest to a query box
+ * by best-first traversal, search_radius() the items within a distance, and
+ * search_many() answers a batch of box queries, optionally on a ThreadPool.
  *
  * @tparam E Item type to be stored in the R-tree.
  * @tparam B Bounding box type associated with E.
@@ -255,6 +344,12 @@ public:
         : root(nullptr)
     {
     }
+    /// Build a packed tree of @p items; see bulk_load().
+    explicit RTree(std::span<E const> items)
+        : root(nullptr)
+    {
+        bulk_load(items);
+    }
     RTree(RTree const &) = delete;
     RTree & operator=(RTree const &) = delete;
     RTree(RTree &&) = delete;
@@ -287,6 +382,72 @@ public:
         adjust_tree(leaf, std::move(new_node));
     }
 
+    /**
+     * Replace the content with @p items, packed bottom-up by
+     * Sort-Tile-Recursive: every node but the last of a level is full and all
+     * leaves are at the same depth. The tree stays open to insert and remove.
+     */
+    void bulk_load(std::span<E const> items)
+    {
+        constexpr auto node_size = static_cast<size_t>(MAX_ITEMS_PER_NODE);
+        root = nullptr;
+        if (items.empty())
+        {
+            return;
+        }
+
+        std::vector<B> boxes;
+        boxes.reserve(items.size());
+        for (E const & item : items)
+        {
+            boxes.push_back(ValueOps::calc_bound_box(item));
+        }
+        std::vector<size_t> order = detail::str_order(boxes, node_size);
+        std::vector<node_type> level;
+        level.reserve((items.size() + node_size - 1) / node_size);
+        for (size_t begin = 0; begin < items.size(); begin += node_size)
+        {
+            size_t const end = std::min(begin + node_size, items.size());
+            auto leaf = std::make_unique<RTreeNodeType>(boxes[order[begin]]);
+            leaf->items.reserve(end - begin);
+            for (size_t k = begin; k < end; ++k)
+            {
+                leaf->items.push_back(items[order[k]]);
+                leaf->bbox.expand(boxes[order[k]]);
+            }
+            level.push_back(std::move(leaf));
+        }
+
+        while (level.size() > 1)
+        {
+            boxes.clear();
+            for (node_type const & node : level)
+            {
+                boxes.push_back(node->bbox);
+            }
+            order = detail::str_order(boxes, node_size);
+            std::vector<node_type> upper;
+            upper.reserve((level.size() + node_size - 1) / node_size);
+            for (size_t begin = 0; begin < level.size(); begin += node_size)
+            {
+                size_t const end = std::min(begin + node_size, level.size());
+                auto parent = std::make_unique<RTreeNodeType>(boxes[order[begin]]);
+                parent->nodes.reserve(end - begin);
+                for (size_t k = begin; k < end; ++k)
+                {
+                    parent->bbox.expand(boxes[order[k]]);
+                    parent->nodes.push_back(std::move(level[order[k]]));
+                }
+                upper.push_back(std::move(parent));
+            }
+            level.swap(upper);
+        }
+        root = std::move(level.front());
+    }
+
+    /// True if the tree holds no item.
+    bool empty() const { return root == nullptr || (root->items.empty() && root->nodes.empty()); }
+
     /// Search for items intersecting the given bounding box
     /// @param box the bounding box to search
     /// @param output the vector to store found items
@@ -301,6 +462,143 @@ public:
         search_internal(root, box, output);
     }
 
+    /**
+     * Find the @p k items nearest to @p query, closest first, by best-first
+     * traversal (Hjaltason and Samet, 1999). The distance of an item is that
+     * of its bounding box to @p query, and items farther than
+     * @p max_distance are left out. Ties are broken arbitrarily.
+     * @param query the query box; a point is a box of zero extent
+     * @param k the maximal number of items to return
+     * @param output the vector to store found items
+     * @param max_distance the largest distance to report
+     */
+    void nearest(B const & query, size_t k, std::vector<E> & output, value_type max_distance = std::numeric_limits<value_type>::max()) const
+    {
+        nearest(query, k, output, max_distance, [&query](E const & item)
+                { return detail::box_distance(ValueOps::calc_bound_box(item), query); });
+    }
+
+    /**
+     * Same as above but measure each item with @p distance(item), e.g., the
+     * exact distance from a point to a segment. @p distance must never be
+     * smaller than the distance from @p query to the bounding box of the
+     * item; node boxes prune the traversal on that bound.
+     */
+    template <typename F>
+    void nearest(B const & query, size_t k, std::vector<E> & output, value_type max_distance, F && distance) const
+    {
+        output.clear();
+        if (root == nullptr || k == 0)
+        {
+            return;
+        }
+
+        // A queue entry is a node when item is null and an item otherwise.
+        struct Candidate
+        {
+            value_type distance;
+            RTreeNodeType const * node;
+            E const * item;
+            bool operator>(Candidate const & other) const { return distance > other.distance; }
+        }; /* end struct Candidate */
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+        queue.push(Candidate{detail::box_distance(root->bbox, query), root.get(), nullptr});
+        while (!queue.empty() && output.size() < k)
+        {
+            Candidate const top = queue.top();
+            queue.pop();
+            if (top.distance > max_distance)
+            {
+                break;
+            }
+            if (top.item != nullptr)
+            {
+                output.push_back(*top.item);
+                continue;
+            }
+            for (auto const & child : top.node->nodes)
+            {
+                value_type const d = detail::box_distance(child->bbox, query);
+                if (d <= max_distance)
+                {
+                    queue.push(Candidate{d, child.get(), nullptr});
+                }
+            }
+            for (auto const & it : top.node->items)
+            {
+                value_type const d = distance(it);
+                if (d <= max_distance)
+                {
+                    queue.push(Candidate{d, nullptr, &it});
+                }
+            }
+        }
+    }
+
+    /// Search for items whose bounding box is within @p radius of @p query
+    /// @param query the query box; a point is a box of zero extent
+    /// @param radius the largest distance to report
+    /// @param output the vector to store found items
+    void search_radius(B const & query, value_type radius, std::vector<E> & output) const
+    {
+        output.clear();
+        if (root == nullptr)
+        {
+            return; // empty tree
+        }
+        search_radius_internal(*root, query, radius, output);
+    }
+
+    /**
+     * Search for the items intersecting each of @p boxes; outputs[i] gets
+     * the same items in the same order as search(boxes[i], outputs[i]).
+     *
+     * The queries are put in Sort-Tile-Recursive order and cut into batches
+     * of nearby boxes. A batch walks the tree once: a node is visited with
+     * the queries that overlap it, and its children are tested against
+     * them together. With a @p pool the batches run on its threads.
+     */
+    void search_many(std::span<B const> boxes, std::vector<std::vector<E>> & outputs, ThreadPool * pool = nullptr) const
+    {
+        constexpr size_t BATCH_SIZE = 256;
+        outputs.resize(boxes.size());
+        for (std::vector<E> & output : outputs)
+        {
+            output.clear();
+        }
+        if (root == nullptr || boxes.empty())
+        {
+            return;
+        }
+
+        std::vector<size_t> const order = detail::str_order(std::vector<B>(boxes.begin(), boxes.end()), BATCH_SIZE);
+        size_t const nbatch = (order.size() + BATCH_SIZE - 1) / BATCH_SIZE;
+        auto run_batches = [&](size_t first, size_t last)
+        {
+            // One list of active queries per tree level.
+            std::vector<std::vector<size_t>> active(1);
+            for (size_t ibatch = first; ibatch < last; ++ibatch)
+            {
+                auto const begin = order.begin() + static_cast<ptrdiff_t>(ibatch * BATCH_SIZE);
+                active[0].assign(begin, begin + static_cast<ptrdiff_t>(std::min(BATCH_SIZE, order.size() - ibatch * BATCH_SIZE)));
+                std::erase_if(active[0], [&](size_t q)
+                              { return !root->bbox.overlap(boxes[q]); });
+                if (!active[0].empty())
+                {
+                    search_many_internal(*root, boxes, active, 0, outputs);
+                }
+            }
+        };
+        if (pool == nullptr)
+        {
+            run_batches(0, nbatch);
+        }
+        else
+        {
+            pool->parallel_for(size_t(0), nbatch, run_batches);
+        }
+    }
+
     /// Remove item from R-tree
     void remove(E const & item)
     {
@@ -358,6 +656,62 @@ private:
         }
     }
 
+    // FIXME: NOLINTNEXTLINE(misc-no-recursion)
+    void search_radius_internal(RTreeNodeType const & node, B const & query, value_type radius, std::vector<E> & output) const
+    {
+        for (auto const & child : node.nodes)
+        {
+            if (detail::box_distance(child->bbox, query) <= radius)
+            {
+                search_radius_internal(*child, query, radius, output);
+            }
+        }
+        for (auto const & it : node.items)
+        {
+            if (detail::box_distance(ValueOps::calc_bound_box(it), query) <= radius)
+            {
+                output.push_back(it);
+            }
+        }
+    }
+
+    /// Visit @p node, which overlaps all the queries in active[depth].
+    // FIXME: NOLINTNEXTLINE(misc-no-recursion)
+    void search_many_internal(RTreeNodeType const & node, std::span<B const> boxes, std::vector<std::vector<size_t>> & active, size_t depth, std::vector<std::vector<E>> & outputs) const
+    {
+        if (active.size() <= depth + 1)
+        {
+            active.resize(depth + 2);
+        }
+        for (auto const & child : node.nodes)
+        {
+            std::vector<size_t> & child_active = active[depth + 1];
+            child_active.clear();
+            for (size_t const q : active[depth])
+            {
+                if (child->bbox.overlap(boxes[q]))
+                {
+                    child_active.push_back(q);
+                }
+            }
+            if (!child_active.empty())
+            {
+                search_many_internal(*child, boxes, active, depth + 1, outputs);
+            }
+        }
+        for (auto const & it : node.items)
+        {
+            B const item_box = ValueOps::calc_bound_box(it);
+            for (size_t const q : active[depth])
+            {
+                if (item_box.overlap(boxes[q]))
+                {
+                    outputs[q].push_back(it);
+                }
+            }
+        }
+    }
+
     // FIXME: NOLINTNEXTLINE(misc-no-recursion)
     node_type & choose_leaf_for_new_entry(node_type & node, const B & box)
     {
@@ -677,6 +1031,192 @@ private:
 
 }; /* end class RTree */
 
+/**
+ * Read-only R-tree packed by Sort-Tile-Recursive into flat arrays.
+ *
+ * The nodes are stored level by level from the leaves up to the root, their
+ * bounding boxes and those of the items in structure-of-arrays form, and the
+ * items in leaf order, so that a query scans contiguous memory instead of
+ * chasing node pointers. Build it once from all the items; use RTree when
+ * items come and go.
+ *
+ * @tparam E Item type to be stored in the tree.
+ * @tparam B Bounding box type associated with E.
+ * @tparam ValueOps Value operations traits for E and B.
+ * @tparam MAX_ITEMS_PER_NODE Number of entries per packed node.
+ *
+ * @ingroup group_geometry
+ */
+template <typename E, typename B, typename ValueOps = RTreeValueOps<E, B>, int MAX_ITEMS_PER_NODE = 16>
+class FlatRTree
+{
+
+public:
+
+    using value_type = typename B::value_type;
+
+    FlatRTree() = default;
+    explicit FlatRTree(std::span<E const> items) { build(items); }
+    FlatRTree(FlatRTree const &) = default;
+    FlatRTree & operator=(FlatRTree const &) = default;
+    FlatRTree(FlatRTree &&) = default;
+    FlatRTree & operator=(FlatRTree &&) = default;
+    ~FlatRTree() = default;
+
+    size_t size() const { return m_items.size(); }
+    bool empty() const { return m_items.empty(); }
+    size_t nnode() const { return m_first.size(); }
+
+    /// Search for items intersecting the given bounding box
+    /// @param box the bounding box to search
+    /// @param output the vector to store found items
+    void search(B const & box, std::vector<E> & output) const
+    {
+        output.clear();
+        if (!m_items.empty())
+        {
+            search_node(m_first.size() - 1, box, output);
+        }
+    }
+
+private:
+
+    /// Bounding boxes in structure-of-arrays form.
+    struct BoxArray
+    {
+        std::vector<value_type> min_x, min_y, min_z, max_x, max_y, max_z;
+
+        void push_back(B const & box)
+        {
+            min_x.push_back(box.min_x());
+            min_y.push_back(box.min_y());
+            min_z.push_back(box.min_z());
+            max_x.push_back(box.max_x());
+            max_y.push_back(box.max_y());
+            max_z.push_back(box.max_z());
+        }
+
+        B get(size_t i) const { return B(min_x[i], min_y[i], min_z[i], max_x[i], max_y[i], max_z[i]); }
+
+        /// Same test as BoundBox3d::overlap.
+        bool overlap(size_t i, B const & box) const
+        {
+            return !(box.min_x() > max_x[i] || box.max_x() < min_x[i] ||
+                     box.min_y() > max_y[i] || box.max_y() < min_y[i] ||
+                     box.min_z() > max_z[i] || box.max_z() < min_z[i]);
+        }
+    }; /* end struct BoxArray */
+
+    void build(std::span<E const> items)
+    {
+        constexpr auto node_size = static_cast<size_t>(MAX_ITEMS_PER_NODE);
+        if (items.empty())
+        {
+            return;
+        }
+
+        std::vector<B> boxes;
+        boxes.reserve(items.size());
+        for (E const & item : items)
+        {
+            boxes.push_back(ValueOps::calc_bound_box(item));
+        }
+        std::vector<size_t> order = detail::str_order(boxes, node_size);
+        m_items.reserve(items.size());
+        for (size_t const k : order)
+        {
+            m_items.push_back(items[k]);
+            m_item_boxes.push_back(boxes[k]);
+        }
+
+        // The nodes of the level being built: bounding box and child range.
+        std::vector<B> level_boxes;
+        std::vector<size_t> level_first;
+        std::vector<uint32_t> level_count;
+        auto pack = [&](size_t count, size_t base, auto const & box_of)
+        {
+            for (size_t begin = 0; begin < count; begin += node_size)
+            {
+                size_t const end = std::min(begin + node_size, count);
+                B bbox = box_of(begin);
+                for (size_t k = begin + 1; k < end; ++k)
+                {
+                    bbox.expand(box_of(k));
+                }
+                level_boxes.push_back(bbox);
+                level_first.push_back(base + begin);
+                level_count.push_back(static_cast<uint32_t>(end - begin));
+            }
+        };
+        pack(items.size(), 0, [&](size_t k)
+             { return boxes[order[k]]; });
+        m_nleaf = level_boxes.size();
+
+        // Put each level in STR order, append it, and pack its parents from
+        // the contiguous runs.
+        while (true)
+        {
+            if (level_boxes.size() > 1)
+            {
+                order = detail::str_order(level_boxes, node_size);
+            }
+            else
+            {
+                order.assign(1, 0);
+            }
+            size_t const base = m_first.size();
+            for (size_t const k : order)
+            {
+                m_node_boxes.push_back(level_boxes[k]);
+                m_first.push_back(level_first[k]);
+                m_count.push_back(level_count[k]);
+            }
+            if (order.size() == 1)
+            {
+                break;
+            }
+            level_boxes.clear();
+            level_first.clear();
+            level_count.clear();
+            pack(order.size(), base, [&](size_t k)
+                 { return m_node_boxes.get(base + k); });
+        }
+    }
+
+    // FIXME: NOLINTNEXTLINE(misc-no-recursion)
+    void search_node(size_t node, B const & box, std::vector<E> & output) const
+    {
+        size_t const first = m_first[node];
+        size_t const last = first + m_count[node];
+        if (node < m_nleaf)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                if (m_item_boxes.overlap(i, box))
+                {
+                    output.push_back(m_items[i]);
+                }
+            }
+            return;
+        }
+        for (size_t child = first; child < last; ++child)
+        {
+            if (m_node_boxes.overlap(child, box))
+            {
+                search_node(child, box, output);
+            }
+        }
+    }
+
+    std::vector<E> m_items; ///< In leaf order.
+    BoxArray m_item_boxes;
+    BoxArray m_node_boxes; ///< Leaves first, the root last.
+    std::vector<size_t> m_first; ///< First item of a leaf, first child node otherwise.
+    std::vector<uint32_t> m_count; ///< Number of items or children.
+    size_t m_nleaf = 0;
+
+}; /* end class FlatRTree */
+
 } /* end namespace solvcon */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
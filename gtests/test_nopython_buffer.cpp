@@ -2,7 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <random>
+#include <string>
+#include <thread>
 #ifdef Py_PYTHON_H
 #error "Python.h should not be included."
 #endif
@@ -25,6 +31,265 @@ TEST(ConcreteBuffer, iterator)
     }
 }
 
+namespace
+{
+
+// Write 16 doubles 0, 1, ..., 15 to a fresh temporary file.
+std::string write_mapped_file(char const * name)
+{
+    std::string const path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (int i = 0; i < 16; ++i)
+    {
+        double const v = i;
+        out.write(reinterpret_cast<char const *>(&v), sizeof(v)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    return path;
+}
+
+double read_mapped_value(std::string const & path, size_t index)
+{
+    std::ifstream in(path, std::ios::binary);
+    in.seekg(static_cast<std::streamoff>(index * sizeof(double)));
+    double v = 0;
+    in.read(reinterpret_cast<char *>(&v), sizeof(v)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return v;
+}
+
+} /* end namespace */
+
+TEST(ConcreteBuffer, map_file)
+{
+    using namespace solvcon;
+
+    std::string const path = write_mapped_file("solvcon_map_file.bin");
+
+    auto whole = ConcreteBuffer::map_file(path);
+    EXPECT_EQ(whole->nbytes(), 16 * sizeof(double));
+    EXPECT_TRUE(whole->is_mapped());
+    EXPECT_FALSE(whole->is_writable());
+    EXPECT_FALSE(ConcreteBuffer::construct(8)->is_mapped());
+    EXPECT_TRUE(ConcreteBuffer::construct(8)->is_writable());
+
+    // The offset does not need to be page-aligned; view it as a 2x3 array.
+    auto part = ConcreteBuffer::map_file(path, 4 * sizeof(double), 6 * sizeof(double));
+    SimpleArray<double> const arr(small_vector<ssize_t>{2, 3}, part);
+    EXPECT_EQ(arr.data(), reinterpret_cast<double const *>(part->data())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_EQ(arr(0, 0), 4.0);
+    EXPECT_EQ(arr(1, 2), 9.0);
+
+    // A clone is an ordinary heap buffer.
+    auto copied = part->clone();
+    EXPECT_FALSE(copied->is_mapped());
+    EXPECT_EQ(copied->nbytes(), part->nbytes());
+
+    // Mapping from the end of the file gives an empty buffer.
+    EXPECT_EQ(ConcreteBuffer::map_file(path, 16 * sizeof(double))->nbytes(), 0);
+
+    EXPECT_THROW(ConcreteBuffer::map_file(path, 17 * sizeof(double)), std::out_of_range);
+    EXPECT_THROW(ConcreteBuffer::map_file(path, 8, 16 * sizeof(double)), std::out_of_range);
+    EXPECT_THROW(ConcreteBuffer::map_file(path + ".missing"), std::runtime_error);
+    EXPECT_THROW(map_mode_from_string("w"), std::invalid_argument);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ConcreteBuffer, map_file_write)
+{
+    using namespace solvcon;
+
+    std::string const path = write_mapped_file("solvcon_map_file_write.bin");
+
+    {
+        // Copy-on-write pages are private to the buffer.
+        auto buf = ConcreteBuffer::map_file(path, 0, 0, MapMode::COPY_ON_WRITE);
+        EXPECT_TRUE(buf->is_writable());
+        SimpleArray<double> arr(small_vector<ssize_t>{16}, buf);
+        arr(3) = -3.0;
+        EXPECT_EQ(arr(3), -3.0);
+    }
+    EXPECT_EQ(read_mapped_value(path, 3), 3.0);
+
+    {
+        // Shared pages write through to the file.
+        auto buf = ConcreteBuffer::map_file(path, sizeof(double), 2 * sizeof(double), MapMode::SHARED);
+        SimpleArray<double> arr(small_vector<ssize_t>{2}, buf);
+        arr(1) = -2.0;
+    }
+    EXPECT_EQ(read_mapped_value(path, 2), -2.0);
+    EXPECT_EQ(read_mapped_value(path, 3), 3.0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(BufferAllocator, pool)
+{
+    using namespace solvcon;
+
+    auto pool = PoolBufferAllocator::construct(/*max_block*/ 1 << 20, /*max_cached*/ 1 << 22);
+    EXPECT_EQ(pool->size_class(1), 0);
+    EXPECT_EQ(pool->size_class(64), 0);
+    EXPECT_EQ(pool->size_class(65), 1);
+    EXPECT_EQ(pool->size_class(1 << 20), 14);
+    EXPECT_EQ(pool->size_class((1 << 20) + 1), PoolBufferAllocator::NCLASS);
+
+    int8_t const * first = nullptr;
+    {
+        BufferAllocatorScope const scope(pool);
+        auto buf = ConcreteBuffer::construct(960, 64);
+        EXPECT_EQ(buf->allocator(), pool);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buf->data()) % 64, 0);
+        first = buf->data();
+        EXPECT_EQ(pool->nlive(), 1);
+    }
+    EXPECT_EQ(pool->nlive(), 0);
+    EXPECT_EQ(pool->cached_bytes(), 1024);
+    {
+        BufferAllocatorScope const scope(pool);
+        // The same size class gets the cached block back.
+        auto buf = ConcreteBuffer::construct(900);
+        EXPECT_EQ(buf->data(), first);
+        EXPECT_EQ(pool->nreuse(), 1);
+        EXPECT_EQ(pool->nsystem(), 1);
+        // A block larger than max_block is not cached.
+        auto big = ConcreteBuffer::construct((1 << 20) + 8);
+        EXPECT_EQ(big->allocator(), pool);
+    }
+    EXPECT_EQ(pool->nsystem(), 2);
+    EXPECT_EQ(pool->cached_bytes(), 1024);
+    pool->release();
+    EXPECT_EQ(pool->cached_bytes(), 0);
+
+    // Without a scope the buffer comes from malloc.
+    EXPECT_EQ(ConcreteBuffer::construct(16)->allocator(), nullptr);
+}
+
+TEST(BufferAllocator, arena)
+{
+    using namespace solvcon;
+
+    auto arena = ArenaBufferAllocator::construct(/*chunk_size*/ 4096);
+    SimpleArray<double> kept;
+    int8_t const * start = nullptr;
+    {
+        BufferAllocatorScope const scope(arena);
+        SimpleArray<double> a(small_vector<ssize_t>{100}, 1.0);
+        SimpleArray<double> b(small_vector<ssize_t>{100}, 2.0);
+        start = a.buffer().data();
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(b.data()) % BufferAllocator::ALIGNMENT, 0);
+        // Both fit in the first chunk.
+        EXPECT_EQ(arena->nchunk(), 1);
+        EXPECT_EQ(b.buffer().data() - start, 832);
+        EXPECT_EQ(arena->used(), 2 * 832);
+        // A temporary on the top of the stack gives its memory back at once.
+        int8_t const * top = a.add(b).buffer().data();
+        EXPECT_EQ(arena->used(), 2 * 832);
+        EXPECT_EQ(a.mul(b).buffer().data(), top);
+        // Releasing a block under the top waits for the top.
+        {
+            SimpleArray<double> t1 = a.add(b);
+            SimpleArray<double> t2 = a.add(b);
+            t1 = SimpleArray<double>();
+            EXPECT_EQ(arena->used(), 4 * 832);
+        }
+        EXPECT_EQ(arena->used(), 2 * 832);
+        // A request larger than the chunk size gets its own chunk.
+        SimpleArray<double> c(small_vector<ssize_t>{1000}, 3.0);
+        EXPECT_EQ(arena->nchunk(), 2);
+        kept = a.add(b);
+        EXPECT_EQ(arena->nlive(), 4);
+        EXPECT_THROW(arena->release(), std::runtime_error);
+    }
+    // The buffer that escapes the scope stays valid and holds the arena.
+    EXPECT_EQ(arena->nlive(), 1);
+    EXPECT_EQ(kept(99), 3.0);
+    EXPECT_GT(arena->used(), 0);
+    kept = SimpleArray<double>();
+    EXPECT_EQ(arena->nlive(), 0);
+    EXPECT_EQ(arena->used(), 0);
+
+    // The arena rewinds when the last buffer is released.
+    {
+        BufferAllocatorScope const scope(arena);
+        auto buf = ConcreteBuffer::construct(8);
+        EXPECT_EQ(buf->data(), start);
+    }
+    EXPECT_EQ(arena->capacity(), 4096 + 8000 + 4096);
+    arena->release();
+    EXPECT_EQ(arena->nchunk(), 0);
+    EXPECT_EQ(arena->capacity(), 0);
+
+    // Each thread has its own arena.
+    std::shared_ptr<ArenaBufferAllocator> other;
+    std::thread([&other]()
+                { other = ArenaBufferAllocator::thread_instance(); })
+        .join();
+    EXPECT_NE(other, ArenaBufferAllocator::thread_instance());
+    EXPECT_EQ(ArenaBufferAllocator::thread_instance(), ArenaBufferAllocator::thread_instance());
+}
+
+TEST(BufferAllocator, scope)
+{
+    using namespace solvcon;
+
+    auto pool = PoolBufferAllocator::construct();
+    auto arena = ArenaBufferAllocator::construct();
+    EXPECT_EQ(BufferAllocator::current(), nullptr);
+    {
+        BufferAllocatorScope const outer(pool);
+        EXPECT_EQ(BufferAllocator::current(), pool);
+        {
+            BufferAllocatorScope const inner(arena);
+            EXPECT_EQ(BufferAllocator::current(), arena);
+            EXPECT_EQ(ConcreteBuffer::construct(8)->allocator(), arena);
+            {
+                // A null allocator selects malloc again.
+                BufferAllocatorScope const none(nullptr);
+                EXPECT_EQ(ConcreteBuffer::construct(8)->allocator(), nullptr);
+            }
+            // The scope is per thread.
+            std::thread([]()
+                        { EXPECT_EQ(BufferAllocator::current(), nullptr); })
+                .join();
+        }
+        EXPECT_EQ(BufferAllocator::current(), pool);
+        // A copy allocates from the current allocator too.
+        SimpleArray<int32_t> arr(small_vector<ssize_t>{4, 5}, 7);
+        SimpleArray<int32_t> const copy(arr);
+        EXPECT_EQ(copy.buffer().allocator(), pool);
+    }
+    EXPECT_EQ(BufferAllocator::current(), nullptr);
+    EXPECT_THROW(BufferAllocatorScope::pop(), std::runtime_error);
+}
+
+TEST(BufferAllocator, temporaries)
+{
+    // A post-processing style loop that creates short-lived arrays gives the
+    // same results from every allocator.  profiling/profile_buffer_allocator.py
+    // times it.
+    using namespace solvcon;
+
+    auto run = [](std::shared_ptr<BufferAllocator> const & allocator, size_t nelem)
+    {
+        SimpleArray<double> const x(small_vector<ssize_t>{static_cast<ssize_t>(nelem)}, -1.5);
+        BufferAllocatorScope const scope(allocator);
+        std::vector<double> totals;
+        for (size_t it = 0; it < 20; ++it)
+        {
+            SimpleArray<double> const y = x.mul(x).add(x).abs();
+            totals.push_back(y(nelem - 1));
+        }
+        return totals;
+    };
+    for (size_t const nelem : {16, 4096})
+    {
+        std::vector<double> const expected(20, 0.75);
+        EXPECT_EQ(run(nullptr, nelem), expected);
+        EXPECT_EQ(run(PoolBufferAllocator::construct(), nelem), expected);
+        EXPECT_EQ(run(ArenaBufferAllocator::construct(size_t(1) << 16), nelem), expected);
+    }
+}
+
 TEST(SimpleArray, construction)
 {
     namespace mm = solvcon;
@@ -65,6 +330,30 @@ TEST(SimpleArray, minmaxsum)
     EXPECT_EQ(arr_int.max(), 9);
 }
 
+TEST(SimpleArray, minmaxvar_data_offset)
+{
+    using namespace solvcon;
+
+    // The view skips the first 4 elements, whose values would change every
+    // result if they were read.
+    auto buffer = ConcreteBuffer::construct(6 * sizeof(double));
+    double * const raw_data = buffer->data<double>();
+    raw_data[0] = -100.0;
+    raw_data[1] = 100.0;
+    raw_data[2] = -50.0;
+    raw_data[3] = 50.0;
+    raw_data[4] = 1.5;
+    raw_data[5] = 4.5;
+
+    SimpleArray<double> view(small_vector<ssize_t>{2}, buffer, 4 * sizeof(double));
+    EXPECT_EQ(view.min(), 1.5);
+    EXPECT_EQ(view.max(), 4.5);
+    EXPECT_DOUBLE_EQ(view.sum(), 6.0);
+    EXPECT_DOUBLE_EQ(view.mean(), 3.0);
+    EXPECT_DOUBLE_EQ(view.var(0), 2.25);
+    EXPECT_DOUBLE_EQ(view.var(1), 4.5);
+}
+
 TEST(SimpleArray, argminmax_axis_rejects_rank_zero_result)
 {
     using namespace solvcon;
@@ -180,6 +469,200 @@ TEST(SimpleArray, logical_data)
     EXPECT_EQ(shifted.logical_data(), reshaped.logical_data());
 }
 
+namespace
+{
+
+solvcon::SimpleArray<double> make_random_array(size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    solvcon::SimpleArray<double> ret(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        ret(i) = dist(gen);
+    }
+    return ret;
+}
+
+template <typename T>
+bool same_array(solvcon::SimpleArray<T> const & a, solvcon::SimpleArray<T> const & b)
+{
+    return a.shape() == b.shape() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+} /* end namespace */
+
+TEST(ArrayExpression, arithmetic)
+{
+    using namespace solvcon;
+
+    // Not a multiple of the tile size, to cover a partial tile.
+    constexpr size_t n = (3 * expr::TILE_SIZE) + 17;
+    auto const a = make_random_array(n, 1);
+    auto const b = make_random_array(n, 2);
+    auto const c = make_random_array(n, 3);
+    auto const d = make_random_array(n, 4);
+
+    SimpleArray<double> const eager = a.add(b).mul(c).sub(d);
+    SimpleArray<double> const lazy = (expr::lazy(a) + b) * c - d;
+    EXPECT_TRUE(same_array(eager, lazy));
+    EXPECT_TRUE(same_array(eager, expr::lazy(a).add(b).mul(c).sub(d).evaluate()));
+
+    // Scalars on either side.
+    EXPECT_TRUE(same_array(a.mul(2.0).add(1.0), (expr::lazy(a) * 2.0 + 1.0).evaluate()));
+    EXPECT_TRUE(same_array(b.div(a), (expr::lazy(b) / expr::lazy(a)).evaluate()));
+    SimpleArray<double> const rsub = 3.0 - expr::lazy(a);
+    SimpleArray<double> const rdiv = 1.0 / expr::lazy(a);
+    SimpleArray<double> const neg = -expr::lazy(a);
+    SimpleArray<double> const abs = expr::lazy(a).abs();
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(rsub(i), 3.0 - a(i));
+        EXPECT_EQ(rdiv(i), 1.0 / a(i));
+        EXPECT_EQ(neg(i), -a(i));
+        EXPECT_EQ(abs(i), std::abs(a(i)));
+    }
+
+    // The output may be an operand.
+    SimpleArray<double> inplace = a;
+    ((expr::lazy(inplace) * b) + inplace).evaluate_into(inplace);
+    EXPECT_TRUE(same_array(a.mul(b).add(a), inplace));
+
+    // Multi-dimensional and integer arrays.
+    SimpleArray<int32_t> m(small_vector<ssize_t>{7, 9}, 3);
+    SimpleArray<int32_t> const m2 = expr::lazy(m) * expr::lazy(m) - 4;
+    EXPECT_EQ(m2.shape(), m.shape());
+    EXPECT_EQ(m2(6, 8), 5);
+
+    SimpleArray<double> const shorter(n - 1);
+    EXPECT_THROW(expr::lazy(a) + shorter, std::invalid_argument);
+    SimpleArray<double> out(n - 1);
+    EXPECT_THROW((expr::lazy(a) + 1.0).evaluate_into(out), std::invalid_argument);
+}
+
+TEST(ArrayExpression, compare_where)
+{
+    using namespace solvcon;
+
+    constexpr size_t n = (2 * expr::TILE_SIZE) + 5;
+    auto const a = make_random_array(n, 5);
+    auto const b = make_random_array(n, 6);
+
+    EXPECT_TRUE(same_array(a.lt(b), (expr::lazy(a) < b).evaluate()));
+    EXPECT_TRUE(same_array(a.ge(0.5), (expr::lazy(a) >= 0.5).evaluate()));
+    EXPECT_TRUE(same_array(a.ne(b), expr::lazy(a).ne(b).evaluate()));
+
+    // Clip the negative values of a to zero and double the rest.
+    SimpleArray<double> const clipped = expr::where(expr::lazy(a) < 0.0, 0.0, expr::lazy(a) * 2.0);
+    EXPECT_TRUE(same_array(a.lt(0.0).where(SimpleArray<double>(a.shape(), 0.0), a.mul(2.0)), clipped));
+    SimpleArray<double> const picked = expr::where(expr::lazy(a) > b, a, b);
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(picked(i), std::max(a(i), b(i)));
+    }
+}
+
+TEST(ArrayExpression, lazy_array)
+{
+    using namespace solvcon;
+
+    constexpr size_t n = (2 * expr::TILE_SIZE) + 100;
+    auto a = make_random_array(n, 7);
+    auto const b = make_random_array(n, 8);
+    auto const c = make_random_array(n, 9);
+
+    LazyArray<double> chain = LazyArray<double>(a).add(b).mul(c).sub(2.0);
+    // The lazy array keeps its operands alive.
+    a = SimpleArray<double>();
+    auto const a2 = make_random_array(n, 7);
+    EXPECT_TRUE(same_array(a2.add(b).mul(c).sub(2.0), chain.evaluate()));
+
+    SimpleArray<double> const reflected = LazyArray<double>(b).rsub(1.0).sub(LazyArray<double>(c).rdiv(2.0)).evaluate();
+    LazyArray<bool> const cond = LazyArray<double>(b).gt(c);
+    SimpleArray<double> const picked = cond.where(LazyArray<double>(b), LazyArray<double>(c).neg()).evaluate();
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(reflected(i), (1.0 - b(i)) - (2.0 / c(i)));
+        EXPECT_EQ(picked(i), b(i) > c(i) ? b(i) : -c(i));
+    }
+    EXPECT_THROW(LazyArray<double>(b).add(SimpleArray<double>(n + 1)), std::invalid_argument);
+}
+
+TEST(SimpleArray, broadcast_arithmetic)
+{
+    using namespace solvcon;
+
+    using shape_type = small_vector<ssize_t>;
+    SimpleArray<double> a(shape_type{3, 4});
+    SimpleArray<double> row(shape_type{4});
+    SimpleArray<double> col(shape_type{3, 1});
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        col(i, 0) = 100.0 * static_cast<double>(i);
+        for (ssize_t j = 0; j < 4; ++j)
+        {
+            a(i, j) = static_cast<double>((i * 4) + j);
+            row(j) = 10.0 * static_cast<double>(j);
+        }
+    }
+
+    // Add per-column offsets, and combine a column with a row.
+    SimpleArray<double> const shifted = a.add(row);
+    SimpleArray<double> const outer = col.mul(row.reshape(shape_type{1, 4}));
+    SimpleArray<bool> const less = row.lt(a);
+    ASSERT_EQ(shifted.shape(), (shape_type{3, 4}));
+    ASSERT_EQ(outer.shape(), (shape_type{3, 4}));
+    ASSERT_EQ(less.shape(), (shape_type{3, 4}));
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        for (ssize_t j = 0; j < 4; ++j)
+        {
+            EXPECT_EQ(shifted(i, j), a(i, j) + row(j));
+            EXPECT_EQ(outer(i, j), col(i, 0) * row(j));
+            EXPECT_EQ(less(i, j), row(j) < a(i, j));
+        }
+    }
+
+    // The operand of the in-place operations broadcasts to this array.
+    SimpleArray<double> inplace(a);
+    inplace.isub(col);
+    EXPECT_EQ(inplace(2, 3), a(2, 3) - col(2, 0));
+    EXPECT_THROW(col.iadd(a), std::invalid_argument);
+    EXPECT_EQ(col(2, 0), 200.0);
+
+    // An operand that views the memory of this array through another buffer
+    // is read before it is overwritten.
+    SimpleArray<double> overlap(a);
+    auto const row_buffer = ConcreteBuffer::construct(4 * sizeof(double), overlap.data(), std::make_unique<detail::ConcreteBufferNoRemove>());
+    overlap.isub(SimpleArray<double>(shape_type{4}, row_buffer));
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        for (ssize_t j = 0; j < 4; ++j)
+        {
+            EXPECT_EQ(overlap(i, j), a(i, j) - a(0, j));
+        }
+    }
+
+    // Outer axes and a scalar inner loop: (2,3,4) / (3,1).
+    SimpleArray<double> cube(shape_type{2, 3, 4}, 6.0);
+    SimpleArray<double> const quotient = cube.div(col.add(1.0));
+    ASSERT_EQ(quotient.shape(), (shape_type{2, 3, 4}));
+    EXPECT_EQ(quotient(1, 2, 3), 6.0 / 201.0);
+    EXPECT_EQ(quotient(0, 1, 0), 6.0 / 101.0);
+
+    EXPECT_EQ(SimpleArray<double>(shape_type{0, 4}).add(row).shape(), (shape_type{0, 4}));
+    EXPECT_THROW(a.add(SimpleArray<double>(shape_type{3})), std::invalid_argument);
+    EXPECT_THROW(a.eq(SimpleArray<double>(shape_type{2, 1})), std::invalid_argument);
+
+    SimpleArray<bool> flags(shape_type{2, 1}, false);
+    flags(1, 0) = true;
+    SimpleArray<bool> const mask(shape_type{3}, true);
+    EXPECT_EQ(flags.add(mask).shape(), (shape_type{2, 3}));
+    EXPECT_FALSE(flags.mul(mask)(0, 2));
+    EXPECT_TRUE(flags.mul(mask)(1, 2));
+    EXPECT_THROW(flags.sub(mask), std::runtime_error);
+}
+
 TEST(SimpleArray_DataType, from_type)
 {
     solvcon::DataType dt_double = solvcon::DataType::from<double>();
@@ -311,6 +794,127 @@ TEST(small_vector, equality_requires_same_size)
     EXPECT_FALSE(longer == prefix);
 }
 
+namespace
+{
+
+template <typename T>
+solvcon::SimpleArray<T> make_matmul_operand(solvcon::small_vector<ssize_t> const & shape, uint32_t seed)
+{
+    solvcon::SimpleArray<T> array(shape);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(-4, 4);
+    for (size_t i = 0; i < array.size(); ++i)
+    {
+        array.data(i) = static_cast<T>(dist(rng));
+    }
+    return array;
+}
+
+// Plain triple loop over the trailing two axes, batch by batch.
+template <typename T>
+solvcon::SimpleArray<T> reference_matmul(solvcon::SimpleArray<T> const & lhs, solvcon::SimpleArray<T> const & rhs)
+{
+    using namespace solvcon;
+    size_t const ndim = lhs.ndim();
+    ssize_t const m = lhs.shape(ndim - 2);
+    ssize_t const k = lhs.shape(ndim - 1);
+    ssize_t const n = rhs.shape(ndim - 1);
+    ssize_t const nbatch = ndim == 3 ? lhs.shape(0) : 1;
+    small_vector<ssize_t> shape = lhs.shape();
+    shape[ndim - 1] = n;
+    SimpleArray<T> result(shape);
+    for (ssize_t b = 0; b < nbatch; ++b)
+    {
+        T const * const a = lhs.data() + (ndim == 3 ? b * lhs.stride(0) : 0);
+        T const * const c = rhs.data() + (ndim == 3 ? b * rhs.stride(0) : 0);
+        for (ssize_t i = 0; i < m; ++i)
+        {
+            for (ssize_t j = 0; j < n; ++j)
+            {
+                T total{};
+                for (ssize_t l = 0; l < k; ++l)
+                {
+                    total += a[i * lhs.stride(ndim - 2) + l * lhs.stride(ndim - 1)] *
+                             c[l * rhs.stride(ndim - 2) + j * rhs.stride(ndim - 1)];
+                }
+                result.data((b * m + i) * n + j) = total;
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+void expect_same_elements(solvcon::SimpleArray<T> const & lhs, solvcon::SimpleArray<T> const & rhs)
+{
+    ASSERT_EQ(lhs.shape(), rhs.shape());
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        ASSERT_EQ(lhs.data(i), rhs.data(i)) << "element " << i;
+    }
+}
+
+template <typename T>
+void check_native_matmul(ssize_t m, ssize_t k, ssize_t n)
+{
+    using namespace solvcon;
+    auto lhs = make_matmul_operand<T>(small_vector<ssize_t>{m, k}, 3);
+    auto rhs = make_matmul_operand<T>(small_vector<ssize_t>{k, n}, 5);
+    expect_same_elements(lhs.matmul_planned(rhs), reference_matmul(lhs, rhs));
+
+    // A transposed view takes the same route through the packing.
+    auto rhs_t = make_matmul_operand<T>(small_vector<ssize_t>{n, k}, 7);
+    rhs_t.transpose();
+    expect_same_elements(lhs.matmul_planned(rhs_t), reference_matmul(lhs, rhs_t));
+}
+
+} /* end namespace */
+
+TEST(SimpleArray, matmul_native)
+{
+    // Integer inputs keep every partial sum exact, so the blocked kernel must
+    // reproduce the plain loop bit for bit, edges and all.
+    for (auto const & [m, k, n] : {std::array<ssize_t, 3>{8, 8, 8},
+                                   std::array<ssize_t, 3>{37, 41, 29},
+                                   std::array<ssize_t, 3>{70, 300, 9},
+                                   std::array<ssize_t, 3>{5, 20, 600}})
+    {
+        check_native_matmul<int32_t>(m, k, n);
+        check_native_matmul<int64_t>(m, k, n);
+        check_native_matmul<float>(m, k, n);
+        check_native_matmul<double>(m, k, n);
+        check_native_matmul<solvcon::Complex<double>>(m, k, n);
+    }
+}
+
+TEST(SimpleArray, matmul_native_threads)
+{
+    using namespace solvcon;
+    auto const saved = matmul_nthread();
+
+    auto big_lhs = make_matmul_operand<double>(small_vector<ssize_t>{130, 70}, 11);
+    auto big_rhs = make_matmul_operand<double>(small_vector<ssize_t>{70, 600}, 13);
+    auto batch_lhs = make_matmul_operand<int64_t>(small_vector<ssize_t>{40, 12, 10}, 17);
+    auto batch_rhs = make_matmul_operand<int64_t>(small_vector<ssize_t>{40, 10, 14}, 19);
+    // Small products go through the generic loop, also split over the batch.
+    auto small_lhs = make_matmul_operand<int32_t>(small_vector<ssize_t>{5000, 3, 4}, 23);
+    auto small_rhs = make_matmul_operand<int32_t>(small_vector<ssize_t>{5000, 4, 2}, 29);
+
+    set_matmul_nthread(1);
+    EXPECT_EQ(matmul_nthread(), 1);
+    auto const big_serial = big_lhs.matmul_planned(big_rhs);
+
+    for (size_t nthread : {2, 3, 5})
+    {
+        set_matmul_nthread(nthread);
+        EXPECT_EQ(matmul_nthread(), nthread);
+        expect_same_elements(big_lhs.matmul_planned(big_rhs), big_serial);
+        expect_same_elements(batch_lhs.matmul_planned(batch_rhs), reference_matmul(batch_lhs, batch_rhs));
+        expect_same_elements(small_lhs.matmul_planned(small_rhs), reference_matmul(small_lhs, small_rhs));
+    }
+    set_matmul_nthread(saved);
+}
+
 TEST(TakeAlongAxisSimd, basic_int32)
 {
     using namespace solvcon;
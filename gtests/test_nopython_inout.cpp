@@ -3,6 +3,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+
 #ifdef Py_PYTHON_H
 #error "Python.h should not be included."
 #endif
@@ -315,4 +321,443 @@ TEST(Gmsh_Parser, Hexahedron125NodeDefinition)
     EXPECT_THAT(ele_def.mmcl(), testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
 }
 
+namespace
+{
+
+std::string snapshot_path(char const * name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Structured nx-by-ny quadrilateral grid over the unit square.
+std::shared_ptr<solvcon::StaticMesh> make_snapshot_grid(int32_t nx, int32_t ny)
+{
+    using namespace solvcon;
+    using uint_type = StaticMesh::uint_type;
+    auto mh = StaticMesh::construct(2, static_cast<uint_type>((nx + 1) * (ny + 1)), uint_type(0), static_cast<uint_type>(nx * ny));
+    for (int32_t j = 0; j <= ny; ++j)
+    {
+        for (int32_t i = 0; i <= nx; ++i)
+        {
+            mh->ndcrd(j * (nx + 1) + i, 0) = static_cast<double>(i) / nx;
+            mh->ndcrd(j * (nx + 1) + i, 1) = static_cast<double>(j) / ny;
+        }
+    }
+    for (int32_t j = 0; j < ny; ++j)
+    {
+        for (int32_t i = 0; i < nx; ++i)
+        {
+            int32_t const icl = j * nx + i;
+            int32_t const n0 = j * (nx + 1) + i;
+            mh->cltpn(icl) = CellType::QUADRILATERAL;
+            mh->clnds(icl, 0) = 4;
+            mh->clnds(icl, 1) = n0;
+            mh->clnds(icl, 2) = n0 + 1;
+            mh->clnds(icl, 3) = n0 + nx + 2;
+            mh->clnds(icl, 4) = n0 + nx + 1;
+        }
+    }
+    mh->build_interior(true);
+    mh->build_boundary();
+    mh->build_ghost();
+    return mh;
+}
+
+template <typename T>
+void expect_same_array(solvcon::SimpleArray<T> const & a, solvcon::SimpleArray<T> const & b, char const * name)
+{
+    EXPECT_EQ(a.shape(), b.shape()) << name;
+    EXPECT_EQ(a.nghost(), b.nghost()) << name;
+    ASSERT_EQ(a.nbytes(), b.nbytes()) << name;
+    EXPECT_EQ(0, std::memcmp(a.data(), b.data(), a.nbytes())) << name;
+}
+
+void expect_same_mesh(solvcon::StaticMesh const & a, solvcon::StaticMesh const & b)
+{
+    EXPECT_EQ(a.ndim(), b.ndim());
+    EXPECT_EQ(a.nnode(), b.nnode());
+    EXPECT_EQ(a.nface(), b.nface());
+    EXPECT_EQ(a.ncell(), b.ncell());
+    EXPECT_EQ(a.nbound(), b.nbound());
+    EXPECT_EQ(a.ngstnode(), b.ngstnode());
+    EXPECT_EQ(a.ngstface(), b.ngstface());
+    EXPECT_EQ(a.ngstcell(), b.ngstcell());
+    expect_same_array(a.ndcrd(), b.ndcrd(), "ndcrd");
+    expect_same_array(a.fccnd(), b.fccnd(), "fccnd");
+    expect_same_array(a.fcnml(), b.fcnml(), "fcnml");
+    expect_same_array(a.fcara(), b.fcara(), "fcara");
+    expect_same_array(a.clcnd(), b.clcnd(), "clcnd");
+    expect_same_array(a.clvol(), b.clvol(), "clvol");
+    expect_same_array(a.fctpn(), b.fctpn(), "fctpn");
+    expect_same_array(a.cltpn(), b.cltpn(), "cltpn");
+    expect_same_array(a.clgrp(), b.clgrp(), "clgrp");
+    expect_same_array(a.fcnds(), b.fcnds(), "fcnds");
+    expect_same_array(a.fccls(), b.fccls(), "fccls");
+    expect_same_array(a.clnds(), b.clnds(), "clnds");
+    expect_same_array(a.clfcs(), b.clfcs(), "clfcs");
+    expect_same_array(a.ednds(), b.ednds(), "ednds");
+    expect_same_array(a.bndfcs(), b.bndfcs(), "bndfcs");
+    ASSERT_EQ(a.nbcs(), b.nbcs());
+    for (size_t ibc = 0; ibc < a.nbcs(); ++ibc)
+    {
+        EXPECT_EQ(a.bc(ibc)->name(), b.bc(ibc)->name());
+        expect_same_array(a.bc(ibc)->facn(), b.bc(ibc)->facn(), "facn");
+    }
+}
+
+} /* end namespace */
+
+TEST(Snapshot, mesh_roundtrip)
+{
+    using namespace solvcon;
+    std::string const path = snapshot_path("solvcon_snapshot_mesh.bin");
+
+    auto const mh = make_snapshot_grid(7, 5);
+    inout::Snapshot out;
+    out.add_mesh(*mh);
+    out.save(path);
+
+    for (bool const mapped : {true, false})
+    {
+        inout::Snapshot const in = inout::Snapshot::load(path, mapped);
+        EXPECT_EQ(in.names(), out.names());
+        EXPECT_EQ(in.section("mesh/ndcrd").buffer->is_mapped(), mapped);
+        auto const loaded = in.to_mesh();
+        expect_same_mesh(*mh, *loaded);
+        // Copy-on-write pages let the loaded mesh be modified.
+        loaded->ndcrd(0, 0) = -1;
+    }
+    EXPECT_EQ(inout::Snapshot::load(path).to_mesh()->ndcrd(0, 0), 0.0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(Snapshot, euler_restart)
+{
+    using namespace solvcon;
+    std::string const path = snapshot_path("solvcon_snapshot_euler.bin");
+
+    auto const mh = make_snapshot_grid(12, 8);
+    auto const ec = EulerCore::construct(mh, 0.005);
+    ec->set_taumin(0.1);
+    ec->init_solution(1.4, 1.0, {0.3, -0.1, 0}, 1.0);
+    for (int32_t icl = 0; icl < ec->ncell(); ++icl)
+    {
+        double const dx = mh->clcnd(icl, 0) - 0.5;
+        double const dy = mh->clcnd(icl, 1) - 0.5;
+        ec->so0n()(icl, 0) += 0.2 * std::exp(-40.0 * (dx * dx + dy * dy));
+    }
+    std::vector<int32_t> faces;
+    for (size_t ibnd = 0; ibnd < mh->nbound(); ++ibnd)
+    {
+        faces.push_back(mh->bndfcs(static_cast<int32_t>(ibnd), 0));
+    }
+    ec->add_bc(EulerBC::NonReflective, faces, {});
+    ec->bc_soln();
+    ec->bc_dsoln();
+    ec->march(2);
+
+    inout::Snapshot out;
+    out.add_mesh(*mh);
+    out.add_euler(*ec);
+    out.save(path);
+
+    inout::Snapshot const in = inout::Snapshot::load(path);
+    auto const restarted = in.to_euler(in.to_mesh());
+    EXPECT_EQ(restarted->taumin(), 0.1);
+    ASSERT_EQ(restarted->boundaries().size(), 1);
+    EXPECT_EQ(restarted->boundaries()[0].faces.size(), faces.size());
+
+    // The restart continues bit for bit.
+    ec->march(2);
+    restarted->march(2);
+    expect_same_array(ec->so0n(), restarted->so0n(), "so0n");
+    expect_same_array(ec->so1n(), restarted->so1n(), "so1n");
+
+    EXPECT_THROW(in.to_euler(make_snapshot_grid(3, 3)), std::invalid_argument);
+
+    std::filesystem::remove(path);
+}
+
+TEST(Snapshot, errors)
+{
+    using namespace solvcon;
+    std::string const path = snapshot_path("solvcon_snapshot_errors.bin");
+
+    inout::Snapshot snap;
+    SimpleArray<double> arr(small_vector<ssize_t>{3}, 1.5);
+    snap.add("a", arr);
+    EXPECT_THROW(snap.add("a", arr), std::invalid_argument);
+    EXPECT_THROW(snap.get<int32_t>("a"), std::invalid_argument);
+    EXPECT_THROW(snap.get<double>("b"), std::out_of_range);
+    snap.save(path);
+    EXPECT_EQ(inout::Snapshot::load(path).get<double>("a")(2), 1.5);
+
+    {
+        std::ofstream bad(path, std::ios::binary | std::ios::trunc);
+        bad << "not a snapshot at all, just some text";
+    }
+    EXPECT_THROW(inout::Snapshot::load(path), std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW(inout::Snapshot::load(path), std::runtime_error);
+}
+
+namespace
+{
+
+// Unit square split into four triangles around the center node, with the
+// four boundary lines in physical group 1 and the triangles in group 2.
+std::string const gmsh22_square = R"($MeshFormat
+2.2 0 8
+$EndMeshFormat
+$PhysicalNames
+2
+1 1 "wall"
+2 2 "domain"
+$EndPhysicalNames
+$Nodes
+5
+1 0 0 0
+2 1 0 0
+3 1 1 0
+4 0 1 0
+5 0.5 0.5 0
+$EndNodes
+$Elements
+8
+1 1 2 1 1 1 2
+2 1 2 1 2 2 3
+3 1 2 1 3 3 4
+4 1 2 1 4 4 1
+5 2 2 2 1 1 2 5
+6 2 2 2 1 2 3 5
+7 2 2 2 1 3 4 5
+8 2 2 2 1 4 1 5
+$EndElements
+)";
+
+// Write the same square in MSH 4.1, as text or as binary.
+class Msh41Writer
+{
+
+public:
+
+    explicit Msh41Writer(bool binary)
+        : m_binary(binary)
+    {
+    }
+
+    template <typename T>
+    Msh41Writer & put(T value)
+    {
+        if (m_binary)
+        {
+            m_out.append(reinterpret_cast<char const *>(&value), sizeof(T)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        else
+        {
+            m_out += std::format("{} ", value);
+        }
+        return *this;
+    }
+
+    Msh41Writer & line()
+    {
+        if (!m_binary)
+        {
+            m_out += '\n';
+        }
+        return *this;
+    }
+
+    Msh41Writer & text(std::string const & value)
+    {
+        m_out += value;
+        return *this;
+    }
+
+    std::string const & str() const { return m_out; }
+
+private:
+
+    bool m_binary;
+    std::string m_out;
+
+}; /* end class Msh41Writer */
+
+std::string make_gmsh41_square(bool binary)
+{
+    Msh41Writer w(binary);
+    w.text(binary ? "$MeshFormat\n4.1 1 8\n" : "$MeshFormat\n4.1 0 8\n");
+    if (binary)
+    {
+        w.put(int32_t(1));
+    }
+    w.text("\n$EndMeshFormat\n$PhysicalNames\n2\n1 1 \"wall\"\n2 2 \"domain\"\n$EndPhysicalNames\n");
+
+    // Four curves and one surface; the bounding entity tags may be negative.
+    w.text("$Entities\n").put(uint64_t(0)).put(uint64_t(4)).put(uint64_t(1)).put(uint64_t(0)).line();
+    for (int32_t icv = 1; icv <= 4; ++icv)
+    {
+        w.put(icv).put(0.0).put(0.0).put(0.0).put(1.0).put(1.0).put(0.0);
+        w.put(uint64_t(1)).put(int32_t(1)).put(uint64_t(2)).put(icv).put(-(icv % 4 + 1)).line();
+    }
+    w.put(int32_t(1)).put(0.0).put(0.0).put(0.0).put(1.0).put(1.0).put(0.0);
+    w.put(uint64_t(1)).put(int32_t(2)).put(uint64_t(4));
+    for (int32_t icv = 1; icv <= 4; ++icv)
+    {
+        w.put(icv);
+    }
+    w.line().text("\n$EndEntities\n");
+
+    // The corner nodes sit in one block.  The center node has parametric
+    // coordinates in the text file, which the reader must skip.
+    w.text("$Nodes\n").put(uint64_t(2)).put(uint64_t(5)).put(uint64_t(1)).put(uint64_t(5)).line();
+    w.put(int32_t(1)).put(int32_t(1)).put(int32_t(0)).put(uint64_t(4)).line();
+    for (uint64_t tag = 1; tag <= 4; ++tag)
+    {
+        w.put(tag).line();
+    }
+    w.put(0.0).put(0.0).put(0.0).line();
+    w.put(1.0).put(0.0).put(0.0).line();
+    w.put(1.0).put(1.0).put(0.0).line();
+    w.put(0.0).put(1.0).put(0.0).line();
+    w.put(int32_t(2)).put(int32_t(1)).put(int32_t(binary ? 0 : 1)).put(uint64_t(1)).line();
+    w.put(uint64_t(5)).line().put(0.5).put(0.5).put(0.0);
+    if (!binary)
+    {
+        w.put(0.5).put(0.5);
+    }
+    w.line().text("\n$EndNodes\n");
+
+    w.text("$Elements\n").put(uint64_t(5)).put(uint64_t(8)).put(uint64_t(1)).put(uint64_t(8)).line();
+    for (int32_t icv = 1; icv <= 4; ++icv)
+    {
+        w.put(int32_t(1)).put(icv).put(int32_t(1)).put(uint64_t(1)).line();
+        w.put(uint64_t(icv)).put(uint64_t(icv)).put(uint64_t(icv % 4 + 1)).line();
+    }
+    w.put(int32_t(2)).put(int32_t(1)).put(int32_t(2)).put(uint64_t(4)).line();
+    for (uint64_t itr = 1; itr <= 4; ++itr)
+    {
+        w.put(itr + 4).put(itr).put(itr % 4 + 1).put(uint64_t(5)).line();
+    }
+    w.text("\n$EndElements\n");
+    return w.str();
+}
+
+std::shared_ptr<solvcon::inout::GmshStream> make_gmsh_stream(std::string const & data, size_t chunk_size)
+{
+    std::istringstream input(data);
+    return std::make_shared<solvcon::inout::GmshStream>(input, chunk_size);
+}
+
+void expect_same_gmsh(solvcon::inout::GmshStream const & a, solvcon::inout::GmshStream const & b)
+{
+    expect_same_array(a.nds(), b.nds(), "nds");
+    expect_same_array(a.eltpn(), b.eltpn(), "eltpn");
+    expect_same_array(a.elnds(), b.elnds(), "elnds");
+    expect_same_array(a.eldim(), b.eldim(), "eldim");
+    expect_same_array(a.elgrp(), b.elgrp(), "elgrp");
+    expect_same_array(a.elgeo(), b.elgeo(), "elgeo");
+}
+
+} /* end namespace */
+
+TEST(GmshStream, v22_matches_gmsh)
+{
+    using namespace solvcon;
+    auto const expected = inout::Gmsh(gmsh22_square).to_block();
+
+    // Tiny chunks split every line and number across reads.
+    for (size_t chunk_size : {size_t(1), size_t(7), inout::GmshStream::DEFAULT_CHUNK_SIZE})
+    {
+        auto const stream = make_gmsh_stream(gmsh22_square, chunk_size);
+        EXPECT_EQ(stream->version(), "2.2");
+        EXPECT_FALSE(stream->is_binary());
+        EXPECT_EQ(stream->nnode(), 5);
+        EXPECT_EQ(stream->nelement(), 8);
+        EXPECT_EQ(stream->elgrp()(0), 1);
+        EXPECT_EQ(stream->elgeo()(3), 4);
+        EXPECT_EQ(stream->elgrp()(7), 2);
+
+        auto const blk = stream->to_block();
+        EXPECT_EQ(blk->ndim(), expected->ndim());
+        EXPECT_EQ(blk->nnode(), expected->nnode());
+        EXPECT_EQ(blk->nface(), expected->nface());
+        EXPECT_EQ(blk->ncell(), 4);
+        EXPECT_EQ(blk->ncell(), expected->ncell());
+        EXPECT_EQ(blk->nbound(), expected->nbound());
+        EXPECT_EQ(blk->ngstcell(), expected->ngstcell());
+        for (int32_t ind = 0; ind < static_cast<int32_t>(blk->nnode()); ++ind)
+        {
+            EXPECT_EQ(blk->ndcrd(ind, 0), expected->ndcrd(ind, 0));
+            EXPECT_EQ(blk->ndcrd(ind, 1), expected->ndcrd(ind, 1));
+        }
+        expect_same_array(blk->cltpn(), expected->cltpn(), "cltpn");
+        for (int32_t icl = -static_cast<int32_t>(blk->ngstcell()); icl < static_cast<int32_t>(blk->ncell()); ++icl)
+        {
+            for (int32_t j = 0; j <= blk->clnds(icl, 0); ++j)
+            {
+                EXPECT_EQ(blk->clnds(icl, j), expected->clnds(icl, j)) << "icl " << icl;
+            }
+        }
+        expect_same_array(blk->fcnds(), expected->fcnds(), "fcnds");
+        expect_same_array(blk->fccls(), expected->fccls(), "fccls");
+        expect_same_array(blk->clvol(), expected->clvol(), "clvol");
+    }
+}
+
+TEST(GmshStream, v41_ascii_and_binary)
+{
+    using namespace solvcon;
+    auto const expected = make_gmsh_stream(gmsh22_square, inout::GmshStream::DEFAULT_CHUNK_SIZE);
+
+    std::string const ascii = make_gmsh41_square(false);
+    std::string const binary = make_gmsh41_square(true);
+    for (size_t chunk_size : {size_t(1), size_t(5), inout::GmshStream::DEFAULT_CHUNK_SIZE})
+    {
+        auto const from_ascii = make_gmsh_stream(ascii, chunk_size);
+        EXPECT_EQ(from_ascii->version(), "4.1");
+        EXPECT_FALSE(from_ascii->is_binary());
+        expect_same_gmsh(*from_ascii, *expected);
+
+        auto const from_binary = make_gmsh_stream(binary, chunk_size);
+        EXPECT_TRUE(from_binary->is_binary());
+        expect_same_gmsh(*from_binary, *expected);
+    }
+
+    // Read from a file path.
+    std::string const path = snapshot_path("solvcon_gmsh_stream.msh");
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << binary;
+    }
+    inout::GmshStream const from_file(path);
+    expect_same_gmsh(from_file, *expected);
+    EXPECT_EQ(from_file.to_block()->ncell(), 4);
+    std::filesystem::remove(path);
+    EXPECT_THROW(inout::GmshStream{path}, std::runtime_error);
+}
+
+TEST(GmshStream, errors)
+{
+    using namespace solvcon;
+    auto const replaced = [](std::string data, std::string const & from, std::string const & to)
+    {
+        data.replace(data.find(from), from.size(), to);
+        return data;
+    };
+    size_t const chunk_size = inout::GmshStream::DEFAULT_CHUNK_SIZE;
+    EXPECT_THROW(make_gmsh_stream(replaced(gmsh22_square, "2.2 0 8", "3.0 0 8"), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(replaced(gmsh22_square, "2.2 0 8", "2.2 1 8"), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(replaced(gmsh22_square, "5 0.5 0.5 0", "5 0.5 x 0"), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(replaced(gmsh22_square, "8 2 2 2 1 4 1 5", "8 2 2 2 1 4 1 6"), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(replaced(gmsh22_square, "8 2 2 2 1", "8 99 2 2 1"), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(gmsh22_square.substr(0, gmsh22_square.find("$Elements")), chunk_size), std::invalid_argument);
+    EXPECT_THROW(make_gmsh_stream(gmsh22_square.substr(gmsh22_square.find("$Nodes")), chunk_size), std::invalid_argument);
+
+    std::string const binary = make_gmsh41_square(true);
+    EXPECT_THROW(make_gmsh_stream(binary.substr(0, binary.size() - 40), chunk_size), std::invalid_argument);
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
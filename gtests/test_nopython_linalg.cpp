@@ -0,0 +1,633 @@
+#include <solvcon/solvcon.hpp>
+#include <solvcon/linalg/linalg.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+using shape_type = solvcon::small_vector<ssize_t>;
+
+// Constant-acceleration track sampled at dt, with position and velocity
+// measurements.
+template <typename T>
+struct TrackerModel
+{
+    using array_type = solvcon::SimpleArray<T>;
+
+    explicit TrackerModel(double dt)
+        : f(array_type::eye(3))
+        , b(shape_type{3, 1}, T(0))
+        , h(shape_type{2, 3}, T(0))
+        , q(array_type::scaled_eye(3, T(1.e-4)))
+        , r(array_type::scaled_eye(2, T(0.25)))
+        , p(array_type::scaled_eye(3, T(10)))
+    {
+        f(0, 1) = T(dt);
+        f(0, 2) = T(0.5 * dt * dt);
+        f(1, 2) = T(dt);
+        b(2, 0) = T(dt);
+        h(0, 0) = T(1);
+        h(1, 1) = T(1);
+        q(2, 2) = T(1.e-2);
+        r(1, 1) = T(0.04);
+    }
+
+    array_type f;
+    array_type b;
+    array_type h;
+    array_type q;
+    array_type r;
+    array_type p;
+}; /* end struct TrackerModel */
+
+template <typename T>
+solvcon::KalmanFilter<T> make_tracker(double dt, solvcon::SimpleArray<T> const & x)
+{
+    TrackerModel<T> const model(dt);
+    // No jitter, so that the modes solve the same equations.
+    return solvcon::KalmanFilter<T>(x, model.f, model.b, model.h, model.q, model.r, model.p, 0.0);
+}
+
+template <typename T>
+solvcon::KalmanFilter<T> make_tracker(double dt)
+{
+    return make_tracker<T>(dt, solvcon::SimpleArray<T>(shape_type{3}, T(0)));
+}
+
+// Initial state of track t in a bank.
+template <typename T>
+solvcon::SimpleArray<T> make_track_state(ssize_t t)
+{
+    solvcon::SimpleArray<T> x(shape_type{3});
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        x(i) = T(0.5 * static_cast<double>(t - (i * 3)));
+    }
+    return x;
+}
+
+template <typename T>
+solvcon::KalmanFilterBank<T> make_tracker_bank(ssize_t ntrack, double dt)
+{
+    TrackerModel<T> const model(dt);
+    solvcon::SimpleArray<T> x(shape_type{ntrack, 3});
+    for (ssize_t t = 0; t < ntrack; ++t)
+    {
+        solvcon::SimpleArray<T> const xt = make_track_state<T>(t);
+        for (ssize_t i = 0; i < 3; ++i)
+        {
+            x(t, i) = xt(i);
+        }
+    }
+    return solvcon::KalmanFilterBank<T>(x, model.f, model.b, model.h, model.q, model.r, model.p, 0.0);
+}
+
+template <typename T>
+solvcon::SimpleArray<T> make_measurements(ssize_t nstep, double dt, unsigned seed)
+{
+    std::mt19937 rng{seed};
+    std::normal_distribution<double> noise{0.0, 0.3};
+    solvcon::SimpleArray<T> zs(shape_type{nstep, 2});
+    for (ssize_t i = 0; i < nstep; ++i)
+    {
+        double const t = static_cast<double>(i) * dt;
+        zs(i, 0) = T((3.0 * std::sin(t)) + noise(rng));
+        zs(i, 1) = T((3.0 * std::cos(t)) + noise(rng));
+    }
+    return zs;
+}
+
+template <typename T>
+void expect_near_array(solvcon::SimpleArray<T> const & a, solvcon::SimpleArray<T> const & b, double tol)
+{
+    ASSERT_EQ(a.shape(), b.shape());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_NEAR(solvcon::abs(a.data(i) - b.data(i)), 0.0, tol) << "at " << i;
+    }
+}
+
+template <typename T>
+solvcon::SimpleArray<T> make_random_matrices(shape_type const & shape, unsigned seed)
+{
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    solvcon::SimpleArray<T> a(shape);
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if constexpr (solvcon::is_complex_v<T>)
+        {
+            double const re = dist(rng);
+            a.data(i) = T(re, dist(rng));
+        }
+        else
+        {
+            a.data(i) = T(dist(rng));
+        }
+    }
+    return a;
+}
+
+// Max |P A - L U| of a row-major n-by-n factorization.
+template <typename T>
+double lu_residual(T const * a, T const * lu, int64_t const * piv, ssize_t n)
+{
+    std::vector<T> pa(a, a + (n * n));
+    for (ssize_t k = 0; k < n; ++k)
+    {
+        if (piv[k] != k)
+        {
+            std::swap_ranges(pa.begin() + (k * n), pa.begin() + ((k + 1) * n), pa.begin() + (piv[k] * n));
+        }
+    }
+    double residual = 0.0;
+    for (ssize_t i = 0; i < n; ++i)
+    {
+        for (ssize_t j = 0; j < n; ++j)
+        {
+            T sum{0};
+            for (ssize_t k = 0; k <= std::min(i, j); ++k)
+            {
+                T const l = k == i ? T{1} : lu[(i * n) + k];
+                sum += l * lu[(k * n) + j];
+            }
+            residual = std::max(residual, static_cast<double>(solvcon::abs(pa[(i * n) + j] - sum)));
+        }
+    }
+    return residual;
+}
+
+} /* end namespace */
+
+TEST(LuFactorization, strided)
+{
+    using namespace solvcon;
+
+    // Transposed views must be read by index rather than in buffer order.
+    SimpleArray<double> a(shape_type{3, 3});
+    SimpleArray<double> b(shape_type{3, 2});
+    double const avalues[] = {4.0, 1.0, 2.0, 0.5, 3.0, 1.0, 1.0, 2.0, 5.0};
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a.data(i) = avalues[i];
+    }
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+        b.data(i) = static_cast<double>(i + 1);
+    }
+    SimpleArray<double> const at = a.hermitian();
+    SimpleArray<double> const bt = SimpleArray<double>(b.hermitian()).hermitian();
+    LuFactorization<double> const lu(at);
+    SimpleArray<double> const x = lu.solve(b);
+    expect_near_array(at.matmul(x), b, 1.e-12);
+    SimpleArray<double> const xt = lu.solve(bt);
+    expect_near_array(at.matmul(xt), b, 1.e-12);
+}
+
+TEST(LuFactorization, blocked)
+{
+    using namespace solvcon;
+
+    // Narrow panels exercise full and partial trailing updates on small
+    // matrices.  The blocked and unblocked algorithms pick the same pivots.
+    for (ssize_t const n : {16, 17, 64, 101})
+    {
+        SimpleArray<double> const a = make_random_matrices<double>(shape_type{n, n}, static_cast<unsigned>(n));
+        SimpleArray<double> blocked = a;
+        SimpleArray<double> unblocked = a;
+        SimpleArray<int64_t> blocked_piv(shape_type{n});
+        SimpleArray<int64_t> unblocked_piv(shape_type{n});
+        ASSERT_EQ(detail::lu_factorize_blocked(blocked.data(), n, 16, blocked_piv.data(), nullptr), -1);
+        ASSERT_EQ(detail::lu_factorize_panel(unblocked.data(), n, 0, n, unblocked_piv.data()), -1);
+        for (ssize_t k = 0; k < n; ++k)
+        {
+            EXPECT_EQ(blocked_piv(k), unblocked_piv(k)) << "n = " << n << ", k = " << k;
+        }
+        expect_near_array(blocked, unblocked, 1.e-11);
+        EXPECT_LT(lu_residual(a.data(), blocked.data(), blocked_piv.data(), n), 1.e-12) << "n = " << n;
+    }
+
+    // LuFactorization takes the blocked path from BLOCKED_MIN_SIZE.
+    constexpr ssize_t n = LuFactorization<double>::BLOCKED_MIN_SIZE + 45;
+    SimpleArray<double> const a = make_random_matrices<double>(shape_type{n, n}, 1);
+    LuFactorization<double> const lu(a);
+    EXPECT_LT(lu_residual(a.data(), lu.lu().data(), lu.piv().data(), n), 1.e-12);
+    SimpleArray<double> const b = make_random_matrices<double>(shape_type{n, 3}, 2);
+    expect_near_array(a.matmul(lu.solve(b)), b, 1.e-9);
+
+    using cplx = Complex<double>;
+    SimpleArray<cplx> const ca = make_random_matrices<cplx>(shape_type{n, n}, 3);
+    LuFactorization<cplx> const clu(ca);
+    EXPECT_LT(lu_residual(ca.data(), clu.lu().data(), clu.piv().data(), n), 1.e-12);
+
+    // A singular trailing block is detected past the first panel.
+    SimpleArray<double> singular = a;
+    for (ssize_t j = 0; j < n; ++j)
+    {
+        singular(n - 10, j) = 0.0;
+    }
+    EXPECT_THROW(LuFactorization<double>{singular}, std::runtime_error);
+}
+
+TEST(LuFactorizationBatch, matches_single)
+{
+    using namespace solvcon;
+
+    for (ssize_t const n : {1, 2, 3, 5, 8, 9, 17})
+    {
+        constexpr ssize_t nbatch = 37;
+        SimpleArray<double> const a = make_random_matrices<double>(shape_type{nbatch, n, n}, static_cast<unsigned>(n));
+        SimpleArray<double> const b = make_random_matrices<double>(shape_type{nbatch, n}, 5);
+        SimpleArray<double> const b3 = make_random_matrices<double>(shape_type{nbatch, n, 2}, 6);
+        LuFactorizationBatch<double> const batch(a);
+        ASSERT_EQ(batch.nbatch(), nbatch);
+        ASSERT_EQ(batch.n(), n);
+        ASSERT_EQ(batch.lu().shape(), (shape_type{nbatch, n, n}));
+        ASSERT_EQ(batch.piv().shape(), (shape_type{nbatch, n}));
+
+        SimpleArray<double> const x = batch.solve(b);
+        SimpleArray<double> const x3 = batch.solve(b3);
+        SimpleArray<double> const inv = batch.inv();
+        SimpleArray<double> const det = batch.det();
+        ASSERT_EQ(x.shape(), b.shape());
+        ASSERT_EQ(x3.shape(), b3.shape());
+        for (ssize_t ib = 0; ib < nbatch; ++ib)
+        {
+            SimpleArray<double> ai(shape_type{n, n});
+            SimpleArray<double> bi(shape_type{n});
+            SimpleArray<double> b3i(shape_type{n, 2});
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                bi(i) = b(ib, i);
+                b3i(i, 0) = b3(ib, i, 0);
+                b3i(i, 1) = b3(ib, i, 1);
+                for (ssize_t j = 0; j < n; ++j)
+                {
+                    ai(i, j) = a(ib, i, j);
+                }
+            }
+            LuFactorization<double> const single(ai);
+            SimpleArray<double> const xi = single.solve(bi);
+            SimpleArray<double> const x3i = single.solve(b3i);
+            SimpleArray<double> const invi = single.inv();
+            EXPECT_NEAR(det(ib), single.det(), 1.e-12 * std::max(1.0, std::abs(single.det())));
+            for (ssize_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(batch.piv()(ib, i), single.piv()(i));
+                EXPECT_NEAR(x(ib, i), xi(i), 1.e-10);
+                EXPECT_NEAR(x3(ib, i, 1), x3i(i, 1), 1.e-10);
+                for (ssize_t j = 0; j < n; ++j)
+                {
+                    EXPECT_NEAR(batch.lu()(ib, i, j), single.lu()(i, j), 1.e-13);
+                    EXPECT_NEAR(inv(ib, i, j), invi(i, j), 1.e-9);
+                }
+            }
+        }
+    }
+
+    // The complex instantiation solves the same systems.
+    using cplx = Complex<double>;
+    SimpleArray<cplx> const ca = make_random_matrices<cplx>(shape_type{11, 5, 5}, 7);
+    SimpleArray<cplx> const cb = make_random_matrices<cplx>(shape_type{11, 5}, 8);
+    SimpleArray<cplx> const cx = LuFactorizationBatch<cplx>(ca).solve(cb);
+    for (ssize_t ib = 0; ib < 11; ++ib)
+    {
+        for (ssize_t i = 0; i < 5; ++i)
+        {
+            cplx sum{0};
+            for (ssize_t j = 0; j < 5; ++j)
+            {
+                sum += ca(ib, i, j) * cx(ib, j);
+            }
+            EXPECT_NEAR(abs(sum - cb(ib, i)), 0.0, 1.e-12);
+        }
+    }
+}
+
+TEST(LuFactorizationBatch, threads)
+{
+    using namespace solvcon;
+
+    // The batch is split over the matmul threads; the result does not
+    // depend on the thread count.
+    constexpr ssize_t nbatch = 4000;
+    SimpleArray<double> const a = make_random_matrices<double>(shape_type{nbatch, 5, 5}, 9);
+    SimpleArray<double> const b = make_random_matrices<double>(shape_type{nbatch, 5}, 10);
+    size_t const saved = matmul_nthread();
+    set_matmul_nthread(1);
+    SimpleArray<double> const serial = LuFactorizationBatch<double>(a).solve(b);
+    set_matmul_nthread(4);
+    LuFactorizationBatch<double> const batch(a);
+    SimpleArray<double> const threaded = batch.solve(b);
+    expect_near_array(serial, threaded, 0.0);
+
+    // The lowest singular matrix is reported.
+    SimpleArray<double> singular = a;
+    for (ssize_t const ib : {ssize_t(3999), ssize_t(2500), ssize_t(1200)})
+    {
+        for (ssize_t j = 0; j < 5; ++j)
+        {
+            singular(ib, 4, j) = 0.0;
+        }
+    }
+    try
+    {
+        LuFactorizationBatch<double> const failed(singular);
+        ADD_FAILURE() << "singular batch not rejected";
+    }
+    catch (std::runtime_error const & e)
+    {
+        EXPECT_NE(std::string(e.what()).find("at index 1200"), std::string::npos) << e.what();
+    }
+    set_matmul_nthread(saved);
+}
+
+TEST(LuFactorizationBatch, data_offset)
+{
+    using namespace solvcon;
+
+    // Dense inputs that do not start at the beginning of their buffers.  The
+    // leading elements are filled with values that are not part of the views.
+    constexpr ssize_t nbatch = 6;
+    constexpr ssize_t n = 4;
+    constexpr ssize_t pad = 7;
+    SimpleArray<double> const a = make_random_matrices<double>(shape_type{nbatch, n, n}, 12);
+    SimpleArray<double> const b = make_random_matrices<double>(shape_type{nbatch, n}, 13);
+
+    auto abuf = ConcreteBuffer::construct((pad + a.size()) * sizeof(double));
+    std::fill_n(abuf->data<double>(), pad, 1.e3);
+    SimpleArray<double> aview(a.shape(), abuf, pad * sizeof(double));
+    std::copy_n(a.data(), a.size(), aview.logical_data());
+    auto bbuf = ConcreteBuffer::construct((pad + b.size()) * sizeof(double));
+    std::fill_n(bbuf->data<double>(), pad, -1.e3);
+    SimpleArray<double> bview(b.shape(), bbuf, pad * sizeof(double));
+    std::copy_n(b.data(), b.size(), bview.logical_data());
+    ASSERT_TRUE(aview.is_c_contiguous());
+    ASSERT_TRUE(bview.is_c_contiguous());
+
+    LuFactorizationBatch<double> const batch(a);
+    LuFactorizationBatch<double> const offset_batch(aview);
+    expect_near_array(offset_batch.lu(), batch.lu(), 0.0);
+    expect_near_array(offset_batch.solve(bview), batch.solve(b), 0.0);
+}
+
+TEST(LuFactorizationBatch, errors)
+{
+    using namespace solvcon;
+
+    EXPECT_THROW(LuFactorizationBatch<double>(SimpleArray<double>(shape_type{3, 3})), std::invalid_argument);
+    EXPECT_THROW(LuFactorizationBatch<double>(SimpleArray<double>(shape_type{2, 3, 4})), std::invalid_argument);
+    SimpleArray<double> const a = make_random_matrices<double>(shape_type{4, 3, 3}, 11);
+    LuFactorizationBatch<double> const batch(a);
+    EXPECT_THROW(batch.solve(SimpleArray<double>(shape_type{3, 3})), std::invalid_argument);
+    EXPECT_THROW(batch.solve(SimpleArray<double>(shape_type{4, 2})), std::invalid_argument);
+    EXPECT_THROW(batch.solve(SimpleArray<double>(shape_type{4})), std::invalid_argument);
+}
+
+TEST(KalmanFilter, square_root)
+{
+    using namespace solvcon;
+
+    constexpr double dt = 1.e-3;
+    auto const zs = make_measurements<double>(500, dt, 1);
+    SimpleArray<double> us(shape_type{500, 1}, 0.5);
+
+    auto standard = make_tracker<double>(dt);
+    auto square_root = make_tracker<double>(dt);
+    auto const expected = standard.batch_filter(zs, us);
+    auto const result = square_root.batch_filter(zs, us, KalmanBatchMode::SQUARE_ROOT);
+    expect_near_array(expected.prior_states, result.prior_states, 1.e-9);
+    expect_near_array(expected.posterior_states, result.posterior_states, 1.e-9);
+    expect_near_array(expected.prior_states_covariance, result.prior_states_covariance, 1.e-9);
+    expect_near_array(expected.posterior_states_covariance, result.posterior_states_covariance, 1.e-9);
+    expect_near_array(standard.state(), square_root.state(), 1.e-9);
+    expect_near_array(standard.covariance(), square_root.covariance(), 1.e-9);
+
+    // The complex filter runs the same recursion with Hermitian transposes.
+    using cplx = Complex<double>;
+    auto const czs = make_measurements<cplx>(200, dt, 2);
+    auto cstandard = make_tracker<cplx>(dt);
+    auto csquare_root = make_tracker<cplx>(dt);
+    auto const cexpected = cstandard.batch_filter(czs);
+    auto const cresult = csquare_root.batch_filter(czs, KalmanBatchMode::SQUARE_ROOT);
+    expect_near_array(cexpected.posterior_states, cresult.posterior_states, 1.e-9);
+    expect_near_array(cexpected.posterior_states_covariance, cresult.posterior_states_covariance, 1.e-9);
+}
+
+TEST(KalmanFilter, steady_state)
+{
+    using namespace solvcon;
+
+    constexpr double dt = 1.e-3;
+    auto kf = make_tracker<double>(dt);
+    SimpleArray<double> const p = kf.steady_state_covariance();
+    SimpleArray<double> const k = kf.steady_state_gain();
+
+    ASSERT_EQ(p.shape(), (shape_type{3, 3}));
+    ASSERT_EQ(k.shape(), (shape_type{3, 2}));
+
+    // The standard recursion converges to the DARE solution.
+    auto const zs = make_measurements<double>(20000, dt, 3);
+    auto standard = make_tracker<double>(dt);
+    auto const expected = standard.batch_filter(zs);
+    ssize_t const last = zs.shape(0) - 1;
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        for (ssize_t j = 0; j < 3; ++j)
+        {
+            EXPECT_NEAR(expected.prior_states_covariance(last, i, j), p(i, j), 1.e-8 * std::abs(p(i, i)));
+        }
+    }
+
+    // After the transient, the steady-state filter tracks the standard one.
+    auto steady = make_tracker<double>(dt);
+    auto const result = steady.batch_filter(zs, KalmanBatchMode::STEADY_STATE);
+    for (ssize_t i = 0; i < 3; ++i)
+    {
+        EXPECT_NEAR(result.posterior_states(last, i), expected.posterior_states(last, i), 1.e-6);
+        EXPECT_EQ(result.prior_states_covariance(0, i, i), p(i, i));
+    }
+    EXPECT_NEAR(steady.state()(0), standard.state()(0), 1.e-6);
+}
+
+TEST(KalmanFilter, batch_mode_errors)
+{
+    using namespace solvcon;
+
+    EXPECT_EQ(kalman_batch_mode_from_string("steady_state"), KalmanBatchMode::STEADY_STATE);
+    EXPECT_THROW(kalman_batch_mode_from_string("fast"), std::invalid_argument);
+
+    auto kf = make_tracker<double>(1.e-3);
+    SimpleArray<double> const zs(shape_type{10, 3});
+    EXPECT_THROW(kf.batch_filter(zs, KalmanBatchMode::SQUARE_ROOT), std::invalid_argument);
+    SimpleArray<double> const us(shape_type{9, 1});
+    EXPECT_THROW(kf.batch_filter(SimpleArray<double>(shape_type{10, 2}), us, KalmanBatchMode::STEADY_STATE), std::invalid_argument);
+
+    // An unobservable unstable mode has no steady state.
+    SimpleArray<double> f = SimpleArray<double>::scaled_eye(2, 2.0);
+    SimpleArray<double> h(shape_type{1, 2}, 0.0);
+    h(0, 0) = 1.0;
+    KalmanFilter<double> diverging(
+        SimpleArray<double>(shape_type{2}, 0.0),
+        f,
+        SimpleArray<double>(shape_type{2, 0}),
+        h,
+        1.0,
+        1.0,
+        1.e-9);
+    EXPECT_THROW(diverging.steady_state_covariance(), std::runtime_error);
+}
+
+TEST(KalmanFilterBank, matches_single_filters)
+{
+    using namespace solvcon;
+
+    constexpr double dt = 1.e-3;
+    constexpr ssize_t ntrack = 13;
+    constexpr ssize_t nstep = 200;
+    auto bank = make_tracker_bank<double>(ntrack, dt);
+    ASSERT_EQ(bank.ntrack(), ntrack);
+    ASSERT_EQ(bank.state_size(), 3);
+    ASSERT_EQ(bank.measurement_size(), 2);
+    ASSERT_EQ(bank.control_size(), 1);
+
+    std::vector<KalmanFilter<double>> filters;
+    std::vector<SimpleArray<double>> zs;
+    for (ssize_t t = 0; t < ntrack; ++t)
+    {
+        filters.push_back(make_tracker<double>(dt, make_track_state<double>(t)));
+        zs.push_back(make_measurements<double>(nstep, dt, static_cast<unsigned>(t + 10)));
+    }
+
+    SimpleArray<double> z(shape_type{ntrack, 2});
+    SimpleArray<double> u(shape_type{ntrack, 1});
+    for (ssize_t step = 0; step < nstep; ++step)
+    {
+        bool const with_control = (step % 2) == 0;
+        for (ssize_t t = 0; t < ntrack; ++t)
+        {
+            u(t, 0) = 0.1 * static_cast<double>(t);
+            z(t, 0) = zs[t](step, 0);
+            z(t, 1) = zs[t](step, 1);
+            if (with_control)
+            {
+                filters[t].predict(SimpleArray<double>(shape_type{1}, u(t, 0)));
+            }
+            else
+            {
+                filters[t].predict();
+            }
+            SimpleArray<double> zt(shape_type{2});
+            zt(0) = z(t, 0);
+            zt(1) = z(t, 1);
+            filters[t].update(zt);
+        }
+        if (with_control)
+        {
+            bank.predict(u);
+        }
+        else
+        {
+            bank.predict();
+        }
+        bank.update(z);
+    }
+
+    SimpleArray<double> const states = bank.states();
+    SimpleArray<double> const covariances = bank.covariances();
+    for (ssize_t t = 0; t < ntrack; ++t)
+    {
+        expect_near_array(bank.state(t), filters[t].state(), 1.e-10);
+        expect_near_array(bank.covariance(t), filters[t].covariance(), 1.e-10);
+        for (ssize_t i = 0; i < 3; ++i)
+        {
+            EXPECT_EQ(states(t, i), bank.state(t)(i));
+            EXPECT_EQ(covariances(t, i, i), bank.covariance(t)(i, i));
+        }
+    }
+
+    // Restarting a track restarts only that track.
+    SimpleArray<double> const p0 = SimpleArray<double>::scaled_eye(3, 10.0);
+    bank.set_track(4, make_track_state<double>(4), p0);
+    expect_near_array(bank.state(4), make_track_state<double>(4), 0.0);
+    expect_near_array(bank.covariance(4), p0, 0.0);
+    expect_near_array(bank.state(5), filters[5].state(), 1.e-10);
+}
+
+TEST(KalmanFilterBank, complex)
+{
+    using namespace solvcon;
+    using cplx = Complex<double>;
+
+    constexpr double dt = 1.e-3;
+    constexpr ssize_t ntrack = 5;
+    constexpr ssize_t nstep = 50;
+    auto bank = make_tracker_bank<cplx>(ntrack, dt);
+    std::vector<KalmanFilter<cplx>> filters;
+    for (ssize_t t = 0; t < ntrack; ++t)
+    {
+        filters.push_back(make_tracker<cplx>(dt, make_track_state<cplx>(t)));
+    }
+    auto const zs = make_measurements<cplx>(nstep, dt, 5);
+    SimpleArray<cplx> z(shape_type{ntrack, 2});
+    for (ssize_t step = 0; step < nstep; ++step)
+    {
+        for (ssize_t t = 0; t < ntrack; ++t)
+        {
+            SimpleArray<cplx> zt(shape_type{2});
+            zt(0) = zs(step, 0) * cplx(1.0, 0.1 * static_cast<double>(t));
+            zt(1) = zs(step, 1);
+            z(t, 0) = zt(0);
+            z(t, 1) = zt(1);
+            filters[t].predict();
+            filters[t].update(zt);
+        }
+        bank.predict();
+        bank.update(z);
+    }
+    for (ssize_t t = 0; t < ntrack; ++t)
+    {
+        expect_near_array(bank.state(t), filters[t].state(), 1.e-10);
+        expect_near_array(bank.covariance(t), filters[t].covariance(), 1.e-10);
+    }
+}
+
+TEST(KalmanFilterBank, errors)
+{
+    using namespace solvcon;
+
+    TrackerModel<double> const model(1.e-3);
+    SimpleArray<double> const x(shape_type{4, 3}, 0.0);
+    EXPECT_THROW(
+        KalmanFilterBank<double>(SimpleArray<double>(shape_type{3}), model.f, model.b, model.h, model.q, model.r, model.p, 0.0),
+        std::invalid_argument);
+    EXPECT_THROW(
+        KalmanFilterBank<double>(x, model.f, model.b, model.h, model.q, model.r, SimpleArray<double>(shape_type{3, 3, 3}), 0.0),
+        std::invalid_argument);
+    EXPECT_THROW(
+        KalmanFilterBank<double>(x, model.f, model.b, model.h, model.q, model.q, model.p, 0.0),
+        std::invalid_argument);
+
+    KalmanFilterBank<double> bank(x, model.f, SimpleArray<double>(shape_type{3, 0}), model.h, 0.1, 0.5, 0.0);
+    EXPECT_THROW(bank.predict(SimpleArray<double>(shape_type{4, 1})), std::invalid_argument);
+    EXPECT_THROW(bank.update(SimpleArray<double>(shape_type{3, 2})), std::invalid_argument);
+    EXPECT_THROW(bank.state(4), std::out_of_range);
+    EXPECT_THROW(bank.set_track(0, SimpleArray<double>(shape_type{2}), model.p), std::invalid_argument);
+
+    // A track whose measurement is certain and whose state is known cannot
+    // be updated.
+    SimpleArray<double> const zero(shape_type{3, 3}, 0.0);
+    KalmanFilterBank<double> singular(x, model.f, SimpleArray<double>(shape_type{3, 0}), model.h, zero, SimpleArray<double>(shape_type{2, 2}, 0.0), zero, 0.0);
+    singular.predict();
+    EXPECT_THROW(singular.update(SimpleArray<double>(shape_type{4, 2}, 0.0)), std::runtime_error);
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
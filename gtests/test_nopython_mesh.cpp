@@ -0,0 +1,185 @@
+#include <solvcon/mesh/mesh.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+using namespace solvcon;
+
+namespace
+{
+
+using uint_type = StaticMesh::uint_type;
+
+struct CellDef
+{
+    int32_t tpn;
+    std::vector<int32_t> nds;
+}; /* end struct CellDef */
+
+// An n-by-n-by-n box of unit cubes cut, in turn, into a hexahedron, two
+// prisms, or six tetrahedra, with the cells shuffled.
+std::shared_ptr<StaticMesh> make_mixed_box(int32_t n, uint32_t seed)
+{
+    auto id = [n](int32_t i, int32_t j, int32_t k)
+    { return (((k * (n + 1)) + j) * (n + 1)) + i; };
+    std::vector<CellDef> cells;
+    for (int32_t k = 0; k < n; ++k)
+    {
+        for (int32_t j = 0; j < n; ++j)
+        {
+            for (int32_t i = 0; i < n; ++i)
+            {
+                int32_t const a = id(i, j, k);
+                int32_t const b = id(i + 1, j, k);
+                int32_t const c = id(i + 1, j + 1, k);
+                int32_t const d = id(i, j + 1, k);
+                int32_t const e = id(i, j, k + 1);
+                int32_t const f = id(i + 1, j, k + 1);
+                int32_t const g = id(i + 1, j + 1, k + 1);
+                int32_t const h = id(i, j + 1, k + 1);
+                switch ((i + j + k) % 3)
+                {
+                case 0:
+                    cells.push_back({CellType::HEXAHEDRON, {a, b, c, d, e, f, g, h}});
+                    break;
+                case 1:
+                    cells.push_back({CellType::PRISM, {a, b, c, e, f, g}});
+                    cells.push_back({CellType::PRISM, {a, c, d, e, g, h}});
+                    break;
+                default:
+                    cells.push_back({CellType::TETRAHEDRON, {a, b, c, g}});
+                    cells.push_back({CellType::TETRAHEDRON, {a, c, d, g}});
+                    cells.push_back({CellType::TETRAHEDRON, {a, d, h, g}});
+                    cells.push_back({CellType::TETRAHEDRON, {a, h, e, g}});
+                    cells.push_back({CellType::TETRAHEDRON, {a, e, f, g}});
+                    cells.push_back({CellType::TETRAHEDRON, {a, f, b, g}});
+                    break;
+                }
+            }
+        }
+    }
+    std::shuffle(cells.begin(), cells.end(), std::mt19937(seed));
+
+    auto mh = StaticMesh::construct(3, static_cast<uint_type>(id(n, n, n) + 1), uint_type(0), static_cast<uint_type>(cells.size()));
+    for (int32_t k = 0; k <= n; ++k)
+    {
+        for (int32_t j = 0; j <= n; ++j)
+        {
+            for (int32_t i = 0; i <= n; ++i)
+            {
+                mh->ndcrd(id(i, j, k), 0) = i;
+                mh->ndcrd(id(i, j, k), 1) = j;
+                mh->ndcrd(id(i, j, k), 2) = k;
+            }
+        }
+    }
+    for (size_t icl = 0; icl < cells.size(); ++icl)
+    {
+        mh->cltpn(icl) = cells[icl].tpn;
+        mh->clnds(icl, 0) = static_cast<int32_t>(cells[icl].nds.size());
+        std::copy(cells[icl].nds.begin(), cells[icl].nds.end(), mh->clnds().vptr(icl, 1));
+    }
+    return mh;
+}
+
+template <typename T>
+bool same_array(SimpleArray<T> const & a, SimpleArray<T> const & b)
+{
+    return a.shape() == b.shape() && std::memcmp(a.data(), b.data(), a.nbytes()) == 0;
+}
+
+void expect_same_connectivity(StaticMesh const & a, StaticMesh const & b)
+{
+    EXPECT_EQ(a.nface(), b.nface());
+    EXPECT_EQ(a.nedge(), b.nedge());
+    EXPECT_TRUE(same_array(a.fctpn(), b.fctpn()));
+    EXPECT_TRUE(same_array(a.fcnds(), b.fcnds()));
+    EXPECT_TRUE(same_array(a.fccls(), b.fccls()));
+    EXPECT_TRUE(same_array(a.clfcs(), b.clfcs()));
+    EXPECT_TRUE(same_array(a.ednds(), b.ednds()));
+}
+
+} /* end namespace */
+
+TEST(StaticMesh, nthread)
+{
+    auto mh = make_mixed_box(1, 0);
+    EXPECT_EQ(mh->nthread(), 1);
+    mh->set_nthread(3);
+    EXPECT_EQ(mh->nthread(), 3);
+    mh->set_nthread(0);
+    EXPECT_EQ(mh->nthread(), ThreadPool::hardware_nthread());
+}
+
+TEST(StaticMesh, build_interior_square)
+{
+    // Two triangles sharing the diagonal of the unit square.
+    auto mh = StaticMesh::construct(2, uint_type(4), uint_type(0), uint_type(2));
+    double const crd[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    for (int32_t ind = 0; ind < 4; ++ind)
+    {
+        mh->ndcrd(ind, 0) = crd[ind][0];
+        mh->ndcrd(ind, 1) = crd[ind][1];
+    }
+    int32_t const nds[2][3] = {{0, 1, 2}, {0, 2, 3}};
+    for (int32_t icl = 0; icl < 2; ++icl)
+    {
+        mh->cltpn(icl) = CellType::TRIANGLE;
+        mh->clnds(icl, 0) = 3;
+        std::copy_n(nds[icl], 3, mh->clnds().vptr(icl, 1));
+    }
+    mh->set_nthread(2);
+    mh->build_interior(true);
+
+    EXPECT_EQ(mh->nface(), 5);
+    EXPECT_EQ(mh->nedge(), 5);
+    int32_t ninner = 0;
+    for (int32_t ifc = 0; ifc < 5; ++ifc)
+    {
+        EXPECT_EQ(mh->fctpn(ifc), CellType::LINE);
+        if (mh->fccls(ifc, 1) >= 0)
+        {
+            // The shared diagonal belongs to the first cell first.
+            ++ninner;
+            EXPECT_EQ(mh->fccls(ifc, 0), 0);
+            EXPECT_EQ(mh->fccls(ifc, 1), 1);
+        }
+    }
+    EXPECT_EQ(ninner, 1);
+    EXPECT_DOUBLE_EQ(mh->clvol(0) + mh->clvol(1), 1.0);
+}
+
+TEST(StaticMesh, build_interior_thread_independent)
+{
+    auto serial = make_mixed_box(6, 11);
+    serial->build_interior(true);
+    serial->build_boundary();
+    serial->build_ghost();
+
+    for (size_t nthread : {2, 3, 7})
+    {
+        auto mh = make_mixed_box(6, 11);
+        mh->set_nthread(nthread);
+        mh->build_interior(true);
+        mh->build_boundary();
+        mh->build_ghost();
+        expect_same_connectivity(*serial, *mh);
+        EXPECT_EQ(serial->nbound(), mh->nbound());
+        EXPECT_TRUE(same_array(serial->bndfcs(), mh->bndfcs())) << "nthread " << nthread;
+        EXPECT_TRUE(same_array(serial->fcnml(), mh->fcnml())) << "nthread " << nthread;
+        EXPECT_TRUE(same_array(serial->clvol(), mh->clvol())) << "nthread " << nthread;
+    }
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
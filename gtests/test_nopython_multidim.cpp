@@ -3,9 +3,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <memory>
+#include <random>
 #include <vector>
 
 #ifdef Py_PYTHON_H
@@ -77,6 +79,65 @@ std::shared_ptr<StaticMesh> make_mixed()
         {{4, 0, 1, 4, 3}, {3, 1, 2, 4, 0}, {3, 2, 5, 4, 0}});
 }
 
+// Structured nx-by-ny quadrilateral grid over the unit square.  A nonzero
+// seed shuffles the cells.
+std::shared_ptr<StaticMesh> make_quad_grid(int32_t nx, int32_t ny, uint32_t seed = 0)
+{
+    std::vector<std::array<double, 3>> coords;
+    for (int32_t j = 0; j <= ny; ++j)
+    {
+        for (int32_t i = 0; i <= nx; ++i)
+        {
+            coords.push_back({static_cast<double>(i) / nx, static_cast<double>(j) / ny, 0});
+        }
+    }
+    auto nid = [nx](int32_t i, int32_t j)
+    {
+        return j * (nx + 1) + i;
+    };
+    std::vector<int32_t> cltpn;
+    std::vector<std::vector<int32_t>> clnds;
+    for (int32_t j = 0; j < ny; ++j)
+    {
+        for (int32_t i = 0; i < nx; ++i)
+        {
+            cltpn.push_back(CellType::QUADRILATERAL);
+            clnds.push_back({4, nid(i, j), nid(i + 1, j), nid(i + 1, j + 1), nid(i, j + 1)});
+        }
+    }
+    if (seed != 0)
+    {
+        std::mt19937 rng(seed);
+        std::shuffle(clnds.begin(), clnds.end(), rng);
+    }
+    return build_mesh(2, coords, cltpn, clnds);
+}
+
+// March a density bump on the grid with non-reflective boundaries.
+SimpleArray<double> march_bump(std::shared_ptr<StaticMesh> const & mh, size_t nthread)
+{
+    auto const ec = EulerCore::construct(mh, 0.005);
+    ec->set_nthread(nthread);
+    ec->init_solution(1.4, 1.0, {0.3, -0.1, 0}, 1.0);
+    SimpleArray<double> const & clcnd = mh->clcnd();
+    for (int32_t icl = 0; icl < ec->ncell(); ++icl)
+    {
+        double const dx = clcnd(icl, 0) - 0.5;
+        double const dy = clcnd(icl, 1) - 0.5;
+        ec->so0n()(icl, 0) += 0.2 * std::exp(-40.0 * (dx * dx + dy * dy));
+    }
+    std::vector<int32_t> faces;
+    for (size_t ibnd = 0; ibnd < mh->nbound(); ++ibnd)
+    {
+        faces.push_back(mh->bndfcs(static_cast<int32_t>(ibnd), 0));
+    }
+    ec->add_bc(EulerBC::NonReflective, faces, {});
+    ec->bc_soln();
+    ec->bc_dsoln();
+    ec->march(4);
+    return ec->so0n();
+}
+
 } /* end namespace */
 
 TEST(Multidim, ge_linalg_2d)
@@ -195,4 +256,130 @@ TEST(Multidim, solve_gradient_linear_field)
     }
 }
 
+TEST(Multidim, gradient_element_block)
+{
+    // The block solve must reproduce solve_gradient() bit for bit, on every
+    // lane and for every slot a lane owns.
+    using block_type = GradientElementBlock<2>;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<std::shared_ptr<StaticMesh>> const meshes = {
+        make_quad(), make_triangles(), make_mixed(), make_quad_grid(5, 4, 3)};
+    for (auto const & mh : meshes)
+    {
+        auto const ec = EulerCore::construct(mh, 0.01);
+        SimpleArray<double> const & cecnd = ec->cecnd();
+        auto const ncell = static_cast<int32_t>(mh->ncell());
+        auto block = std::make_unique<block_type>();
+        std::vector<GradientElement> gelems;
+        // Leave the last lane empty to exercise a partial block.
+        for (size_t lane = 0; lane + 1 < block_type::WIDTH; ++lane)
+        {
+            auto const icl = static_cast<int32_t>(lane) % ncell;
+            gelems.emplace_back(*mh, cecnd, icl, 0.5 + 0.1 * static_cast<double>(lane));
+            block->set(lane, gelems.back());
+        }
+        block->clear(block_type::WIDTH - 1);
+        for (size_t ifge = 0; ifge < block_type::NFGE_MAX; ++ifge)
+        {
+            block_type::vector_type udf{};
+            for (size_t d = 0; d < 2; ++d)
+            {
+                std::generate(udf[d].begin(), udf[d].end(), [&]()
+                              { return dist(rng); });
+            }
+            block_type::vector_type grad{};
+            block->solve(ifge, udf, grad);
+            for (size_t lane = 0; lane < gelems.size(); ++lane)
+            {
+                GradientElement const & ge = gelems[lane];
+                if (static_cast<int32_t>(ifge) >= ge.nfge())
+                {
+                    continue;
+                }
+                GradientElement::ge_vector_type const got = ge.solve_gradient(
+                    static_cast<int32_t>(ifge), {udf[0][lane], udf[1][lane], 0.0});
+                EXPECT_EQ(got[0], grad[0][lane]) << "lane " << lane << " ifge " << ifge;
+                EXPECT_EQ(got[1], grad[1][lane]) << "lane " << lane << " ifge " << ifge;
+            }
+            // Empty lanes and slots solve to finite zeros.
+            EXPECT_EQ(0.0, grad[0][block_type::WIDTH - 1]);
+        }
+    }
+}
+
+TEST(Multidim, euler_nthread)
+{
+    auto const mh = make_quad_grid(8, 6);
+    auto const ec = EulerCore::construct(mh, 0.01);
+    ec->set_nthread(3);
+    EXPECT_EQ(ec->nthread(), 3);
+    ec->set_nthread(1);
+    EXPECT_EQ(ec->nthread(), 1);
+    ec->set_nthread(0);
+    EXPECT_EQ(ec->nthread(), ThreadPool::hardware_nthread());
+}
+
+TEST(Multidim, euler_march_thread_independent)
+{
+    auto const mh = make_quad_grid(16, 12);
+    SimpleArray<double> const serial = march_bump(mh, 1);
+    for (double const v : serial)
+    {
+        ASSERT_TRUE(std::isfinite(v));
+    }
+    for (size_t nthread : {2, 3, 7})
+    {
+        SimpleArray<double> const threaded = march_bump(mh, nthread);
+        ASSERT_EQ(serial.size(), threaded.size());
+        for (size_t i = 0; i < serial.size(); ++i)
+        {
+            // The cells are partitioned, not reduced across threads, so the
+            // result is bit-identical.
+            EXPECT_EQ(serial.data(i), threaded.data(i)) << "nthread " << nthread << " index " << i;
+        }
+    }
+}
+
+TEST(Multidim, mesh_reorder_march)
+{
+    auto bandwidth = [](StaticMesh const & mh)
+    {
+        int32_t width = 0;
+        for (int32_t ifc = 0; ifc < static_cast<int32_t>(mh.nface()); ++ifc)
+        {
+            if (mh.fcjcl(ifc) >= 0)
+            {
+                width = std::max(width, std::abs(mh.fcicl(ifc) - mh.fcjcl(ifc)));
+            }
+        }
+        return width;
+    };
+
+    auto const shuffled = make_quad_grid(16, 12, 5);
+    SimpleArray<double> const ref = march_bump(shuffled, 1);
+    for (MeshOrdering const ordering : {MeshOrdering::RCM, MeshOrdering::HILBERT, MeshOrdering::MORTON})
+    {
+        auto const mh = make_quad_grid(16, 12, 5);
+        StaticMeshPermutation const perm = mh->reorder(ordering);
+        ASSERT_EQ(perm.cell.size(), mh->ncell());
+        ASSERT_EQ(perm.face.size(), mh->nface());
+        ASSERT_EQ(perm.node.size(), mh->nnode());
+        EXPECT_LT(bandwidth(*mh), bandwidth(*shuffled));
+
+        // The renumbered mesh marches to the permuted solution.
+        SimpleArray<double> const got = march_bump(mh, 1);
+        for (int32_t icl = 0; icl < static_cast<int32_t>(mh->ncell()); ++icl)
+        {
+            for (int32_t ieq = 0; ieq < 4; ++ieq)
+            {
+                EXPECT_DOUBLE_EQ(got(icl, ieq), ref(perm.cell(icl), ieq))
+                    << "ordering " << static_cast<int>(ordering) << " cell " << icl;
+            }
+        }
+    }
+    EXPECT_THROW(mesh_ordering_from_string("random"), std::invalid_argument);
+    EXPECT_EQ(mesh_ordering_from_string("hilbert"), MeshOrdering::HILBERT);
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
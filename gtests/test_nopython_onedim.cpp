@@ -0,0 +1,158 @@
+#include <solvcon/onedim/onedim.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+using namespace solvcon;
+using namespace solvcon::onedim;
+
+namespace
+{
+
+// A shock tube with a smooth disturbance on both sides, like the one set up by
+// solvcon.onedim.euler1d.ShockTube.  The variant changes the heat capacity
+// ratio and the state on the right.
+std::shared_ptr<Euler1DCore> make_core(size_t ncoord, size_t variant = 0)
+{
+    double const dx = 2.0 / static_cast<double>(ncoord - 1);
+    double const ratio = 1.0 + (0.1 * static_cast<double>(variant % 7));
+    auto svr = Euler1DCore::construct(ncoord, 0.4 * dx);
+    svr->cfl().fill(0.0);
+    svr->so1().fill(0.0);
+    svr->gamma().fill(1.4 - (0.01 * static_cast<double>(variant % 11)));
+    for (size_t it = 0; it < ncoord; ++it)
+    {
+        double const x = -1.0 + dx * static_cast<double>(it);
+        double const bump = 0.05 * std::sin(8 * std::numbers::pi * x);
+        double const density = (x < 0 ? 1.0 : 0.125 * ratio) + bump * 0.1;
+        double const pressure = (x < 0 ? 1.0 : 0.1 * ratio) + bump * 0.05;
+        svr->coord()(it) = x;
+        svr->so0()(it, 0) = density;
+        svr->so0()(it, 1) = 0.0;
+        svr->so0()(it, 2) = pressure / (svr->gamma()(it) - 1.0);
+    }
+    svr->setup_march();
+    return svr;
+}
+
+bool same_field(Euler1DCore const & a, Euler1DCore const & b)
+{
+    auto same = [](SimpleArray<double> const & x, SimpleArray<double> const & y)
+    { return x.shape() == y.shape() && std::memcmp(x.data(), y.data(), x.nbytes()) == 0; };
+    return same(a.so0(), b.so0()) && same(a.so1(), b.so1()) && same(a.cfl(), b.cfl());
+}
+
+// Put the variants from first on into a batch.
+std::shared_ptr<Euler1DBatch> make_batch(size_t ncoord, size_t nbatch, size_t first = 0)
+{
+    auto core = make_core(ncoord, first);
+    auto batch = Euler1DBatch::construct(ncoord, nbatch, core->time_increment());
+    for (size_t it = 0; it < ncoord; ++it)
+    {
+        batch->coord()(it) = core->coord()(it);
+    }
+    for (size_t ib = 0; ib < nbatch; ++ib)
+    {
+        batch->set_member(ib, *make_core(ncoord, first + ib));
+    }
+    return batch;
+}
+
+} /* end namespace */
+
+TEST(Euler1DCore, march_blocked)
+{
+    constexpr size_t ncoord = 1001;
+    constexpr size_t steps = 37;
+    auto ref = make_core(ncoord);
+    ref->march_alpha<2>(steps);
+
+    // Tiles narrower than the skew, tiles not dividing the grid, and a single
+    // tile covering everything.
+    for (auto const & [tile_size, tile_steps] : {std::tuple<size_t, size_t>{1, 1},
+                                                 {7, 3},
+                                                 {64, 8},
+                                                 {100, 37},
+                                                 {5000, 4}})
+    {
+        auto svr = make_core(ncoord);
+        svr->march_alpha_blocked<2>(steps, tile_size, tile_steps);
+        EXPECT_TRUE(same_field(*ref, *svr)) << "tile_size " << tile_size << " tile_steps " << tile_steps;
+    }
+
+    auto ref1 = make_core(ncoord);
+    ref1->march_alpha<1>(steps);
+    auto svr1 = make_core(ncoord);
+    svr1->march_alpha_blocked<1>(steps, 50, 5);
+    EXPECT_TRUE(same_field(*ref1, *svr1));
+
+    // A march of no step leaves everything untouched.
+    auto svr0 = make_core(ncoord);
+    svr0->march_alpha_blocked<2>(0);
+    EXPECT_TRUE(same_field(*make_core(ncoord), *svr0));
+
+    EXPECT_THROW(svr0->march_alpha_blocked<2>(1, 0, 1), std::invalid_argument);
+    EXPECT_THROW(svr0->march_alpha_blocked<2>(1, 16, 0), std::invalid_argument);
+}
+
+TEST(Euler1DBatch, construct)
+{
+    auto batch = Euler1DBatch::construct(11, 5, 0.1);
+    EXPECT_EQ(batch->ncoord(), 11);
+    EXPECT_EQ(batch->nbatch(), 5);
+    EXPECT_EQ(batch->so0().shape(), (small_vector<ssize_t>{11, 3, 5}));
+    EXPECT_EQ(batch->so1().shape(), (small_vector<ssize_t>{11, 3, 5}));
+    EXPECT_EQ(batch->cfl().shape(), (small_vector<ssize_t>{11, 5}));
+    EXPECT_EQ(batch->gamma().shape(), (small_vector<ssize_t>{11, 5}));
+    EXPECT_EQ(batch->gamma()(3, 4), 1.4);
+    EXPECT_EQ(batch->density().shape(), (small_vector<ssize_t>{11, 5}));
+
+    EXPECT_THROW(Euler1DBatch::construct(10, 5, 0.1), std::invalid_argument);
+    EXPECT_THROW(Euler1DBatch::construct(11, 0, 0.1), std::invalid_argument);
+    EXPECT_THROW(batch->set_member(5, *make_core(11)), std::out_of_range);
+    EXPECT_THROW(batch->set_member(0, *make_core(13)), std::invalid_argument);
+    EXPECT_THROW(batch->get_member(5), std::out_of_range);
+
+    // A member goes in and out unchanged.
+    auto core = make_core(11, 3);
+    auto batch2 = make_batch(11, 5);
+    batch2->set_member(2, *core);
+    EXPECT_TRUE(same_field(*core, *batch2->get_member(2)));
+    EXPECT_EQ(batch2->get_member(2)->coord()(4), core->coord()(4));
+    EXPECT_EQ(batch2->pressure()(4, 2), core->pressure(4));
+    EXPECT_EQ(batch2->velocity()(4, 2), core->velocity(4));
+}
+
+TEST(Euler1DBatch, march)
+{
+    // More members than BATCH_WIDTH to cover a partial group.
+    constexpr size_t ncoord = 201;
+    constexpr size_t nbatch = Euler1DBatch::BATCH_WIDTH + 9;
+    constexpr size_t steps = 60;
+    auto batch = make_batch(ncoord, nbatch);
+    batch->march_alpha<2>(steps);
+    auto batch1 = make_batch(ncoord, nbatch);
+    batch1->march_alpha<1>(steps);
+    for (size_t ib = 0; ib < nbatch; ++ib)
+    {
+        auto core = make_core(ncoord, ib);
+        core->march_alpha<2>(steps);
+        EXPECT_TRUE(same_field(*core, *batch->get_member(ib))) << "ib " << ib;
+        auto core1 = make_core(ncoord, ib);
+        core1->march_alpha<1>(steps);
+        EXPECT_TRUE(same_field(*core1, *batch1->get_member(ib))) << "ib " << ib;
+    }
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,142 @@
+#include <solvcon/parallel/parallel.hpp>
+#include <solvcon/toggle/toggle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+using namespace solvcon;
+
+TEST(ThreadPool, nthread)
+{
+    EXPECT_EQ(ThreadPool(1).nthread(), 1);
+    EXPECT_EQ(ThreadPool(4).nthread(), 4);
+    EXPECT_EQ(ThreadPool(0).nthread(), ThreadPool::hardware_nthread());
+    EXPECT_GE(ThreadPool::hardware_nthread(), 1);
+}
+
+TEST(ThreadPool, toggle_nthread)
+{
+    std::string const key = "parallel.gtest_toggle_nthread";
+    EXPECT_EQ(ThreadPool::toggle_nthread(key), 1);
+    Toggle::instance().set_int32(key, 3);
+    EXPECT_EQ(ThreadPool::toggle_nthread(key), 3);
+    Toggle::instance().set_int32(key, 0);
+    EXPECT_EQ(ThreadPool::toggle_nthread(key), ThreadPool::hardware_nthread());
+    Toggle::instance().set_int32(key, -2);
+    EXPECT_EQ(ThreadPool::toggle_nthread(key), ThreadPool::hardware_nthread());
+}
+
+TEST(ThreadPool, shared)
+{
+    std::shared_ptr<ThreadPool> const pool = ThreadPool::shared(3);
+    EXPECT_EQ(pool->nthread(), 3);
+    EXPECT_EQ(ThreadPool::shared(3), pool);
+    EXPECT_NE(ThreadPool::shared(2), pool);
+    EXPECT_EQ(ThreadPool::shared(0), ThreadPool::shared(ThreadPool::hardware_nthread()));
+}
+
+TEST(ThreadPool, partition_covers_range)
+{
+    ThreadPool pool(4);
+    for (int32_t count : {0, 1, 3, 4, 5, 17, 1000})
+    {
+        std::vector<int32_t> hit(static_cast<size_t>(count) + 10, 0);
+        std::atomic<int32_t> ncall = 0;
+        pool.parallel_for(
+            int32_t(-10),
+            count,
+            [&](int32_t first, int32_t last)
+            {
+                ++ncall;
+                for (int32_t i = first; i < last; ++i)
+                {
+                    ++hit[static_cast<size_t>(i + 10)];
+                }
+            });
+        for (int32_t const h : hit)
+        {
+            EXPECT_EQ(h, 1) << "count " << count;
+        }
+        EXPECT_LE(ncall.load(), 4);
+    }
+    // An empty range calls nothing.
+    pool.parallel_for(5, 5, [](int, int)
+                      { FAIL(); });
+}
+
+TEST(ThreadPool, static_assignment)
+{
+    // The same range always yields the same chunks.
+    ThreadPool pool(3);
+    std::vector<size_t> first(3, 0);
+    pool.run(3, [&](size_t ichunk)
+             { first[ichunk] = ichunk; });
+    EXPECT_EQ(first, (std::vector<size_t>{0, 1, 2}));
+
+    for (int iter = 0; iter < 2; ++iter)
+    {
+        std::vector<std::pair<size_t, size_t>> seen(3);
+        pool.parallel_for(
+            size_t(0),
+            size_t(10),
+            [&](size_t b, size_t e)
+            {
+                seen[b / 3] = {b, e};
+            });
+        EXPECT_EQ(seen[0], (std::pair<size_t, size_t>{0, 3}));
+        EXPECT_EQ(seen[1], (std::pair<size_t, size_t>{3, 6}));
+        EXPECT_EQ(seen[2], (std::pair<size_t, size_t>{6, 10}));
+    }
+    EXPECT_THROW(pool.run(4, [](size_t) {}), std::invalid_argument);
+}
+
+TEST(ThreadPool, exception)
+{
+    ThreadPool pool(4);
+    auto throw_odd = [](size_t ichunk)
+    {
+        if (ichunk % 2 == 1)
+        {
+            throw std::out_of_range(std::to_string(ichunk));
+        }
+    };
+    try
+    {
+        pool.run(4, throw_odd);
+        FAIL() << "no exception thrown";
+    }
+    catch (std::out_of_range const & e)
+    {
+        // The lowest throwing chunk wins.
+        EXPECT_STREQ(e.what(), "1");
+    }
+    // The pool stays usable after a failed run.
+    std::atomic<int> nrun = 0;
+    pool.run(4, [&](size_t)
+             { ++nrun; });
+    EXPECT_EQ(nrun.load(), 4);
+}
+
+TEST(ThreadPool, nested)
+{
+    // A nested call runs serially on the thread of the enclosing chunk.
+    ThreadPool pool(3);
+    std::vector<int> sum(3, 0);
+    pool.run(3, [&](size_t ichunk)
+             { pool.parallel_for(0, 100, [&](int b, int e)
+                                 { sum[ichunk] += e - b; }); });
+    EXPECT_EQ(sum, (std::vector<int>{100, 100, 100}));
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
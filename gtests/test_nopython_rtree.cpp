@@ -6,7 +6,15 @@
 #include <gtest/gtest.h>
 #include <solvcon/universe/rtree.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
 #include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #ifdef Py_PYTHON_H
 #error "Python.h should not be included."
 #endif
@@ -481,4 +489,504 @@ TEST(RTree, non_overlapping_searches_2d)
     }
 }
 
+namespace
+{
+
+template <typename P>
+bool point_less(P const & a, P const & b)
+{
+    if constexpr (std::is_same_v<P, Point3D>)
+    {
+        return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+    }
+    else
+    {
+        return std::tie(a.x, a.y) < std::tie(b.x, b.y);
+    }
+}
+
+// Points inside @p box, sorted, found by scanning every point.
+template <typename P, typename Ops>
+std::vector<P> brute_force_search(std::vector<P> const & points, TestBoundBox3d const & box)
+{
+    std::vector<P> found;
+    for (P const & pt : points)
+    {
+        if (Ops::calc_bound_box(pt).overlap(box))
+        {
+            found.push_back(pt);
+        }
+    }
+    std::ranges::sort(found, point_less<P>);
+    return found;
+}
+
+template <typename P, typename Tree>
+std::vector<P> sorted_search(Tree const & tree, TestBoundBox3d const & box)
+{
+    std::vector<P> found;
+    tree.search(box, found);
+    std::ranges::sort(found, point_less<P>);
+    return found;
+}
+
+} /* end namespace */
+
+TEST(RTree, bulk_load_2d)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<> dis(0.0, 100.0);
+    std::vector<Point2D> points;
+    for (int i = 0; i < 5000; ++i)
+    {
+        points.push_back(Point2D{dis(gen), dis(gen)});
+    }
+
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps, 16> const rtree(points);
+    FlatRTree<Point2D, TestBoundBox3d, Point2DValueOps> const flat(points);
+    EXPECT_FALSE(rtree.empty());
+    EXPECT_EQ(flat.size(), points.size());
+    for (int iq = 0; iq < 100; ++iq)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        TestBoundBox3d const box(x, y, 0.0, x + dis(gen) / 5, y + dis(gen) / 5, 0.0);
+        std::vector<Point2D> const expected = brute_force_search<Point2D, Point2DValueOps>(points, box);
+        EXPECT_EQ(sorted_search<Point2D>(rtree, box), expected);
+        EXPECT_EQ(sorted_search<Point2D>(flat, box), expected);
+    }
+}
+
+TEST(RTree, bulk_load_3d)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<> dis(0.0, 10.0);
+    std::vector<Point3D> points;
+    for (int i = 0; i < 3000; ++i)
+    {
+        points.push_back(Point3D{dis(gen), dis(gen), dis(gen)});
+    }
+
+    RTree<Point3D, TestBoundBox3d, Point3DValueOps> const rtree(points);
+    FlatRTree<Point3D, TestBoundBox3d, Point3DValueOps, 8> const flat(points);
+    for (int iq = 0; iq < 100; ++iq)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        double const z = dis(gen);
+        TestBoundBox3d const box(x, y, z, x + 2.0, y + 2.0, z + 2.0);
+        std::vector<Point3D> const expected = brute_force_search<Point3D, Point3DValueOps>(points, box);
+        EXPECT_EQ(sorted_search<Point3D>(rtree, box), expected);
+        EXPECT_EQ(sorted_search<Point3D>(flat, box), expected);
+    }
+}
+
+TEST(RTree, bulk_load_small_and_empty)
+{
+    using namespace solvcon;
+
+    std::vector<Point2D> points;
+    FlatRTree<Point2D, TestBoundBox3d, Point2DValueOps> const empty_flat(points);
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> const empty_tree(points);
+    std::vector<Point2D> results{Point2D{0.0, 0.0}};
+    empty_flat.search(TestBoundBox3d(0.0, 0.0, 0.0, 1.0, 1.0, 0.0), results);
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(empty_flat.empty());
+    EXPECT_TRUE(empty_tree.empty());
+
+    // Fewer items than a node holds make a single leaf.
+    points = {Point2D{1.0, 1.0}, Point2D{2.0, 2.0}, Point2D{3.0, 3.0}};
+    FlatRTree<Point2D, TestBoundBox3d, Point2DValueOps> const flat(points);
+    EXPECT_EQ(flat.nnode(), 1);
+    flat.search(TestBoundBox3d(1.5, 1.5, 0.0, 3.5, 3.5, 0.0), results);
+    EXPECT_EQ(results.size(), 2);
+}
+
+TEST(RTree, bulk_load_then_modify)
+{
+    using namespace solvcon;
+
+    std::vector<Point2D> points;
+    for (int i = 0; i < 1000; ++i)
+    {
+        points.push_back(Point2D{static_cast<double>(i % 40), static_cast<double>(i / 40)});
+    }
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps, 8> rtree(points);
+
+    // The packed tree stays dynamic: remove every other point and add new ones.
+    std::vector<Point2D> kept;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        if (i % 2 == 0)
+        {
+            rtree.remove(points[i]);
+        }
+        else
+        {
+            kept.push_back(points[i]);
+        }
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        Point2D const pt{0.5 + i % 10, 0.5 + i / 10};
+        rtree.insert(pt);
+        kept.push_back(pt);
+    }
+    for (TestBoundBox3d const & box : {TestBoundBox3d(0.0, 0.0, 0.0, 40.0, 25.0, 0.0),
+                                       TestBoundBox3d(3.0, 2.0, 0.0, 12.0, 9.0, 0.0),
+                                       TestBoundBox3d(30.5, 20.5, 0.0, 31.5, 24.0, 0.0)})
+    {
+        EXPECT_EQ(sorted_search<Point2D>(rtree, box), (brute_force_search<Point2D, Point2DValueOps>(kept, box)));
+    }
+}
+
+// A benchmark rather than a unit test, so it is disabled; run it with
+// --gtest_also_run_disabled_tests.
+TEST(RTree, DISABLED_bulk_load_scaling)
+{
+    // Build times of one-by-one insertion, the bulk-loaded RTree, and the
+    // FlatRTree, and the time of a batch of queries.  The numbers are printed
+    // for inspection; bulk_load_2d checks the results.
+    using namespace solvcon;
+
+    constexpr size_t nquery = 20000;
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<> dis(0.0, 1000.0);
+    std::vector<Point2D> points;
+    for (size_t i = 0; i < 200000; ++i)
+    {
+        points.push_back(Point2D{dis(gen), dis(gen)});
+    }
+    std::vector<TestBoundBox3d> queries;
+    for (size_t i = 0; i < nquery; ++i)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        queries.emplace_back(x, y, 0.0, x + 5.0, y + 5.0, 0.0);
+    }
+    auto elapsed_ms = [](auto start)
+    { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+    auto run_queries = [&](auto const & tree)
+    {
+        std::vector<Point2D> results;
+        size_t nfound = 0;
+        for (TestBoundBox3d const & box : queries)
+        {
+            tree.search(box, results);
+            nfound += results.size();
+        }
+        return nfound;
+    };
+
+    // Insert only a slice one by one; that path is much slower.
+    constexpr size_t ninsert = 20000;
+    auto start = std::chrono::steady_clock::now();
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> inserted;
+    for (size_t i = 0; i < ninsert; ++i)
+    {
+        inserted.insert(points[i]);
+    }
+    double const insert_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> const packed(points);
+    double const bulk_ms = elapsed_ms(start);
+    start = std::chrono::steady_clock::now();
+    FlatRTree<Point2D, TestBoundBox3d, Point2DValueOps> const flat(points);
+    double const flat_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t const packed_found = run_queries(packed);
+    double const packed_query_ms = elapsed_ms(start);
+    start = std::chrono::steady_clock::now();
+    size_t const flat_found = run_queries(flat);
+    double const flat_query_ms = elapsed_ms(start);
+    EXPECT_EQ(packed_found, flat_found);
+
+    std::cout << "insert " << ninsert << " items " << insert_ms << " ms; "
+              << "build " << points.size() << " items: bulk_load " << bulk_ms << " ms, FlatRTree " << flat_ms << " ms; "
+              << nquery << " queries: RTree " << packed_query_ms << " ms, FlatRTree " << flat_query_ms << " ms" << std::endl;
+    RecordProperty("bulk_load_ms", std::to_string(bulk_ms));
+    RecordProperty("flat_build_ms", std::to_string(flat_ms));
+    RecordProperty("flat_query_ms", std::to_string(flat_query_ms));
+}
+
+namespace
+{
+
+struct Segment2D
+{
+    double x0;
+    double y0;
+    double x1;
+    double y1;
+
+    bool operator==(Segment2D const & other) const = default;
+
+    double distance(double px, double py) const
+    {
+        double const dx = x1 - x0;
+        double const dy = y1 - y0;
+        double const t = std::clamp(((px - x0) * dx + (py - y0) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+        return std::hypot(px - (x0 + t * dx), py - (y0 + t * dy));
+    }
+}; /* end struct Segment2D */
+
+struct Segment2DValueOps
+{
+    static TestBoundBox3d calc_bound_box(Segment2D const & item)
+    {
+        return TestBoundBox3d(std::min(item.x0, item.x1), std::min(item.y0, item.y1), 0.0, std::max(item.x0, item.x1), std::max(item.y0, item.y1), 0.0);
+    }
+}; /* end struct Segment2DValueOps */
+
+// Distances of the k points nearest to (x, y), found by sorting all of them.
+std::vector<double> brute_force_nearest(std::vector<Point2D> const & points, double x, double y, size_t k)
+{
+    std::vector<double> distances;
+    for (Point2D const & pt : points)
+    {
+        distances.push_back(std::hypot(pt.x - x, pt.y - y));
+    }
+    k = std::min(k, distances.size());
+    std::partial_sort(distances.begin(), distances.begin() + static_cast<ptrdiff_t>(k), distances.end());
+    distances.resize(k);
+    return distances;
+}
+
+} /* end namespace */
+
+TEST(RTree, nearest)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<> dis(0.0, 100.0);
+    std::vector<Point2D> points;
+    for (int i = 0; i < 3000; ++i)
+    {
+        points.push_back(Point2D{dis(gen), dis(gen)});
+    }
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps, 8> rtree(points);
+
+    std::vector<Point2D> results;
+    for (int iq = 0; iq < 50; ++iq)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        rtree.nearest(TestBoundBox3d(x, y, 0.0, x, y, 0.0), 7, results);
+        std::vector<double> distances;
+        for (Point2D const & pt : results)
+        {
+            distances.push_back(std::hypot(pt.x - x, pt.y - y));
+        }
+        EXPECT_EQ(distances, brute_force_nearest(points, x, y, 7));
+    }
+
+    // The distance limit and an empty tree.
+    rtree.nearest(TestBoundBox3d(-50.0, -50.0, 0.0, -50.0, -50.0, 0.0), 3, results, 10.0);
+    EXPECT_TRUE(results.empty());
+    rtree.nearest(TestBoundBox3d(0.0, 0.0, 0.0, 1.0, 1.0, 0.0), 0, results);
+    EXPECT_TRUE(results.empty());
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> empty_tree;
+    empty_tree.nearest(TestBoundBox3d(0.0, 0.0, 0.0, 0.0, 0.0, 0.0), 3, results);
+    EXPECT_TRUE(results.empty());
+}
+
+TEST(RTree, nearest_with_item_distance)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(19);
+    std::uniform_real_distribution<> dis(0.0, 100.0);
+    std::uniform_real_distribution<> len(-3.0, 3.0);
+    std::vector<Segment2D> segments;
+    for (int i = 0; i < 2000; ++i)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        segments.push_back(Segment2D{x, y, x + len(gen), y + len(gen)});
+    }
+    RTree<Segment2D, TestBoundBox3d, Segment2DValueOps, 16> rtree(segments);
+
+    std::vector<Segment2D> results;
+    for (int iq = 0; iq < 50; ++iq)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        rtree.nearest(TestBoundBox3d(x, y, 0.0, x, y, 0.0), 4, results, 5.0, [&](Segment2D const & seg)
+                      { return seg.distance(x, y); });
+        std::vector<double> expected;
+        for (Segment2D const & seg : segments)
+        {
+            if (seg.distance(x, y) <= 5.0)
+            {
+                expected.push_back(seg.distance(x, y));
+            }
+        }
+        std::ranges::sort(expected);
+        expected.resize(std::min<size_t>(expected.size(), 4));
+        std::vector<double> distances;
+        for (Segment2D const & seg : results)
+        {
+            distances.push_back(seg.distance(x, y));
+        }
+        EXPECT_EQ(distances, expected);
+    }
+}
+
+TEST(RTree, search_radius)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(23);
+    std::uniform_real_distribution<> dis(0.0, 10.0);
+    std::vector<Point3D> points;
+    for (int i = 0; i < 2000; ++i)
+    {
+        points.push_back(Point3D{dis(gen), dis(gen), dis(gen)});
+    }
+    RTree<Point3D, TestBoundBox3d, Point3DValueOps, 8> const rtree(points);
+
+    std::vector<Point3D> results;
+    for (int iq = 0; iq < 50; ++iq)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        double const z = dis(gen);
+        double const radius = dis(gen) / 4;
+        rtree.search_radius(TestBoundBox3d(x, y, z, x, y, z), radius, results);
+        std::ranges::sort(results, point_less<Point3D>);
+        std::vector<Point3D> expected;
+        for (Point3D const & pt : points)
+        {
+            if (std::sqrt((pt.x - x) * (pt.x - x) + (pt.y - y) * (pt.y - y) + (pt.z - z) * (pt.z - z)) <= radius)
+            {
+                expected.push_back(pt);
+            }
+        }
+        std::ranges::sort(expected, point_less<Point3D>);
+        EXPECT_EQ(results, expected);
+    }
+}
+
+TEST(RTree, search_many)
+{
+    using namespace solvcon;
+
+    std::mt19937 gen(29);
+    std::uniform_real_distribution<> dis(0.0, 100.0);
+    std::vector<Point2D> points;
+    for (int i = 0; i < 5000; ++i)
+    {
+        points.push_back(Point2D{dis(gen), dis(gen)});
+    }
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps, 16> rtree;
+    for (Point2D const & pt : points)
+    {
+        rtree.insert(pt);
+    }
+    std::vector<TestBoundBox3d> boxes;
+    for (int iq = 0; iq < 1000; ++iq)
+    {
+        double const x = dis(gen) - 10.0;
+        double const y = dis(gen) - 10.0;
+        boxes.emplace_back(x, y, 0.0, x + dis(gen) / 10, y + dis(gen) / 10, 0.0);
+    }
+
+    std::vector<std::vector<Point2D>> expected(boxes.size());
+    for (size_t iq = 0; iq < boxes.size(); ++iq)
+    {
+        rtree.search(boxes[iq], expected[iq]);
+    }
+    // Every batch result equals its single query, order included.
+    std::vector<std::vector<Point2D>> outputs;
+    rtree.search_many(boxes, outputs);
+    EXPECT_EQ(outputs, expected);
+    ThreadPool pool(3);
+    rtree.search_many(boxes, outputs, &pool);
+    EXPECT_EQ(outputs, expected);
+
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> const empty_tree;
+    empty_tree.search_many(boxes, outputs, &pool);
+    ASSERT_EQ(outputs.size(), boxes.size());
+    EXPECT_TRUE(std::ranges::all_of(outputs, [](auto const & output)
+                                    { return output.empty(); }));
+}
+
+// A benchmark rather than a unit test, so it is disabled; run it with
+// --gtest_also_run_disabled_tests.
+TEST(RTree, DISABLED_query_scaling)
+{
+    // Time kNN against a brute-force partial sort and search_many against a
+    // loop of single searches, serially and on all hardware threads.  The
+    // numbers are printed for inspection; the nearest and search_many tests
+    // check the results.
+    using namespace solvcon;
+
+    constexpr size_t npoint = 200000;
+    constexpr size_t nquery = 20000;
+    constexpr size_t nbrute = 200;
+    constexpr size_t k = 8;
+    std::mt19937 gen(31);
+    std::uniform_real_distribution<> dis(0.0, 1000.0);
+    std::vector<Point2D> points;
+    for (size_t i = 0; i < npoint; ++i)
+    {
+        points.push_back(Point2D{dis(gen), dis(gen)});
+    }
+    std::vector<TestBoundBox3d> boxes;
+    for (size_t i = 0; i < nquery; ++i)
+    {
+        double const x = dis(gen);
+        double const y = dis(gen);
+        boxes.emplace_back(x, y, 0.0, x + 5.0, y + 5.0, 0.0);
+    }
+    RTree<Point2D, TestBoundBox3d, Point2DValueOps> const rtree(points);
+    auto elapsed_ms = [](auto start)
+    { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+
+    std::vector<Point2D> results;
+    auto start = std::chrono::steady_clock::now();
+    for (TestBoundBox3d const & box : boxes)
+    {
+        rtree.nearest(TestBoundBox3d(box.min_x(), box.min_y(), 0.0, box.min_x(), box.min_y(), 0.0), k, results);
+    }
+    double const nearest_ms = elapsed_ms(start);
+    start = std::chrono::steady_clock::now();
+    for (size_t iq = 0; iq < nbrute; ++iq)
+    {
+        brute_force_nearest(points, boxes[iq].min_x(), boxes[iq].min_y(), k);
+    }
+    double const brute_ms = elapsed_ms(start) * static_cast<double>(nquery) / static_cast<double>(nbrute);
+
+    std::vector<std::vector<Point2D>> expected(nquery);
+    start = std::chrono::steady_clock::now();
+    for (size_t iq = 0; iq < nquery; ++iq)
+    {
+        rtree.search(boxes[iq], expected[iq]);
+    }
+    double const loop_ms = elapsed_ms(start);
+    std::vector<std::vector<Point2D>> outputs;
+    start = std::chrono::steady_clock::now();
+    rtree.search_many(boxes, outputs);
+    double const many_ms = elapsed_ms(start);
+    ThreadPool pool(0);
+    start = std::chrono::steady_clock::now();
+    rtree.search_many(boxes, outputs, &pool);
+    double const threaded_ms = elapsed_ms(start);
+
+    std::cout << nquery << " queries on " << npoint << " points: nearest k=" << k << " " << nearest_ms
+              << " ms, brute force (extrapolated) " << brute_ms << " ms; search loop " << loop_ms
+              << " ms, search_many " << many_ms << " ms, search_many nthread " << pool.nthread() << " "
+              << threaded_ms << " ms" << std::endl;
+    RecordProperty("nearest_ms", std::to_string(nearest_ms));
+    RecordProperty("search_many_ms", std::to_string(many_ms));
+    RecordProperty("search_many_threaded_ms", std::to_string(threaded_ms));
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,400 @@
+#include <solvcon/simd/simd.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+template <typename T>
+using binary_fn = void (*)(T *, T const *, T const *, T const *);
+
+template <typename T>
+using between_fn = T const * (*)(T const *, T const *, T const &, T const &);
+
+// Small magnitudes keep integer products and quotients away from overflow,
+// where the generic loop would be undefined behavior for signed types.
+template <typename T>
+std::vector<T> make_operand(size_t n, std::mt19937 & gen, bool nonzero)
+{
+    std::vector<T> ret(n);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(-100, 100);
+        for (T & it : ret)
+        {
+            it = dist(gen);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<int64_t> dist(std::is_signed_v<T> ? -10 : 0, 10);
+        for (T & it : ret)
+        {
+            it = static_cast<T>(dist(gen));
+        }
+    }
+    if (nonzero)
+    {
+        for (T & it : ret)
+        {
+            if (it == T(0))
+            {
+                it = T(1);
+            }
+        }
+    }
+    return ret;
+}
+
+// Lengths run past several blocks of the widest lane count (64 int8 lanes of
+// AVX-512) so the vector body, the scalar tail, and inputs shorter than one
+// lane are all compared. The leading element is skipped to feed unaligned
+// pointers.
+template <typename T>
+void expect_binary_bitwise(binary_fn<T> simd_fn, binary_fn<T> generic_fn, bool nonzero_rhs, char const * name)
+{
+    std::mt19937 gen(1234);
+    for (size_t n = 1; n < 200; ++n)
+    {
+        std::vector<T> const lhs = make_operand<T>(n + 1, gen, false);
+        std::vector<T> const rhs = make_operand<T>(n + 1, gen, nonzero_rhs);
+        std::vector<T> got(n + 1);
+        std::vector<T> want(n + 1);
+        simd_fn(got.data() + 1, got.data() + n + 1, lhs.data() + 1, rhs.data() + 1);
+        generic_fn(want.data() + 1, want.data() + n + 1, lhs.data() + 1, rhs.data() + 1);
+        EXPECT_EQ(std::memcmp(got.data() + 1, want.data() + 1, n * sizeof(T)), 0) << name << " n=" << n;
+    }
+}
+
+template <typename T>
+void expect_between_same(between_fn<T> simd_fn, between_fn<T> generic_fn, char const * name)
+{
+    T const lo = T(10);
+    T const hi = T(100);
+    std::mt19937 gen(5678);
+    std::uniform_int_distribution<int32_t> dist(10, 100);
+    for (size_t n = 1; n < 200; ++n)
+    {
+        std::vector<T> data(n);
+        for (T & it : data)
+        {
+            it = static_cast<T>(dist(gen));
+        }
+        // Both bounds are inclusive, so values equal to them are in range.
+        data[0] = lo;
+        data[n - 1] = hi;
+        T const * const begin = data.data();
+        T const * const end = begin + n;
+        EXPECT_EQ(simd_fn(begin, end, lo, hi), nullptr) << name << " n=" << n;
+
+        for (size_t pos : {size_t(0), n / 2, n - 1})
+        {
+            for (T bad : {T(lo - 1), T(hi + 1)})
+            {
+                std::vector<T> probe = data;
+                probe[pos] = bad;
+                // A second offender later in the array must not win over the first.
+                probe[n - 1] = T(hi + 1);
+                T const * const want = generic_fn(probe.data(), probe.data() + n, lo, hi);
+                T const * const got = simd_fn(probe.data(), probe.data() + n, lo, hi);
+                EXPECT_EQ(got, want) << name << " n=" << n << " pos=" << pos;
+            }
+        }
+    }
+}
+
+template <typename T>
+using reduce_fn = T (*)(T const *, T const *);
+
+template <typename T>
+using extremum_fn = T (*)(T const *, T const *, T);
+
+template <typename T>
+using dot_fn = T (*)(T const *, T const *, T const *);
+
+// Integer reductions are exact however they are reassociated, so the vector
+// kernels must agree bit for bit. Floating-point sums only agree to rounding.
+template <typename T>
+void expect_reduce_same(reduce_fn<T> simd_fn, reduce_fn<T> generic_fn, char const * name)
+{
+    std::mt19937 gen(4321);
+    for (size_t n = 0; n < 300; ++n)
+    {
+        std::vector<T> const data = make_operand<T>(n + 1, gen, false);
+        T const got = simd_fn(data.data() + 1, data.data() + n + 1);
+        T const want = generic_fn(data.data() + 1, data.data() + n + 1);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // The classic bound n * eps * sum(|x|) with |x| <= 100.
+            EXPECT_NEAR(got, want, T(100) * T(n + 1) * T(n + 1) * std::numeric_limits<T>::epsilon()) << name << " n=" << n;
+        }
+        else
+        {
+            EXPECT_EQ(got, want) << name << " n=" << n;
+        }
+    }
+}
+
+template <typename T>
+void expect_dot_same(dot_fn<T> simd_fn, dot_fn<T> generic_fn, char const * name)
+{
+    std::mt19937 gen(8765);
+    for (size_t n = 0; n < 300; ++n)
+    {
+        std::vector<T> const lhs = make_operand<T>(n + 1, gen, false);
+        std::vector<T> const rhs = make_operand<T>(n + 1, gen, false);
+        T const got = simd_fn(lhs.data() + 1, lhs.data() + n + 1, rhs.data() + 1);
+        T const want = generic_fn(lhs.data() + 1, lhs.data() + n + 1, rhs.data() + 1);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            EXPECT_NEAR(got, want, T(1e4) * T(n + 1) * T(n + 1) * std::numeric_limits<T>::epsilon()) << name << " n=" << n;
+        }
+        else
+        {
+            EXPECT_EQ(got, want) << name << " n=" << n;
+        }
+    }
+}
+
+// The extremum is a selection, not arithmetic, so it is exact for every type.
+// NaN is sprinkled into floating-point inputs; it must never be selected.
+template <typename T>
+void expect_extremum_same(extremum_fn<T> simd_fn, extremum_fn<T> generic_fn, T init, char const * name)
+{
+    std::mt19937 gen(2468);
+    for (size_t n = 0; n < 300; ++n)
+    {
+        std::vector<T> data = make_operand<T>(n + 1, gen, false);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            for (size_t i = 1; i < data.size(); i += 7)
+            {
+                data[i] = std::numeric_limits<T>::quiet_NaN();
+            }
+        }
+        T const got = simd_fn(data.data() + 1, data.data() + n + 1, init);
+        T const want = generic_fn(data.data() + 1, data.data() + n + 1, init);
+        EXPECT_EQ(got, want) << name << " n=" << n;
+    }
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+bool has_avx2()
+{
+    namespace sd = solvcon::simd::detail;
+    sd::SimdFeature const feature = sd::detect_simd();
+    return feature == sd::SIMD_AVX2 || feature == sd::SIMD_AVX512;
+}
+
+bool has_avx512() { return solvcon::simd::detail::detect_simd() == solvcon::simd::detail::SIMD_AVX512; }
+
+template <typename T>
+void expect_avx2_matches_generic()
+{
+    namespace ss = solvcon::simd;
+    expect_binary_bitwise<T>(&ss::avx2::add<T>, &ss::generic::add<T>, false, "avx2::add");
+    expect_binary_bitwise<T>(&ss::avx2::sub<T>, &ss::generic::sub<T>, false, "avx2::sub");
+    expect_binary_bitwise<T>(&ss::avx2::mul<T>, &ss::generic::mul<T>, false, "avx2::mul");
+    expect_binary_bitwise<T>(&ss::avx2::div<T>, &ss::generic::div<T>, true, "avx2::div");
+    expect_between_same<T>(&ss::avx2::check_between<T>, &ss::generic::check_between<T>, "avx2::check_between");
+    expect_reduce_same<T>(&ss::avx2::sum<T>, &ss::generic::sum<T>, "avx2::sum");
+    expect_dot_same<T>(&ss::avx2::dot<T>, &ss::generic::dot<T>, "avx2::dot");
+    expect_extremum_same<T>(&ss::avx2::min<T>, &ss::generic::min<T>, std::numeric_limits<T>::max(), "avx2::min");
+    expect_extremum_same<T>(&ss::avx2::max<T>, &ss::generic::max<T>, std::numeric_limits<T>::lowest(), "avx2::max");
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        expect_reduce_same<T>(&ss::avx2::sum_kahan<T>, &ss::generic::sum_kahan<T>, "avx2::sum_kahan");
+    }
+}
+
+template <typename T>
+void expect_avx512_matches_generic()
+{
+    namespace ss = solvcon::simd;
+    expect_binary_bitwise<T>(&ss::avx512::add<T>, &ss::generic::add<T>, false, "avx512::add");
+    expect_binary_bitwise<T>(&ss::avx512::sub<T>, &ss::generic::sub<T>, false, "avx512::sub");
+    expect_binary_bitwise<T>(&ss::avx512::mul<T>, &ss::generic::mul<T>, false, "avx512::mul");
+    expect_binary_bitwise<T>(&ss::avx512::div<T>, &ss::generic::div<T>, true, "avx512::div");
+    expect_between_same<T>(&ss::avx512::check_between<T>, &ss::generic::check_between<T>, "avx512::check_between");
+    expect_reduce_same<T>(&ss::avx512::sum<T>, &ss::generic::sum<T>, "avx512::sum");
+    expect_dot_same<T>(&ss::avx512::dot<T>, &ss::generic::dot<T>, "avx512::dot");
+    expect_extremum_same<T>(&ss::avx512::min<T>, &ss::generic::min<T>, std::numeric_limits<T>::max(), "avx512::min");
+    expect_extremum_same<T>(&ss::avx512::max<T>, &ss::generic::max<T>, std::numeric_limits<T>::lowest(), "avx512::max");
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        expect_reduce_same<T>(&ss::avx512::sum_kahan<T>, &ss::generic::sum_kahan<T>, "avx512::sum_kahan");
+    }
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
+} /* end namespace */
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TEST(Simd, detect_x86)
+{
+    namespace sd = solvcon::simd::detail;
+    sd::SimdFeature const feature = sd::detect_simd();
+    // SSE2 is the x86-64 baseline; anything lower means detection fell through.
+    EXPECT_GE(feature, sd::SIMD_SSE2);
+    EXPECT_LE(feature, sd::SIMD_AVX512);
+}
+
+TEST(Simd, avx2_matches_generic)
+{
+    if (!has_avx2())
+    {
+        GTEST_SKIP() << "AVX2 is not available";
+    }
+    expect_avx2_matches_generic<int8_t>();
+    expect_avx2_matches_generic<int16_t>();
+    expect_avx2_matches_generic<int32_t>();
+    expect_avx2_matches_generic<int64_t>();
+    expect_avx2_matches_generic<uint8_t>();
+    expect_avx2_matches_generic<uint16_t>();
+    expect_avx2_matches_generic<uint32_t>();
+    expect_avx2_matches_generic<uint64_t>();
+    expect_avx2_matches_generic<float>();
+    expect_avx2_matches_generic<double>();
+}
+
+TEST(Simd, avx512_matches_generic)
+{
+    if (!has_avx512())
+    {
+        GTEST_SKIP() << "AVX-512 (F, BW, DQ) is not available";
+    }
+    expect_avx512_matches_generic<int8_t>();
+    expect_avx512_matches_generic<int16_t>();
+    expect_avx512_matches_generic<int32_t>();
+    expect_avx512_matches_generic<int64_t>();
+    expect_avx512_matches_generic<uint8_t>();
+    expect_avx512_matches_generic<uint16_t>();
+    expect_avx512_matches_generic<uint32_t>();
+    expect_avx512_matches_generic<uint64_t>();
+    expect_avx512_matches_generic<float>();
+    expect_avx512_matches_generic<double>();
+}
+
+// The upper half of the unsigned range sorts as negative under a signed
+// compare, which is what the AVX2 sign-bit flip has to undo.
+TEST(Simd, check_between_unsigned_high_bit)
+{
+    namespace ss = solvcon::simd;
+    std::vector<uint32_t> data(37, 5);
+    data[20] = std::numeric_limits<uint32_t>::max();
+    uint32_t const lo = 0;
+    uint32_t const hi = 10;
+    uint32_t const * const want = ss::generic::check_between<uint32_t>(data.data(), data.data() + data.size(), lo, hi);
+    ASSERT_EQ(want, data.data() + 20);
+    if (has_avx2())
+    {
+        EXPECT_EQ(ss::avx2::check_between<uint32_t>(data.data(), data.data() + data.size(), lo, hi), want);
+    }
+    if (has_avx512())
+    {
+        EXPECT_EQ(ss::avx512::check_between<uint32_t>(data.data(), data.data() + data.size(), lo, hi), want);
+    }
+}
+
+// NaN compares false against both bounds, so the scalar loop treats it as in
+// range. The vector predicates must agree.
+TEST(Simd, check_between_nan)
+{
+    namespace ss = solvcon::simd;
+    std::vector<double> data(19, 1.0);
+    data[3] = std::numeric_limits<double>::quiet_NaN();
+    double const lo = 0.0;
+    double const hi = 2.0;
+    EXPECT_EQ(ss::generic::check_between<double>(data.data(), data.data() + data.size(), lo, hi), nullptr);
+    if (has_avx2())
+    {
+        EXPECT_EQ(ss::avx2::check_between<double>(data.data(), data.data() + data.size(), lo, hi), nullptr);
+    }
+    if (has_avx512())
+    {
+        EXPECT_EQ(ss::avx512::check_between<double>(data.data(), data.data() + data.size(), lo, hi), nullptr);
+    }
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+
+#ifdef __aarch64__
+
+template <typename T>
+void expect_neon_extremum_matches_generic()
+{
+    namespace ss = solvcon::simd;
+    expect_extremum_same<T>(&ss::neon::min<T>, &ss::generic::min<T>, std::numeric_limits<T>::max(), "neon::min");
+    expect_extremum_same<T>(&ss::neon::max<T>, &ss::generic::max<T>, std::numeric_limits<T>::lowest(), "neon::max");
+}
+
+TEST(Simd, neon_extremum_matches_generic)
+{
+    expect_neon_extremum_matches_generic<int8_t>();
+    expect_neon_extremum_matches_generic<int16_t>();
+    expect_neon_extremum_matches_generic<int32_t>();
+    expect_neon_extremum_matches_generic<int64_t>();
+    expect_neon_extremum_matches_generic<uint8_t>();
+    expect_neon_extremum_matches_generic<uint16_t>();
+    expect_neon_extremum_matches_generic<uint32_t>();
+    expect_neon_extremum_matches_generic<uint64_t>();
+    expect_neon_extremum_matches_generic<float>();
+    expect_neon_extremum_matches_generic<double>();
+}
+
+#endif /* defined(__aarch64__) */
+
+// The dispatched extremum must skip NaN in any position, including the one
+// that seeds the running value.
+TEST(Simd, minmax_skip_nan)
+{
+    namespace ss = solvcon::simd;
+    std::vector<double> data(45, 3.0);
+    data[0] = std::numeric_limits<double>::quiet_NaN();
+    data[17] = -4.0;
+    data[30] = 8.0;
+    data[44] = std::numeric_limits<double>::quiet_NaN();
+    double const * const begin = data.data();
+    double const * const end = begin + data.size();
+    EXPECT_EQ(ss::min<double>(begin, end, std::numeric_limits<double>::max()), -4.0);
+    EXPECT_EQ(ss::max<double>(begin, end, std::numeric_limits<double>::lowest()), 8.0);
+    EXPECT_EQ(ss::max<double>(begin + 1, end), 8.0);
+}
+
+// 0.1 is inexact in binary, so a long float sum drifts unless the rounding
+// error is controlled. The double-precision sum serves as the reference.
+TEST(Simd, sum_float_accuracy)
+{
+    namespace ss = solvcon::simd;
+    std::vector<float> data(1 << 20, 0.1f);
+    double want = 0.0;
+    for (float const v : data)
+    {
+        want += v;
+    }
+    float const * const begin = data.data();
+    float const * const end = begin + data.size();
+    double const err_fast = std::abs(ss::sum<float>(begin, end) - want);
+    double const err_pairwise = std::abs(ss::sum_pairwise<float>(begin, end) - want);
+    double const err_kahan = std::abs(ss::sum_kahan<float>(begin, end) - want);
+    EXPECT_LE(err_kahan, want * 1e-6);
+    EXPECT_LE(err_pairwise, want * 1e-5);
+    EXPECT_LE(err_kahan, err_fast);
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
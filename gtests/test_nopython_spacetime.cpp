@@ -0,0 +1,122 @@
+#include <solvcon/spacetime/spacetime.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+using namespace solvcon;
+using namespace solvcon::spacetime;
+
+namespace
+{
+
+// A periodic sine wave on a slightly non-uniform grid, so that the element
+// widths differ from each other.
+template <typename ST>
+std::shared_ptr<ST> make_solver(size_t ncelm, bool burgers)
+{
+    SimpleArray<real_type> xloc(small_vector<ssize_t>{static_cast<ssize_t>(ncelm + 1)});
+    for (size_t it = 0; it <= ncelm; ++it)
+    {
+        real_type const s = static_cast<real_type>(it) / static_cast<real_type>(ncelm);
+        xloc[it] = 2 * std::numbers::pi * (s + 0.02 * std::sin(2 * std::numbers::pi * s));
+    }
+    auto grid = Grid::construct(xloc);
+    real_type const dt = (burgers ? 0.4 : 0.9) * 2 * std::numbers::pi / static_cast<real_type>(ncelm);
+    auto svr = ST::construct(grid, dt);
+    for (bool const odd_plane : {false, true})
+    {
+        SimpleArray<real_type> const x = svr->x(odd_plane);
+        SimpleArray<real_type> so0(x.shape());
+        SimpleArray<real_type> so1(x.shape());
+        for (size_t it = 0; it < x.size(); ++it)
+        {
+            so0[it] = (burgers ? 1.0 : 0.0) + std::sin(x[it]);
+            so1[it] = std::cos(x[it]);
+        }
+        svr->set_so0(0, so0, odd_plane);
+        svr->set_so1(0, so1, odd_plane);
+    }
+    svr->setup_march();
+    return svr;
+}
+
+// Compare the solution elements of both planes; the padding around them is
+// never written.
+template <typename ST>
+bool same_field(ST const & a, ST const & b)
+{
+    auto same = [](SimpleArray<real_type> const & x, SimpleArray<real_type> const & y)
+    { return x.shape() == y.shape() && std::memcmp(x.data(), y.data(), x.nbytes()) == 0; };
+    bool ret = true;
+    for (bool const odd_plane : {false, true})
+    {
+        ret = ret && same(a.get_so0(0, odd_plane), b.get_so0(0, odd_plane));
+        ret = ret && same(a.get_so1(0, odd_plane), b.get_so1(0, odd_plane));
+        ret = ret && same(a.get_cfl(odd_plane), b.get_cfl(odd_plane));
+    }
+    return ret;
+}
+
+// March with the proxy path and with the array path on 1 and 3 threads; all
+// must agree bit for bit.
+template <typename ST>
+void check_march_paths(bool burgers)
+{
+    constexpr size_t ncelm = 40001;
+    auto proxy = make_solver<ST>(ncelm, burgers);
+    proxy->set_soa_march(false);
+    EXPECT_FALSE(proxy->soa_march());
+    proxy->template march_alpha<2>(7);
+    proxy->template march_alpha<1>(3);
+
+    for (size_t const nthread : {1, 3})
+    {
+        auto svr = make_solver<ST>(ncelm, burgers);
+        svr->set_nthread(nthread);
+        EXPECT_TRUE(svr->soa_march());
+        svr->template march_alpha<2>(7);
+        svr->template march_alpha<1>(3);
+        EXPECT_TRUE(same_field(*proxy, *svr)) << "nthread " << nthread;
+    }
+}
+
+} /* end namespace */
+
+TEST(SpacetimeSolver, nthread)
+{
+    auto svr = make_solver<LinearScalarSolver>(10, false);
+    EXPECT_EQ(svr->nthread(), 1);
+    svr->set_nthread(3);
+    EXPECT_EQ(svr->nthread(), 3);
+    auto other = svr->clone();
+    EXPECT_EQ(other->nthread(), 3);
+    svr->set_nthread(0);
+    EXPECT_EQ(svr->nthread(), ThreadPool::hardware_nthread());
+    EXPECT_EQ(other->nthread(), 3);
+
+    // The generic solver has no array path.
+    auto generic = Solver::construct(Grid::construct(0.0, 1.0, 10), 0.1, 1);
+    EXPECT_FALSE(generic->soa_march());
+}
+
+TEST(SpacetimeSolver, linear_scalar_march_paths)
+{
+    check_march_paths<LinearScalarSolver>(false);
+}
+
+TEST(SpacetimeSolver, inviscid_burgers_march_paths)
+{
+    check_march_paths<InviscidBurgersSolver>(true);
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
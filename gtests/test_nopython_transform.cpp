@@ -1,6 +1,8 @@
 #include <solvcon/solvcon.hpp>
 #include <solvcon/transform/transform.hpp>
 #include <random>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #ifdef Py_PYTHON_H
@@ -190,4 +192,356 @@ TYPED_TEST(InverseTest, dft)
     this->verify_inverse_fft_function();
 }
 
+namespace
+{
+
+using cplx = solvcon::Complex<double>;
+using shape_type = solvcon::small_vector<ssize_t>;
+
+solvcon::SimpleArray<cplx> make_signal(shape_type const & shape, unsigned seed)
+{
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    solvcon::SimpleArray<cplx> ret(shape);
+    for (size_t i = 0; i < ret.size(); ++i)
+    {
+        ret.data(i) = cplx{dist(rng), dist(rng)};
+    }
+    return ret;
+}
+
+// Direct DFT of a C-contiguous array over all its axes.
+solvcon::SimpleArray<cplx> direct_dft(solvcon::SimpleArray<cplx> const & in)
+{
+    solvcon::SimpleArray<cplx> ret(in.shape(), cplx{0.0, 0.0});
+    size_t const ndim = in.ndim();
+    shape_type k(ndim, 0);
+    for (size_t ik = 0; ik < in.size(); ++ik)
+    {
+        shape_type j(ndim, 0);
+        cplx sum{0.0, 0.0};
+        for (size_t ij = 0; ij < in.size(); ++ij)
+        {
+            double phase = 0.0;
+            for (size_t a = 0; a < ndim; ++a)
+            {
+                phase += static_cast<double>(k[a] * j[a]) / static_cast<double>(in.shape(a));
+            }
+            double const angle = -2.0 * solvcon::pi<double> * phase;
+            sum += in.data(ij) * cplx{std::cos(angle), std::sin(angle)};
+            j.next_cartesian_product(in.shape());
+        }
+        ret.data(ik) = sum;
+        k.next_cartesian_product(in.shape());
+    }
+    return ret;
+}
+
+void expect_near_array(solvcon::SimpleArray<cplx> const & a, solvcon::SimpleArray<cplx> const & b, double tol)
+{
+    ASSERT_EQ(a.shape(), b.shape());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_NEAR(a.data(i).real(), b.data(i).real(), tol) << "at " << i;
+        EXPECT_NEAR(a.data(i).imag(), b.data(i).imag(), tol) << "at " << i;
+    }
+}
+
+} /* end namespace */
+
+TEST(FourierPlan, lengths)
+{
+    using namespace solvcon;
+
+    // Powers of two with even and odd bit counts, and mixed-radix lengths.
+    for (ssize_t const n : {1, 2, 4, 8, 32, 64, 256, 3, 7, 12, 100})
+    {
+        auto const in = make_signal(shape_type{n}, static_cast<unsigned>(n));
+        SimpleArray<cplx> out(in.shape());
+        SimpleArray<cplx> back(in.shape());
+        auto plan = FourierPlan<double>::construct(shape_type{n});
+        plan->fft(in, out);
+        expect_near_array(direct_dft(in), out, 1.e-10);
+        plan->ifft(out, back);
+        expect_near_array(in, back, 1.e-12);
+        // The plan gives the same result when executed again.
+        SimpleArray<cplx> again(in.shape());
+        plan->fft(in, again);
+        expect_near_array(out, again, 0.0);
+    }
+}
+
+TEST(FourierPlan, real)
+{
+    using namespace solvcon;
+
+    for (ssize_t const n : {1, 2, 8, 16, 15, 12, 6})
+    {
+        auto const signal = make_signal(shape_type{3, n}, 40 + static_cast<unsigned>(n));
+        SimpleArray<double> in(shape_type{3, n});
+        SimpleArray<cplx> cin(shape_type{3, n});
+        for (size_t i = 0; i < in.size(); ++i)
+        {
+            in.data(i) = signal.data(i).real();
+            cin.data(i) = cplx{in.data(i), 0.0};
+        }
+        auto plan = FourierPlan<double>::construct(shape_type{n});
+        SimpleArray<cplx> full(shape_type{3, n});
+        plan->fft(cin, full);
+        SimpleArray<cplx> half(shape_type{3, (n / 2) + 1});
+        plan->rfft(in, half);
+        for (ssize_t i = 0; i < 3; ++i)
+        {
+            for (ssize_t k = 0; k <= n / 2; ++k)
+            {
+                EXPECT_NEAR(half(i, k).real(), full(i, k).real(), 1.e-12);
+                EXPECT_NEAR(half(i, k).imag(), full(i, k).imag(), 1.e-12);
+            }
+        }
+        SimpleArray<double> back(shape_type{3, n});
+        plan->irfft(half, back);
+        for (size_t i = 0; i < in.size(); ++i)
+        {
+            EXPECT_NEAR(back.data(i), in.data(i), 1.e-12);
+        }
+    }
+
+    auto plan = FourierPlan<double>::construct(shape_type{8});
+    SimpleArray<double> in(shape_type{8});
+    SimpleArray<cplx> wrong(shape_type{8});
+    EXPECT_THROW(plan->rfft(in, wrong), std::invalid_argument);
+}
+
+TEST(FourierPlan, multidimensional)
+{
+    using namespace solvcon;
+
+    // A batch of three 2D transforms, and a 3D transform.
+    auto const in2 = make_signal(shape_type{3, 6, 8}, 7);
+    SimpleArray<cplx> out2(in2.shape());
+    FourierPlan<double>::construct(shape_type{6, 8})->fft(in2, out2);
+    for (ssize_t ib = 0; ib < 3; ++ib)
+    {
+        SimpleArray<cplx> slice(shape_type{6, 8});
+        SimpleArray<cplx> expected_slice(shape_type{6, 8});
+        for (ssize_t i = 0; i < 6; ++i)
+        {
+            for (ssize_t j = 0; j < 8; ++j)
+            {
+                slice(i, j) = in2(ib, i, j);
+            }
+        }
+        SimpleArray<cplx> const expected = direct_dft(slice);
+        for (ssize_t i = 0; i < 6; ++i)
+        {
+            for (ssize_t j = 0; j < 8; ++j)
+            {
+                expected_slice(i, j) = out2(ib, i, j);
+            }
+        }
+        expect_near_array(expected, expected_slice, 1.e-10);
+    }
+
+    auto const in3 = make_signal(shape_type{4, 5, 6}, 8);
+    SimpleArray<cplx> out3(in3.shape());
+    SimpleArray<cplx> back3(in3.shape());
+    auto plan3 = FourierPlan<double>::construct(shape_type{4, 5, 6});
+    plan3->fft(in3, out3);
+    expect_near_array(direct_dft(in3), out3, 1.e-10);
+    plan3->ifft(out3, back3);
+    expect_near_array(in3, back3, 1.e-12);
+
+    // Real 2D transform and its inverse.
+    SimpleArray<double> rin(shape_type{6, 8});
+    SimpleArray<cplx> cin(shape_type{6, 8});
+    for (size_t i = 0; i < rin.size(); ++i)
+    {
+        rin.data(i) = in2.data(i).real();
+        cin.data(i) = cplx{rin.data(i), 0.0};
+    }
+    auto plan2 = FourierPlan<double>::construct(shape_type{6, 8});
+    SimpleArray<cplx> half(shape_type{6, 5});
+    plan2->rfft(rin, half);
+    SimpleArray<cplx> const full = direct_dft(cin);
+    for (ssize_t i = 0; i < 6; ++i)
+    {
+        for (ssize_t k = 0; k < 5; ++k)
+        {
+            EXPECT_NEAR(half(i, k).real(), full(i, k).real(), 1.e-10);
+            EXPECT_NEAR(half(i, k).imag(), full(i, k).imag(), 1.e-10);
+        }
+    }
+    SimpleArray<double> rback(shape_type{6, 8});
+    plan2->irfft(half, rback);
+    for (size_t i = 0; i < rin.size(); ++i)
+    {
+        EXPECT_NEAR(rback.data(i), rin.data(i), 1.e-12);
+    }
+}
+
+TEST(FourierPlan, axis)
+{
+    using namespace solvcon;
+
+    // Transform the columns of a (16, 5) array with a rank-1 plan.
+    auto const in = make_signal(shape_type{16, 5}, 9);
+    SimpleArray<cplx> out(in.shape());
+    auto plan = FourierPlan<double>::construct(shape_type{16});
+    plan->fft(in, out, 0);
+    for (ssize_t j = 0; j < 5; ++j)
+    {
+        SimpleArray<cplx> column(shape_type{16});
+        SimpleArray<cplx> result(shape_type{16});
+        for (ssize_t i = 0; i < 16; ++i)
+        {
+            column(i) = in(i, j);
+            result(i) = out(i, j);
+        }
+        expect_near_array(direct_dft(column), result, 1.e-10);
+    }
+    EXPECT_THROW(plan->fft(in, out, 1), std::invalid_argument);
+    EXPECT_THROW(plan->fft(in, out, 2), std::invalid_argument);
+}
+
+TEST(FourierPlan, planned_batch)
+{
+    // Transforming a batch of signals with a plan gives what
+    // FourierTransform::fft() gives per signal.  profiling/profile_fft.py
+    // times both.
+    using namespace solvcon;
+
+    constexpr ssize_t n = 256;
+    constexpr ssize_t nbatch = 8;
+    auto const in = make_signal(shape_type{nbatch, n}, 10);
+    SimpleArray<cplx> planned(in.shape());
+    SimpleArray<cplx> single(shape_type{n});
+    SimpleArray<cplx> line(shape_type{n});
+
+    FourierPlan<double>::construct(shape_type{n})->fft(in, planned);
+    for (ssize_t ib = 0; ib < nbatch; ++ib)
+    {
+        std::copy_n(&in(ib, 0), n, line.begin());
+        FourierTransform::fft<Complex, double>(line, single);
+        for (ssize_t k = 0; k < n; ++k)
+        {
+            EXPECT_NEAR(planned(ib, k).real(), single(k).real(), 1.e-9);
+            EXPECT_NEAR(planned(ib, k).imag(), single(k).imag(), 1.e-9);
+        }
+    }
+}
+
+TEST(FourierPlan, mixed_radix)
+{
+    using namespace solvcon;
+
+    // Lengths of the factors 2, 3, 5, and 7 run the mixed-radix stages, and
+    // the lengths with a larger prime factor run Bluestein.
+    for (ssize_t const n : {5, 6, 9, 10, 15, 18, 45, 49, 60, 210, 343, 1000, 11, 22, 101, 1009})
+    {
+        auto const in = make_signal(shape_type{n}, 70 + static_cast<unsigned>(n));
+        SimpleArray<cplx> out(in.shape());
+        SimpleArray<cplx> back(in.shape());
+        auto plan = FourierPlan<double>::construct(shape_type{n});
+        plan->fft(in, out);
+        expect_near_array(direct_dft(in), out, 1.e-9);
+        plan->ifft(out, back);
+        expect_near_array(in, back, 1.e-12);
+    }
+
+    EXPECT_EQ(detail::smooth_radices(1000), (std::vector<size_t>{4, 2, 5, 5, 5}));
+    EXPECT_TRUE(detail::smooth_radices(1001).empty()); // 7 * 11 * 13
+    EXPECT_EQ(detail::next_smooth_length(2017), 2025); // 3^4 * 5^2
+    EXPECT_EQ(detail::next_smooth_length(1), 1);
+}
+
+TEST(FourierPlanCache, reuse)
+{
+    using namespace solvcon;
+
+    FourierPlanCache<double> cache(2);
+    EXPECT_EQ(cache.capacity(), 2);
+    FourierPlan<double> const * first = nullptr;
+    {
+        auto plan = cache.acquire(shape_type{1000});
+        first = plan.get();
+        EXPECT_EQ(cache.size(), 0);
+        // A plan in use is not handed out again.
+        auto other = cache.acquire(shape_type{1000});
+        EXPECT_NE(other.get(), first);
+    }
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.nhit(), 0);
+    EXPECT_EQ(cache.nmiss(), 2);
+    {
+        auto plan = cache.acquire(shape_type{1000});
+        EXPECT_EQ(plan->shape(), shape_type{1000});
+        EXPECT_EQ(cache.nhit(), 1);
+    }
+
+    // The least recently used plans are evicted beyond the capacity.
+    cache.acquire(shape_type{12});
+    cache.acquire(shape_type{4, 6});
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.nmiss(), 4);
+    cache.acquire(shape_type{12});
+    EXPECT_EQ(cache.nhit(), 2);
+    cache.acquire(shape_type{1000});
+    EXPECT_EQ(cache.nmiss(), 5);
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.size(), 1);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+
+    // A plan released after the cache is destroyed is just freed.
+    std::shared_ptr<FourierPlan<double>> survivor;
+    {
+        FourierPlanCache<double> local;
+        survivor = local.acquire(shape_type{30});
+    }
+    survivor.reset();
+}
+
+TEST(FourierPlanCache, threads)
+{
+    using namespace solvcon;
+
+    constexpr ssize_t n = 1000;
+    constexpr size_t nthread = 4;
+    constexpr size_t nrepeat = 50;
+    auto const in = make_signal(shape_type{n}, 91);
+    SimpleArray<cplx> expected(in.shape());
+    FourierPlan<double>::construct(shape_type{n})->fft(in, expected);
+
+    std::vector<double> errors(nthread, 0.0);
+    std::vector<std::thread> threads;
+    for (size_t it = 0; it < nthread; ++it)
+    {
+        threads.emplace_back(
+            [&, it]()
+            {
+                SimpleArray<cplx> out(in.shape());
+                for (size_t ir = 0; ir < nrepeat; ++ir)
+                {
+                    FourierTransform::fft<Complex, double>(in, out);
+                    for (size_t i = 0; i < out.size(); ++i)
+                    {
+                        double const dr = std::abs(out.data(i).real() - expected.data(i).real());
+                        double const di = std::abs(out.data(i).imag() - expected.data(i).imag());
+                        errors[it] = std::max({errors[it], dr, di});
+                    }
+                }
+            });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+    for (double const error : errors)
+    {
+        EXPECT_EQ(error, 0.0);
+    }
+    EXPECT_LE(FourierPlanCache<double>::instance().size(), FourierPlanCache<double>::DEFAULT_CAPACITY);
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
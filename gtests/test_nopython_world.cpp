@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026, solvcon team <contact@solvcon.net>
+ * BSD 3-Clause License, see COPYING
+ */
+
+#include <gtest/gtest.h>
+#include <solvcon/universe/World.hpp>
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+using namespace solvcon;
+
+namespace
+{
+
+using WorldFp64 = World<double>;
+using point_type = WorldFp64::point_type;
+
+// The geometry of a world as the test built it, with the owning shape id of
+// every segment and curve (-1 for bare geometry).
+struct Shadow
+{
+    struct Segment
+    {
+        std::array<double, 4> crd; // x0, y0, x1, y1
+        int32_t owner;
+    }; /* end struct Segment */
+
+    struct Curve
+    {
+        std::array<double, 4> cx;
+        std::array<double, 4> cy;
+        int32_t owner;
+    }; /* end struct Curve */
+
+    std::vector<Segment> segments;
+    std::vector<Curve> curves;
+    std::vector<bool> dead_shapes;
+
+    bool live(int32_t owner) const { return owner < 0 || !dead_shapes[owner]; }
+}; /* end struct Shadow */
+
+// Reference: test every pair, the way the diagnostics did before the broad
+// phase.
+WorldDiagnostics brute_force_intersections(Shadow const & shadow)
+{
+    WorldDiagnostics diag;
+    auto const & segs = shadow.segments;
+    for (size_t i = 0; i < segs.size(); ++i)
+    {
+        if (!shadow.live(segs[i].owner))
+        {
+            continue;
+        }
+        for (size_t j = i + 1; j < segs.size(); ++j)
+        {
+            if (!shadow.live(segs[j].owner))
+            {
+                continue;
+            }
+            auto const & a = segs[i].crd;
+            auto const & b = segs[j].crd;
+            auto const hit = detail::segment_proper_intersection(a[0], a[1], a[2], a[3], b[0], b[1], b[2], b[3]);
+            if (hit)
+            {
+                diag.add_intersection(segs[i].owner, segs[j].owner, (*hit)[0], (*hit)[1]);
+            }
+        }
+    }
+    for (auto const & seg : segs)
+    {
+        if (!shadow.live(seg.owner))
+        {
+            continue;
+        }
+        for (auto const & curve : shadow.curves)
+        {
+            if (!shadow.live(curve.owner))
+            {
+                continue;
+            }
+            auto const & a = seg.crd;
+            for (auto const & point : detail::segment_bezier_crossings(a[0], a[1], a[2], a[3], curve.cx, curve.cy))
+            {
+                diag.add_intersection(seg.owner, curve.owner, point[0], point[1]);
+            }
+        }
+    }
+    return diag;
+}
+
+// A random world of lines, bare segments, circles, and bare curves, some of
+// the shapes removed again. With @p grid set the coordinates are small
+// integers, so shared endpoints, T-junctions, and collinear overlaps are
+// frequent.
+std::shared_ptr<WorldFp64> make_random_world(Shadow & shadow, size_t nitem, uint32_t seed, bool grid)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> real_dist(0.0, 20.0);
+    std::uniform_int_distribution<int> int_dist(0, 8);
+    std::uniform_int_distribution<int> kind_dist(0, 9);
+    auto coord = [&]()
+    { return grid ? static_cast<double>(int_dist(rng)) : real_dist(rng); };
+
+    auto world = WorldFp64::construct();
+    for (size_t item = 0; item < nitem; ++item)
+    {
+        int const kind = kind_dist(rng);
+        if (kind < 7)
+        {
+            std::array<double, 4> crd{coord(), coord(), coord(), coord()};
+            if (crd[0] == crd[2] && crd[1] == crd[3])
+            {
+                crd[2] += 1.0;
+            }
+            if (kind < 4)
+            {
+                int32_t const sid = world->add_line(crd[0], crd[1], crd[2], crd[3]);
+                shadow.segments.push_back({crd, sid});
+                shadow.dead_shapes.push_back(false);
+            }
+            else
+            {
+                world->add_segment(point_type(crd[0], crd[1], 0), point_type(crd[2], crd[3], 0));
+                shadow.segments.push_back({crd, -1});
+            }
+        }
+        else if (kind < 9)
+        {
+            double const r = grid ? 1.0 + int_dist(rng) % 3 : 0.5 + real_dist(rng) / 4;
+            int32_t const sid = world->add_circle(coord(), coord(), r);
+            shadow.dead_shapes.push_back(false);
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                auto const c = world->shape_curve(sid, i);
+                shadow.curves.push_back({{c.x0(), c.x1(), c.x2(), c.x3()}, {c.y0(), c.y1(), c.y2(), c.y3()}, sid});
+            }
+        }
+        else
+        {
+            std::array<double, 4> cx{coord(), coord(), coord(), coord()};
+            std::array<double, 4> cy{coord(), coord(), coord(), coord()};
+            cx[3] += 0.5; // keep the controls from all coinciding
+            world->add_bezier(point_type(cx[0], cy[0], 0), point_type(cx[1], cy[1], 0), point_type(cx[2], cy[2], 0), point_type(cx[3], cy[3], 0));
+            shadow.curves.push_back({cx, cy, -1});
+        }
+    }
+    // Remove about a tenth of the shapes.
+    for (size_t sid = 0; sid < shadow.dead_shapes.size(); sid += 10)
+    {
+        world->remove_shape(static_cast<int32_t>(sid));
+        shadow.dead_shapes[sid] = true;
+    }
+    return world;
+}
+
+void expect_same_intersections(WorldFp64 const & world, Shadow const & shadow)
+{
+    // The expected value carries no degeneracies and neither does the world,
+    // so the serialized diagnostics must appear verbatim in the state.
+    std::string const expected = brute_force_intersections(shadow).to_json();
+    std::string const state = world.describe_state(DescribeLevel::DIAGNOSTICS);
+    EXPECT_NE(state.find(expected), std::string::npos) << "expected " << expected << "\nstate " << state;
+}
+
+} /* end namespace */
+
+TEST(World, segment_bezier_crossings)
+{
+    // The quarter arcs of a unit circle about the origin against the x axis
+    // from -2 to 2: the arcs that start or end on the axis only meet it at an
+    // endpoint, so a chord through the circle crosses nothing, while a line at
+    // y = 0.5 crosses the two upper arcs.
+    auto world = WorldFp64::construct();
+    int32_t const circle = world->add_circle(0, 0, 1);
+    world->add_line(-2, 0, 2, 0);
+    int32_t const line = world->add_line(-2, 0.5, 2, 0.5);
+    std::string const state = world->describe_state(DescribeLevel::DIAGNOSTICS);
+    EXPECT_EQ(state.find(std::format("\"shapes\":[{},{}]", circle + 1, circle)), std::string::npos);
+    size_t const first = state.find(std::format("\"shapes\":[{},{}]", line, circle));
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_NE(state.find(std::format("\"shapes\":[{},{}]", line, circle), first + 1), std::string::npos);
+
+    // A curve tangent to a segment touches without crossing it.
+    auto const touch = detail::segment_bezier_crossings(-1, 1, 1, 1, {-1, -0.5, 0.5, 1}, {0, 4.0 / 3, 4.0 / 3, 0});
+    EXPECT_TRUE(touch.empty());
+    // A curve lying on the segment's line has no single crossing.
+    auto const lying = detail::segment_bezier_crossings(0, 0, 3, 0, {0.5, 1, 2, 2.5}, {0, 0, 0, 0});
+    EXPECT_TRUE(lying.empty());
+    // An S-curve crossing the segment three times, in curve order.
+    auto const s_curve = detail::segment_bezier_crossings(-1, 0, 4, 0, {0, 1, 2, 3}, {-1, 3, -3, 1});
+    ASSERT_EQ(s_curve.size(), 3);
+    EXPECT_LT(s_curve[0][0], s_curve[1][0]);
+    EXPECT_LT(s_curve[1][0], s_curve[2][0]);
+    EXPECT_DOUBLE_EQ(s_curve[1][0], 1.5);
+    EXPECT_DOUBLE_EQ(s_curve[1][1], 0.0);
+}
+
+TEST(World, intersections_random)
+{
+    for (uint32_t seed = 0; seed < 8; ++seed)
+    {
+        for (bool const grid : {false, true})
+        {
+            Shadow shadow;
+            auto const world = make_random_world(shadow, 150, seed, grid);
+            SCOPED_TRACE(std::format("seed {} grid {}", seed, grid));
+            expect_same_intersections(*world, shadow);
+        }
+    }
+}
+
+TEST(World, diagnostics_incremental)
+{
+    // Random edits, undos, and redos; after each the incremental diagnostics
+    // must equal the ones computed from scratch.
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> pos(0.0, 20.0);
+    std::uniform_real_distribution<double> step(-3.0, 3.0);
+    std::uniform_int_distribution<int> op_dist(0, 11);
+    auto world = WorldFp64::construct();
+    std::vector<int32_t> shapes;
+    for (size_t iop = 0; iop < 400; ++iop)
+    {
+        int const op = op_dist(rng);
+        auto const pick = [&]()
+        { return shapes[std::uniform_int_distribution<size_t>(0, shapes.size() - 1)(rng)]; };
+        if (op < 3 || shapes.empty())
+        {
+            // Every fifth line has zero length to exercise the degeneracies.
+            double const x = pos(rng);
+            double const y = pos(rng);
+            bool const degenerate = iop % 5 == 0;
+            shapes.push_back(world->add_line(x, y, degenerate ? x : pos(rng), degenerate ? y : pos(rng)));
+        }
+        else if (op == 3)
+        {
+            shapes.push_back(world->add_circle(pos(rng), pos(rng), iop % 7 == 0 ? 0.0 : 1.0 + pos(rng) / 5));
+        }
+        else if (op == 4)
+        {
+            shapes.push_back(world->add_triangle(pos(rng), pos(rng), pos(rng), pos(rng), pos(rng), pos(rng)));
+        }
+        else if (op == 5)
+        {
+            double const x = pos(rng);
+            world->add_segment(point_type(x, pos(rng), 0), point_type(iop % 4 == 0 ? x : pos(rng), pos(rng), 0));
+        }
+        else if (op == 6)
+        {
+            world->add_bezier(point_type(pos(rng), pos(rng), 0), point_type(pos(rng), pos(rng), 0), point_type(pos(rng), pos(rng), 0), point_type(pos(rng), pos(rng), 0));
+        }
+        else if (op == 7)
+        {
+            int32_t const sid = pick();
+            if (world->shape_is_live(sid))
+            {
+                world->translate_shape(sid, step(rng), step(rng));
+            }
+        }
+        else if (op == 8)
+        {
+            int32_t const sid = pick();
+            if (world->shape_is_live(sid))
+            {
+                world->rotate_shape(sid, step(rng), pos(rng), pos(rng));
+            }
+        }
+        else if (op == 9)
+        {
+            int32_t const sid = pick();
+            if (world->shape_is_live(sid))
+            {
+                world->remove_shape(sid);
+            }
+        }
+        else if (op == 10)
+        {
+            world->undo();
+        }
+        else
+        {
+            world->redo();
+        }
+        // Skip some checks so that several changes pile up between syncs.
+        if (iop % 3 != 0)
+        {
+            continue;
+        }
+        SCOPED_TRACE(std::format("op {} kind {}", iop, op));
+        ASSERT_EQ(world->diagnostics().to_json(), world->compute_diagnostics().to_json());
+        if (iop == 200)
+        {
+            world->clear();
+            shapes.clear();
+        }
+    }
+    EXPECT_FALSE(world->diagnostics().intersections().empty());
+    EXPECT_FALSE(world->diagnostics().degeneracies().empty());
+}
+
+TEST(World, diagnostics_follow_pad_edits)
+{
+    auto world = WorldFp64::construct();
+    world->add_line(0, 0, 10, 10);
+    world->add_line(0, 10, 10, 20);
+    EXPECT_TRUE(world->diagnostics().intersections().empty());
+
+    // Moving the second line through the pad makes the two cross.
+    world->segments()->set_at(1, point_type(0, 10, 0), point_type(10, 0, 0));
+    EXPECT_EQ(world->diagnostics().intersections().size(), 1);
+    EXPECT_EQ(world->diagnostics().to_json(), world->compute_diagnostics().to_json());
+
+    // A handle kept around may edit the pad again at any time.
+    auto const segments = world->segments();
+    world->diagnostics();
+    segments->set_at(1, point_type(0, 10, 0), point_type(10, 20, 0));
+    EXPECT_TRUE(world->diagnostics().intersections().empty());
+    EXPECT_EQ(world->diagnostics().to_json(), world->compute_diagnostics().to_json());
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,75 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time adding an array of the same shape, a row, and a column to a matrix with
+SimpleArray.add, which broadcasts like numpy, with numpy as the reference.
+The wall time comes from the call profiler.
+"""
+
+import functools
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+@profile_function
+def add_np(src1, src2):
+    return np.add(src1, src2)
+
+
+@profile_function
+def add_sa(src1, src2):
+    return src1.add(src2)
+
+
+def profile_broadcast(nrow, ncol, it=5):
+    rng = np.random.default_rng(21)
+    na = rng.random((nrow, ncol))
+    others = (("same shape", rng.random((nrow, ncol))),
+              ("row", rng.random(ncol)),
+              ("column", rng.random((nrow, 1))))
+    sa = solvcon.SimpleArrayFloat64(array=na)
+
+    for title, nother in others:
+        sother = solvcon.SimpleArrayFloat64(array=nother)
+        solvcon.call_profiler.reset()
+        for _ in range(it):
+            add_np(na, nother)
+            add_sa(sa, sother)
+        res = solvcon.call_profiler.result()["children"]
+        out = {r["name"].replace("add_", ""): r["total_time"] / r["count"]
+               for r in res if r["name"].startswith("add_")}
+
+        print(f"## add {title} {nother.shape} to ({nrow}, {ncol})\n")
+
+        def print_row(*cols):
+            print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+        print_row("func", "per call (ms)", "cmp to np")
+        print_row("-" * 10, "-" * 15, "-" * 15)
+        base = out["np"]
+        for name, value in out.items():
+            print_row(name, f"{value:.3E}", f"{value / base:.3f}")
+        print()
+
+
+def main():
+    for n in [256, 2048]:
+        profile_broadcast(n, n)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,83 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time a post-processing style loop that creates short-lived arrays, with the
+buffers from the system allocator, a PoolBufferAllocator, and an
+ArenaBufferAllocator.  The wall time comes from the call profiler.
+"""
+
+import contextlib
+import functools
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def run(x, niter):
+    for _ in range(niter):
+        x.mul(x).add(x).abs()
+
+
+@profile_function
+def temporaries_malloc(x, niter):
+    run(x, niter)
+
+
+@profile_function
+def temporaries_pool(x, niter):
+    run(x, niter)
+
+
+@profile_function
+def temporaries_arena(x, niter):
+    run(x, niter)
+
+
+def profile_temporaries(nelem, niter, it=3):
+    x = solvcon.SimpleArrayFloat64((nelem,), value=1.5)
+    allocators = (
+        (temporaries_malloc, contextlib.nullcontext()),
+        (temporaries_pool, solvcon.PoolBufferAllocator()),
+        (temporaries_arena, solvcon.ArenaBufferAllocator(chunk_size=64 << 20)),
+    )
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        for func, allocator in allocators:
+            with allocator:
+                func(x, niter)
+    res = solvcon.call_profiler.result()["children"]
+    out = {r["name"].replace("temporaries_", ""): r["total_time"] / r["count"]
+           for r in res if r["name"].startswith("temporaries_")}
+
+    print(f"## temporaries nelem = {nelem} niter = {niter}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("allocator", "per loop (ms)", "cmp to malloc")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = out["malloc"]
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{value / base:.3f}")
+    print()
+
+
+def main():
+    profile_temporaries(16, 20000)
+    profile_temporaries(1 << 20, 50)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
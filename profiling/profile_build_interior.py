@@ -0,0 +1,86 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time StaticMesh.build_interior, which extracts the faces and the edges, over
+thread counts.  The wall time comes from the call profiler.
+"""
+
+import functools
+import os
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_mesh(nx, ny):
+    """A structured nx-by-ny triangle grid without its interior built."""
+    mh = solvcon.StaticMesh(ndim=2, nnode=(nx + 1) * (ny + 1), nface=0,
+                            ncell=2 * nx * ny)
+    ii, jj = np.meshgrid(np.arange(nx + 1), np.arange(ny + 1))
+    mh.ndcrd.ndarray[:, 0] = ii.ravel() / nx
+    mh.ndcrd.ndarray[:, 1] = jj.ravel() / ny
+    mh.cltpn.ndarray[:] = solvcon.StaticMesh.TRIANGLE
+    i, j = np.meshgrid(np.arange(nx), np.arange(ny))
+    n0 = (j * (nx + 1) + i).ravel()
+    n1, n2, n3 = n0 + 1, n0 + nx + 2, n0 + nx + 1
+    three = np.full_like(n0, 3)
+    mh.clnds.ndarray[:, :4] = np.concatenate(
+        [np.stack([three, n0, n1, n2], axis=1),
+         np.stack([three, n0, n2, n3], axis=1)])
+    return mh
+
+
+@profile_function
+def build_interior(mh):
+    mh.build_interior(do_metric=False)
+
+
+def profile_build_interior(nx, nthreads, it=3):
+    out = {}
+    for nthread in nthreads:
+        solvcon.call_profiler.reset()
+        for _ in range(it):
+            mh = make_mesh(nx, nx)
+            mh.nthread = nthread
+            build_interior(mh)
+        res = solvcon.call_profiler.result()["children"]
+        out[nthread] = sum(r["total_time"] / r["count"] for r in res
+                           if r["name"] == "build_interior")
+
+    print(f"## build_interior ncell = {2 * nx * nx}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("nthread", "per call (ms)", "speedup")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = out[nthreads[0]]
+    for nthread, value in out.items():
+        print_row(f"{nthread}", f"{value:.3E}", f"{base / value:.3f}")
+    print()
+
+
+def main():
+    nthreads = [1, 2, 4]
+    ncpu = os.cpu_count() or 1
+    if ncpu > 4:
+        nthreads.append(ncpu)
+    for nx in [128, 512]:
+        profile_build_interior(nx, nthreads)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
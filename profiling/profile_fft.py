@@ -0,0 +1,139 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+import functools
+import numpy as np
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+@profile_function
+def profile_fft_np(narr, axes):
+    return np.fft.fftn(narr, axes=axes)
+
+
+@profile_function
+def profile_fft_plan(plan, sarr, sout):
+    plan.fft(sarr, sout)
+
+
+@profile_function
+def profile_fft_single(srows, sout):
+    for srow in srows:
+        solvcon.FourierTransform.fft(srow, sout)
+
+
+@profile_function
+def profile_rfft_np(narr, axes):
+    return np.fft.rfftn(narr, axes=axes)
+
+
+@profile_function
+def profile_rfft_plan(plan, sarr, sout):
+    plan.rfft(sarr, sout)
+
+
+@profile_function
+def profile_repeat_plan(sarr, sout):
+    solvcon.FourierPlanFloat64(sarr.shape).fft(sarr, sout)
+
+
+@profile_function
+def profile_repeat_cached(sarr, sout):
+    solvcon.FourierTransform.fft(sarr, sout)
+
+
+def print_table(title, res, prefix, base="np"):
+    print(f"## {title}\n")
+    out = {}
+    for r in res:
+        if not r["name"].startswith(prefix):
+            continue
+        name = r["name"].replace(prefix, "")
+        out[name] = r["total_time"] / r["count"]
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *(cols[0:3])))
+
+    print_row('func', 'per call (ms)', f'cmp to {base}')
+    print_row('-' * 10, '-' * 15, '-' * 15)
+    npbase = out[base]
+    for k, v in out.items():
+        print_row(f"{k:8s}", f"{v:.3E}", f"{v / npbase:.3f}")
+    print()
+
+
+def profile_fft(shape, batch, it=10):
+    """
+    Time a batch of complex and real transforms of the given shape with
+    numpy.fft and a FourierPlanFloat64 that is made once and reused.  A
+    one-dimensional batch is also transformed one signal at a time with
+    FourierTransform.fft.
+    """
+    full = (batch,) + shape
+    half = full[:-1] + (shape[-1] // 2 + 1,)
+    axes = tuple(range(1, len(full)))
+    plan = solvcon.FourierPlanFloat64(shape)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        cdata = np.random.rand(*full) + 1j * np.random.rand(*full)
+        rdata = np.random.rand(*full)
+        scin = solvcon.SimpleArrayComplex128(array=cdata)
+        scout = solvcon.SimpleArrayComplex128(full)
+        srin = solvcon.SimpleArrayFloat64(array=rdata)
+        srout = solvcon.SimpleArrayComplex128(half)
+
+        profile_fft_np(cdata, axes)
+        profile_fft_plan(plan, scin, scout)
+        if len(shape) == 1:
+            srows = [solvcon.SimpleArrayComplex128(array=row) for row in cdata]
+            profile_fft_single(srows, solvcon.SimpleArrayComplex128(shape))
+        profile_rfft_np(rdata, axes)
+        profile_rfft_plan(plan, srin, srout)
+
+    res = solvcon.call_profiler.result()["children"]
+    text = "x".join(str(n) for n in shape)
+    print_table(f"fft {text} batch {batch}", res, "profile_fft_")
+    print_table(f"rfft {text} batch {batch}", res, "profile_rfft_")
+
+
+def profile_repeated_length(n, it=256):
+    """
+    Time repeated transforms of one length through the plan cache of
+    FourierTransform against constructing a plan per call.
+    """
+    data = np.random.rand(n) + 1j * np.random.rand(n)
+    sarr = solvcon.SimpleArrayComplex128(array=data)
+    sout = solvcon.SimpleArrayComplex128((n,))
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        profile_repeat_plan(sarr, sout)
+        profile_repeat_cached(sarr, sout)
+
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"repeated fft {n}", res, "profile_repeat_", base="plan")
+
+
+def main():
+    for n in (256, 1000, 4096, 65536):
+        profile_fft((n,), 64)
+    profile_fft((256, 256), 4)
+    profile_fft((64, 64, 64), 1)
+    for n in (1000, 4096):
+        profile_repeated_length(n)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,166 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Compare the Gmsh string reader against the streaming GmshStream reader.
+
+The script writes a structured nx-by-nx triangle mesh in the MSH 2.2 ASCII,
+4.1 ASCII, and 4.1 binary formats to a temporary directory.  The Gmsh reader
+is timed with the file read into memory first, as its constructor takes the
+contents; GmshStream reads the file itself.  Only the parsing is timed: both
+readers build the StaticMesh with the same code in to_block().
+"""
+
+import argparse
+import functools
+import os
+import tempfile
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_grid(nx):
+    """Node coordinates and the 1-based triangle node tags of a nx-by-nx
+    grid over the unit square."""
+    ii, jj = np.meshgrid(np.arange(nx + 1), np.arange(nx + 1))
+    ndcrd = np.zeros(((nx + 1) ** 2, 3), dtype='float64')
+    ndcrd[:, 0] = ii.ravel() / nx
+    ndcrd[:, 1] = jj.ravel() / nx
+    i, j = np.meshgrid(np.arange(nx), np.arange(nx))
+    n0 = (j * (nx + 1) + i).ravel() + 1
+    n1, n2, n3 = n0 + 1, n0 + nx + 2, n0 + nx + 1
+    tris = np.concatenate([np.stack([n0, n1, n2], axis=1),
+                           np.stack([n0, n2, n3], axis=1)])
+    return ndcrd, tris
+
+
+def write_msh22(path, ndcrd, tris):
+    nnode, ntri = len(ndcrd), len(tris)
+    with open(path, 'w') as fobj:
+        fobj.write("$MeshFormat\n2.2 0 8\n$EndMeshFormat\n")
+        fobj.write(f"$Nodes\n{nnode}\n")
+        rows = np.column_stack([np.arange(1, nnode + 1), ndcrd])
+        np.savetxt(fobj, rows, fmt=["%d", "%.17g", "%.17g", "%.17g"])
+        fobj.write(f"$EndNodes\n$Elements\n{ntri}\n")
+        head = np.tile([2, 2, 1, 1], (ntri, 1))
+        rows = np.column_stack([np.arange(1, ntri + 1), head, tris])
+        np.savetxt(fobj, rows, fmt="%d")
+        fobj.write("$EndElements\n")
+
+
+def write_msh41(path, ndcrd, tris, binary):
+    nnode, ntri = len(ndcrd), len(tris)
+    tags = np.arange(1, nnode + 1, dtype='uint64')
+    rows = np.column_stack([np.arange(1, ntri + 1), tris]).astype('uint64')
+    with open(path, 'wb') as fobj:
+        def text(value):
+            fobj.write(value.encode())
+
+        if binary:
+            text("$MeshFormat\n4.1 1 8\n")
+            fobj.write(np.int32(1).tobytes())
+            text("\n$EndMeshFormat\n$Nodes\n")
+            fobj.write(np.array([1, nnode, 1, nnode], 'uint64').tobytes())
+            fobj.write(np.array([2, 1, 0], 'int32').tobytes())
+            fobj.write(np.uint64(nnode).tobytes())
+            fobj.write(tags.tobytes())
+            fobj.write(ndcrd.tobytes())
+            text("\n$EndNodes\n$Elements\n")
+            fobj.write(np.array([1, ntri, 1, ntri], 'uint64').tobytes())
+            fobj.write(np.array([2, 1, 2], 'int32').tobytes())
+            fobj.write(np.uint64(ntri).tobytes())
+            fobj.write(rows.tobytes())
+            text("\n$EndElements\n")
+        else:
+            text("$MeshFormat\n4.1 0 8\n$EndMeshFormat\n")
+            text(f"$Nodes\n1 {nnode} 1 {nnode}\n2 1 0 {nnode}\n")
+            np.savetxt(fobj, tags, fmt="%d")
+            np.savetxt(fobj, ndcrd, fmt="%.17g")
+            text(f"$EndNodes\n$Elements\n1 {ntri} 1 {ntri}\n2 1 2 {ntri}\n")
+            np.savetxt(fobj, rows, fmt="%d")
+            text("$EndElements\n")
+
+
+@profile_function
+def gmsh_msh22(path):
+    with open(path, 'rb') as fobj:
+        return solvcon.Gmsh(fobj.read())
+
+
+@profile_function
+def stream_msh22(path):
+    return solvcon.GmshStream(path)
+
+
+@profile_function
+def stream_msh41(path):
+    return solvcon.GmshStream(path)
+
+
+@profile_function
+def stream_msh41_binary(path):
+    return solvcon.GmshStream(path)
+
+
+def profile_reader(nx, tmpdir, it=3):
+    ndcrd, tris = make_grid(nx)
+    paths = {
+        "msh22": os.path.join(tmpdir, "grid22.msh"),
+        "msh41": os.path.join(tmpdir, "grid41.msh"),
+        "msh41_binary": os.path.join(tmpdir, "grid41b.msh"),
+    }
+    write_msh22(paths["msh22"], ndcrd, tris)
+    write_msh41(paths["msh41"], ndcrd, tris, binary=False)
+    write_msh41(paths["msh41_binary"], ndcrd, tris, binary=True)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        gmsh_msh22(paths["msh22"])
+        stream_msh22(paths["msh22"])
+        stream_msh41(paths["msh41"])
+        stream_msh41_binary(paths["msh41_binary"])
+    res = solvcon.call_profiler.result()["children"]
+    out = {r["name"]: r["total_time"] / r["count"] for r in res}
+
+    print(f"## nnode = {len(ndcrd)} nelement = {len(tris)}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:20s} | {:12s} | {:15s} | {:12s} |", *cols))
+
+    print_row("reader", "parse (ms)", "cmp to Gmsh", "file (MB)")
+    print_row("-" * 20, "-" * 12, "-" * 15, "-" * 12)
+    base = out["gmsh_msh22"]
+    for name, key in (("gmsh_msh22", "msh22"), ("stream_msh22", "msh22"),
+                      ("stream_msh41", "msh41"),
+                      ("stream_msh41_binary", "msh41_binary")):
+        size = os.path.getsize(paths[key]) / 1.e6
+        print_row(name, f"{out[name]:.3E}", f"{out[name] / base:.3f}",
+                  f"{size:.1f}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--nx", type=int, action="append")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for nx in args.nx or [100, 500]:
+            profile_reader(nx, tmpdir)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,152 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+import functools
+import numpy as np
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+@profile_function
+def profile_batch_standard(kf, zs):
+    return kf.batch_filter(zs, mode="standard")
+
+
+@profile_function
+def profile_batch_steady_state(kf, zs):
+    return kf.batch_filter(zs, mode="steady_state")
+
+
+@profile_function
+def profile_batch_square_root(kf, zs):
+    return kf.batch_filter(zs, mode="square_root")
+
+
+@profile_function
+def profile_tracks_single(filters, zs):
+    for z in zs:
+        for kf, zt in zip(filters, z):
+            kf.predict()
+            kf.update(zt)
+
+
+@profile_function
+def profile_tracks_bank(bank, zs):
+    for z in zs:
+        bank.predict()
+        bank.update(z)
+
+
+def tracker_model(dt):
+    """
+    Constant-acceleration track with position and velocity measurements.
+    """
+    f = np.array([[1.0, dt, 0.5 * dt * dt],
+                  [0.0, 1.0, dt],
+                  [0.0, 0.0, 1.0]])
+    h = np.array([[1.0, 0.0, 0.0],
+                  [0.0, 1.0, 0.0]])
+    return dict(
+        f=solvcon.SimpleArrayFloat64(array=f),
+        h=solvcon.SimpleArrayFloat64(array=h),
+        q=solvcon.SimpleArrayFloat64(array=np.diag([1.e-4, 1.e-4, 1.e-2])),
+        r=solvcon.SimpleArrayFloat64(array=np.diag([0.25, 0.04])),
+        p=solvcon.SimpleArrayFloat64(array=np.eye(3) * 10.0),
+    )
+
+
+def make_tracker(dt, solve_steady_state=True):
+    kf = solvcon.KalmanFilterFp64(
+        x=solvcon.SimpleArrayFloat64(array=np.zeros(3)), **tracker_model(dt))
+    if solve_steady_state:
+        # Solve the steady state outside the timed calls.
+        kf.steady_state_covariance()
+    return kf
+
+
+def print_table(title, res, prefix, nsample):
+    print(f"## {title}\n")
+    out = {}
+    for r in res:
+        if not r["name"].startswith(prefix):
+            continue
+        name = r["name"].replace(prefix, "")
+        out[name] = r["total_time"] / r["count"]
+
+    def print_row(*cols):
+        print(str.format("| {:12s} | {:15s} | {:15s} |", *(cols[0:3])))
+
+    print_row('mode', 'per call (ms)', 'samples/s')
+    print_row('-' * 12, '-' * 15, '-' * 15)
+    for k, v in out.items():
+        print_row(f"{k:12s}", f"{v:.3E}", f"{nsample / (v * 1.e-3):.3E}")
+    print()
+
+
+def profile_batch_filter(nsample, rate=1000.0, it=5):
+    """
+    Time batch_filter in each mode on nsample measurements of a track
+    sampled at rate Hz.
+    """
+    dt = 1.0 / rate
+    t = np.arange(nsample) * dt
+    zs = np.stack([3.0 * np.sin(t), 3.0 * np.cos(t)], axis=1)
+    zs += np.random.normal(0.0, 0.3, zs.shape)
+    szs = solvcon.SimpleArrayFloat64(array=zs)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        profile_batch_standard(make_tracker(dt), szs)
+        profile_batch_steady_state(make_tracker(dt), szs)
+        profile_batch_square_root(make_tracker(dt), szs)
+
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"batch_filter {nsample} samples at {rate:g} Hz", res,
+                "profile_batch_", nsample)
+
+
+def profile_tracks(ntrack, nstep=100, rate=1000.0, it=3):
+    """
+    Time nstep predict and update steps of ntrack tracks, with one filter
+    per track and with a filter bank.
+    """
+    dt = 1.0 / rate
+    zs = np.random.normal(0.0, 0.3, (nstep, ntrack, 2))
+    single_zs = [[solvcon.SimpleArrayFloat64(array=zt) for zt in z]
+                 for z in zs]
+    bank_zs = [solvcon.SimpleArrayFloat64(array=z) for z in zs]
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        filters = [make_tracker(dt, solve_steady_state=False)
+                   for _ in range(ntrack)]
+        profile_tracks_single(filters, single_zs)
+        bank = solvcon.KalmanFilterBankFp64(
+            x=solvcon.SimpleArrayFloat64(array=np.zeros((ntrack, 3))),
+            **tracker_model(dt))
+        profile_tracks_bank(bank, bank_zs)
+
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"{nstep} steps of {ntrack} tracks", res,
+                "profile_tracks_", nstep * ntrack)
+
+
+def main():
+    for nsample in (1000, 10000, 100000):
+        profile_batch_filter(nsample)
+    for ntrack in (10, 100, 1000):
+        profile_tracks(ntrack)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
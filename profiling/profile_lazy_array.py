@@ -0,0 +1,80 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time the eager chain a.add(b).mul(c).sub(d) against the fused LazyArray
+expression, with numpy as the reference.  Each eager operation copies its
+left operand and then reads two arrays and writes one; the fused pass reads
+four arrays and writes one.  The wall time comes from the call profiler.
+"""
+
+import functools
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+@profile_function
+def chain_np(a, b, c, d):
+    return (a + b) * c - d
+
+
+@profile_function
+def chain_eager(a, b, c, d):
+    return a.add(b).mul(c).sub(d)
+
+
+@profile_function
+def chain_lazy(a, b, c, d):
+    return a.lazy().add(b).mul(c).sub(d).evaluate()
+
+
+def profile_chain(n, it=5):
+    rng = np.random.default_rng(11)
+    nds = [rng.uniform(-2, 2, n) for _ in range(4)]
+    sas = [solvcon.SimpleArrayFloat64(array=nd) for nd in nds]
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        chain_np(*nds)
+        chain_eager(*sas)
+        chain_lazy(*sas)
+    res = solvcon.call_profiler.result()["children"]
+    out = {r["name"].replace("chain_", ""): r["total_time"] / r["count"]
+           for r in res if r["name"].startswith("chain_")}
+
+    mb = n * 8 / (1024 * 1024)
+    print(f"## a.add(b).mul(c).sub(d) n = {n} "
+          f"(modeled traffic eager {15 * mb:.0f} MB, lazy {5 * mb:.0f} MB)\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("func", "per call (ms)", "cmp to np")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = out["np"]
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{value / base:.3f}")
+    print()
+
+
+def main():
+    # The last size is larger than the last-level cache.
+    for n in [1 << 12, 1 << 18, 1 << 23]:
+        profile_chain(n)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,115 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time LuFactorizationFloat64 on matrices below and above BLOCKED_MIN_SIZE,
+where it switches from the unblocked kernel to the blocked algorithm, and
+LuFactorizationBatchFloat64 on many small systems against one factorization
+per system.  numpy.linalg is the reference.  The wall time comes from the
+call profiler.
+"""
+
+import functools
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+@profile_function
+def factorize_np(na, nb):
+    return np.linalg.solve(na, nb)
+
+
+@profile_function
+def factorize_lu(sa, sb):
+    return solvcon.LuFactorizationFloat64(sa).solve(sb)
+
+
+@profile_function
+def systems_np(na, nb):
+    return np.linalg.solve(na, nb[..., None])
+
+
+@profile_function
+def systems_single(sas, sbs):
+    return [solvcon.LuFactorizationFloat64(sa).solve(sb)
+            for sa, sb in zip(sas, sbs)]
+
+
+@profile_function
+def systems_batch(sa, sb):
+    return solvcon.LuFactorizationBatchFloat64(sa).solve(sb)
+
+
+def print_table(title, res, prefix, unit, count):
+    print(f"## {title}\n")
+    out = {r["name"].replace(prefix, ""): r["total_time"] / r["count"]
+           for r in res if r["name"].startswith(prefix)}
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("func", "per call (ms)", unit)
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{count / (value * 1.e-3):.3E}")
+    print()
+
+
+def profile_factorize(n, it=3):
+    rng = np.random.default_rng(4)
+    na = rng.uniform(-1, 1, (n, n)) + n * np.eye(n)
+    nb = rng.uniform(-1, 1, n)
+    sa = solvcon.SimpleArrayFloat64(array=na)
+    sb = solvcon.SimpleArrayFloat64(array=nb)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        factorize_np(na, nb)
+        factorize_lu(sa, sb)
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"factorize and solve {n}x{n}", res, "factorize_",
+                "GFLOP/s", 2.0 / 3.0 * n ** 3 * 1.e-9)
+
+
+def profile_systems(nbatch, n=5, it=3):
+    rng = np.random.default_rng(12)
+    na = rng.uniform(-1, 1, (nbatch, n, n)) + n * np.eye(n)
+    nb = rng.uniform(-1, 1, (nbatch, n))
+    sa = solvcon.SimpleArrayFloat64(array=na)
+    sb = solvcon.SimpleArrayFloat64(array=nb)
+    sas = [solvcon.SimpleArrayFloat64(array=a) for a in na]
+    sbs = [solvcon.SimpleArrayFloat64(array=b) for b in nb]
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        systems_np(na, nb)
+        systems_single(sas, sbs)
+        systems_batch(sa, sb)
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"{nbatch} {n}x{n} systems", res, "systems_", "systems/s",
+                nbatch)
+
+
+def main():
+    # BLOCKED_MIN_SIZE is 256.
+    for n in [128, 512, 1536]:
+        profile_factorize(n)
+    for nbatch in [1000, 20000]:
+        profile_systems(nbatch)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
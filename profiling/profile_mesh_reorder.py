@@ -0,0 +1,133 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Compare EulerCore.march on a shuffled mesh against the same mesh renumbered
+by StaticMesh.reorder.
+
+The shuffled cell order stands in for the order a mesh reader produces.  The
+wall time comes from the call profiler.  The neighbor distance (mean and
+maximum |icl - jcl| over the interior faces) is the locality the reorder
+improves.  For the hardware counters run the script under perf, e.g.::
+
+    perf stat -e cache-misses,cache-references \\
+        python3 profiling/profile_mesh_reorder.py --ordering hilbert
+"""
+
+import argparse
+import functools
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_mesh(nx, ny, seed=7):
+    """A structured nx-by-ny triangle grid whose cells are shuffled."""
+    mh = solvcon.StaticMesh(ndim=2, nnode=(nx + 1) * (ny + 1), nface=0,
+                            ncell=2 * nx * ny)
+    ii, jj = np.meshgrid(np.arange(nx + 1), np.arange(ny + 1))
+    mh.ndcrd.ndarray[:, 0] = ii.ravel() / nx
+    mh.ndcrd.ndarray[:, 1] = jj.ravel() / ny
+    mh.cltpn.ndarray[:] = solvcon.StaticMesh.TRIANGLE
+    i, j = np.meshgrid(np.arange(nx), np.arange(ny))
+    n0 = (j * (nx + 1) + i).ravel()
+    n1, n2, n3 = n0 + 1, n0 + nx + 2, n0 + nx + 1
+    three = np.full_like(n0, 3)
+    clnds = np.concatenate([np.stack([three, n0, n1, n2], axis=1),
+                            np.stack([three, n0, n2, n3], axis=1)])
+    rng = np.random.default_rng(seed)
+    mh.clnds.ndarray[:, :4] = clnds[rng.permutation(len(clnds))]
+    mh.build_interior()
+    mh.build_boundary()
+    mh.build_ghost()
+    return mh
+
+
+def neighbor_distance(mh):
+    fccls = mh.fccls.ndarray[mh.ngstface:, :2]
+    inner = fccls[fccls[:, 1] >= 0]
+    dist = np.abs(inner[:, 0] - inner[:, 1])
+    return dist.mean(), dist.max()
+
+
+def make_core(mh, nthread):
+    ec = solvcon.EulerCore(mesh=mh, time_increment=1.e-4)
+    ec.nthread = nthread
+    ec.init_solution(gamma=1.4, rho=1.0, v=[0.3, 0.1], p=1.0)
+    ec.add_nonrefl([int(f) for f in mh.bndfcs.ndarray[:, 0]])
+    ec.bc_soln()
+    ec.bc_dsoln()
+    return ec
+
+
+@profile_function
+def march_shuffled(ec, steps):
+    ec.march(steps=steps)
+
+
+@profile_function
+def march_reordered(ec, steps):
+    ec.march(steps=steps)
+
+
+def profile_reorder(nx, ordering, steps, nthread, it=3):
+    shuffled = make_mesh(nx, nx)
+    reordered = make_mesh(nx, nx)
+    reordered.reorder(ordering)
+    ec_shuffled = make_core(shuffled, nthread)
+    ec_reordered = make_core(reordered, nthread)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        march_shuffled(ec_shuffled, steps)
+        march_reordered(ec_reordered, steps)
+    res = solvcon.call_profiler.result()["children"]
+    out = {r["name"].replace("march_", ""): r["total_time"] / r["count"]
+           for r in res}
+
+    print(f"## {ordering} ncell = {shuffled.ncell} nthread = {nthread}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} | {:10s} | {:10s} |",
+                         *cols))
+
+    print_row("mesh", "per march (ms)", "cmp to shuffled", "mean dist",
+              "max dist")
+    print_row("-" * 10, "-" * 15, "-" * 15, "-" * 10, "-" * 10)
+    base = out["shuffled"]
+    for name, mh in (("shuffled", shuffled), ("reordered", reordered)):
+        mean, peak = neighbor_distance(mh)
+        print_row(name, f"{out[name]:.3E}", f"{out[name] / base:.3f}",
+                  f"{mean:.1f}", f"{peak}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--ordering", action="append",
+                        choices=["rcm", "hilbert", "morton"])
+    parser.add_argument("--steps", type=int, default=5)
+    parser.add_argument("--nthread", type=int, default=1)
+    args = parser.parse_args()
+    orderings = args.ordering or ["rcm", "hilbert", "morton"]
+
+    # 2*64^2 cells fit in the last-level cache; 2*512^2 do not.
+    for nx in [64, 512]:
+        for ordering in orderings:
+            profile_reorder(nx, ordering, args.steps, args.nthread)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
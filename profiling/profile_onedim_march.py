@@ -0,0 +1,117 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time the one-dimensional Euler march: the full-sweep march against the
+temporally blocked one on grids smaller and larger than the last-level cache,
+and a loop of Euler1DCore objects against one Euler1DBatch.  The wall time
+comes from the call profiler.
+"""
+
+import functools
+
+import numpy as np
+
+import solvcon
+from solvcon.onedim import euler1d
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_core(ncoord, variant=0):
+    """A smooth density disturbance on a periodic-looking domain."""
+    svr = euler1d.Euler1DSolver(xmin=0.0, xmax=2 * np.pi, ncoord=ncoord,
+                                time_increment=0.5 / ncoord)
+    svr.gamma.fill(1.4 - 0.002 * variant)
+    svr.so0[:, 0] = 1.0 + 0.1 * np.sin(svr.coord + 0.01 * variant)
+    svr.so0[:, 2] = 2.5
+    svr.setup_march()
+    return svr._core
+
+
+@profile_function
+def march_full(core, steps):
+    core.march_alpha2(steps=steps)
+
+
+@profile_function
+def march_blocked(core, steps):
+    core.march_alpha2_blocked(steps=steps)
+
+
+@profile_function
+def batch_cores(cores, steps):
+    for core in cores:
+        core.march_alpha2(steps=steps)
+
+
+@profile_function
+def batch_batch(batch, steps):
+    batch.march_alpha2(steps=steps)
+
+
+def make_batch(ncoord, nbatch):
+    cores = [make_core(ncoord, ib) for ib in range(nbatch)]
+    batch = euler1d._impl.Euler1DBatch(
+        ncoord=ncoord, nbatch=nbatch, time_increment=cores[0].time_increment)
+    batch.coord[...] = cores[0].coord
+    for ib, core in enumerate(cores):
+        batch.set_member(ib, core)
+    return cores, batch
+
+
+def print_table(title, res, prefix):
+    print(f"## {title}\n")
+    out = {r["name"].replace(prefix, ""): r["total_time"] / r["count"]
+           for r in res if r["name"].startswith(prefix)}
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("march", "per call (ms)", "speedup")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = next(iter(out.values()))
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{base / value:.3f}")
+    print()
+
+
+def profile_blocked(ncoord, steps=8, it=3):
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        march_full(make_core(ncoord), steps)
+        march_blocked(make_core(ncoord), steps)
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"march_alpha2 ncoord = {ncoord} steps = {steps}", res,
+                "march_")
+
+
+def profile_batch(ncoord, nbatch, steps=40, it=3):
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        cores, batch = make_batch(ncoord, nbatch)
+        batch_cores(cores, steps)
+        batch_batch(batch, steps)
+    res = solvcon.call_profiler.result()["children"]
+    print_table(f"march_alpha2 ncoord = {ncoord} nbatch = {nbatch} "
+                f"steps = {steps}", res, "batch_")
+
+
+def main():
+    for ncoord in [(1 << 14) + 1, (1 << 20) + 1]:
+        profile_blocked(ncoord)
+    for nbatch in [16, 256]:
+        profile_batch(1001, nbatch)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,212 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+import functools
+import numpy as np
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_container(data):
+    if np.isdtype(data.dtype, np.uint8):
+        return solvcon.SimpleArrayUint8(array=data)
+    elif np.isdtype(data.dtype, np.uint16):
+        return solvcon.SimpleArrayUint16(array=data)
+    elif np.isdtype(data.dtype, np.uint32):
+        return solvcon.SimpleArrayUint32(array=data)
+    elif np.isdtype(data.dtype, np.uint64):
+        return solvcon.SimpleArrayUint64(array=data)
+    if np.isdtype(data.dtype, np.int8):
+        return solvcon.SimpleArrayInt8(array=data)
+    elif np.isdtype(data.dtype, np.int16):
+        return solvcon.SimpleArrayInt16(array=data)
+    elif np.isdtype(data.dtype, np.int32):
+        return solvcon.SimpleArrayInt32(array=data)
+    elif np.isdtype(data.dtype, np.int64):
+        return solvcon.SimpleArrayInt64(array=data)
+    elif np.isdtype(data.dtype, np.float32):
+        return solvcon.SimpleArrayFloat32(array=data)
+    elif np.isdtype(data.dtype, np.float64):
+        return solvcon.SimpleArrayFloat64(array=data)
+
+
+@profile_function
+def profile_sum_np(src):
+    return np.sum(src)
+
+
+@profile_function
+def profile_sum_sa(src):
+    return src.sum()
+
+
+@profile_function
+def profile_sum_pairwise(src):
+    return src.sum(method="pairwise")
+
+
+@profile_function
+def profile_sum_kahan(src):
+    return src.sum(method="kahan")
+
+
+@profile_function
+def profile_min_np(src):
+    return np.min(src)
+
+
+@profile_function
+def profile_min_sa(src):
+    return src.min()
+
+
+@profile_function
+def profile_max_np(src):
+    return np.max(src)
+
+
+@profile_function
+def profile_max_sa(src):
+    return src.max()
+
+
+@profile_function
+def profile_argmin_np(src):
+    return np.argmin(src)
+
+
+@profile_function
+def profile_argmin_sa(src):
+    return src.argmin()
+
+
+@profile_function
+def profile_mean_np(src):
+    return np.mean(src)
+
+
+@profile_function
+def profile_mean_sa(src):
+    return src.mean()
+
+
+@profile_function
+def profile_var_np(src):
+    return np.var(src)
+
+
+@profile_function
+def profile_var_sa(src):
+    return src.var()
+
+
+def prof_sum(src):
+    src_sa = make_container(src)
+    profile_sum_np(src)
+    profile_sum_sa(src_sa)
+    if np.isdtype(src.dtype, "real floating"):
+        profile_sum_pairwise(src_sa)
+        profile_sum_kahan(src_sa)
+
+
+def prof_min(src):
+    src_sa = make_container(src)
+    profile_min_np(src)
+    profile_min_sa(src_sa)
+
+
+def prof_max(src):
+    src_sa = make_container(src)
+    profile_max_np(src)
+    profile_max_sa(src_sa)
+
+
+def prof_argmin(src):
+    src_sa = make_container(src)
+    profile_argmin_np(src)
+    profile_argmin_sa(src_sa)
+
+
+def prof_mean(src):
+    src_sa = make_container(src)
+    profile_mean_np(src)
+    profile_mean_sa(src_sa)
+
+
+def prof_var(src):
+    src_sa = make_container(src)
+    profile_var_np(src)
+    profile_var_sa(src_sa)
+
+
+def make_data(dtype, N):
+    if "float" in dtype:
+        return np.random.rand(N).astype(dtype, copy=False)
+    else:
+        return np.random.randint(0, 100, N, dtype=dtype)
+
+
+def profile_reduction(op, prof_func, dtype, N, it=10):
+    src = make_data(dtype, N)
+
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        prof_func(src)
+
+    res = solvcon.call_profiler.result()["children"]
+
+    print(f"## {op} N = {N} type: `{dtype}`\n")
+    out = {}
+    for r in res:
+        name = r["name"].replace(f"profile_{op}_", "")
+        time = r["total_time"] / r["count"]
+        out[name] = time
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *(cols[0:3])))
+
+    print_row('func', 'per call (ms)', 'cmp to np')
+    print_row('-' * 10, '-' * 15, '-' * 15)
+    npbase = out["np"]
+    for k, v in out.items():
+        print_row(f"{k:8s}", f"{v:.3E}", f"{v / npbase:.3f}")
+
+    print()
+
+
+def main():
+    # The small size stays in cache and shows the kernel; the large one is
+    # bound by memory bandwidth like the solution arrays are.
+    sizes = [2 ** 14, 2 ** 24]
+    op_to_func = {
+        "sum": prof_sum,
+        "min": prof_min,
+        "max": prof_max,
+        "argmin": prof_argmin,
+        "mean": prof_mean,
+        "var": prof_var,
+    }
+    float_only = ["mean", "var"]
+
+    print(f"SIMD feature: {solvcon.core._impl._simd_feature()}\n")
+    for op, prof_func in op_to_func.items():
+        dtypes = ["float32", "float64"]
+        if op not in float_only:
+            dtypes += ["int8", "int16", "int32", "int64"]
+        for dtype in dtypes:
+            for N in sizes:
+                profile_reduction(op, prof_func, dtype, N)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
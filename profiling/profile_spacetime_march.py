@@ -0,0 +1,89 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time LinearScalarSolver.march_alpha2 on the per-element proxy path against
+the array path over thread counts.  The wall time comes from the call
+profiler.
+"""
+
+import functools
+import os
+
+import numpy as np
+
+import solvcon
+from solvcon import spacetime as libst
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_solver(ncelm):
+    """A periodic sine wave over ncelm elements."""
+    xcrd = np.arange(ncelm + 1) / ncelm * 2 * np.pi
+    grid = libst.Grid(xcrd)
+    svr = libst.LinearScalarSolver(grid=grid,
+                                   time_increment=0.9 * 2 * np.pi / ncelm)
+    svr.set_so0(0, np.sin(xcrd))
+    svr.set_so1(0, np.cos(xcrd))
+    svr.setup_march()
+    return svr
+
+
+@profile_function
+def march(svr, steps):
+    svr.march_alpha2(steps)
+
+
+def time_march(svr, steps, it):
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        march(svr, steps)
+    res = solvcon.call_profiler.result()["children"]
+    return sum(r["total_time"] / r["count"] for r in res
+               if r["name"] == "march")
+
+
+def profile_march(ncelm, nthreads, steps=50, it=3):
+    out = {}
+    svr = make_solver(ncelm)
+    svr.soa_march = False
+    out["proxy"] = time_march(svr, steps, it)
+    for nthread in nthreads:
+        svr = make_solver(ncelm)
+        svr.nthread = nthread
+        out[f"array {nthread}"] = time_march(svr, steps, it)
+
+    print(f"## march_alpha2 ncelm = {ncelm} steps = {steps}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("path", "per march (ms)", "speedup")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = out["proxy"]
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{base / value:.3f}")
+    print()
+
+
+def main():
+    nthreads = [1, 2, 4]
+    ncpu = os.cpu_count() or 1
+    if ncpu > 4:
+        nthreads.append(ncpu)
+    for ncelm in [20000, 200000]:
+        profile_march(ncelm, nthreads)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,82 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+"""
+Time the "diagnostics" level of World.describe_state on many short segments
+spread over a large area, where the broad phase keeps the pass far from
+quadratic.  The first call evaluates every shape; a call after moving one
+shape evaluates only that shape again.  The wall time comes from the call
+profiler.
+"""
+
+import functools
+
+import numpy as np
+
+import solvcon
+
+
+def profile_function(func):
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        _ = solvcon.CallProfilerProbe(func.__name__)
+        result = func(*args, **kwargs)
+        return result
+    return wrapper
+
+
+def make_world(nsegment, seed=3):
+    rng = np.random.default_rng(seed)
+    pos = rng.uniform(0.0, 1000.0, size=(nsegment, 2))
+    delta = rng.uniform(-2.0, 2.0, size=(nsegment, 2))
+    w = solvcon.WorldFp64()
+    for (x, y), (dx, dy) in zip(pos, delta):
+        w.add_segment(solvcon.Point3dFp64(x, y, 0),
+                      solvcon.Point3dFp64(x + dx, y + dy, 0))
+    return w
+
+
+@profile_function
+def diagnostics_full(w):
+    return w.describe_state(level="diagnostics")
+
+
+@profile_function
+def diagnostics_edit(w):
+    return w.describe_state(level="diagnostics")
+
+
+def profile_diagnostics(nsegment, it=3):
+    solvcon.call_profiler.reset()
+    for _ in range(it):
+        w = make_world(nsegment)
+        sid = w.add_line(500, 500, 510, 510)
+        diagnostics_full(w)
+        w.translate_shape(sid, 1.0, 0.5)
+        diagnostics_edit(w)
+    res = solvcon.call_profiler.result()["children"]
+    out = {r["name"].replace("diagnostics_", ""): r["total_time"] / r["count"]
+           for r in res}
+
+    print(f"## describe_state diagnostics nsegment = {nsegment}\n")
+
+    def print_row(*cols):
+        print(str.format("| {:10s} | {:15s} | {:15s} |", *cols))
+
+    print_row("call", "per call (ms)", "cmp to full")
+    print_row("-" * 10, "-" * 15, "-" * 15)
+    base = out["full"]
+    for name, value in out.items():
+        print_row(name, f"{value:.3E}", f"{value / base:.3f}")
+    print()
+
+
+def main():
+    for nsegment in [2000, 20000]:
+        profile_diagnostics(nsegment)
+
+
+if __name__ == "__main__":
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -18,6 +18,9 @@ from . import pylibmgr
 list_of_buffer = [
     'ConcreteBuffer',
     'BufferExpander',
+    'BufferAllocator',
+    'PoolBufferAllocator',
+    'ArenaBufferAllocator',
     'SimpleArray',
     'SimpleArrayBool',
     'SimpleArrayInt8',
@@ -32,6 +35,17 @@ list_of_buffer = [
     'SimpleArrayFloat64',
     'SimpleArrayComplex64',
     'SimpleArrayComplex128',
+    'LazyArrayBool',
+    'LazyArrayInt8',
+    'LazyArrayInt16',
+    'LazyArrayInt32',
+    'LazyArrayInt64',
+    'LazyArrayUint8',
+    'LazyArrayUint16',
+    'LazyArrayUint32',
+    'LazyArrayUint64',
+    'LazyArrayFloat32',
+    'LazyArrayFloat64',
     'SimpleCollectorBool',
     'SimpleCollectorInt8',
     'SimpleCollectorInt16',
@@ -45,12 +59,16 @@ list_of_buffer = [
     'SimpleCollectorFloat64',
     'SimpleCollectorComplex64',
     'SimpleCollectorComplex128',
+    'matmul_nthread',
+    'set_matmul_nthread',
 ]
 
 # inout directory symbols
 list_of_inout = [
     'Gmsh',
+    'GmshStream',
     'Plot3d',
+    'Snapshot',
 ]
 
 # math directory symbols
@@ -101,6 +119,8 @@ list_of_toggle = [
 # transform directory symbols
 list_of_transform = [
     'FourierTransform',
+    'FourierPlanFloat32',
+    'FourierPlanFloat64',
 ]
 
 # linalg directory symbols
@@ -115,6 +135,10 @@ list_of_linalg = [
     'LuFactorizationFloat64',
     'LuFactorizationComplex64',
     'LuFactorizationComplex128',
+    'LuFactorizationBatchFloat32',
+    'LuFactorizationBatchFloat64',
+    'LuFactorizationBatchComplex64',
+    'LuFactorizationBatchComplex128',
     'EigenSystem',
     'EigenSystemFloat32',
     'EigenSystemFloat64',
@@ -128,6 +152,10 @@ list_of_linalg = [
     'KalmanFilterFp64',
     'KalmanFilterComplex64',
     'KalmanFilterComplex128',
+    'KalmanFilterBankFp32',
+    'KalmanFilterBankFp64',
+    'KalmanFilterBankComplex64',
+    'KalmanFilterBankComplex128',
 ]
 
 # universe directory symbols
@@ -3,6 +3,8 @@
 
 
 import operator
+import os
+import tempfile
 import unittest
 
 import numpy as np
@@ -165,6 +167,90 @@ class ConcreteBufferAlignmentTC(unittest.TestCase):
         self.assertEqual(0, cloned[0])
 
 
+class ConcreteBufferMapFileTC(unittest.TestCase):
+
+    def setUp(self):
+        fd, self.path = tempfile.mkstemp(suffix=".bin")
+        os.close(fd)
+        np.arange(16, dtype="float64").tofile(self.path)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def test_read_only(self):
+        buf = solvcon.ConcreteBuffer.map_file(self.path)
+        self.assertEqual(16 * 8, buf.nbytes)
+        self.assertTrue(buf.is_mapped)
+        self.assertFalse(buf.is_writable)
+        self.assertFalse(solvcon.ConcreteBuffer(8).is_mapped)
+
+        ndarr = buf.ndarray
+        self.assertFalse(ndarr.flags.writeable)
+        np.testing.assert_equal(ndarr.view("float64"), np.arange(16))
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            buf[0] = 1
+        with self.assertRaises(ValueError):
+            ndarr[0] = 1
+
+    def test_simple_array_view(self):
+        buf = solvcon.ConcreteBuffer.map_file(self.path, offset=4 * 8,
+                                              nbytes=6 * 8)
+        sarr = solvcon.SimpleArrayFloat64((2, 3), buffer=buf)
+        np.testing.assert_equal(sarr.ndarray, [[4, 5, 6], [7, 8, 9]])
+        self.assertFalse(sarr.ndarray.flags.writeable)
+
+        sarr = solvcon.SimpleArrayFloat64((2,), buffer=buf, offset=4 * 8)
+        np.testing.assert_equal(sarr.ndarray, [8, 9])
+
+    def test_simple_array_read_only(self):
+        buf = solvcon.ConcreteBuffer.map_file(self.path)
+        sarr = solvcon.SimpleArrayFloat64((4, 4), buffer=buf)
+        other = solvcon.SimpleArrayFloat64((4, 4), value=1.0)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr[0, 0] = 1
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr[1, ...] = np.zeros(4)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr.fill(0)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr.iadd(other)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr.imul(2.0)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr.isub_simd(other)
+        with self.assertRaisesRegex(ValueError, "read-only"):
+            sarr.imatmul(other)
+        # Nothing reached the file.
+        np.testing.assert_equal(np.fromfile(self.path, dtype="float64"),
+                                np.arange(16))
+
+    def test_copy_on_write(self):
+        buf = solvcon.ConcreteBuffer.map_file(self.path, mode="c")
+        self.assertTrue(buf.is_writable)
+        sarr = solvcon.SimpleArrayFloat64((16,), buffer=buf)
+        sarr.ndarray[3] = -3
+        self.assertEqual(-3, sarr[3])
+        del sarr, buf
+        self.assertEqual(3, np.fromfile(self.path, dtype="float64")[3])
+
+    def test_shared(self):
+        buf = solvcon.ConcreteBuffer.map_file(self.path, offset=8, nbytes=16,
+                                              mode="r+")
+        sarr = solvcon.SimpleArrayFloat64((2,), buffer=buf)
+        sarr.ndarray[1] = -2
+        del sarr, buf
+        np.testing.assert_equal(np.fromfile(self.path, dtype="float64")[:4],
+                                [0, 1, -2, 3])
+
+    def test_errors(self):
+        with self.assertRaisesRegex(IndexError, "exceeds size 128"):
+            solvcon.ConcreteBuffer.map_file(self.path, offset=17 * 8)
+        with self.assertRaisesRegex(RuntimeError, "cannot open"):
+            solvcon.ConcreteBuffer.map_file(self.path + ".missing")
+        with self.assertRaisesRegex(ValueError, "map mode 'w' not supported"):
+            solvcon.ConcreteBuffer.map_file(self.path, mode="w")
+
+
 class BufferExpanderBasicTC(unittest.TestCase):
 
     def test_BufferExpander(self):
@@ -233,6 +319,109 @@ class BufferExpanderBasicTC(unittest.TestCase):
             self.assertEqual(buf[it] + 100, ep[it])
 
 
+class BufferAllocatorTC(unittest.TestCase):
+
+    def test_pool(self):
+        pool = solvcon.PoolBufferAllocator(max_block=1 << 20)
+        self.assertIsNone(solvcon.BufferAllocator.current)
+        with pool:
+            self.assertIs(pool, solvcon.BufferAllocator.current)
+            arr = solvcon.SimpleArrayFloat64(1000)
+            self.assertIs(pool, arr.allocator)
+            self.assertEqual(1, pool.nlive)
+            del arr
+            arr = solvcon.SimpleArrayFloat64(900)
+            self.assertEqual(1, pool.nreuse)
+        self.assertIsNone(solvcon.BufferAllocator.current)
+        # The array outlives the scope.
+        arr.fill(2.0)
+        self.assertEqual(2.0, arr[899])
+        self.assertIsNone(solvcon.SimpleArrayFloat64(10).allocator)
+        del arr
+        self.assertEqual(8192, pool.cached_bytes)
+        pool.release()
+        self.assertEqual(0, pool.cached_bytes)
+
+    def test_arena(self):
+        arena = solvcon.ArenaBufferAllocator(chunk_size=1 << 16)
+        x = solvcon.SimpleArrayFloat64(100, value=1.5)
+        with arena:
+            for _ in range(10):
+                y = x.mul(x).add(x)
+                self.assertEqual(3.75, y[99])
+                del y
+            self.assertEqual(0, arena.used)
+            kept = x.add(x)
+        self.assertEqual(1, arena.nchunk)
+        self.assertEqual(1, arena.nlive)
+        with self.assertRaisesRegex(RuntimeError, "still live"):
+            arena.release()
+        self.assertEqual(3.0, kept[0])
+        del kept
+        arena.release()
+        self.assertEqual(0, arena.capacity)
+        self.assertIsInstance(solvcon.ArenaBufferAllocator.thread_instance(),
+                              solvcon.ArenaBufferAllocator)
+
+
+class LazyArrayTC(unittest.TestCase):
+
+    def setUp(self):
+        rng = np.random.default_rng(7)
+        # Not a multiple of the tile size.
+        self.nd = [rng.uniform(-2, 2, 1037) for _ in range(4)]
+        self.sa = [solvcon.SimpleArrayFloat64(array=nd) for nd in self.nd]
+
+    def test_chain(self):
+        a, b, c, d = self.sa
+        na, nb, nc, nd = self.nd
+        lazy = a.lazy().add(b).mul(c).sub(d)
+        self.assertIsInstance(lazy, solvcon.LazyArrayFloat64)
+        self.assertEqual((1037,), lazy.shape)
+        np.testing.assert_equal(((na + nb) * nc - nd),
+                                lazy.evaluate().ndarray)
+        np.testing.assert_equal(a.add(b).mul(c).sub(d).ndarray,
+                                lazy.evaluate().ndarray)
+
+    def test_operators(self):
+        a, b, c, _ = self.sa
+        na, nb, nc, _ = self.nd
+        la = a.lazy()
+        np.testing.assert_equal(2.0 * na + 1.0,
+                                (2.0 * la + 1.0).evaluate().ndarray)
+        np.testing.assert_equal(1.0 - na / nb,
+                                (1.0 - la / b).evaluate().ndarray)
+        np.testing.assert_equal(3.0 / na, (3.0 / la).evaluate().ndarray)
+        np.testing.assert_equal(nb - na, (b - la).evaluate().ndarray)
+        np.testing.assert_equal(np.abs(-na), abs(-la).evaluate().ndarray)
+        np.testing.assert_equal(na < nc, (la < c).evaluate().ndarray)
+        np.testing.assert_equal(na >= 0.5, (la >= 0.5).evaluate().ndarray)
+
+    def test_where(self):
+        a, b, c, _ = self.sa
+        na, nb, nc, _ = self.nd
+        cond = a.lazy() > b
+        self.assertIsInstance(cond, solvcon.LazyArrayBool)
+        np.testing.assert_equal(np.where(na > nb, na, nb),
+                                cond.where(a, b).evaluate().ndarray)
+        np.testing.assert_equal(
+            np.where(na > nb, na * 2, -nc),
+            cond.where(a.lazy() * 2.0, -c.lazy()).evaluate().ndarray)
+
+    def test_evaluate_into(self):
+        a, b, _, _ = self.sa
+        na, nb, _, _ = self.nd
+        expected = na * nb + na
+        (a.lazy() * b + a).evaluate_into(a)
+        np.testing.assert_equal(expected, a.ndarray)
+        with self.assertRaisesRegex(ValueError, "shape mismatch"):
+            a.lazy().add(solvcon.SimpleArrayFloat64(10))
+
+    def test_keeps_operands(self):
+        lazy = solvcon.SimpleArrayFloat64(100, value=2.0).lazy() + 1.0
+        np.testing.assert_equal(np.full(100, 3.0), lazy.evaluate().ndarray)
+
+
 class SimpleArrayBasicTC(unittest.TestCase):
 
     def test_SimpleArray(self):
@@ -1915,6 +2104,43 @@ class SimpleArrayCalculatorsTC(unittest.TestCase):
         sarr = solvcon.SimpleArrayFloat64(array=nparr)
         self.assertEqual(sarr.sum(), np.sum(nparr))
 
+    def test_sum_method(self):
+        # 0.1 is inexact in binary, so a long float32 sum drifts with the
+        # length unless the rounding error is controlled.
+        nparr = np.full(1 << 20, 0.1, dtype='float32')
+        sarr = solvcon.SimpleArrayFloat32(array=nparr)
+        ref = np.sum(nparr, dtype='float64')
+        self.assertAlmostEqual(sarr.sum(method="kahan"), ref, delta=ref * 1e-6)
+        self.assertAlmostEqual(sarr.sum(method="pairwise"), ref,
+                               delta=ref * 1e-5)
+        self.assertAlmostEqual(sarr.sum(), ref, delta=ref * 1e-3)
+
+        # Integer sums are exact whatever the method.
+        nparr = np.arange(1000, dtype='int32')
+        sarr = solvcon.SimpleArrayInt32(array=nparr)
+        for method in ("fast", "pairwise", "kahan"):
+            self.assertEqual(sarr.sum(method=method), np.sum(nparr))
+
+        with self.assertRaisesRegex(ValueError, "sum method 'naive'"):
+            sarr.sum(method="naive")
+
+    def test_minmax_contiguous(self):
+        # Lengths off the vector width exercise the scalar tail; NaN is
+        # skipped rather than propagated.
+        nparr = np.linspace(-3.0, 5.0, 1037)
+        nparr[0] = np.nan
+        nparr[500] = np.nan
+        sarr = solvcon.SimpleArrayFloat64(array=nparr)
+        self.assertEqual(sarr.min(), np.nanmin(nparr))
+        self.assertEqual(sarr.max(), np.nanmax(nparr))
+
+        nparr = np.random.randint(-1000, 1000, 1037, dtype='int16')
+        sarr = solvcon.SimpleArrayInt16(array=nparr)
+        self.assertEqual(sarr.min(), nparr.min())
+        self.assertEqual(sarr.max(), nparr.max())
+        self.assertEqual(sarr.argmin(), np.argmin(nparr))
+        self.assertEqual(sarr.argmax(), np.argmax(nparr))
+
     def test_sum_non_contiguous(self):
         # Strided slice that fails both C- and F-contiguity checks, so
         # sum() must take the sum_strided path. Distinct integer values
@@ -2635,6 +2861,46 @@ class SimpleArrayCalculatorsTC(unittest.TestCase):
             'float64': solvcon.SimpleArrayFloat64,
         }[dtype]
 
+    def test_binary_arithmetic_broadcast(self):
+        lhs = np.arange(12, dtype='float64').reshape((3, 4)) + 1
+        shapes = (((4,), (3, 4)), ((1, 4), (3, 4)), ((3, 1), (3, 4)),
+                  ((2, 1, 1), (2, 3, 4)), ((1,), (3, 4)))
+        for other_shape, result_shape in shapes:
+            rhs = np.arange(np.prod(other_shape), dtype='float64')
+            rhs = rhs.reshape(other_shape) + 2
+            for operation, npop in (('add', np.add), ('sub', np.subtract),
+                                    ('mul', np.multiply),
+                                    ('div', np.divide),
+                                    ('lt', np.less), ('eq', np.equal)):
+                with self.subTest(operation=operation,
+                                  other_shape=other_shape):
+                    slhs = solvcon.SimpleArrayFloat64(array=lhs.copy())
+                    srhs = solvcon.SimpleArrayFloat64(array=rhs.copy())
+                    sres = getattr(slhs, operation)(srhs)
+                    self.assertEqual(result_shape, sres.shape)
+                    np.testing.assert_array_equal(npop(lhs, rhs),
+                                                  sres.ndarray)
+                    # The reflected operation broadcasts the same way.
+                    sres = getattr(srhs, operation)(slhs)
+                    np.testing.assert_array_equal(npop(rhs, lhs),
+                                                  sres.ndarray)
+
+        slhs = solvcon.SimpleArrayFloat64(array=lhs.copy())
+        slhs.iadd(solvcon.SimpleArrayFloat64(array=np.arange(4.0)))
+        np.testing.assert_array_equal(lhs + np.arange(4.0), slhs.ndarray)
+        # An operand viewing the same memory is read before it is
+        # overwritten.
+        nd = lhs.copy()
+        slhs = solvcon.SimpleArrayFloat64(array=nd)
+        slhs.isub(solvcon.SimpleArrayFloat64(array=nd[0]))
+        np.testing.assert_array_equal(lhs - lhs[0], nd)
+        scol = solvcon.SimpleArrayFloat64((3, 1), value=1)
+        with self.assertRaisesRegex(
+                ValueError,
+                r"SimpleArray::iadd\(\): shape mismatch: "
+                r"this=\(3, 1\) other=\(3, 4\)"):
+            scol.iadd(slhs)
+
     def test_binary_arithmetic_shape_mismatch(self):
         operations = (
             'add', 'sub', 'mul', 'div',
@@ -24,6 +24,16 @@ class SimdDispatchTC(unittest.TestCase):
         else:
             self.skipTest("_simd_feature() = " + feature)
 
+    # SSE2 is the x86-64 baseline, so a missing level means the CPUID probe
+    # fell through and the AVX backends can never be dispatched.
+    def test_x86_feature_detected(self):
+        feature = solvcon.core._impl._simd_feature()
+        if platform.machine() in ("x86_64", "AMD64"):
+            self.assertIn(feature, ("SSE2", "SSE3", "SSSE3", "SSE41",
+                                    "SSE42", "AVX", "AVX2", "AVX512"))
+        else:
+            self.skipTest("_simd_feature() = " + feature)
+
 
 class SimdTransformBinaryTC(unittest.TestCase):
     # Each n targets a distinct SIMD code path (int32: 4 lanes per block):
@@ -73,4 +83,27 @@ class SimdTransformBinaryTC(unittest.TestCase):
         for i, want in enumerate(expected):
             self.assertEqual(out[i], want)
 
+
+class SimdTakeAlongAxisTC(unittest.TestCase):
+    # The vectorized index check must accept the last position of the axis
+    # and reject the one past it; an off-by-one in a vector compare would
+    # pass the sparse indices of the general take_along_axis tests.
+    def test_index_bounds(self):
+        n = 70  # More than one block of int8 lanes on every backend.
+        data = solvcon.SimpleArrayFloat64(
+            array=np.arange(n, dtype='float64'))
+        for dtype, sacls in (('int8', solvcon.SimpleArrayInt8),
+                             ('int32', solvcon.SimpleArrayInt32),
+                             ('uint64', solvcon.SimpleArrayUint64)):
+            idx = sacls(array=np.arange(n - 1, -1, -1, dtype=dtype))
+            out = data.take_along_axis_simd(idx)
+            for i in range(n):
+                self.assertEqual(out[i], float(n - 1 - i), msg=dtype)
+
+            bad = np.full(n, n - 1, dtype=dtype)
+            bad[n - 3] = n
+            with self.assertRaisesRegex(
+                    IndexError, r"indices\[67\] is 70, which is out of range"):
+                data.take_along_axis_simd(sacls(array=bad))
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -69,4 +69,32 @@ class GmshRectangularTC(GmshTB):
         # TODO: all cell should be triangles including ghost cells.
         np.testing.assert_equal(blk.cltpn, 4)
 
+
+class GmshStreamTC(GmshTB):
+    def test_match_gmsh(self):
+        path = os.path.join(self.DATADIR, "rectangle.msh")
+        with open(path, 'rb') as fobj:
+            data = fobj.read()
+        expected = sc.Gmsh(data).to_block()
+
+        for stream in (sc.GmshStream(path),
+                       sc.GmshStream.from_bytes(data, chunk_size=13)):
+            self.assertEqual(stream.version, "2.2")
+            self.assertFalse(stream.is_binary)
+            self.assertEqual(stream.nnode, 104)
+            blk = stream.to_block()
+            self.assertEqual(blk.ndim, expected.ndim)
+            self.assertEqual(blk.nnode, expected.nnode)
+            self.assertEqual(blk.nface, expected.nface)
+            self.assertEqual(blk.ncell, expected.ncell)
+            self.assertEqual(blk.nbound, expected.nbound)
+            np.testing.assert_equal(
+                blk.ndcrd.ndarray[:, :2], expected.ndcrd.ndarray[:, :2])
+            np.testing.assert_equal(blk.cltpn.ndarray, expected.cltpn.ndarray)
+            np.testing.assert_equal(blk.fccls.ndarray, expected.fccls.ndarray)
+
+    def test_bad_path(self):
+        with self.assertRaises(RuntimeError):
+            sc.GmshStream(os.path.join(self.DATADIR, "no_such_file.msh"))
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -817,6 +817,158 @@ class KalmanFilterBatchFilterTC(unittest.TestCase):
         np.testing.assert_allclose(xs_upd, xs_upd_np, atol=1e-12, rtol=0.0)
         np.testing.assert_allclose(ps_upd, ps_upd_np, atol=1e-12, rtol=0.0)
 
+    def make_tracker(self, jitter=0.0):
+        dt = 1.0e-3
+        f = np.array([[1.0, dt, 0.5 * dt * dt],
+                      [0.0, 1.0, dt],
+                      [0.0, 0.0, 1.0]])
+        h = np.array([[1.0, 0.0, 0.0],
+                      [0.0, 1.0, 0.0]])
+        q = np.diag([1.0e-4, 1.0e-4, 1.0e-2])
+        r = np.diag([0.25, 0.04])
+        return sc.KalmanFilterFp64(
+            x=sc.SimpleArrayFloat64(array=np.zeros(3)),
+            f=sc.SimpleArrayFloat64(array=f),
+            h=sc.SimpleArrayFloat64(array=h),
+            q=sc.SimpleArrayFloat64(array=q),
+            r=sc.SimpleArrayFloat64(array=r),
+            p=sc.SimpleArrayFloat64(array=np.eye(3) * 10.0),
+            jitter=jitter,
+        )
+
+    def make_measurements(self, m):
+        t = np.arange(m) * 1.0e-3
+        rng = np.random.default_rng(7)
+        zs = np.stack([3.0 * np.sin(t), 3.0 * np.cos(t)], axis=1)
+        zs += rng.normal(0.0, 0.3, zs.shape)
+        return sc.SimpleArrayFloat64(array=zs)
+
+    def test_batchfilter_square_root(self):
+        zs_sa = self.make_measurements(300)
+        bps = self.make_tracker().batch_filter(zs_sa)
+        sqr = self.make_tracker().batch_filter(zs_sa, mode="square_root")
+        for name in ("prior_states", "prior_states_covariance",
+                     "posterior_states", "posterior_states_covariance"):
+            np.testing.assert_allclose(
+                getattr(sqr, name).ndarray, getattr(bps, name).ndarray,
+                atol=1e-9, rtol=0.0)
+
+    def test_batchfilter_steady_state(self):
+        zs_sa = self.make_measurements(20000)
+        kf = self.make_tracker()
+        p = kf.steady_state_covariance().ndarray
+        k = kf.steady_state_gain().ndarray
+        self.assertEqual((3, 3), p.shape)
+        self.assertEqual((3, 2), k.shape)
+
+        bps = self.make_tracker().batch_filter(zs_sa)
+        np.testing.assert_allclose(
+            bps.prior_states_covariance.ndarray[-1], p, atol=1e-10, rtol=0.0)
+        sss = kf.batch_filter(zs_sa, mode="steady_state")
+        np.testing.assert_allclose(
+            sss.prior_states_covariance.ndarray[0], p, atol=0.0, rtol=0.0)
+        np.testing.assert_allclose(
+            sss.posterior_states.ndarray[-1],
+            bps.posterior_states.ndarray[-1], atol=1e-6, rtol=0.0)
+
+    def test_batchfilter_mode_error(self):
+        zs_sa = self.make_measurements(10)
+        with self.assertRaisesRegex(
+                ValueError,
+                "KalmanFilter: batch mode 'fast' not supported"):
+            self.make_tracker().batch_filter(zs_sa, mode="fast")
+
+
+class KalmanFilterBankTC(unittest.TestCase):
+
+    dt = 1.0e-3
+    f = np.array([[1.0, dt, 0.5 * dt * dt],
+                  [0.0, 1.0, dt],
+                  [0.0, 0.0, 1.0]])
+    b = np.array([[0.0], [0.0], [dt]])
+    h = np.array([[1.0, 0.0, 0.0],
+                  [0.0, 1.0, 0.0]])
+    q = np.diag([1.0e-4, 1.0e-4, 1.0e-2])
+    r = np.diag([0.25, 0.04])
+    p = np.eye(3) * 10.0
+
+    def make_bank(self, xs):
+        return sc.KalmanFilterBankFp64(
+            x=sc.SimpleArrayFloat64(array=xs),
+            f=sc.SimpleArrayFloat64(array=self.f),
+            b=sc.SimpleArrayFloat64(array=self.b),
+            h=sc.SimpleArrayFloat64(array=self.h),
+            q=sc.SimpleArrayFloat64(array=self.q),
+            r=sc.SimpleArrayFloat64(array=self.r),
+            p=sc.SimpleArrayFloat64(array=self.p),
+            jitter=0.0,
+        )
+
+    def make_filter(self, x):
+        return sc.KalmanFilterFp64(
+            x=sc.SimpleArrayFloat64(array=x),
+            f=sc.SimpleArrayFloat64(array=self.f),
+            b=sc.SimpleArrayFloat64(array=self.b),
+            h=sc.SimpleArrayFloat64(array=self.h),
+            q=sc.SimpleArrayFloat64(array=self.q),
+            r=sc.SimpleArrayFloat64(array=self.r),
+            p=sc.SimpleArrayFloat64(array=self.p),
+            jitter=0.0,
+        )
+
+    def test_matches_single_filters(self):
+        ntrack, nstep = 7, 100
+        rng = np.random.default_rng(11)
+        xs = rng.normal(0.0, 1.0, (ntrack, 3))
+        zs = rng.normal(0.0, 0.5, (nstep, ntrack, 2))
+        us = rng.normal(0.0, 0.1, (nstep, ntrack, 1))
+
+        bank = self.make_bank(xs)
+        self.assertEqual(ntrack, bank.ntrack)
+        self.assertEqual(3, bank.state_size)
+        self.assertEqual(2, bank.measurement_size)
+        self.assertEqual(1, bank.control_size)
+        filters = [self.make_filter(x) for x in xs]
+        for i in range(nstep):
+            bank.predict(sc.SimpleArrayFloat64(array=us[i]))
+            bank.update(sc.SimpleArrayFloat64(array=zs[i]))
+            for t, kf in enumerate(filters):
+                kf.predict(sc.SimpleArrayFloat64(array=us[i, t]))
+                kf.update(sc.SimpleArrayFloat64(array=zs[i, t]))
+
+        self.assertEqual((ntrack, 3), bank.states.ndarray.shape)
+        self.assertEqual((ntrack, 3, 3), bank.covariances.ndarray.shape)
+        for t, kf in enumerate(filters):
+            np.testing.assert_allclose(
+                bank.states.ndarray[t], kf.state.ndarray, atol=1e-10, rtol=0.0)
+            np.testing.assert_allclose(
+                bank.covariances.ndarray[t], kf.covariance.ndarray,
+                atol=1e-10, rtol=0.0)
+            np.testing.assert_allclose(
+                bank.state(t).ndarray, kf.state.ndarray, atol=0.0, rtol=0.0)
+
+    def test_set_track(self):
+        bank = self.make_bank(np.zeros((3, 3)))
+        bank.predict()
+        bank.update(sc.SimpleArrayFloat64(array=np.ones((3, 2))))
+        x = np.array([1.0, 2.0, 3.0])
+        bank.set_track(1, sc.SimpleArrayFloat64(array=x),
+                       sc.SimpleArrayFloat64(array=self.p))
+        np.testing.assert_equal(bank.state(1).ndarray, x)
+        np.testing.assert_equal(bank.covariance(1).ndarray, self.p)
+        np.testing.assert_equal(bank.state(0).ndarray, bank.state(2).ndarray)
+
+    def test_errors(self):
+        bank = self.make_bank(np.zeros((4, 3)))
+        with self.assertRaisesRegex(
+                ValueError, "The measurement SimpleArray zs must be"):
+            bank.update(sc.SimpleArrayFloat64(array=np.zeros((3, 2))))
+        with self.assertRaisesRegex(
+                ValueError, "The control SimpleArray us must be"):
+            bank.predict(sc.SimpleArrayFloat64(array=np.zeros((4, 2))))
+        with self.assertRaises(IndexError):
+            bank.state(4)
+
 
 def _assert_PA_equals_LU(A_np, lu_np, piv, rtol, atol):
     """Assert PA == L @ U for Lu::factorize output.
@@ -1237,6 +1389,94 @@ class TestLuSimpleArrayMethods(unittest.TestCase):
                 self.assertFalse(hasattr(A, 'det'))
 
 
+class TestLuFactorizationBatch(unittest.TestCase):
+    """Verify LuFactorizationBatch against numpy on stacks of matrices."""
+
+    # (batch class, SimpleArray class, numpy dtype, tolerance)
+    _CASES = [
+        (sc.LuFactorizationBatchFloat32, sc.SimpleArrayFloat32,
+         np.float32, 1e-4),
+        (sc.LuFactorizationBatchFloat64, sc.SimpleArrayFloat64,
+         np.float64, 1e-10),
+        (sc.LuFactorizationBatchComplex64, sc.SimpleArrayComplex64,
+         np.complex64, 1e-4),
+        (sc.LuFactorizationBatchComplex128, sc.SimpleArrayComplex128,
+         np.complex128, 1e-10),
+    ]
+
+    @staticmethod
+    def _make_stack(nbatch, n, np_dtype, seed=0):
+        # Diagonally shifted random matrices are far from singular.
+        rng = np.random.default_rng(seed)
+        A = rng.uniform(-1.0, 1.0, (nbatch, n, n))
+        if np.issubdtype(np_dtype, np.complexfloating):
+            A = A + 1j * rng.uniform(-1.0, 1.0, (nbatch, n, n))
+        A = A + n * np.eye(n)
+        return A.astype(np_dtype)
+
+    def test_factors_match_single(self):
+        # Every matrix of the stack factorizes like LuFactorization.
+        A_np = self._make_stack(7, 5, np.float64)
+        batch = sc.LuFactorizationBatchFloat64(
+            sc.SimpleArrayFloat64(array=A_np))
+        self.assertEqual(batch.nbatch, 7)
+        self.assertEqual(batch.n, 5)
+        lu_np = np.array(batch.lu)
+        piv_np = np.array(batch.piv)
+        self.assertEqual(lu_np.shape, (7, 5, 5))
+        self.assertEqual(piv_np.shape, (7, 5))
+        for i in range(7):
+            single = sc.LuFactorizationFloat64(
+                sc.SimpleArrayFloat64(array=A_np[i]))
+            np.testing.assert_allclose(
+                lu_np[i], np.array(single.lu), rtol=1e-13, atol=1e-13)
+            np.testing.assert_array_equal(piv_np[i], np.array(single.piv))
+            _assert_PA_equals_LU(
+                A_np[i], lu_np[i], piv_np[i], rtol=1e-12, atol=1e-12)
+
+    def test_solve_inv_det_match_numpy(self):
+        # Small (unrolled) and larger (general) sizes for all dtypes.
+        for batch_cls, sa_cls, np_dtype, tol in self._CASES:
+            for n in (1, 3, 8, 12):
+                with self.subTest(cls=batch_cls.__name__, n=n):
+                    A_np = self._make_stack(6, n, np_dtype, seed=n)
+                    b_np = self._make_stack(6, n, np_dtype, seed=n + 1)
+                    batch = batch_cls(sa_cls(array=A_np))
+                    # Single right-hand side per matrix.
+                    x = np.array(batch.solve(sa_cls(array=b_np[:, :, 0])))
+                    np.testing.assert_allclose(
+                        x, np.linalg.solve(A_np, b_np[:, :, :1])[:, :, 0],
+                        rtol=tol, atol=tol)
+                    # Multiple right-hand sides per matrix.
+                    X = np.array(batch.solve(sa_cls(array=b_np)))
+                    np.testing.assert_allclose(
+                        X, np.linalg.solve(A_np, b_np), rtol=tol, atol=tol)
+                    np.testing.assert_allclose(
+                        np.array(batch.inv()), np.linalg.inv(A_np),
+                        rtol=tol, atol=tol)
+                    np.testing.assert_allclose(
+                        np.array(batch.det()), np.linalg.det(A_np),
+                        rtol=tol, atol=tol)
+
+    def test_rejects_bad_shapes(self):
+        A = sc.SimpleArrayFloat64(array=np.zeros((2, 3, 4)))
+        with self.assertRaisesRegex(
+                ValueError, r"must be a 3D SimpleArray of square matrices"):
+            sc.LuFactorizationBatchFloat64(A)
+        A = sc.SimpleArrayFloat64(array=np.eye(3))
+        with self.assertRaisesRegex(
+                ValueError, r"must be a 3D SimpleArray of square matrices"):
+            sc.LuFactorizationBatchFloat64(A)
+
+    def test_rejects_singular_with_index(self):
+        # The error names the first singular matrix of the stack.
+        A_np = self._make_stack(5, 3, np.float64)
+        A_np[3, 1, :] = 0.0
+        with self.assertRaisesRegex(
+                RuntimeError, r"singular or near-singular matrix at index 3"):
+            sc.LuFactorizationBatchFloat64(sc.SimpleArrayFloat64(array=A_np))
+
+
 class TestLuErrorHandling(unittest.TestCase):
     """Verify LU routines reject invalid inputs with clear errors."""
 
@@ -939,4 +939,47 @@ class MatmulComplex128TC(MatmulTestBase, unittest.TestCase):
         self.dtype = np.complex128
         self.SimpleArray = sc.SimpleArrayComplex128
 
+
+class MatmulNativeTC(unittest.TestCase):
+    """Integer and large products through the native blocked GEMM."""
+
+    def setUp(self):
+        self.saved_nthread = sc.matmul_nthread()
+
+    def tearDown(self):
+        sc.set_matmul_nthread(self.saved_nthread)
+
+    @staticmethod
+    def make(dtype, shape, seed):
+        rng = np.random.default_rng(seed)
+        return rng.integers(-4, 5, size=shape).astype(dtype)
+
+    def check(self, array_type, lhs_data, rhs_data):
+        result = array_type(array=lhs_data).matmul_planned(
+            array_type(array=rhs_data))
+        np.testing.assert_array_equal(
+            result.ndarray, np.matmul(lhs_data, rhs_data))
+
+    def test_integer(self):
+        for dtype, array_type in (("int32", sc.SimpleArrayInt32),
+                                   ("int64", sc.SimpleArrayInt64)):
+            for m, k, n in ((8, 8, 8), (37, 41, 29), (70, 300, 9)):
+                lhs = self.make(dtype, (m, k), 1)
+                rhs = self.make(dtype, (k, n), 2)
+                with self.subTest(dtype=dtype, shape=(m, k, n)):
+                    self.check(array_type, lhs, rhs)
+                    self.check(array_type, lhs, np.asfortranarray(rhs))
+
+    def test_threads(self):
+        lhs = self.make("float64", (130, 70), 3)
+        rhs = self.make("float64", (70, 600), 4)
+        batch_lhs = self.make("int64", (40, 12, 10), 5)
+        batch_rhs = self.make("int64", (40, 10, 14), 6)
+        for nthread in (1, 3):
+            sc.set_matmul_nthread(nthread)
+            self.assertEqual(nthread, sc.matmul_nthread())
+            with self.subTest(nthread=nthread):
+                self.check(sc.SimpleArrayFloat64, lhs, rhs)
+                self.check(sc.SimpleArrayInt64, batch_lhs, batch_rhs)
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
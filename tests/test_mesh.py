@@ -315,4 +315,145 @@ class StaticMeshBcTC(unittest.TestCase):
             mh.bc(0)
         with self.assertRaises(KeyError):
             mh.bc('absent')
+
+
+class StaticMeshReorderTC(unittest.TestCase):
+    """Renumber a structured quadrilateral grid whose cells are shuffled."""
+
+    NX = 12
+    NY = 9
+
+    def _make_mesh(self):
+        nx, ny = self.NX, self.NY
+        mh = solvcon.StaticMesh(ndim=2, nnode=(nx + 1) * (ny + 1), nface=0,
+                                ncell=nx * ny)
+        mh.ndcrd.ndarray[:, :] = [(i, j) for j in range(ny + 1)
+                                  for i in range(nx + 1)]
+        mh.cltpn.ndarray[:] = solvcon.StaticMesh.QUADRILATERAL
+        clnds = [(4, j * (nx + 1) + i, j * (nx + 1) + i + 1,
+                  (j + 1) * (nx + 1) + i + 1, (j + 1) * (nx + 1) + i)
+                 for j in range(ny) for i in range(nx)]
+        rng = np.random.default_rng(7)
+        mh.clnds.ndarray[:, :5] = np.array(clnds)[rng.permutation(nx * ny)]
+        mh.build_interior()
+        mh.build_boundary()
+        mh.build_ghost()
+        return mh
+
+    @staticmethod
+    def _bandwidth(mh):
+        fccls = mh.fccls.ndarray[mh.ngstface:, :2]
+        inner = fccls[fccls[:, 1] >= 0]
+        return np.abs(inner[:, 0] - inner[:, 1]).max()
+
+    def _check(self, ordering):
+        mh = self._make_mesh()
+        old = {name: getattr(mh, name).ndarray.copy()
+               for name in ("ndcrd", "clnds", "clfcs", "fcnds", "fccls",
+                            "clcnd", "clvol", "fcnml", "bndfcs")}
+        perm = mh.reorder(ordering)
+        node = perm["node"].ndarray
+        face = perm["face"].ndarray
+        cell = perm["cell"].ndarray
+        for arr, n in ((node, mh.nnode), (face, mh.nface), (cell, mh.ncell)):
+            self.assertEqual(list(range(n)), sorted(arr))
+
+        gn, gf, gc = mh.ngstnode, mh.ngstface, mh.ngstcell
+        np.testing.assert_array_equal(
+            old["ndcrd"][gn:][node], mh.ndcrd.ndarray[gn:])
+        np.testing.assert_array_equal(
+            old["clcnd"][gc:][cell], mh.clcnd.ndarray[gc:])
+        np.testing.assert_array_equal(
+            old["clvol"][gc:][cell], mh.clvol.ndarray[gc:])
+        np.testing.assert_array_equal(
+            old["fcnml"][gf:][face], mh.fcnml.ndarray[gf:])
+        # The ghost rows keep their geometry.
+        np.testing.assert_array_equal(
+            old["clcnd"][:gc], mh.clcnd.ndarray[:gc])
+
+        def mapped(arr, perm_arr):
+            out = arr.copy()
+            out[arr >= 0] = perm_arr[arr[arr >= 0]]
+            return out
+
+        # Mapping the new indices back reproduces the old tables.
+        clnds = mh.clnds.ndarray[gc:]
+        for icl in range(mh.ncell):
+            nnd = clnds[icl, 0]
+            self.assertEqual(
+                list(old["clnds"][gc + cell[icl], 1:nnd + 1]),
+                list(node[clnds[icl, 1:nnd + 1]]))
+            nfc = mh.clfcs.ndarray[gc + icl, 0]
+            self.assertEqual(
+                list(old["clfcs"][gc + cell[icl], 1:nfc + 1]),
+                list(face[mh.clfcs.ndarray[gc + icl, 1:nfc + 1]]))
+        np.testing.assert_array_equal(
+            old["fccls"][gf:, :2][face],
+            mapped(mh.fccls.ndarray[gf:, :2], cell))
+        np.testing.assert_array_equal(
+            old["bndfcs"][:, 0], face[mh.bndfcs.ndarray[:, 0]])
+        # The catch-all boundary-condition group follows bndfcs.
+        np.testing.assert_array_equal(
+            mh.bndfcs.ndarray[:, 0], mh.bc(0).facn.ndarray[:, 0])
+        return mh
+
+    def test_rcm(self):
+        before = self._bandwidth(self._make_mesh())
+        mh = self._check("rcm")
+        # RCM bounds the bandwidth by about two BFS levels of the grid.
+        self.assertLess(self._bandwidth(mh), before)
+        self.assertLessEqual(self._bandwidth(mh), 2 * (self.NY + 1))
+
+    def test_hilbert(self):
+        before = self._bandwidth(self._make_mesh())
+        mh = self._check("hilbert")
+        self.assertLess(self._bandwidth(mh), before)
+
+    def test_morton(self):
+        self._check("morton")
+
+    def test_errors(self):
+        mh = self._make_mesh()
+        with self.assertRaisesRegex(ValueError, "not supported"):
+            mh.reorder("random")
+        mh = solvcon.StaticMesh(ndim=2, nnode=4, nface=0, ncell=1)
+        with self.assertRaisesRegex(RuntimeError, "interior is not built"):
+            mh.reorder("rcm")
+
+
+class StaticMeshThreadTC(unittest.TestCase):
+
+    def _build(self, nthread):
+        nx, ny = 10, 7
+        mh = solvcon.StaticMesh(ndim=2, nnode=(nx + 1) * (ny + 1), nface=0,
+                                ncell=nx * ny)
+        mh.nthread = nthread
+        mh.ndcrd.ndarray[:, :] = [(i, j) for j in range(ny + 1)
+                                  for i in range(nx + 1)]
+        mh.cltpn.ndarray[:] = solvcon.StaticMesh.QUADRILATERAL
+        clnds = [(4, j * (nx + 1) + i, j * (nx + 1) + i + 1,
+                  (j + 1) * (nx + 1) + i + 1, (j + 1) * (nx + 1) + i)
+                 for j in range(ny) for i in range(nx)]
+        rng = np.random.default_rng(3)
+        mh.clnds.ndarray[:, :5] = np.array(clnds)[rng.permutation(nx * ny)]
+        mh.build_interior()
+        return mh
+
+    def test_nthread(self):
+        mh = solvcon.StaticMesh(ndim=2, nnode=4, nface=0, ncell=1)
+        self.assertEqual(1, mh.nthread)
+        mh.nthread = 3
+        self.assertEqual(3, mh.nthread)
+
+    def test_same_connectivity(self):
+        serial = self._build(1)
+        for nthread in (2, 5):
+            mh = self._build(nthread)
+            self.assertEqual(serial.nface, mh.nface)
+            self.assertEqual(serial.nedge, mh.nedge)
+            for name in ("fctpn", "fcnds", "fccls", "clfcs", "ednds"):
+                np.testing.assert_array_equal(
+                    getattr(serial, name).ndarray,
+                    getattr(mh, name).ndarray)
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
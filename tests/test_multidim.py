@@ -1083,5 +1083,30 @@ class EulerChannelMarchTC(unittest.TestCase):
         for ifc in left:
             assert_almost_equal(ec.so0n[mh.fccls[ifc, 1], 0], self.RHO)
 
+    def test_march_channel_nthread(self):
+        lx, ly = 4.0, 2.0
+        mh = _build_quad_channel(8, 4, lx, ly)
+        left, right, walls = self._classify(mh, lx)
+
+        def run(nthread):
+            ec = solvcon.EulerCore(mesh=mh, time_increment=0.04)
+            ec.nthread = nthread
+            self.assertEqual(nthread, ec.nthread)
+            ec.init_solution(gamma=self.GAMMA, rho=self.RHO,
+                             v=[self.VX, 0.5], p=self.PRES)
+            ec.add_inlet(left, value=[self.RHO, self.VX, 0.0, self.PRES,
+                                      self.GAMMA])
+            ec.add_nonrefl(right)
+            ec.add_slipwall(walls)
+            ec.bc_soln()
+            ec.bc_dsoln()
+            ec.march(steps=3)
+            return ec.so0n.ndarray.copy()
+
+        # Cells are partitioned across threads without a cross-thread
+        # reduction, so the result does not depend on the thread count.
+        serial = run(1)
+        np.testing.assert_array_equal(serial, run(3))
+
 
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
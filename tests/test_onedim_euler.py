@@ -70,6 +70,62 @@ class Euler1DSolverTC(unittest.TestCase):
             svr2.march_alpha2(steps=1)
             self.assertEqual(self.svr.so0.tolist(), svr2.so0.tolist())
 
+    def test_march_blocked(self):
+        svr1 = self._build_solver(64)[-1]
+        svr2 = self._build_solver(64)[-1]
+        for svr in (svr1, svr2):
+            svr.so0[:, 0] = 1.0 + 0.1 * np.sin(svr.coord)
+            svr.so0[:, 2] = 0.5
+            svr.setup_march()
+
+        svr1.march_alpha2(steps=20)
+        svr2.march_alpha2_blocked(steps=20, tile_size=9, tile_steps=3)
+        self.assertEqual(svr1.so0.tolist(), svr2.so0.tolist())
+        self.assertEqual(svr1.so1.tolist(), svr2.so1.tolist())
+        self.assertEqual(svr1.cfl.tolist(), svr2.cfl.tolist())
+
+
+class Euler1DBatchTC(unittest.TestCase):
+
+    nbatch = 5
+
+    @staticmethod
+    def _build_core(ib):
+        svr = euler1d.Euler1DSolver(xmin=0.0, xmax=2 * np.pi, ncoord=65,
+                                    time_increment=0.05)
+        svr.gamma.fill(1.4 - 0.02 * ib)
+        svr.so0[:, 0] = 1.0 + 0.1 * (ib + 1) * np.sin(svr.coord)
+        svr.so0[:, 2] = 0.5
+        svr.setup_march()
+        return svr._core
+
+    def setUp(self):
+        self.cores = [self._build_core(ib) for ib in range(self.nbatch)]
+        self.batch = euler1d._impl.Euler1DBatch(
+            ncoord=65, nbatch=self.nbatch, time_increment=0.05)
+        self.batch.coord[...] = self.cores[0].coord
+        for ib, core in enumerate(self.cores):
+            self.batch.set_member(ib, core)
+
+    def test_shape(self):
+        self.assertEqual(65, self.batch.ncoord)
+        self.assertEqual(self.nbatch, self.batch.nbatch)
+        self.assertEqual((65, 3, self.nbatch), self.batch.so0.shape)
+        self.assertEqual((65, 3, self.nbatch), self.batch.so1.shape)
+        self.assertEqual((65, self.nbatch), self.batch.gamma.shape)
+        self.assertEqual((65, self.nbatch), self.batch.pressure.shape)
+        np.testing.assert_equal(self.cores[2].so0, self.batch.so0[:, :, 2])
+
+    def test_march(self):
+        self.batch.march_alpha2(steps=30)
+        for ib, core in enumerate(self.cores):
+            core.march_alpha2(steps=30)
+            member = self.batch.get_member(ib)
+            self.assertEqual(core.so0.tolist(), member.so0.tolist())
+            self.assertEqual(core.so1.tolist(), member.so1.tolist())
+            self.assertEqual(core.pressure.tolist(),
+                             self.batch.pressure[:, ib].tolist())
+
 
 class ShockTubeTC(unittest.TestCase):
 
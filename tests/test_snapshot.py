@@ -0,0 +1,77 @@
+# Copyright (c) 2026, solvcon team <contact@solvcon.net>
+# BSD 3-Clause License, see COPYING
+
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+import solvcon
+
+
+class SnapshotTC(unittest.TestCase):
+    TESTDIR = os.path.abspath(os.path.dirname(__file__))
+    DATADIR = os.path.join(TESTDIR, "data")
+
+    ARRAYS = ["ndcrd", "fccnd", "fcnml", "fcara", "clcnd", "clvol",
+              "fctpn", "cltpn", "clgrp", "fcnds", "fccls", "clnds",
+              "clfcs", "ednds", "bndfcs"]
+
+    def setUp(self):
+        with open(os.path.join(self.DATADIR, "rectangle.msh"), "rb") as fobj:
+            self.mesh = solvcon.Gmsh(fobj.read()).to_block()
+        fd, self.path = tempfile.mkstemp(suffix=".snap")
+        os.close(fd)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def test_mesh(self):
+        out = solvcon.Snapshot()
+        out.add_mesh(self.mesh)
+        out.save(self.path)
+
+        for mapped in (True, False):
+            snap = solvcon.Snapshot.load(self.path, mapped=mapped)
+            self.assertEqual(out.names, snap.names)
+            self.assertIn("mesh/ndcrd", snap)
+            mh = snap.to_mesh()
+            for name in ("ndim", "nnode", "nface", "ncell", "nbound",
+                         "ngstnode", "ngstface", "ngstcell", "nbcs"):
+                self.assertEqual(getattr(self.mesh, name), getattr(mh, name))
+            for name in self.ARRAYS:
+                np.testing.assert_array_equal(
+                    getattr(self.mesh, name).ndarray,
+                    getattr(mh, name).ndarray, err_msg=name)
+
+    def test_euler_restart(self):
+        mh = self.mesh
+        ec = solvcon.EulerCore(mesh=mh, time_increment=1.e-4)
+        ec.init_solution(gamma=1.4, rho=1.0, v=[0.3, 0.1], p=1.0)
+        ec.add_nonrefl([int(f) for f in mh.bndfcs.ndarray[:, 0]])
+        ec.bc_soln()
+        ec.bc_dsoln()
+        ec.march(steps=2)
+
+        out = solvcon.Snapshot()
+        out.add_mesh(mh)
+        out.add_euler(ec)
+        out.save(self.path)
+
+        snap = solvcon.Snapshot.load(self.path)
+        restarted = snap.to_euler(snap.to_mesh())
+        ec.march(steps=2)
+        restarted.march(steps=2)
+        np.testing.assert_array_equal(ec.so0n.ndarray,
+                                      restarted.so0n.ndarray)
+
+    def test_errors(self):
+        with open(self.path, "wb") as fobj:
+            fobj.write(b"not a snapshot")
+        with self.assertRaisesRegex(RuntimeError, "is not a snapshot"):
+            solvcon.Snapshot.load(self.path)
+        with self.assertRaisesRegex(IndexError, "'mesh/counts' not found"):
+            solvcon.Snapshot().to_mesh()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
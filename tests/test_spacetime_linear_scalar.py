@@ -135,6 +135,26 @@ class LinearScalarSolverTC(unittest.TestCase):
             self.assertEqual(self.svr.get_so0(0).ndarray.tolist(),
                              svr2.get_so0(0).ndarray.tolist())
 
+    def test_march_paths(self):
+
+        self.assertTrue(self.svr.soa_march)
+        self.assertEqual(1, self.svr.nthread)
+        svr2 = self._build_solver(self.resolution)[-1]
+        svr2.soa_march = False
+        svr2.nthread = 2
+        self.assertFalse(svr2.soa_march)
+        self.assertEqual(2, svr2.nthread)
+
+        self.svr.march_alpha2(self.nstep)
+        svr2.march_alpha2(self.nstep)
+        for odd_plane in (False, True):
+            self.assertEqual(
+                self.svr.get_so0(0, odd_plane=odd_plane).ndarray.tolist(),
+                svr2.get_so0(0, odd_plane=odd_plane).ndarray.tolist())
+            self.assertEqual(
+                self.svr.get_so1(0, odd_plane=odd_plane).ndarray.tolist(),
+                svr2.get_so1(0, odd_plane=odd_plane).ndarray.tolist())
+
 
 class LinearScalarGridTestTC(unittest.TestCase):
     """
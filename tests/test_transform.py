@@ -130,4 +130,84 @@ class TransformFp64TC(FourierTransformTB, unittest.TestCase):
         self.complex = sc.complex128
         self.SimpleArray = sc.SimpleArrayComplex128
 
+
+class FourierPlanTC(unittest.TestCase):
+
+    def setUp(self):
+        self.rng = np.random.default_rng(1)
+
+    def complex_array(self, shape):
+        data = (self.rng.uniform(-1.0, 1.0, shape)
+                + 1j * self.rng.uniform(-1.0, 1.0, shape))
+        return sc.SimpleArrayComplex128(array=data)
+
+    def test_fft_lengths(self):
+        for n in (1, 2, 8, 64, 12, 45, 100, 343, 1000, 127, 1009):
+            with self.subTest(n=n):
+                sin = self.complex_array((3, n))
+                sout = sc.SimpleArrayComplex128((3, n))
+                sback = sc.SimpleArrayComplex128((3, n))
+                plan = sc.FourierPlanFloat64(n)
+                self.assertEqual((n,), plan.shape)
+                plan.fft(sin, sout)
+                np.testing.assert_allclose(
+                    np.fft.fft(sin.ndarray), sout.ndarray, atol=1.e-10)
+                plan.ifft(sout, sback)
+                np.testing.assert_allclose(
+                    sin.ndarray, sback.ndarray, atol=1.e-12)
+
+    def test_fft_axis(self):
+        sin = self.complex_array((16, 5))
+        sout = sc.SimpleArrayComplex128((16, 5))
+        sc.FourierPlanFloat64(16).fft(sin, sout, axis=0)
+        np.testing.assert_allclose(
+            np.fft.fft(sin.ndarray, axis=0), sout.ndarray, atol=1.e-10)
+        with self.assertRaisesRegex(ValueError, "does not match"):
+            sc.FourierPlanFloat64(16).fft(sin, sout, axis=1)
+
+    def test_rfft(self):
+        for n in (16, 15, 6):
+            with self.subTest(n=n):
+                data = self.rng.uniform(-1.0, 1.0, (4, n))
+                sin = sc.SimpleArrayFloat64(array=data)
+                shalf = sc.SimpleArrayComplex128((4, n // 2 + 1))
+                sback = sc.SimpleArrayFloat64((4, n))
+                plan = sc.FourierPlanFloat64(n)
+                plan.rfft(sin, shalf)
+                np.testing.assert_allclose(
+                    np.fft.rfft(data), shalf.ndarray, atol=1.e-10)
+                plan.irfft(shalf, sback)
+                np.testing.assert_allclose(data, sback.ndarray, atol=1.e-12)
+
+    def test_multidimensional(self):
+        sin = self.complex_array((3, 6, 8))
+        sout = sc.SimpleArrayComplex128((3, 6, 8))
+        plan = sc.FourierPlanFloat64((6, 8))
+        self.assertEqual(2, plan.rank)
+        plan.fft(sin, sout)
+        np.testing.assert_allclose(
+            np.fft.fft2(sin.ndarray), sout.ndarray, atol=1.e-10)
+
+        sout = sc.SimpleArrayComplex128((3, 6, 8))
+        sc.FourierPlanFloat64((3, 6, 8)).ifft(sin, sout)
+        np.testing.assert_allclose(
+            np.fft.ifftn(sin.ndarray), sout.ndarray, atol=1.e-12)
+
+        data = self.rng.uniform(-1.0, 1.0, (6, 8))
+        shalf = sc.SimpleArrayComplex128((6, 5))
+        sback = sc.SimpleArrayFloat64((6, 8))
+        plan.rfft(sc.SimpleArrayFloat64(array=data), shalf)
+        np.testing.assert_allclose(
+            np.fft.rfft2(data), shalf.ndarray, atol=1.e-10)
+        plan.irfft(shalf, sback)
+        np.testing.assert_allclose(data, sback.ndarray, atol=1.e-12)
+
+    def test_float32(self):
+        data = self.rng.uniform(-1.0, 1.0, 100).astype('float32')
+        shalf = sc.SimpleArrayComplex64(51)
+        sc.FourierPlanFloat32(100).rfft(
+            sc.SimpleArrayFloat32(array=data), shalf)
+        np.testing.assert_allclose(
+            np.fft.rfft(data), shalf.ndarray, atol=1.e-4)
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
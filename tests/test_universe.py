@@ -622,6 +622,15 @@ class WorldPickTC(unittest.TestCase):
     def test_pick_empty_world_returns_minus_one(self):
         self.assertEqual(self.w.pick_shape(0, 0, 1.0), -1)
 
+    def test_nearest_shape(self):
+        left = self.w.add_line(0, 0, 0, 4)
+        right = self.w.add_line(3, 0, 3, 4)
+        self.assertEqual(self.w.nearest_shape(1, 2, 10.0), left)
+        self.assertEqual(self.w.nearest_shape(2, 2, 10.0), right)
+        self.assertEqual(self.w.nearest_shape(5, 2, 1.0), -1)
+        self.w.remove_shape(right)
+        self.assertEqual(self.w.nearest_shape(2, 2, 10.0), left)
+
 
 class WorldShapeAccessorTC(unittest.TestCase):
     """shape_is_live, shape_bbox, shape_handle, shape_obb: go-through that
@@ -1062,6 +1071,25 @@ class WorldDescribeDiagnosticsTC(unittest.TestCase):
         points = sorted(hit["point"] for hit in hits)
         self.assertEqual(points, [[0, 1], [3, 1]])
 
+    def test_line_through_circle(self):
+        # A segment crossing a drawn curve; the segment's shape comes first.
+        cir = self.w.add_circle(0, 0, 1)
+        line = self.w.add_line(-2, 0.5, 2, 0.5)
+        hits = self.diag()["intersections"]
+        self.assertEqual(len(hits), 2)
+        for hit in hits:
+            self.assertEqual(hit["shapes"], [line, cir])
+            self.assertAlmostEqual(hit["point"][1], 0.5)
+        xs = sorted(hit["point"][0] for hit in hits)
+        self.assertAlmostEqual(xs[0], -(0.75 ** 0.5), places=3)
+        self.assertAlmostEqual(xs[1], 0.75 ** 0.5, places=3)
+
+    def test_chord_ending_on_circle_not_reported(self):
+        # A diameter meets the circle only at the end points of its arcs.
+        self.w.add_circle(0, 0, 1)
+        self.w.add_line(-1, 0, 1, 0)
+        self.assertEqual(self.diag()["intersections"], [])
+
     def test_bare_segments_crossing(self):
         p = solvcon.Point3dFp64
         self.w.add_segment(p(0, 0), p(2, 2))
@@ -1089,6 +1117,33 @@ class WorldDescribeDiagnosticsTC(unittest.TestCase):
         self.w.redo()
         self.assertEqual(len(self.diag()["intersections"]), 1)
 
+    def test_diagnostics_follow_edits(self):
+        # The diagnostics are updated incrementally; moving a shape away and
+        # back, and rotating it, must be reflected in each call.
+        self.w.add_line(0, 0, 2, 2)
+        b = self.w.add_line(0, 2, 2, 0)
+        self.assertEqual(len(self.diag()["intersections"]), 1)
+        self.w.translate_shape(b, 10, 0)
+        self.assertEqual(self.diag()["intersections"], [])
+        self.w.translate_shape(b, -10, 0)
+        self.assertEqual(self.diag()["intersections"][0]["point"], [1, 1])
+        self.w.rotate_shape(b, math.pi / 2, 1, 1)
+        self.assertEqual(self.diag()["intersections"], [])
+        self.w.add_line(1, 1, 1, 1)
+        self.assertEqual(len(self.diag()["degeneracies"]), 1)
+
+    def test_diagnostics_follow_pad_edits(self):
+        # Editing a segment through the pad bypasses the shape operations,
+        # but the diagnostics must still see it.
+        self.w.add_line(0, 0, 2, 2)
+        self.w.add_line(0, 2, 2, 4)
+        self.assertEqual(self.diag()["intersections"], [])
+        self.w.segments.set_at(1, 0.0, 2.0, 2.0, 0.0)
+        self.assertEqual(self.diag()["intersections"][0]["point"], [1, 1])
+        segments = self.w.segments
+        segments.set_at(1, 0.0, 2.0, 2.0, 4.0)
+        self.assertEqual(self.diag()["intersections"], [])
+
     def test_collinear_triangle(self):
         sid = self.w.add_triangle(0, 0, 1, 1, 2, 2)
         self.assert_one_degeneracy(sid, "triangle", "collinear")